@@ -0,0 +1,30 @@
+#!/bin/sh
+
+# Measures the startup dominated wall time of spnm-cli on the bisection example
+# of the README.
+#
+# Usage: ./cli-startup.sh [runs] [spnm-cli]
+
+RUNS=${1:-100}
+CLI=${2:-../cli/bin/spnm-cli}
+
+if [ ! -x "${CLI}" ]; then
+	echo "[ERROR] '${CLI}' not found, run 'make release' in cli/ first." >&2
+	exit 1
+fi
+
+# warm up the page cache
+"${CLI}" 1 1 "e^x -x - 2" 1 2 2 4 > /dev/null || exit 1
+
+start=$(date +%s%N)
+i=0
+while [ ${i} -lt ${RUNS} ]; do
+	"${CLI}" 1 1 "e^x -x - 2" 1 2 2 4 > /dev/null
+	i=$((i + 1))
+done
+end=$(date +%s%N)
+
+total_us=$(((end - start) / 1000))
+echo "runs: ${RUNS}"
+echo "total: $((total_us / 1000)) ms"
+echo "per run: $((total_us / RUNS)) us"
@@ -0,0 +1,1653 @@
+/*
+ ===============================================================================
+ |                         License - GPL-3.0-or-later                          |
+ ===============================================================================
+ *
+ * spnm - C++ Library for Numerical Methods analysis
+ * Copyright (C) 2022  Safal Piya
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Benchmarks of spnm.
+ *
+ * Usage: spnm-bench [benchmark...]
+ *
+ * Runs the given benchmarks or all of them. Each benchmark verifies its
+ * results and the program fails if any of them is wrong.
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sys/resource.h>
+
+/* spnm - https://github.com/mrsafalpiya/spnm */
+#define SPNM_IMPL
+#include "../spnm.hpp"
+
+/* = BENCH = */
+
+/* colors */
+#define RED   "\x1B[31m"
+#define RESET "\x1B[0m"
+
+/* bench */
+size_t bench_failed_c = 0;
+
+double
+elapsed_ms(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(
+		       std::chrono::steady_clock::now() - start)
+	        .count();
+}
+
+/* = CONCURRENCY = */
+
+#define CONCURRENCY_SOLVES 4000 /* solves per measurement */
+
+struct concurrency_case {
+	int             is_secant;
+	const char     *fx;
+	const char     *input1;
+	const char     *input2;
+	spnm::process_t process;
+	size_t          process_n;
+};
+
+const concurrency_case concurrency_cases[] = {
+	{ 0, "x^3 - 3x + 1", "0", "1", spnm::DECIMAL_PLACES, 3 },
+	{ 0, "x^3 - 2 sin(x)", "0.5", "2", spnm::SIGNIFICANT_DIGITS, 5 },
+	{ 0, "x*e^x - 1", "0", "1", spnm::DECIMAL_PLACES, 3 },
+	{ 0, "e^x - x - 2", "1", "2", spnm::SIGNIFICANT_DIGITS, 4 },
+	{ 0, "log(x) - cos(x)", "1", "2", spnm::DECIMAL_PLACES, 3 },
+	{ 1, "x^3 - 3x + 1", "0", "1", spnm::DECIMAL_PLACES, 3 },
+	{ 1, "3x + sin(x) - e^x", "0", "1", spnm::NO_OF_STEPS, 6 },
+	{ 1, "x^3 + x^2 - 3x - 3", "1", "2", spnm::SIGNIFICANT_DIGITS, 5 },
+	{ 1, "x^5 + x^3 + 3", "1", "-1", spnm::DECIMAL_PLACES, 4 },
+};
+const size_t concurrency_cases_c =
+	sizeof(concurrency_cases) / sizeof(*concurrency_cases);
+
+/* Returns the steps of the solve of `c` as text. */
+std::string
+concurrency_solve(const concurrency_case *c)
+{
+	std::string out;
+	char        buffer[1024];
+
+	if (!c->is_secant) {
+		spnm::bisection_t t = spnm::bisection_init(
+			c->fx, c->input1, c->input2, c->process, c->process_n);
+		out += std::to_string(spnm::bisection_perform(&t)) + "\n";
+		for (size_t i = 0; i < t.steps_c; i++) {
+			snprintf(buffer, sizeof(buffer), "%s %s %s\n",
+			         t.steps[i].a_n, t.steps[i].b_n, t.steps[i].c_n);
+			out += buffer;
+		}
+		spnm::bisection_free(&t);
+	} else {
+		spnm::secant_t t = spnm::secant_init(
+			c->fx, c->input1, c->input2, c->process, c->process_n);
+		out += std::to_string(spnm::secant_perform(&t)) + "\n";
+		for (size_t i = 0; i < t.steps_c; i++) {
+			snprintf(buffer, sizeof(buffer), "%s %s\n",
+			         t.steps[i].x_next, t.steps[i].fx_next);
+			out += buffer;
+		}
+		spnm::secant_free(&t);
+	}
+
+	return out;
+}
+
+/*
+ * Runs `CONCURRENCY_SOLVES` solves from the cases concurrently on 1, 2, 4, ...
+ * threads, checking every result against a serial reference and reporting the
+ * throughput and the scaling.
+ */
+void
+bench_concurrency(void)
+{
+	printf("= concurrency =\n");
+
+	/* serial reference */
+	std::vector<std::string> reference;
+	for (size_t i = 0; i < concurrency_cases_c; i++)
+		reference.push_back(concurrency_solve(concurrency_cases + i));
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	double base_ms = 0;
+	for (size_t threads_c = 1;; threads_c *= 2) {
+		if (threads_c > threads_max)
+			threads_c = threads_max;
+
+		std::atomic<size_t>      next(0), wrong(0);
+		std::vector<std::thread> threads;
+
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < threads_c; i++) {
+			threads.emplace_back([&]() {
+				size_t s;
+				while ((s = next++) < CONCURRENCY_SOLVES) {
+					size_t c = s % concurrency_cases_c;
+					if (concurrency_solve(concurrency_cases +
+					                      c) != reference[c])
+						wrong++;
+				}
+			});
+		}
+		for (std::thread &thread : threads)
+			thread.join();
+		double ms = elapsed_ms(start);
+
+		if (threads_c == 1)
+			base_ms = ms;
+		printf("threads: %3lu, solves: %d, %9.3f ms, %10.0f solves/s, "
+		       "speedup: %.2fx\n",
+		       threads_c, CONCURRENCY_SOLVES, ms,
+		       CONCURRENCY_SOLVES / ms * 1000, base_ms / ms);
+
+		if (wrong) {
+			fprintf(stderr,
+			        RED "FAILED concurrency: %lu wrong results on "
+			            "%lu threads\n" RESET,
+			        (size_t)wrong, threads_c);
+			bench_failed_c++;
+		}
+
+		if (threads_c == threads_max)
+			break;
+	}
+}
+
+/* = NEWTON-KRYLOV = */
+
+#define NEWTON_KRYLOV_UNKNOWNS 200000 /* of the bratu problem */
+
+/* Returns the steps of the bratu solve on `threads_c` threads as text. */
+std::string
+newton_krylov_solve(size_t threads_c, double *ms)
+{
+	const char *vars[]    = { "l", "c", "r" };
+	int         offsets[] = { -1, 0, 1 };
+
+	spnm::newton_krylov_t t = spnm::newton_krylov_init(
+		"l - 2c + r + e^c/(n + 1)^2", vars, offsets, 3,
+		NEWTON_KRYLOV_UNKNOWNS, "0", "0", "0", spnm::PRECOND_ILU0,
+		spnm::SIGNIFICANT_DIGITS, 8);
+	t.threads_c = threads_c;
+
+	auto        start = std::chrono::steady_clock::now();
+	std::string out   = std::to_string(spnm::newton_krylov_perform(&t)) +
+	                  "\n";
+	*ms = elapsed_ms(start);
+
+	char buffer[1024];
+	for (size_t i = 0; i < t.steps_c; i++) {
+		snprintf(buffer, sizeof(buffer), "%s %lu %s\n",
+		         t.steps[i].residual_norm, t.steps[i].linear_iterations_c,
+		         t.steps[i].x_norm);
+		out += buffer;
+	}
+	spnm::newton_krylov_free(&t);
+
+	return out;
+}
+
+/*
+ * Solves the bratu problem with `NEWTON_KRYLOV_UNKNOWNS` unknowns on 1, 2, 4,
+ * ... threads, checking the steps against the serial solve and reporting the
+ * scaling.
+ */
+void
+bench_newton_krylov(void)
+{
+	printf("= newton_krylov =\n");
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	double      base_ms;
+	std::string reference = newton_krylov_solve(1, &base_ms);
+	for (size_t threads_c = 1;; threads_c *= 2) {
+		if (threads_c > threads_max)
+			threads_c = threads_max;
+
+		double ms;
+		if (newton_krylov_solve(threads_c, &ms) != reference) {
+			fprintf(stderr,
+			        RED "FAILED newton_krylov: different steps on "
+			            "%lu threads\n" RESET,
+			        threads_c);
+			bench_failed_c++;
+		}
+		printf("threads: %3lu, unknowns: %d, %9.3f ms, speedup: %.2fx\n",
+		       threads_c, NEWTON_KRYLOV_UNKNOWNS, ms, base_ms / ms);
+
+		if (threads_c == threads_max)
+			break;
+	}
+}
+
+/* = SWEEP = */
+
+#define SWEEP_POINTS 20000 /* parameters of the sweep */
+
+/* Returns the points of the sweep of cos(x) = a x as text along with the sum
+ * of their steps. */
+std::string
+sweep_solve(int warm_start, size_t threads_c, double *ms, size_t *steps_c)
+{
+	spnm::sweep_t t =
+		spnm::sweep_init("cos(x) - a*x", "a", "0.5", "4", SWEEP_POINTS,
+	                         spnm::SWEEP_SECANT, "0", "1",
+	                         spnm::SIGNIFICANT_DIGITS, 8);
+	t.warm_start = warm_start;
+	t.threads_c  = threads_c;
+
+	auto        start = std::chrono::steady_clock::now();
+	std::string out   = std::to_string(spnm::sweep_perform(&t)) + "\n";
+	*ms               = elapsed_ms(start);
+
+	*steps_c = 0;
+	for (size_t i = 0; i < t.points_c; i++) {
+		out += std::string(t.points[i].root ? t.points[i].root : "*") +
+		       "\n";
+		*steps_c += t.points[i].steps_c;
+	}
+	spnm::sweep_free(&t);
+
+	return out;
+}
+
+/*
+ * Sweeps `SWEEP_POINTS` parameters cold and warm started, then warm started on
+ * 1, 2, 4, ... threads, checking the roots against the serial sweep.
+ */
+void
+bench_sweep(void)
+{
+	printf("= sweep =\n");
+
+	double cold_ms, base_ms;
+	size_t cold_steps_c, steps_c;
+	sweep_solve(0, 1, &cold_ms, &cold_steps_c);
+	std::string reference = sweep_solve(1, 1, &base_ms, &steps_c);
+	printf("cold: %9.3f ms, %lu steps, warm: %9.3f ms, %lu steps\n",
+	       cold_ms, cold_steps_c, base_ms, steps_c);
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	for (size_t threads_c = 1;; threads_c *= 2) {
+		if (threads_c > threads_max)
+			threads_c = threads_max;
+
+		double ms;
+		if (sweep_solve(1, threads_c, &ms, &steps_c) != reference) {
+			fprintf(stderr,
+			        RED "FAILED sweep: different roots on %lu "
+			            "threads\n" RESET,
+			        threads_c);
+			bench_failed_c++;
+		}
+		printf("threads: %3lu, points: %d, %9.3f ms, speedup: %.2fx\n",
+		       threads_c, SWEEP_POINTS, ms, base_ms / ms);
+
+		if (threads_c == threads_max)
+			break;
+	}
+}
+
+/* = ISOLATE = */
+
+/* Returns the enclosures of the roots of sin(200x) + 0.3 over [0, 100] found
+ * on `threads_c` threads as text. */
+std::string
+isolate_solve(size_t threads_c, double *ms, size_t *enclosures_c)
+{
+	spnm::isolate_t t = spnm::isolate_init("sin(200x) + 0.3", "0", "100",
+	                                       "0.000001",
+	                                       spnm::DECIMAL_PLACES, 6);
+	t.threads_c = threads_c;
+
+	auto        start = std::chrono::steady_clock::now();
+	std::string out   = std::to_string(spnm::isolate_perform(&t)) + "\n";
+	*ms               = elapsed_ms(start);
+
+	for (size_t i = 0; i < t.enclosures_c; i++)
+		out += std::string(t.enclosures[i].lower) + " " +
+		       t.enclosures[i].upper + "\n";
+	*enclosures_c = t.enclosures_c;
+	spnm::isolate_free(&t);
+
+	return out;
+}
+
+/*
+ * Isolates the thousands of roots of a fast oscillating function on 1, 2, 4,
+ * ... threads, checking the enclosures against the serial run.
+ */
+void
+bench_isolate(void)
+{
+	printf("= isolate =\n");
+
+	double      base_ms;
+	size_t      enclosures_c;
+	std::string reference = isolate_solve(1, &base_ms, &enclosures_c);
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	for (size_t threads_c = 1;; threads_c *= 2) {
+		if (threads_c > threads_max)
+			threads_c = threads_max;
+
+		double ms;
+		if (isolate_solve(threads_c, &ms, &enclosures_c) != reference) {
+			fprintf(stderr,
+			        RED "FAILED isolate: different enclosures on "
+			            "%lu threads\n" RESET,
+			        threads_c);
+			bench_failed_c++;
+		}
+		printf("threads: %3lu, roots: %lu, %9.3f ms, speedup: %.2fx\n",
+		       threads_c, enclosures_c, ms, base_ms / ms);
+
+		if (threads_c == threads_max)
+			break;
+	}
+}
+
+/* = POLYNOMIAL ROOTS = */
+
+/* chebyshev polynomial T_32, the 32 roots of which crowd towards -1 and 1 */
+#define POLYNOMIAL_ROOTS_FX                                                    \
+	"2147483648*x^32 - 17179869184*x^30 + 62277025792*x^28 - "             \
+	"135291469824*x^26 + 196293427200*x^24 - 200655503360*x^22 + "         \
+	"148562247680*x^20 - 80648077312*x^18 + 32133218304*x^16 - "           \
+	"9313976320*x^14 + 1926299648*x^12 - 275185664*x^10 + 25798656*x^8 - " \
+	"1462272*x^6 + 43520*x^4 - 512*x^2 + 1"
+
+/* Returns the enclosures of the roots of T_32 found on `threads_c` threads
+ * as text. */
+std::string
+polynomial_roots_solve(size_t threads_c, double *ms, size_t *enclosures_c)
+{
+	spnm::polynomial_roots_t t = spnm::polynomial_roots_init(
+		POLYNOMIAL_ROOTS_FX, spnm::DECIMAL_PLACES, 12);
+	t.threads_c = threads_c;
+
+	auto        start = std::chrono::steady_clock::now();
+	std::string out = std::to_string(spnm::polynomial_roots_perform(&t)) +
+	                  "\n";
+	*ms             = elapsed_ms(start);
+
+	for (size_t i = 0; i < t.enclosures_c; i++)
+		out += std::string(t.enclosures[i].lower) + " " +
+		       t.enclosures[i].upper + "\n";
+	*enclosures_c = t.enclosures_c;
+	spnm::polynomial_roots_free(&t);
+
+	return out;
+}
+
+/*
+ * Isolates and bisects the roots of a polynomial of degree 32 by its sturm
+ * sequence on 1, 2, 4, ... threads, checking the enclosures against the
+ * serial run.
+ */
+void
+bench_polynomial_roots(void)
+{
+	printf("= polynomial_roots =\n");
+
+	double      base_ms;
+	size_t      enclosures_c;
+	std::string reference =
+		polynomial_roots_solve(1, &base_ms, &enclosures_c);
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	for (size_t threads_c = 1;; threads_c *= 2) {
+		if (threads_c > threads_max)
+			threads_c = threads_max;
+
+		double ms;
+		if (polynomial_roots_solve(threads_c, &ms, &enclosures_c) !=
+		    reference) {
+			fprintf(stderr,
+			        RED "FAILED polynomial_roots: different "
+			            "enclosures on %lu threads\n" RESET,
+			        threads_c);
+			bench_failed_c++;
+		}
+		printf("threads: %3lu, roots: %lu, %9.3f ms, speedup: %.2fx\n",
+		       threads_c, enclosures_c, ms, base_ms / ms);
+
+		if (threads_c == threads_max)
+			break;
+	}
+}
+
+/* = INTEGRATION = */
+
+#define INTEGRATION_NODES   (1 << 22) /* nodes per evaluation measurement */
+#define INTEGRATION_FX      "e^(-x^2) sin(3x) + sqrt(1 + x^3)"
+
+/* Evaluates f over the nodes in batches of `batch_c`, returning the time. */
+double
+integration_eval(spnm::fx_t *f, const std::vector<double> &x,
+                 std::vector<double> *fx, size_t batch_c)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < x.size(); i += batch_c)
+		spnm_utils::fx_val_batch(f, x.data() + i,
+		                         std::min(batch_c, x.size() - i),
+		                         fx->data() + i);
+	return elapsed_ms(start);
+}
+
+/*
+ * Evaluates the integrand over `INTEGRATION_NODES` nodes one at a time and in
+ * batches, checking that they agree, then times the romberg integration on
+ * 2^20 subintervals.
+ */
+void
+bench_integration(void)
+{
+	printf("= integration =\n");
+
+	std::stringstream log;
+	spnm::fx_t       *f = spnm_utils::fx_parse(INTEGRATION_FX, &log);
+
+	std::vector<double> x(INTEGRATION_NODES), scalar(INTEGRATION_NODES),
+		batched(INTEGRATION_NODES);
+	for (size_t i = 0; i < INTEGRATION_NODES; i++)
+		x[i] = 4.0 * i / INTEGRATION_NODES;
+
+	double scalar_ms  = integration_eval(f, x, &scalar, 1);
+	double batched_ms = integration_eval(f, x, &batched, x.size());
+	if (scalar != batched) {
+		fprintf(stderr,
+		        RED "FAILED integration: batches differ from single "
+		            "evaluations\n" RESET);
+		bench_failed_c++;
+	}
+	printf("nodes: %d, single: %9.3f ms, batched: %9.3f ms, speedup: "
+	       "%.2fx\n",
+	       INTEGRATION_NODES, scalar_ms, batched_ms,
+	       scalar_ms / batched_ms);
+	spnm_utils::fx_free(f);
+
+	spnm::integration_t t = spnm::integration_init(
+		INTEGRATION_FX, "0", "4", spnm::QUAD_ROMBERG, spnm::NO_OF_STEPS,
+		21);
+	auto start = std::chrono::steady_clock::now();
+	if (spnm::integration_perform(&t) != 0) {
+		fprintf(stderr, RED "FAILED integration: romberg\n" RESET);
+		bench_failed_c++;
+	} else {
+		printf("romberg: %lu subintervals, %9.3f ms, integral: %s\n",
+		       t.steps[t.steps_c - 1].intervals_c, elapsed_ms(start),
+		       t.steps[t.steps_c - 1].integral);
+	}
+	spnm::integration_free(&t);
+}
+
+/* = GAUSS-KRONROD = */
+
+/* Returns the rounds of the adaptive integration of |sin(3000x)| over [0, 10]
+ * on `threads_c` threads as text. */
+std::string
+gauss_kronrod_solve(size_t threads_c, double *ms, size_t *evals_c)
+{
+	spnm::gauss_kronrod_t t = spnm::gauss_kronrod_init(
+		"abs(sin(3000x))", "0", "10", "0.000000001", spnm::NO_OF_STEPS,
+		spnm::STEPS_MAX);
+	t.threads_c = threads_c;
+
+	auto        start = std::chrono::steady_clock::now();
+	std::string out =
+		std::to_string(spnm::gauss_kronrod_perform(&t)) + "\n";
+	*ms = elapsed_ms(start);
+
+	for (size_t i = 0; i < t.steps_c; i++)
+		out += std::string(t.steps[i].integral) + " " +
+		       t.steps[i].error + "\n";
+	*evals_c = t.evals_c;
+	spnm::gauss_kronrod_free(&t);
+
+	return out;
+}
+
+/*
+ * Integrates a function with thousands of kinks, needing hundreds of
+ * thousands of subintervals, on 1, 2, 4, ... threads, checking the rounds
+ * against the serial run.
+ */
+void
+bench_gauss_kronrod(void)
+{
+	printf("= gauss_kronrod =\n");
+
+	double      base_ms;
+	size_t      evals_c;
+	std::string reference = gauss_kronrod_solve(1, &base_ms, &evals_c);
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	for (size_t threads_c = 1;; threads_c *= 2) {
+		if (threads_c > threads_max)
+			threads_c = threads_max;
+
+		double ms;
+		if (gauss_kronrod_solve(threads_c, &ms, &evals_c) != reference) {
+			fprintf(stderr,
+			        RED "FAILED gauss_kronrod: different rounds on "
+			            "%lu threads\n" RESET,
+			        threads_c);
+			bench_failed_c++;
+		}
+		printf("threads: %3lu, evaluations: %lu, %9.3f ms, speedup: "
+		       "%.2fx\n",
+		       threads_c, evals_c, ms, base_ms / ms);
+
+		if (threads_c == threads_max)
+			break;
+	}
+}
+
+/* = ODE = */
+
+#define ODE_STEPS 1000000 /* steps of the trajectory */
+
+/* An `on_step` keeping the last y_n in `data`. */
+int
+ode_keep_step(const spnm::ode_s *step, void *data)
+{
+	*(std::string *)data = step->y_n;
+	return 0;
+}
+
+/* Solves y' = -2xy on [0, 3] by `method` in `ODE_STEPS` steps streamed to
+ * `on_step`, returning the time. */
+double
+ode_solve(spnm::ode_method_t method,
+          int (*on_step)(const spnm::ode_s *, void *), void *data,
+          std::string *y_n)
+{
+	char h[64];
+	snprintf(h, sizeof(h), "%.17g", 3.0 / ODE_STEPS);
+
+	spnm::ode_t t = spnm::ode_init("-2x*y", "0", "1", "3", h, "0", method,
+	                               spnm::DECIMAL_PLACES, 6);
+	t.on_step     = on_step;
+	t.data        = data;
+
+	auto start = std::chrono::steady_clock::now();
+	if (spnm::ode_perform(&t) != 0 || t.steps_c != ODE_STEPS) {
+		fprintf(stderr, RED "FAILED ode: the solve failed\n" RESET);
+		bench_failed_c++;
+	}
+	double ms = elapsed_ms(start);
+
+	*y_n = t.step.y_n ? t.step.y_n : "";
+	spnm::ode_free(&t);
+
+	return ms;
+}
+
+/*
+ * Streams a trajectory of a million steps of every fixed step method to a
+ * callback and to a 'std::ostream', checking that both end the same.
+ */
+void
+bench_ode(void)
+{
+	printf("= ode =\n");
+
+	const char *names[] = { "euler", "heun", "rk4" };
+	for (size_t i = 0; i < 3; i++) {
+		std::string       kept, y_n, streamed_y_n;
+		std::stringstream out;
+
+		double callback_ms =
+			ode_solve((spnm::ode_method_t)i, ode_keep_step, &kept,
+		                  &y_n);
+		double stream_ms =
+			ode_solve((spnm::ode_method_t)i, spnm::ode_write_step,
+		                  &out, &streamed_y_n);
+		if (kept != y_n || streamed_y_n != y_n) {
+			fprintf(stderr,
+			        RED "FAILED ode: %s ends differently\n" RESET,
+			        names[i]);
+			bench_failed_c++;
+		}
+		printf("%-5s steps: %d, callback: %9.3f ms, stream: %9.3f ms, "
+		       "%lu bytes, y(3): %s\n",
+		       names[i], ODE_STEPS, callback_ms, stream_ms,
+		       out.str().size(), y_n.c_str());
+	}
+}
+
+/* = ELIMINATION = */
+
+#define ELIMINATION_ROWS 4000 /* equations of the system */
+
+/* Sets `a` and `b` to a system of `ELIMINATION_ROWS` equations with a
+ * dominant entry in every row and column, needing row swaps. */
+void
+elimination_system(std::vector<double> *a, std::vector<double> *b)
+{
+	size_t n = ELIMINATION_ROWS;
+	a->resize(n * n);
+	b->resize(n);
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j < n; j++)
+			(*a)[i * n + j] = 1.0 / (1 + (i * 7 + j * 3) % 11);
+		(*a)[i * n + (i * 7) % n] += n;
+		(*b)[i] = i % 3;
+	}
+}
+
+/* Returns x of the system solved by elimination on `threads_c` threads as
+ * text, checking its residual. */
+std::string
+elimination_solve(size_t threads_c, double *ms)
+{
+	std::vector<double> a, b;
+	elimination_system(&a, &b);
+
+	spnm::elimination_t t = spnm::elimination_init_values(
+		a.data(), b.data(), ELIMINATION_ROWS, spnm::ELIMINATION_LU,
+		spnm::SIGNIFICANT_DIGITS, 12);
+	t.threads_c = threads_c;
+
+	auto        start = std::chrono::steady_clock::now();
+	std::string out = std::to_string(spnm::elimination_perform(&t)) + "\n";
+	*ms = elapsed_ms(start);
+
+	size_t n        = ELIMINATION_ROWS;
+	double residual = 0;
+	for (size_t i = 0; t.x && i < n; i++) {
+		double ax = 0;
+		for (size_t j = 0; j < n; j++)
+			ax += a[i * n + j] * strtod(t.x[j], NULL);
+		residual = std::max(residual, fabs(ax - b[i]));
+		out += std::string(t.x[i]) + "\n";
+	}
+	if (!t.x || residual > 1e-6) {
+		fprintf(stderr, RED "FAILED elimination: residual %g\n" RESET,
+		        residual);
+		bench_failed_c++;
+	}
+	spnm::elimination_free(&t);
+
+	return out;
+}
+
+/*
+ * Solves a dense system of `ELIMINATION_ROWS` equations column by column as
+ * the steps are shown, then by the blocked elimination on 1, 2, 4, ... threads,
+ * checking x against the serial solve.
+ */
+void
+bench_elimination(void)
+{
+	printf("= elimination =\n");
+
+	std::vector<double> a, b;
+	elimination_system(&a, &b);
+	std::vector<size_t> perm(ELIMINATION_ROWS);
+
+	auto start = std::chrono::steady_clock::now();
+	spnm_utils::lu_factor(a.data(), ELIMINATION_ROWS, perm.data());
+	spnm_utils::lu_solve(a.data(), perm.data(), ELIMINATION_ROWS, b.data());
+	double column_ms = elapsed_ms(start);
+	printf("column by column: rows: %d, %9.3f ms\n", ELIMINATION_ROWS,
+	       column_ms);
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	double      base_ms;
+	std::string reference = elimination_solve(1, &base_ms);
+	for (size_t threads_c = 1;; threads_c *= 2) {
+		if (threads_c > threads_max)
+			threads_c = threads_max;
+
+		double ms;
+		if (elimination_solve(threads_c, &ms) != reference) {
+			fprintf(stderr,
+			        RED "FAILED elimination: different x on %lu "
+			            "threads\n" RESET,
+			        threads_c);
+			bench_failed_c++;
+		}
+		printf("threads: %3lu, rows: %d, %9.3f ms, speedup: %.2fx\n",
+		       threads_c, ELIMINATION_ROWS, ms, column_ms / ms);
+
+		if (threads_c == threads_max)
+			break;
+	}
+}
+
+/* = ITERATIVE = */
+
+#define ITERATIVE_GRID  499 /* unknowns on a side, odd for the red-black
+                               ordering to be the checkerboard one */
+#define ITERATIVE_STEPS 10  /* steps of every solve */
+
+/* Returns the last x of `ITERATIVE_STEPS` steps of `method` for the 5 point
+ * poisson problem on the `ITERATIVE_GRID` x `ITERATIVE_GRID` grid on
+ * `threads_c` threads as text. */
+std::string
+iterative_solve(spnm::iterative_method_t method, int red_black,
+                size_t threads_c, double *ms)
+{
+	size_t              m = ITERATIVE_GRID, n = m * m;
+	std::vector<size_t> row_ptr(1, 0), cols;
+	std::vector<double> vals, b(n, 1.0 / ((m + 1) * (m + 1)));
+	for (size_t i = 0; i < n; i++) {
+		size_t r = i / m, c = i % m;
+
+		/* the neighbours and the point in increasing columns */
+		const size_t js[]    = { i - m, i - 1, i, i + 1, i + m };
+		const int    valid[] = { r > 0, c > 0, 1, c + 1 < m,
+			                 r + 1 < m };
+		for (size_t k = 0; k < 5; k++) {
+			if (!valid[k])
+				continue;
+			cols.push_back(js[k]);
+			vals.push_back(k == 2 ? 4 : -1);
+		}
+		row_ptr.push_back(cols.size());
+	}
+
+	spnm::iterative_t t = spnm::iterative_init_csr(
+		row_ptr.data(), cols.data(), vals.data(), b.data(), n, "0",
+		method, "1.9", spnm::NO_OF_STEPS, ITERATIVE_STEPS);
+	t.red_black = red_black;
+	t.threads_c = threads_c;
+
+	auto        start = std::chrono::steady_clock::now();
+	std::string out   = std::to_string(spnm::iterative_perform(&t)) + "\n";
+	*ms               = elapsed_ms(start);
+
+	for (size_t i = 0; t.steps_c == ITERATIVE_STEPS && i < n; i++)
+		out += std::string(t.steps[t.steps_c - 1].x_next[i]) + "\n";
+	spnm::iterative_free(&t);
+
+	return out;
+}
+
+/*
+ * Runs jacobi's method and SOR in the red-black ordering on the poisson
+ * problem of `ITERATIVE_GRID`^2 unknowns on 1, 2, 4, ... threads, checking the
+ * steps against the serial solve.
+ */
+void
+bench_iterative(void)
+{
+	printf("= iterative =\n");
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	const char                    *names[]   = { "jacobi", "sor" };
+	const spnm::iterative_method_t methods[] = { spnm::ITERATIVE_JACOBI,
+		                                     spnm::ITERATIVE_SOR };
+	for (size_t i = 0; i < 2; i++) {
+		double      base_ms;
+		std::string reference =
+			iterative_solve(methods[i], 1, 1, &base_ms);
+		for (size_t threads_c = 1;; threads_c *= 2) {
+			if (threads_c > threads_max)
+				threads_c = threads_max;
+
+			double ms;
+			if (iterative_solve(methods[i], 1, threads_c, &ms) !=
+			    reference) {
+				fprintf(stderr,
+				        RED "FAILED %s: different x on %lu "
+				            "threads\n" RESET,
+				        names[i], threads_c);
+				bench_failed_c++;
+			}
+			printf("%-6s threads: %3lu, unknowns: %d, steps: %d, "
+			       "%9.3f ms, speedup: %.2fx\n",
+			       names[i], threads_c,
+			       ITERATIVE_GRID * ITERATIVE_GRID, ITERATIVE_STEPS,
+			       ms, base_ms / ms);
+
+			if (threads_c == threads_max)
+				break;
+		}
+	}
+}
+
+/* = CONJUGATE GRADIENT = */
+
+#define CONJUGATE_GRADIENT_GRID  1000 /* unknowns on a side */
+#define CONJUGATE_GRADIENT_STEPS 100  /* steps of every solve */
+#define CONJUGATE_GRADIENT_FILE  "spnm-bench-poisson.mtx"
+
+/* Writes the 5 point poisson matrix of the `CONJUGATE_GRADIENT_GRID` x
+ * `CONJUGATE_GRADIENT_GRID` grid to `CONJUGATE_GRADIENT_FILE` in symmetric
+ * matrix market coordinates. Returns the number of entries written. */
+size_t
+conjugate_gradient_write_poisson(void)
+{
+	size_t m = CONJUGATE_GRADIENT_GRID, n = m * m;
+
+	std::ofstream out(CONJUGATE_GRADIENT_FILE);
+	size_t        entries_c = n + 2 * (n - m);
+	out << "%%MatrixMarket matrix coordinate real symmetric\n"
+	    << n << " " << n << " " << entries_c << "\n";
+	for (size_t i = 1; i <= n; i++) {
+		out << i << " " << i << " 4\n";
+		if ((i - 1) % m > 0)
+			out << i << " " << i - 1 << " -1\n";
+		if (i > m)
+			out << i << " " << i - m << " -1\n";
+	}
+
+	return entries_c;
+}
+
+/* Returns the steps of the conjugate gradient preconditioned by `precond` on
+ * `threads_c` threads for the poisson matrix as text, with the time to read
+ * the file in `read_ms`. */
+std::string
+conjugate_gradient_solve(spnm::precond_t precond, size_t threads_c,
+                         double *read_ms, double *ms)
+{
+	std::ostringstream         out;
+	spnm::conjugate_gradient_t t = spnm::conjugate_gradient_init_file(
+		CONJUGATE_GRADIENT_FILE, NULL, "0", precond, spnm::NO_OF_STEPS,
+		CONJUGATE_GRADIENT_STEPS);
+	t.threads_c = threads_c;
+	t.on_step   = spnm::conjugate_gradient_write_step;
+	t.data      = &out;
+
+	auto start = std::chrono::steady_clock::now();
+	int  ret   = spnm::conjugate_gradient_begin(&t);
+	*read_ms   = elapsed_ms(start);
+
+	start = std::chrono::steady_clock::now();
+	while (!ret && !t.done)
+		ret = spnm::conjugate_gradient_step(&t);
+	*ms = elapsed_ms(start);
+
+	if (ret) {
+		fprintf(stderr, RED "FAILED conjugate gradient: %d\n" RESET,
+		        ret);
+		bench_failed_c++;
+	}
+	spnm::conjugate_gradient_free(&t);
+
+	return out.str();
+}
+
+/*
+ * Reads the poisson matrix of `CONJUGATE_GRADIENT_GRID`^2 unknowns from a
+ * matrix market file and takes `CONJUGATE_GRADIENT_STEPS` steps of the
+ * conjugate gradient unpreconditioned and preconditioned by jacobi and by the
+ * incomplete cholesky on 1, 2, 4, ... threads, checking the steps against the
+ * serial solve.
+ */
+void
+bench_conjugate_gradient(void)
+{
+	printf("= conjugate gradient =\n");
+
+	auto   start     = std::chrono::steady_clock::now();
+	size_t entries_c = conjugate_gradient_write_poisson();
+	printf("written: %lu entries, %9.3f ms\n", entries_c,
+	       elapsed_ms(start));
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	const char           *names[]    = { "none", "jacobi", "ic0" };
+	const spnm::precond_t preconds[] = { spnm::PRECOND_NONE,
+		                             spnm::PRECOND_JACOBI,
+		                             spnm::PRECOND_IC0 };
+	for (size_t i = 0; i < 3; i++) {
+		double      read_ms, base_ms;
+		std::string reference = conjugate_gradient_solve(
+			preconds[i], 1, &read_ms, &base_ms);
+
+		/* the last step: n, alpha, beta, ||r|| and ||x|| */
+		size_t last = reference.rfind('\n', reference.size() - 2);
+		printf("%-6s read: %9.3f ms, last step: %s", names[i], read_ms,
+		       reference.c_str() + last + 1);
+
+		for (size_t threads_c = 1;; threads_c *= 2) {
+			if (threads_c > threads_max)
+				threads_c = threads_max;
+
+			double      ms;
+			std::string out = conjugate_gradient_solve(
+				preconds[i], threads_c, &read_ms, &ms);
+			if (out != reference) {
+				fprintf(stderr,
+				        RED "FAILED %s: different steps on %lu "
+				            "threads\n" RESET,
+				        names[i], threads_c);
+				bench_failed_c++;
+			}
+			printf("%-6s threads: %3lu, unknowns: %d, steps: %d, "
+			       "%9.3f ms, speedup: %.2fx\n",
+			       names[i], threads_c,
+			       CONJUGATE_GRADIENT_GRID *
+			               CONJUGATE_GRADIENT_GRID,
+			       CONJUGATE_GRADIENT_STEPS, ms, base_ms / ms);
+
+			if (threads_c == threads_max)
+				break;
+		}
+	}
+
+	remove(CONJUGATE_GRADIENT_FILE);
+}
+
+/* = INTERPOLATION = */
+
+#define INTERPOLATION_POINTS  24        /* chebyshev nodes of sin(x) */
+#define INTERPOLATION_QUERIES (1 << 23) /* points evaluated at */
+
+/* Returns the interpolation of sin(x) on [0, pi] through the first `points_c`
+ * of the nodes `xs`, performed. */
+spnm::interpolation_t
+interpolation_sin(const std::vector<std::string> &xs, size_t points_c)
+{
+	std::string x = "", y = "";
+	for (size_t i = 0; i < points_c; i++) {
+		x += (i ? ";" : "") + xs[i];
+		y += (i ? ";sin(" : "sin(") + xs[i] + ")";
+	}
+
+	spnm::interpolation_t t = spnm::interpolation_init(
+		x.c_str(), y.c_str(), "1", spnm::INTERPOLATION_DIVIDED,
+		spnm::SIGNIFICANT_DIGITS, 12);
+	if (spnm::interpolation_perform(&t) != 0) {
+		fprintf(stderr, RED "FAILED interpolation\n" RESET);
+		bench_failed_c++;
+	}
+	return t;
+}
+
+/*
+ * Interpolates sin(x) by adding `INTERPOLATION_POINTS` nodes one by one to the
+ * table and by building it at once, checking that they agree, then evaluates
+ * the polynomial at `INTERPOLATION_QUERIES` points one after another and by
+ * `spnm::interpolation_eval()` on 1, 2, 4, ... threads, checking the values
+ * against the serial ones.
+ */
+void
+bench_interpolation(void)
+{
+	printf("= interpolation =\n");
+
+	std::vector<std::string> xs(INTERPOLATION_POINTS);
+	for (size_t i = 0; i < INTERPOLATION_POINTS; i++) {
+		char x[spnm::STR_MAX];
+		snprintf(x, sizeof(x), "%.17g",
+		         M_PI / 2 * (1 - cos(M_PI * (i + 0.5) /
+		                             INTERPOLATION_POINTS)));
+		xs[i] = x;
+	}
+
+	auto                  start = std::chrono::steady_clock::now();
+	spnm::interpolation_t t     = interpolation_sin(xs, 2);
+	for (size_t i = 2; i < INTERPOLATION_POINTS; i++)
+		if (spnm::interpolation_add_point(
+			    &t, xs[i].c_str(),
+			    ("sin(" + xs[i] + ")").c_str()) != 0) {
+			fprintf(stderr, RED "FAILED interpolation: adding a "
+			                    "point\n" RESET);
+			bench_failed_c++;
+		}
+	double added_ms = elapsed_ms(start);
+
+	start                          = std::chrono::steady_clock::now();
+	spnm::interpolation_t whole    = interpolation_sin(xs, xs.size());
+	double                whole_ms = elapsed_ms(start);
+	if (!t.value || !whole.value || strcmp(t.value, whole.value)) {
+		fprintf(stderr, RED "FAILED interpolation: added points differ "
+		                    "from the whole table\n" RESET);
+		bench_failed_c++;
+	}
+	printf("points: %d, added one by one: %9.3f ms, at once: %9.3f ms, "
+	       "y(1): %s\n",
+	       INTERPOLATION_POINTS, added_ms, whole_ms, t.value);
+	spnm::interpolation_free(&whole);
+
+	std::vector<double> x(INTERPOLATION_QUERIES), serial(x.size()),
+		y(x.size());
+	for (size_t i = 0; i < x.size(); i++)
+		x[i] = M_PI * i / x.size();
+
+	/* nested multiplication one point at a time */
+	start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < x.size(); i++) {
+		double p = 0;
+		for (size_t k = t.points_c; k-- > 0;)
+			p = p * (x[i] - t.xs[k]) + t.coefs[k];
+		serial[i] = p;
+	}
+	double serial_ms = elapsed_ms(start);
+
+	double error = 0;
+	for (size_t i = 0; i < x.size(); i++)
+		error = std::max(error, fabs(serial[i] - sin(x[i])));
+	printf("one at a time: queries: %d, %9.3f ms, error: %g\n",
+	       INTERPOLATION_QUERIES, serial_ms, error);
+	if (error > 1e-9) {
+		fprintf(stderr, RED "FAILED interpolation: error %g\n" RESET,
+		        error);
+		bench_failed_c++;
+	}
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	for (size_t threads_c = 1;; threads_c *= 2) {
+		if (threads_c > threads_max)
+			threads_c = threads_max;
+
+		t.threads_c = threads_c;
+		start       = std::chrono::steady_clock::now();
+		spnm::interpolation_eval(&t, x.data(), x.size(), y.data());
+		double ms = elapsed_ms(start);
+
+		if (y != serial) {
+			fprintf(stderr,
+			        RED "FAILED interpolation: different values on "
+			            "%lu threads\n" RESET,
+			        threads_c);
+			bench_failed_c++;
+		}
+		printf("threads: %3lu, queries: %d, %9.3f ms, speedup: %.2fx\n",
+		       threads_c, INTERPOLATION_QUERIES, ms, serial_ms / ms);
+
+		if (threads_c == threads_max)
+			break;
+	}
+	spnm::interpolation_free(&t);
+}
+
+/* = SPLINE = */
+
+#define SPLINE_POINTS  1000000  /* knots of the spline */
+#define SPLINE_QUERIES 10000000 /* points evaluated at */
+
+/* Evaluates the spline `t` at `x` into `y` one point at a time by a binary
+ * search over the knots, returning the time. */
+double
+spline_search(const spnm::spline_t *t, const std::vector<double> &x,
+              std::vector<double> *y)
+{
+	const double *xs = t->xs;
+	size_t        n  = t->points_c;
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < x.size(); i++) {
+		size_t s = std::upper_bound(xs, xs + n, x[i]) - xs;
+		s        = std::min(std::max(s, (size_t)1), n - 1) - 1;
+
+		const double *coef = t->coefs + 4 * s;
+		double        dx   = x[i] - xs[s];
+		(*y)[i] = ((coef[3] * dx + coef[2]) * dx + coef[1]) * dx +
+		          coef[0];
+	}
+	return elapsed_ms(start);
+}
+
+/*
+ * Builds the natural spline of sin(x / 1000) through `SPLINE_POINTS` unequally
+ * spaced knots, then evaluates it at `SPLINE_QUERIES` sorted and unsorted
+ * points one at a time by binary search and by `spnm::spline_eval()` on 1, 2,
+ * 4, ... threads, checking the values against the binary search.
+ */
+void
+bench_spline(void)
+{
+	printf("= spline =\n");
+
+	std::vector<double> xs(SPLINE_POINTS), ys(SPLINE_POINTS);
+	for (size_t i = 0; i < SPLINE_POINTS; i++) {
+		xs[i] = i + 0.4 * sin(i * 0.7);
+		ys[i] = sin(xs[i] / 1000);
+	}
+
+	spnm::spline_t t = spnm::spline_init_values(
+		xs.data(), ys.data(), SPLINE_POINTS, "0", spnm::SPLINE_NATURAL,
+		NULL, spnm::SIGNIFICANT_DIGITS, 12);
+	auto start = std::chrono::steady_clock::now();
+	if (spnm::spline_begin(&t) != 0) {
+		fprintf(stderr, RED "FAILED spline\n" RESET);
+		bench_failed_c++;
+		spnm::spline_free(&t);
+		return;
+	}
+	printf("knots: %d, built: %9.3f ms\n", SPLINE_POINTS,
+	       elapsed_ms(start));
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	for (int sorted : { 1, 0 }) {
+		const char *name = sorted ? "sorted" : "unsorted";
+		std::vector<double> x(SPLINE_QUERIES), searched(x.size()),
+			y(x.size());
+		for (size_t i = 0; i < x.size(); i++) {
+			size_t k = sorted ? i : (i * 7919) % x.size();
+			x[i]     = (double)SPLINE_POINTS * k / x.size();
+		}
+
+		double search_ms = spline_search(&t, x, &searched);
+		printf("%s, binary search: queries: %d, %9.3f ms\n",
+		       name, SPLINE_QUERIES, search_ms);
+
+		for (size_t threads_c = 1;; threads_c *= 2) {
+			if (threads_c > threads_max)
+				threads_c = threads_max;
+
+			t.threads_c = threads_c;
+			start       = std::chrono::steady_clock::now();
+			spnm::spline_eval(&t, x.data(), x.size(), y.data());
+			double ms = elapsed_ms(start);
+
+			if (y != searched) {
+				fprintf(stderr,
+				        RED "FAILED spline: different values "
+				            "on %lu threads\n" RESET,
+				        threads_c);
+				bench_failed_c++;
+			}
+			printf("%s, threads: %3lu, queries: %d, %9.3f ms, "
+			       "speedup: %.2fx\n",
+			       name, threads_c, SPLINE_QUERIES, ms,
+			       search_ms / ms);
+
+			if (threads_c == threads_max)
+				break;
+		}
+	}
+	spnm::spline_free(&t);
+}
+
+/* = CURVE FITTING = */
+
+#define FIT_POINTS      10000000 /* points of the files */
+#define FIT_CSV_FILE    "spnm-bench-points.csv"
+#define FIT_BINARY_FILE "spnm-bench-points.bin"
+
+/* Writes `FIT_POINTS` noisy points of y = 3 - 2x + x^2 / 4 to the csv and
+ * binary files. Returns the bytes of the csv file. */
+size_t
+fit_write_points(void)
+{
+	FILE *csv    = fopen(FIT_CSV_FILE, "w");
+	FILE *binary = fopen(FIT_BINARY_FILE, "wb");
+	fprintf(csv, "x,y\n");
+	for (size_t i = 0; i < FIT_POINTS; i++) {
+		double x = 10.0 * i / FIT_POINTS;
+		double y = 3 - 2 * x + x * x / 4 + 0.01 * sin(i * 0.7);
+		fprintf(csv, "%.6f,%.6f\n", x, y);
+
+		double point[2] = { x, y };
+		fwrite(point, sizeof(point), 1, binary);
+	}
+	size_t bytes = ftell(csv);
+	fclose(csv);
+	fclose(binary);
+
+	return bytes;
+}
+
+/* Returns the steps and coefficients of the quadratic fitted to the points of
+ * `file` of `format` on `threads_c` threads as text. */
+std::string
+fit_solve(const char *file, spnm::fit_format_t format, size_t threads_c,
+          double *ms)
+{
+	spnm::fit_t t = spnm::fit_init_file(file, format, spnm::FIT_POLYNOMIAL,
+	                                    2, spnm::SIGNIFICANT_DIGITS, 8);
+	t.threads_c   = threads_c;
+
+	auto start = std::chrono::steady_clock::now();
+	int  ret   = spnm::fit_perform(&t);
+	*ms        = elapsed_ms(start);
+
+	std::string out = "";
+	if (ret) {
+		fprintf(stderr, RED "FAILED fit: %d\n" RESET, ret);
+		bench_failed_c++;
+	} else {
+		for (size_t i = 0; i < t.coefs_c; i++)
+			out += std::string(i ? " " : "") + t.coefs[i];
+	}
+	spnm::fit_free(&t);
+
+	return out;
+}
+
+/*
+ * Writes `FIT_POINTS` points to a csv and a binary file and fits a quadratic
+ * to each by streaming least squares on 1, 2, 4, ... threads, checking the
+ * coefficients against the serial fit, with the peak memory of the process
+ * staying far below the size of the files.
+ */
+void
+bench_fit(void)
+{
+	printf("= fit =\n");
+
+	auto   start = std::chrono::steady_clock::now();
+	size_t bytes = fit_write_points();
+	printf("written: %d points, csv: %lu MB, %9.3f ms\n", FIT_POINTS,
+	       bytes >> 20, elapsed_ms(start));
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	const char              *names[]   = { "csv", "binary" };
+	const char              *files[]   = { FIT_CSV_FILE, FIT_BINARY_FILE };
+	const spnm::fit_format_t formats[] = { spnm::FIT_CSV,
+		                               spnm::FIT_BINARY };
+	for (size_t i = 0; i < 2; i++) {
+		double      base_ms;
+		std::string reference = fit_solve(files[i], formats[i], 1,
+		                                  &base_ms);
+		printf("%-6s coefficients: %s\n", names[i], reference.c_str());
+
+		for (size_t threads_c = 1;; threads_c *= 2) {
+			if (threads_c > threads_max)
+				threads_c = threads_max;
+
+			double      ms;
+			std::string out = fit_solve(files[i], formats[i],
+			                            threads_c, &ms);
+			if (out != reference) {
+				fprintf(stderr,
+				        RED "FAILED %s: different coefficients "
+				            "on %lu threads\n" RESET,
+				        names[i], threads_c);
+				bench_failed_c++;
+			}
+			printf("%-6s threads: %3lu, points: %d, %9.3f ms, "
+			       "%.0f M points/s, speedup: %.2fx\n",
+			       names[i], threads_c, FIT_POINTS, ms,
+			       FIT_POINTS / ms / 1000, base_ms / ms);
+
+			if (threads_c == threads_max)
+				break;
+		}
+	}
+
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	printf("peak memory: %ld MB\n", usage.ru_maxrss >> 10);
+
+	remove(FIT_CSV_FILE);
+	remove(FIT_BINARY_FILE);
+}
+
+/* = EIGENVALUES = */
+
+#define EIGENVALUES_POWER_ROWS 2000 /* rows of the power iterations */
+
+/* Returns the eigenvalues of the `n` x `n` matrix of sin(i) as its i-th entry
+ * by the QR algorithm on `threads_c` threads as text, checking their sum and
+ * the sum of their squares against the traces of A and A^2. */
+std::string
+eigenvalues_qr_solve(size_t n, size_t threads_c, double *ms, size_t *steps_c)
+{
+	std::vector<double> a(n * n);
+	for (size_t i = 0; i < n * n; i++)
+		a[i] = sin((double)i);
+
+	spnm::qr_algorithm_t t = spnm::qr_algorithm_init_values(
+		a.data(), n, spnm::SIGNIFICANT_DIGITS, 12);
+	t.threads_c = threads_c;
+
+	auto        start = std::chrono::steady_clock::now();
+	std::string out   = std::to_string(spnm::qr_algorithm_perform(&t)) +
+	                  "\n";
+	*ms               = elapsed_ms(start);
+	*steps_c          = t.steps_c;
+
+	double trace = 0, trace_sq = 0, sum = 0, sum_sq = 0;
+	for (size_t i = 0; i < n; i++) {
+		trace += a[i * n + i];
+		for (size_t j = 0; j < n; j++)
+			trace_sq += a[i * n + j] * a[j * n + i];
+	}
+	for (size_t i = 0; t.done && i < n; i++) {
+		double re = atof(t.re[i]), im = atof(t.im[i]);
+		sum += re;
+		sum_sq += re * re - im * im;
+		out += std::string(t.re[i]) + " " + t.im[i] + "\n";
+	}
+	if (!t.done || fabs(sum - trace) > 1e-8 * n ||
+	    fabs(sum_sq - trace_sq) > 1e-8 * n * n) {
+		fprintf(stderr,
+		        RED "FAILED qr algorithm: rows: %lu, sum %g of trace "
+		            "%g, sum of squares %g of trace %g\n" RESET,
+		        n, sum, trace, sum_sq, trace_sq);
+		bench_failed_c++;
+	}
+	spnm::qr_algorithm_free(&t);
+
+	return out;
+}
+
+/* Returns the steps of `method` for the dominant eigenvalue n + 1 of
+ * J + I, J being all ones, of `EIGENVALUES_POWER_ROWS` rows on `threads_c`
+ * threads as text, checking the eigenvalue. */
+std::string
+eigenvalues_power_solve(spnm::power_method_t method, size_t threads_c,
+                        double *ms)
+{
+	size_t              n = EIGENVALUES_POWER_ROWS;
+	std::vector<double> a(n * n, 1), x(n, 0);
+	for (size_t i = 0; i < n; i++)
+		a[i * n + i] = 2;
+	x[0] = 1;
+
+	/* shifted next to n + 1 for the inverse iteration */
+	std::string          shift = std::to_string(n);
+	spnm::power_iteration_t t  = spnm::power_iteration_init_values(
+		a.data(), x.data(), n, method,
+		method == spnm::POWER_INVERSE ? shift.c_str() : "0",
+		spnm::SIGNIFICANT_DIGITS, 12);
+	t.threads_c = threads_c;
+
+	auto        start = std::chrono::steady_clock::now();
+	std::string out =
+		std::to_string(spnm::power_iteration_perform(&t)) + "\n";
+	*ms = elapsed_ms(start);
+
+	for (size_t i = 0; i < t.steps_c; i++)
+		out += std::string(t.steps[i].eigenvalue) + "\n";
+	if (t.steps_c == 0 ||
+	    fabs(atof(t.steps[t.steps_c - 1].eigenvalue) - (n + 1)) > 1e-6) {
+		fprintf(stderr,
+		        RED "FAILED power iteration: eigenvalue isn't "
+		            "%lu\n" RESET,
+		        n + 1);
+		bench_failed_c++;
+	}
+	spnm::power_iteration_free(&t);
+
+	return out;
+}
+
+/*
+ * Finds every eigenvalue of matrices of 10 up to 2000 rows by the QR
+ * algorithm, and the dominant one of a matrix of `EIGENVALUES_POWER_ROWS` rows
+ * by the power method and the inverse iteration, on 1, 2, 4, ... threads,
+ * checking the eigenvalues against the serial ones.
+ */
+void
+bench_eigenvalues(void)
+{
+	printf("= eigenvalues =\n");
+
+	size_t threads_max = std::thread::hardware_concurrency();
+	if (threads_max == 0)
+		threads_max = 1;
+
+	const size_t sizes[] = { 10, 100, 500, 1000, 2000 };
+	for (size_t n : sizes) {
+		double      base_ms;
+		size_t      steps_c;
+		std::string reference =
+			eigenvalues_qr_solve(n, 1, &base_ms, &steps_c);
+
+		for (size_t threads_c = 1;; threads_c *= 2) {
+			if (threads_c > threads_max)
+				threads_c = threads_max;
+
+			double ms = base_ms;
+			if (threads_c != 1 &&
+			    eigenvalues_qr_solve(n, threads_c, &ms, &steps_c) !=
+			            reference) {
+				fprintf(stderr,
+				        RED "FAILED qr algorithm: different "
+				            "eigenvalues on %lu "
+				            "threads\n" RESET,
+				        threads_c);
+				bench_failed_c++;
+			}
+			printf("qr      threads: %3lu, rows: %4lu, "
+			       "sweeps: %5lu, %11.3f ms, speedup: %.2fx\n",
+			       threads_c, n, steps_c, ms, base_ms / ms);
+
+			if (threads_c == threads_max)
+				break;
+		}
+	}
+
+	const char                *names[]   = { "power", "inverse" };
+	const spnm::power_method_t methods[] = { spnm::POWER_DIRECT,
+		                                 spnm::POWER_INVERSE };
+	for (size_t i = 0; i < 2; i++) {
+		double      base_ms;
+		std::string reference =
+			eigenvalues_power_solve(methods[i], 1, &base_ms);
+
+		for (size_t threads_c = 1;; threads_c *= 2) {
+			if (threads_c > threads_max)
+				threads_c = threads_max;
+
+			double ms = base_ms;
+			if (threads_c != 1 &&
+			    eigenvalues_power_solve(methods[i], threads_c,
+			                            &ms) != reference) {
+				fprintf(stderr,
+				        RED "FAILED %s: different steps on %lu "
+				            "threads\n" RESET,
+				        names[i], threads_c);
+				bench_failed_c++;
+			}
+			printf("%-7s threads: %3lu, rows: %d, %9.3f ms, "
+			       "speedup: %.2fx\n",
+			       names[i], threads_c, EIGENVALUES_POWER_ROWS, ms,
+			       base_ms / ms);
+
+			if (threads_c == threads_max)
+				break;
+		}
+	}
+}
+
+/* = EXPRESSION OPTIMIZATION = */
+
+#define EXPR_OPTIMIZE_POINTS (1 << 22) /* points per evaluation measurement */
+#define EXPR_OPTIMIZE_FX                                                       \
+	"sin(p^2 + 1) x^4 - cos(p^2 + 1) x^3 + e^(p/2) x^2 + (x^2 + 1)^3 - "   \
+	"sqrt(p) x"
+
+/* Evaluates `e` over the points `x` with p being 1.5, its invariant
+ * instructions once and the others one point at a time if `batched` is 0 and
+ * in batches otherwise, returning the time. */
+double
+expr_optimize_eval(const spnm_utils::expr_t *e, const std::vector<double> &x,
+                   std::vector<double> *fx, int batched)
+{
+	std::vector<double> slots(e->ins.size() * spnm_utils::EXPR_BATCH);
+	double              params[spnm_utils::EXPR_BATCH];
+	for (size_t i = 0; i < spnm_utils::EXPR_BATCH; i++)
+		params[i] = 1.5;
+
+	auto start = std::chrono::steady_clock::now();
+
+	double vars[] = { 0, 1.5 };
+	spnm_utils::expr_eval_invariant(e, vars, slots.data());
+	if (!batched) {
+		for (size_t i = 0; i < x.size(); i++) {
+			vars[0] = x[i];
+			(*fx)[i] = spnm_utils::expr_eval_varying(e, vars,
+			                                         slots.data());
+		}
+		return elapsed_ms(start);
+	}
+
+	/* the invariant slots in every lane */
+	for (size_t i = e->invariant_c; i-- > 0;)
+		std::fill_n(slots.data() + i * spnm_utils::EXPR_BATCH,
+		            spnm_utils::EXPR_BATCH, slots[i]);
+	for (size_t i = 0; i < x.size(); i += spnm_utils::EXPR_BATCH) {
+		size_t        batch_c = std::min(spnm_utils::EXPR_BATCH,
+		                                 x.size() - i);
+		const double *lanes[] = { x.data() + i, params };
+		spnm_utils::expr_eval_batch_varying(e, lanes, batch_c,
+		                                    slots.data(),
+		                                    fx->data() + i);
+	}
+	return elapsed_ms(start);
+}
+
+/*
+ * Evaluates f(x; p) with powers, repeated subterms and terms in p only over
+ * `EXPR_OPTIMIZE_POINTS` points as compiled and as optimized, one at a time
+ * and in batches, checking that the values agree.
+ */
+void
+bench_expr_optimize(void)
+{
+	printf("= expr_optimize =\n");
+
+	const char        *vars[] = { "x", "p" };
+	spnm_utils::expr_t compiled, optimized;
+	spnm_utils::expr_compile(EXPR_OPTIMIZE_FX, vars, 2, &compiled);
+	optimized = compiled;
+	spnm_utils::expr_optimize(&optimized, 1);
+	printf("instructions: %lu compiled, %lu optimized of which %lu "
+	       "invariant\n",
+	       compiled.ins.size(), optimized.ins.size(),
+	       optimized.invariant_c);
+
+	std::vector<double> x(EXPR_OPTIMIZE_POINTS);
+	for (size_t i = 0; i < EXPR_OPTIMIZE_POINTS; i++)
+		x[i] = 4.0 * i / EXPR_OPTIMIZE_POINTS - 2;
+
+	const char *modes[] = { "single", "batched" };
+	for (int batched = 0; batched <= 1; batched++) {
+		std::vector<double> fx(x.size()), opt_fx(x.size());
+		double compiled_ms  = expr_optimize_eval(&compiled, x, &fx,
+		                                         batched);
+		double optimized_ms = expr_optimize_eval(&optimized, x,
+		                                         &opt_fx, batched);
+		for (size_t i = 0; i < x.size(); i++) {
+			if (fabs(fx[i] - opt_fx[i]) <=
+			    1e-12 * std::max(1.0, fabs(fx[i])))
+				continue;
+			fprintf(stderr,
+			        RED "FAILED expr_optimize: %s value differs at "
+			            "%g\n" RESET,
+			        modes[batched], x[i]);
+			bench_failed_c++;
+			break;
+		}
+		printf("%-7s compiled: %9.3f ms, optimized: %9.3f ms, speedup: "
+		       "%.2fx\n",
+		       modes[batched], compiled_ms, optimized_ms,
+		       compiled_ms / optimized_ms);
+	}
+}
+
+/* = MAIN = */
+
+struct bench {
+	const char *name;
+	void (*run)(void);
+};
+
+const bench benches[] = {
+	{ "concurrency", bench_concurrency },
+	{ "newton_krylov", bench_newton_krylov },
+	{ "sweep", bench_sweep },
+	{ "isolate", bench_isolate },
+	{ "polynomial_roots", bench_polynomial_roots },
+	{ "integration", bench_integration },
+	{ "gauss_kronrod", bench_gauss_kronrod },
+	{ "ode", bench_ode },
+	{ "elimination", bench_elimination },
+	{ "iterative", bench_iterative },
+	{ "conjugate_gradient", bench_conjugate_gradient },
+	{ "interpolation", bench_interpolation },
+	{ "spline", bench_spline },
+	{ "fit", bench_fit },
+	{ "eigenvalues", bench_eigenvalues },
+	{ "expr_optimize", bench_expr_optimize },
+};
+
+int
+main(int argc, char **argv)
+{
+	spnm::init();
+
+	for (const bench &b : benches) {
+		/* run all without arguments */
+		int to_run = argc == 1;
+		for (int i = 1; i < argc; i++)
+			if (!strcmp(argv[i], b.name))
+				to_run = 1;
+
+		if (to_run)
+			b.run();
+	}
+
+	/* = EXIT = */
+
+	if (bench_failed_c != 0) {
+		fprintf(stderr, RED "Failed %lu benchmark!\n" RESET,
+		        bench_failed_c);
+		exit(EXIT_FAILURE);
+	}
+	exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,357 @@
+/*
+ ===============================================================================
+ |                         License - GPL-3.0-or-later                          |
+ ===============================================================================
+ *
+ * spnm - C++ Library for Numerical Methods analysis
+ * Copyright (C) 2022  Safal Piya
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Differential harness of the native evaluator against giac.
+ *
+ * Generates a random corpus of f(x), intervals and processes and runs each of
+ * them through both the native path and the giac path, reporting the
+ * divergences and the throughput ratio of the two. Finally runs the native
+ * solves again in shadow mode.
+ *
+ * Usage: spnm-shadow [-n cases] [-s seed] [-r shadow_rate]
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <random>
+#include <chrono>
+
+/* spnm - https://github.com/mrsafalpiya/spnm */
+#define SPNM_IMPL
+#include "../spnm.hpp"
+
+/* = HARNESS = */
+
+/* defaults */
+#define CASES_DEFAULT       1000
+#define SEED_DEFAULT        1
+#define SHADOW_RATE_DEFAULT 0.1
+#define EVAL_POINTS         16 /* f(x) evaluations compared per case */
+#define DIVERGENCES_SHOWN   10 /* divergences printed in detail */
+
+struct shadow_case {
+	std::string     fx;
+	std::string     lower;
+	std::string     upper;
+	spnm::process_t process;
+	size_t          process_n;
+};
+
+struct shadow_report {
+	size_t evals;             /* compared f(x) evaluations */
+	size_t eval_divergences;  /* ... which differ */
+	size_t solves;            /* compared solves */
+	size_t solve_divergences; /* ... whose steps or result differ */
+	double native_ms;         /* time spent on the native path */
+	double giac_ms;           /* time spent on the giac path */
+};
+
+std::mt19937 rng;
+
+/* = CORPUS = */
+
+int
+rand_int(int lower, int upper)
+{
+	return std::uniform_int_distribution<int>(lower, upper)(rng);
+}
+
+/* Returns a random f(x) in giac's syntax with a nesting of at most `depth`. */
+std::string
+rand_fx(int depth)
+{
+	static const char *funcs[] = { "sin", "cos", "exp", "log", "sqrt",
+		                       "atan" };
+
+	if (depth == 0 || rand_int(0, 3) == 0) {
+		switch (rand_int(0, 5)) {
+		case 0:
+			return std::to_string(rand_int(1, 9));
+		case 1:
+			return std::to_string(rand_int(1, 9)) + "." +
+			       std::to_string(rand_int(1, 9));
+		case 2:
+			return rand_int(0, 1) ? "e" : "pi";
+		case 3: /* implicit multiplication */
+			return std::to_string(rand_int(2, 9)) + "x";
+		default:
+			return "x";
+		}
+	}
+
+	std::string a = rand_fx(depth - 1);
+	switch (rand_int(0, 6)) {
+	case 0:
+		return a + " + " + rand_fx(depth - 1);
+	case 1:
+		return a + " - " + rand_fx(depth - 1);
+	case 2:
+		return "(" + a + ")*(" + rand_fx(depth - 1) + ")";
+	case 3:
+		return "(" + a + ")/(" + rand_fx(depth - 1) + ")";
+	case 4:
+		return "(" + a + ")^" + std::to_string(rand_int(2, 4));
+	default:
+		return std::string(funcs[rand_int(0, 5)]) + "(" + a + ")";
+	}
+}
+
+shadow_case
+rand_case(void)
+{
+	shadow_case c;
+
+	c.fx = rand_fx(3);
+
+	int lower = rand_int(-5, 4);
+	c.lower   = std::to_string(lower);
+	c.upper   = std::to_string(lower + rand_int(1, 3)) + "." +
+	          std::to_string(rand_int(0, 9));
+
+	c.process = (spnm::process_t)rand_int(0, 2);
+	c.process_n =
+		c.process == spnm::NO_OF_STEPS ? rand_int(3, 10) : rand_int(1, 5);
+
+	return c;
+}
+
+/* = COMPARISON = */
+
+double
+elapsed_ms(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(
+		       std::chrono::steady_clock::now() - start)
+	        .count();
+}
+
+/* Compares f(x) at evenly spaced points of the interval. */
+void
+compare_evals(const shadow_case *c, shadow_report *r)
+{
+	double lower = atof(c->lower.c_str());
+	double upper = atof(c->upper.c_str());
+
+	/* native */
+	spnm_utils::expr_t  e;
+	const char         *vars[] = { "x" };
+	if (!spnm_utils::expr_compile(c->fx.c_str(), vars, 1, &e)) {
+		printf("[NATIVE] '%s' not compiled\n", c->fx.c_str());
+		return;
+	}
+	std::vector<double> slots(e.ins.size());
+
+	double native_vals[EVAL_POINTS];
+	auto   start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < EVAL_POINTS; i++) {
+		double x = lower + (upper - lower) * i / (EVAL_POINTS - 1);
+		native_vals[i] = spnm_utils::expr_eval(&e, &x, slots.data());
+	}
+	r->native_ms += elapsed_ms(start);
+
+	/* giac */
+	spnm_utils::giac_init();
+	giac::context ct;
+	std::stringstream log;
+	giac::logptr(&log, &ct);
+
+	double giac_vals[EVAL_POINTS];
+	start = std::chrono::steady_clock::now();
+	int parsed = spnm_utils::giac_fx_parse(c->fx.c_str(), &ct);
+	for (size_t i = 0; i < EVAL_POINTS; i++) {
+		double x = lower + (upper - lower) * i / (EVAL_POINTS - 1);
+		giac_vals[i] =
+			parsed ? spnm_utils::giac_fx_val_double(
+					 spnm_utils::approx_string(x).c_str(), &ct)
+			       : NAN;
+	}
+	r->giac_ms += elapsed_ms(start);
+
+	for (size_t i = 0; i < EVAL_POINTS; i++) {
+		r->evals++;
+
+		double native = native_vals[i], giac = giac_vals[i];
+		if (std::isnan(native) && std::isnan(giac))
+			continue;
+		double scale = std::max(1.0, std::max(fabs(native), fabs(giac)));
+		if (fabs(native - giac) <= spnm_utils::SHADOW_TOLERANCE * scale)
+			continue;
+
+		if (r->eval_divergences++ < DIVERGENCES_SHOWN)
+			printf("[EVAL] '%s' at x = %.12g: native %.17g, giac %.17g\n",
+			       c->fx.c_str(),
+			       lower + (upper - lower) * i / (EVAL_POINTS - 1),
+			       native, giac);
+	}
+}
+
+/* Returns the bisection steps of `c` as text, with the error code first. */
+std::string
+bisection_text(const shadow_case *c)
+{
+	spnm::bisection_t t =
+		spnm::bisection_init(c->fx.c_str(), c->lower.c_str(),
+	                             c->upper.c_str(), c->process, c->process_n);
+	int ret = spnm::bisection_perform(&t);
+
+	std::string out = std::to_string(ret) + "\n";
+	for (size_t i = 0; i < t.steps_c; i++) {
+		char buffer[1024];
+		snprintf(buffer, sizeof(buffer), "%lu\t%s\t%c\t%s\t%c\t%s\t%c\n",
+		         t.steps[i].n, t.steps[i].a_n, t.steps[i].fa_n_sign,
+		         t.steps[i].b_n, t.steps[i].fb_n_sign, t.steps[i].c_n,
+		         t.steps[i].fc_n_sign);
+		out += buffer;
+	}
+
+	spnm::bisection_free(&t);
+	return out;
+}
+
+/* Returns the secant steps of `c` as text, with the error code first. */
+std::string
+secant_text(const shadow_case *c)
+{
+	spnm::secant_t t =
+		spnm::secant_init(c->fx.c_str(), c->lower.c_str(),
+	                          c->upper.c_str(), c->process, c->process_n);
+	int ret = spnm::secant_perform(&t);
+
+	std::string out = std::to_string(ret) + "\n";
+	for (size_t i = 0; i < t.steps_c; i++) {
+		char buffer[1024];
+		snprintf(buffer, sizeof(buffer), "%lu\t%s\t%s\t%s\t%s\t%s\t%s\n",
+		         t.steps[i].n, t.steps[i].x_prev, t.steps[i].fx_prev,
+		         t.steps[i].x_n, t.steps[i].fx_n, t.steps[i].x_next,
+		         t.steps[i].fx_next);
+		out += buffer;
+	}
+
+	spnm::secant_free(&t);
+	return out;
+}
+
+/* Compares the solves of `c` step for step. */
+void
+compare_solves(const shadow_case *c, shadow_report *r)
+{
+	std::string (*solves[])(const shadow_case *) = { bisection_text,
+		                                         secant_text };
+	const char *names[] = { "bisection", "secant" };
+
+	for (size_t i = 0; i < 2; i++) {
+		auto        start  = std::chrono::steady_clock::now();
+		std::string native = solves[i](c);
+		r->native_ms += elapsed_ms(start);
+
+		spnm_utils::native_off = 1;
+		start                  = std::chrono::steady_clock::now();
+		std::string giac       = solves[i](c);
+		r->giac_ms += elapsed_ms(start);
+		spnm_utils::native_off = 0;
+
+		r->solves++;
+		if (native == giac)
+			continue;
+
+		if (r->solve_divergences++ < DIVERGENCES_SHOWN)
+			printf("[SOLVE] %s of '%s' in [%s, %s]:\n"
+			       "native:\n%sgiac:\n%s",
+			       names[i], c->fx.c_str(), c->lower.c_str(),
+			       c->upper.c_str(), native.c_str(), giac.c_str());
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	/* = OPTIONS = */
+
+	size_t cases_c     = CASES_DEFAULT;
+	size_t seed        = SEED_DEFAULT;
+	double shadow_rate = SHADOW_RATE_DEFAULT;
+	for (int i = 1; i + 1 < argc; i += 2) {
+		if (!strcmp(argv[i], "-n"))
+			cases_c = atoi(argv[i + 1]);
+		else if (!strcmp(argv[i], "-s"))
+			seed = atoi(argv[i + 1]);
+		else if (!strcmp(argv[i], "-r"))
+			shadow_rate = atof(argv[i + 1]);
+	}
+
+	spnm::init();
+	rng.seed(seed);
+
+	/* = CORPUS = */
+
+	std::vector<shadow_case> cases;
+	for (size_t i = 0; i < cases_c; i++)
+		cases.push_back(rand_case());
+
+	/* the secant starting on the root, and on a single point, landing
+	 * where x_(n-1) and x_n are the same */
+	cases.push_back({ "x^2 - 4", "2", "2.0", spnm::DECIMAL_PLACES, 4 });
+	cases.push_back({ "x^2 - 2", "1.5", "1.5", spnm::DECIMAL_PLACES, 4 });
+
+	/* = DIFFERENTIAL = */
+
+	shadow_report r;
+	memset(&r, 0, sizeof(r));
+	for (const shadow_case &c : cases) {
+		compare_evals(&c, &r);
+		compare_solves(&c, &r);
+	}
+
+	printf("cases: %lu (seed %lu)\n", cases_c, seed);
+	printf("f(x) evaluations: %lu, divergences: %lu\n", r.evals,
+	       r.eval_divergences);
+	printf("solves: %lu, divergences: %lu\n", r.solves,
+	       r.solve_divergences);
+	printf("native: %.3f ms, giac: %.3f ms, throughput ratio: %.1fx\n",
+	       r.native_ms, r.giac_ms, r.giac_ms / r.native_ms);
+
+	/* = SHADOW MODE = */
+
+	spnm::shadow_set_rate(shadow_rate);
+	auto start = std::chrono::steady_clock::now();
+	for (const shadow_case &c : cases) {
+		bisection_text(&c);
+		secant_text(&c);
+	}
+	double shadow_ms = elapsed_ms(start);
+
+	spnm::shadow_stats_t stats = spnm::shadow_stats();
+	printf("shadow mode at rate %g: %.3f ms, %lu solves shadowed, "
+	       "%lu evaluations, %lu divergences\n",
+	       shadow_rate, shadow_ms, stats.solves, stats.evals,
+	       stats.divergences);
+
+	/* = EXIT = */
+
+	if (r.eval_divergences || r.solve_divergences || stats.divergences)
+		exit(EXIT_FAILURE);
+	exit(EXIT_SUCCESS);
+}
@@ -54,6 +54,155 @@
 		print_usage(stderr);                                         \
 	}
 
+#define PARSE_PRECOND(PRECOND_T)                                             \
+	if (!strcmp(precond, "none") || !strcmp(precond, "0"))               \
+		PRECOND_T = spnm::PRECOND_NONE;                              \
+	else if (!strcmp(precond, "jacobi") || !strcmp(precond, "1"))        \
+		PRECOND_T = spnm::PRECOND_JACOBI;                            \
+	else if (!strcmp(precond, "ilu0") || !strcmp(precond, "2"))          \
+		PRECOND_T = spnm::PRECOND_ILU0;                              \
+	else if (!strcmp(precond, "ic0") || !strcmp(precond, "3")) {         \
+		PRECOND_T = spnm::PRECOND_IC0;                               \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid preconditioner given.\n");  \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_METHOD(METHOD_T)                                               \
+	if (!strcmp(method, "bisection") || !strcmp(method, "1"))            \
+		METHOD_T = spnm::SWEEP_BISECTION;                            \
+	else if (!strcmp(method, "secant") || !strcmp(method, "2")) {        \
+		METHOD_T = spnm::SWEEP_SECANT;                               \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid method given.\n");          \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_ACCEL(ACCEL_T)                                                 \
+	if (!strcmp(accel, "none") || !strcmp(accel, "0"))                   \
+		ACCEL_T = spnm::ACCEL_NONE;                                  \
+	else if (!strcmp(accel, "aitken") || !strcmp(accel, "1"))            \
+		ACCEL_T = spnm::ACCEL_AITKEN;                                \
+	else if (!strcmp(accel, "steffensen") || !strcmp(accel, "2")) {     \
+		ACCEL_T = spnm::ACCEL_STEFFENSEN;                            \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid acceleration given.\n");    \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_RULE(RULE_T)                                                   \
+	if (!strcmp(process, "trapezoidal") || !strcmp(process, "1"))        \
+		RULE_T = spnm::QUAD_TRAPEZOIDAL;                             \
+	else if (!strcmp(process, "simpson_13") || !strcmp(process, "2"))    \
+		RULE_T = spnm::QUAD_SIMPSON_13;                              \
+	else if (!strcmp(process, "simpson_38") || !strcmp(process, "3"))    \
+		RULE_T = spnm::QUAD_SIMPSON_38;                              \
+	else if (!strcmp(process, "romberg") || !strcmp(process, "4")) {     \
+		RULE_T = spnm::QUAD_ROMBERG;                                 \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid process given.\n");         \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_ODE_METHOD(METHOD_T)                                           \
+	if (!strcmp(process, "euler") || !strcmp(process, "1"))              \
+		METHOD_T = spnm::ODE_EULER;                                  \
+	else if (!strcmp(process, "heun") || !strcmp(process, "2"))          \
+		METHOD_T = spnm::ODE_HEUN;                                   \
+	else if (!strcmp(process, "rk4") || !strcmp(process, "3"))           \
+		METHOD_T = spnm::ODE_RK4;                                    \
+	else if (!strcmp(process, "rk45") || !strcmp(process, "4")) {        \
+		METHOD_T = spnm::ODE_RK45;                                   \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid process given.\n");         \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_ELIMINATION_METHOD(METHOD_T)                                   \
+	if (!strcmp(process, "gauss") || !strcmp(process, "1"))              \
+		METHOD_T = spnm::ELIMINATION_GAUSS;                          \
+	else if (!strcmp(process, "lu") || !strcmp(process, "2")) {          \
+		METHOD_T = spnm::ELIMINATION_LU;                             \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid process given.\n");         \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_INTERPOLATION_METHOD(METHOD_T)                                 \
+	if (!strcmp(process, "newton_forward") || !strcmp(process, "1"))     \
+		METHOD_T = spnm::INTERPOLATION_FORWARD;                      \
+	else if (!strcmp(process, "newton_backward") ||                      \
+	         !strcmp(process, "2"))                                      \
+		METHOD_T = spnm::INTERPOLATION_BACKWARD;                     \
+	else if (!strcmp(process, "newton_divided") ||                       \
+	         !strcmp(process, "3"))                                      \
+		METHOD_T = spnm::INTERPOLATION_DIVIDED;                      \
+	else if (!strcmp(process, "lagrange") || !strcmp(process, "4")) {    \
+		METHOD_T = spnm::INTERPOLATION_LAGRANGE;                     \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid process given.\n");         \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_FIT_MODEL(MODEL_T)                                             \
+	if (!strcmp(process, "line") || !strcmp(process, "1"))               \
+		MODEL_T = spnm::FIT_LINE;                                    \
+	else if (!strcmp(process, "polynomial") || !strcmp(process, "2"))    \
+		MODEL_T = spnm::FIT_POLYNOMIAL;                              \
+	else if (!strcmp(process, "exponential") ||                          \
+	         !strcmp(process, "3")) {                                    \
+		MODEL_T = spnm::FIT_EXPONENTIAL;                             \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid process given.\n");         \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_DIFFERENCE(DIFFERENCE_T)                                       \
+	if (!strcmp(process, "forward") || !strcmp(process, "1"))            \
+		DIFFERENCE_T = spnm::DIFFERENCE_FORWARD;                     \
+	else if (!strcmp(process, "backward") || !strcmp(process, "2"))      \
+		DIFFERENCE_T = spnm::DIFFERENCE_BACKWARD;                    \
+	else if (!strcmp(process, "central") || !strcmp(process, "3")) {     \
+		DIFFERENCE_T = spnm::DIFFERENCE_CENTRAL;                     \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid process given.\n");         \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_EXTRAPOLATION(EXTRAPOLATION_T)                                 \
+	if (!strcmp(extrapolation, "none") || !strcmp(extrapolation, "0"))   \
+		EXTRAPOLATION_T = spnm::EXTRAPOLATION_NONE;                  \
+	else if (!strcmp(extrapolation, "richardson") ||                     \
+	         !strcmp(extrapolation, "1")) {                              \
+		EXTRAPOLATION_T = spnm::EXTRAPOLATION_RICHARDSON;            \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid extrapolation given.\n");   \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_POWER_METHOD(METHOD_T)                                         \
+	if (!strcmp(process, "power") || !strcmp(process, "1"))              \
+		METHOD_T = spnm::POWER_DIRECT;                               \
+	else if (!strcmp(process, "inverse") || !strcmp(process, "2")) {     \
+		METHOD_T = spnm::POWER_INVERSE;                              \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid process given.\n");         \
+		print_usage(stderr);                                         \
+	}
+
+#define PARSE_ITERATIVE_METHOD(METHOD_T)                                     \
+	if (!strcmp(process, "jacobi") || !strcmp(process, "3"))             \
+		METHOD_T = spnm::ITERATIVE_JACOBI;                           \
+	else if (!strcmp(process, "gauss_seidel") ||                         \
+	         !strcmp(process, "4"))                                      \
+		METHOD_T = spnm::ITERATIVE_GAUSS_SEIDEL;                     \
+	else if (!strcmp(process, "sor") || !strcmp(process, "5")) {         \
+		METHOD_T = spnm::ITERATIVE_SOR;                              \
+	} else {                                                             \
+		fprintf(stderr, "[ERROR] Invalid process given.\n");         \
+		print_usage(stderr);                                         \
+	}
+
 /* = CLI = */
 
 #define USAGE_STR                                                                                                        \
@@ -61,19 +210,92 @@
 	"\n"                                                                                                             \
 	"where 'topic' can be\n"                                                                                         \
 	"- 'solution_of_nonlinear_equations'/'1'\n"                                                                      \
+	"- 'numerical_integration'/'2'\n"                                                                                \
+	"- 'ordinary_differential_equations'/'3'\n"                                                                      \
+	"- 'linear_systems'/'4'\n"                                                                                       \
+	"- 'interpolation'/'5'\n"                                                                                        \
+	"- 'curve_fitting'/'6'\n"                                                                                        \
+	"- 'numerical_differentiation'/'7'\n"                                                                            \
+	"- 'eigenvalues'/'8'\n"                                                                                          \
 	"\n"                                                                                                             \
 	"'process' can be\n"                                                                                             \
-	"- Solution of Nonlinear Equations: 'bisection'/'1', 'secant'/'2'\n"                                             \
+	"- Solution of Nonlinear Equations: 'bisection'/'1', 'secant'/'2', 'fixed_point'/'3', 'newton_system'/'4',\n"     \
+	"  'newton_krylov'/'5', 'sweep'/'6', 'isolate'/'7', 'polynomial_roots'/'8'\n"                                    \
+	"- Numerical Integration: 'trapezoidal'/'1', 'simpson_13'/'2', 'simpson_38'/'3', 'romberg'/'4',\n"               \
+	"  'gauss_kronrod'/'5'\n"                                                                                        \
+	"- Ordinary Differential Equations: 'euler'/'1', 'heun'/'2', 'rk4'/'3', 'rk45'/'4'\n"                            \
+	"- Linear Systems: 'gauss'/'1', 'lu'/'2', 'jacobi'/'3', 'gauss_seidel'/'4', 'sor'/'5',\n"                        \
+	"  'conjugate_gradient'/'6'\n"                                                                                   \
+	"- Interpolation: 'newton_forward'/'1', 'newton_backward'/'2', 'newton_divided'/'3', 'lagrange'/'4',\n"          \
+	"  'natural_spline'/'5', 'clamped_spline'/'6'\n"                                                                 \
+	"- Curve Fitting: 'line'/'1', 'polynomial'/'2', 'exponential'/'3'\n"                                             \
+	"- Numerical Differentiation: 'forward'/'1', 'backward'/'2', 'central'/'3'\n"                                    \
+	"- Eigenvalues: 'power'/'1', 'inverse'/'2', 'qr'/'3'\n"                                                          \
 	"\n"                                                                                                             \
 	"'inputs' can be\n"                                                                                              \
 	"- For \"Solution of Nonlinear Equations\", \"Bisection\": fx interval_lower interval_upper process process_n\n" \
 	"- For \"Solution of Nonlinear Equations\", \"Secant\": fx initial_point_1 initial_point_2 process process_n\n"  \
+	"- For \"Solution of Nonlinear Equations\", \"Fixed Point\": gx initial_point process process_n accel\n"        \
+	"- For \"Solution of Nonlinear Equations\", \"Newton System\": fxs vars initial_points process process_n\n"   \
+	"  where 'fxs', 'vars' and 'initial_points' are lists separated by ';'\n"                                         \
+	"- For \"Solution of Nonlinear Equations\", \"Newton-Krylov\": fx stencil unknowns boundaries initial_point\n"  \
+	"  precond process process_n\n"                                                                                   \
+	"  where 'stencil' is a list of var:offset as in 'l:-1;c:0;r:1' and 'boundaries' is 'lower;upper'\n"             \
+	"- For \"Solution of Nonlinear Equations\", \"Sweep\": fx param params points method inputs process process_n\n"   \
+	"  where 'params' is 'lower;upper' of the parameter and 'inputs' is 'input_1;input_2' of the method\n"             \
+	"- For \"Solution of Nonlinear Equations\", \"Isolate\": fx interval_lower interval_upper tolerance process\n"     \
+	"  process_n\n"                                                                                                   \
+	"- For \"Solution of Nonlinear Equations\", \"Polynomial Roots\": fx process process_n\n"                        \
+	"- For \"Numerical Integration\": fx lower upper process process_n\n"                                            \
+	"- For \"Numerical Integration\", \"Gauss-Kronrod\": fx lower upper tolerance process process_n\n"               \
+	"- For \"Ordinary Differential Equations\": fxy initial_x initial_y final_x h process process_n\n"               \
+	"- For \"Ordinary Differential Equations\", \"RK45\": fxy initial_x initial_y final_x h tolerance process\n"     \
+	"  process_n\n"                                                                                                  \
+	"- For \"Linear Systems\": a b process process_n\n"                                                              \
+	"  where 'a' is the rows of A separated by ';' with the entries of a row by ',' and 'b' is a list separated\n"   \
+	"  by ';'\n"                                                                                                     \
+	"- For \"Linear Systems\", \"Jacobi\" and \"Gauss-Seidel\": a b initial_point process process_n\n"               \
+	"- For \"Linear Systems\", \"SOR\": a b initial_point relaxation process process_n\n"                            \
+	"- For \"Linear Systems\", \"Conjugate Gradient\": a b initial_point precond process process_n\n"                \
+	"  where 'a' can be '@file' of A in the matrix market format, 'b' then being '@file' or 'ones' for every\n"      \
+	"  b_i being 1\n"                                                                                                \
+	"- For \"Interpolation\": x y at process process_n\n"                                                            \
+	"  where 'x' and 'y' are lists separated by ';' and 'at' is the x to interpolate y at\n"                         \
+	"- For \"Interpolation\", \"Clamped Spline\": x y at slopes process process_n\n"                                 \
+	"  where 'slopes' is 'lower;upper' of the slopes at the ends\n"                                                  \
+	"- For \"Curve Fitting\": x y process process_n\n"                                                               \
+	"  where 'x' and 'y' are lists separated by ';', or 'x' is '@file' of the points with 'y' being 'csv' or\n"      \
+	"  'binary' for the format of the file\n"                                                                        \
+	"- For \"Curve Fitting\", \"Polynomial\": x y degree process process_n\n"                                        \
+	"- For \"Numerical Differentiation\": fx x h extrapolation process process_n\n"                                  \
+	"- For \"Eigenvalues\", \"Power\" and \"Inverse\": a initial_vector shift process process_n\n"                   \
+	"  where 'a' is as of \"Linear Systems\" and 'initial_vector' is a list separated by ';'\n"                      \
+	"- For \"Eigenvalues\", \"QR\": a process process_n\n"                                                           \
 	"\n"                                                                                                             \
 	"'process' can be\n"                                                                                             \
 	"- 'decimal_places'/'1'\n"                                                                                       \
 	"- 'significant_digits'/'2'\n"                                                                                   \
 	"- 'no_of_steps'/'3'\n"                                                                                          \
 	"\n"                                                                                                             \
+	"'accel' can be\n"                                                                                               \
+	"- 'none'/'0'\n"                                                                                                 \
+	"- 'aitken'/'1'\n"                                                                                               \
+	"- 'steffensen'/'2'\n"                                                                                           \
+	"\n"                                                                                                             \
+	"'extrapolation' can be\n"                                                                                       \
+	"- 'none'/'0'\n"                                                                                                 \
+	"- 'richardson'/'1'\n"                                                                                           \
+	"\n"                                                                                                             \
+	"'method' can be\n"                                                                                              \
+	"- 'bisection'/'1'\n"                                                                                            \
+	"- 'secant'/'2'\n"                                                                                               \
+	"\n"                                                                                                             \
+	"'precond' can be\n"                                                                                             \
+	"- 'none'/'0'\n"                                                                                                 \
+	"- 'jacobi'/'1'\n"                                                                                               \
+	"- 'ilu0'/'2'\n"                                                                                                 \
+	"- 'ic0'/'3'\n"                                                                                                  \
+	"\n"                                                                                                             \
 	"Available flags are:\n",                                                                                        \
 		prog
 
@@ -84,6 +306,9 @@
  */
 
 char *prog;
+int   threads_c   = 0; /* threads of the solves running on several */
+int   deadline_ms = 0; /* time limit of the adaptive integrations */
+int   red_black   = 0; /* red-black ordering of the gauss-seidel methods */
 
 /*
  ===============================================================================
@@ -105,11 +330,119 @@ perform_secant(const char *fx, const char *initial_point1,
                const char *initial_point2, const char *process,
                const char *process_n);
 
+void
+perform_fixed_point(const char *gx, const char *initial_point,
+                    const char *process, const char *process_n,
+                    const char *accel);
+
+void
+perform_newton_system(char *fxs, char *vars, char *initial_points,
+                      const char *process, const char *process_n);
+
+void
+perform_newton_krylov(const char *fx, char *stencil, const char *unknowns_c,
+                      char *boundaries, const char *initial_point,
+                      const char *precond, const char *process,
+                      const char *process_n);
+
+void
+perform_sweep(const char *fx, const char *param, char *params,
+              const char *points_c, const char *method, char *inputs,
+              const char *process, const char *process_n);
+
+void
+perform_isolate(const char *fx, const char *interval_lower,
+                const char *interval_upper, const char *tolerance,
+                const char *process, const char *process_n);
+
+void
+perform_polynomial_roots(const char *fx, const char *process,
+                         const char *process_n);
+
+/* == 2 - numerical integration == */
+
+void
+perform_integration(spnm::quadrature_t rule, const char *fx,
+                    const char *lower, const char *upper, const char *process,
+                    const char *process_n);
+
+void
+perform_gauss_kronrod(const char *fx, const char *lower, const char *upper,
+                      const char *tolerance, const char *process,
+                      const char *process_n);
+
+/* == 3 - ordinary differential equations == */
+
+void
+perform_ode(spnm::ode_method_t method, const char *fxy, const char *initial_x,
+            const char *initial_y, const char *final_x, const char *h,
+            const char *tolerance, const char *process,
+            const char *process_n);
+
+/* == 4 - linear systems == */
+
+void
+perform_elimination(spnm::elimination_method_t method, const char *a,
+                    const char *b, const char *process, const char *process_n);
+
+void
+perform_iterative(spnm::iterative_method_t method, const char *a,
+                  const char *b, const char *initial_point,
+                  const char *relaxation, const char *process,
+                  const char *process_n);
+
+void
+perform_conjugate_gradient(const char *a, const char *b,
+                           const char *initial_point, const char *precond,
+                           const char *process, const char *process_n);
+
+/* == 5 - interpolation == */
+
+void
+perform_interpolation(spnm::interpolation_method_t method, const char *x,
+                      const char *y, const char *at, const char *process,
+                      const char *process_n);
+
+void
+perform_spline(spnm::spline_end_t ends, const char *x, const char *y,
+               const char *at, const char *slopes, const char *process,
+               const char *process_n);
+
+/* == 6 - curve fitting == */
+
+void
+perform_fit(spnm::fit_model_t model, const char *x, const char *y,
+            const char *degree, const char *process, const char *process_n);
+
+/* == 7 - numerical differentiation == */
+
+void
+perform_differentiation(spnm::difference_t difference, const char *fx,
+                        const char *x, const char *h,
+                        const char *extrapolation, const char *process,
+                        const char *process_n);
+
 /* = CORE = */
 
+/* == 8 - eigenvalues == */
+
+void
+perform_power_iteration(spnm::power_method_t method, const char *a,
+                        const char *initial_vector, const char *shift,
+                        const char *process, const char *process_n);
+
+void
+perform_qr_algorithm(const char *a, const char *process,
+                     const char *process_n);
+
 void
 print_usage(FILE *stream);
 
+/* Splits `list` in place on ';' into at most `max` items of `out` with the
+ * surrounding spaces removed. Returns the number of items. */
+size_t
+split_list(char *list, char **out, size_t max);
+
 /*
  ===============================================================================
  |                          Function Implementations                           |
@@ -155,6 +488,10 @@ perform_bisection(const char *fx, const char *interval_lower,
 				<< "[ERROR] The two intervals don't met the conditions for bisection of f(a).f(b) < 0."
 				<< std::endl;
 		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
 		default:
 			std::cout << "[ERROR] Unknown error." << std::endl
 				  << std::endl;
@@ -208,6 +545,10 @@ perform_secant(const char *fx, const char *initial_point1,
 				  << std::endl;
 			std::cout << secant_instance.log.str() << std::endl;
 		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
 		default:
 			std::cout << "[ERROR] Unknown error." << std::endl
 				  << std::endl;
@@ -231,74 +572,1249 @@ perform_secant(const char *fx, const char *initial_point1,
 	spnm::secant_free(&secant_instance);
 }
 
-/* = CORE = */
-
 void
-print_usage(FILE *stream)
+perform_fixed_point(const char *gx, const char *initial_point,
+                    const char *process, const char *process_n,
+                    const char *accel)
 {
-	int exit_code = EXIT_SUCCESS;
-	if (stream == stderr)
-		exit_code = EXIT_FAILURE;
+	/* parse process and acceleration */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+	spnm::accel_t accel_input;
+	PARSE_ACCEL(accel_input);
 
-	fprintf(stream, USAGE_STR);
-	spl_flag_print_help(stream);
-	exit(exit_code);
-}
+	/* init */
+	spnm::fixed_point_t fixed_point_instance =
+		spnm::fixed_point_init(gx, initial_point, process_input,
+	                               atoi(process_n), accel_input);
 
-int
-main(int argc, char **argv)
-{
-	prog = argv[0];
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::fixed_point_perform(&fixed_point_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid function input."
+				  << std::endl
+				  << std::endl;
+			std::cout << fixed_point_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid initial point or the iteration diverged."
+				<< std::endl
+				<< std::endl;
+			std::cout << fixed_point_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << fixed_point_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
 
-	/* = FLAGS = */
+	/* output */
+	for (size_t i = 0; i < fixed_point_instance.steps_c; i++) {
+		spnm::fixed_point_s *step = fixed_point_instance.steps + i;
+		if (accel_input == spnm::ACCEL_NONE)
+			printf("%lu\t%s\t%s\n", step->n, step->x_n,
+			       step->gx_n);
+		else
+			printf("%lu\t%s\t%s\t%s\t%s\n", step->n, step->x_n,
+			       step->gx_n, step->ggx_n, step->x_next);
+	}
 
-	/* initialize values on flags */
-	int to_print_help = 0;
+	spnm::fixed_point_free(&fixed_point_instance);
+}
 
-	/* set flags */
-	spl_flag_toggle(&to_print_help, 'h', "help", "Print the help message");
+void
+perform_newton_system(char *fxs, char *vars, char *initial_points,
+                      const char *process, const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
 
-	spl_flag_info f_info = spl_flag_parse(argc, argv);
+	/* parse the lists */
+	char  *fx_list[spnm::VARS_MAX];
+	char  *var_list[spnm::VARS_MAX];
+	char  *initial_point_list[spnm::VARS_MAX];
+	size_t vars_c = split_list(vars, var_list, spnm::VARS_MAX);
+	if (split_list(fxs, fx_list, spnm::VARS_MAX) != vars_c ||
+	    split_list(initial_points, initial_point_list, spnm::VARS_MAX) !=
+	            vars_c) {
+		fprintf(stderr,
+		        "[ERROR] Need as many functions and initial points as variables.\n");
+		print_usage(stderr);
+	}
 
-	/* printing any gotchas in parsing */
-	if (spl_flag_print_gotchas(f_info, stderr))
+	/* init */
+	spnm::newton_system_t newton_system_instance = spnm::newton_system_init(
+		fx_list, var_list, initial_point_list, vars_c, process_input,
+		atoi(process_n));
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::newton_system_perform(&newton_system_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid function input."
+				  << std::endl
+				  << std::endl;
+			std::cout << newton_system_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid initial points or the iteration diverged."
+				<< std::endl
+				<< std::endl;
+			std::cout << newton_system_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_singular_matrix: {
+			std::cout << "[ERROR] The Jacobian became singular."
+				  << std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << newton_system_instance.log.str()
+				  << std::endl;
+		}
 		exit(EXIT_FAILURE);
+	}
 
-	/* check if -h flag was passed */
-	if (to_print_help)
-		print_usage(stdout);
+	/* output: n, x_n, f(x_n) and x_(n+1) of every variable */
+	for (size_t i = 0; i < newton_system_instance.steps_c; i++) {
+		spnm::newton_system_s *step = newton_system_instance.steps + i;
 
-	/* = INIT = */
+		printf("%lu", step->n);
+		for (size_t j = 0; j < vars_c; j++)
+			printf("\t%s", step->x_n[j]);
+		for (size_t j = 0; j < vars_c; j++)
+			printf("\t%s", step->fx_n[j]);
+		for (size_t j = 0; j < vars_c; j++)
+			printf("\t%s", step->x_next[j]);
+		printf("\n");
+	}
 
-	spnm::init();
+	spnm::newton_system_free(&newton_system_instance);
+}
 
-	/* = ARGUMENT PARSING = */
+void
+perform_newton_krylov(const char *fx, char *stencil, const char *unknowns_c,
+                      char *boundaries, const char *initial_point,
+                      const char *precond, const char *process,
+                      const char *process_n)
+{
+	/* parse process and preconditioner */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+	spnm::precond_t precond_input;
+	PARSE_PRECOND(precond_input);
 
-	if (f_info.non_flag_arguments_c < 3)
+	/* parse the stencil and the boundaries */
+	char  *var_list[spnm::VARS_MAX];
+	int    offsets[spnm::VARS_MAX];
+	char  *boundary_list[2];
+	size_t vars_c = split_list(stencil, var_list, spnm::VARS_MAX);
+	for (size_t i = 0; i < vars_c && i < spnm::VARS_MAX; i++) {
+		char *colon = strchr(var_list[i], ':');
+		if (!colon) {
+			fprintf(stderr, "[ERROR] Invalid stencil given.\n");
+			print_usage(stderr);
+		}
+		*colon     = '\0';
+		offsets[i] = atoi(colon + 1);
+	}
+	if (split_list(boundaries, boundary_list, 2) != 2) {
+		fprintf(stderr, "[ERROR] Need the lower and upper boundaries.\n");
 		print_usage(stderr);
+	}
 
-	char *topic   = f_info.non_flag_arguments[0];
-	char *process = f_info.non_flag_arguments[1];
-	char *input1  = f_info.non_flag_arguments[2];
-	char *input2  = f_info.non_flag_arguments[3];
-	char *input3  = f_info.non_flag_arguments[4];
-	char *input4  = f_info.non_flag_arguments[5];
-	char *input5  = f_info.non_flag_arguments[6];
+	/* init */
+	spnm::newton_krylov_t newton_krylov_instance = spnm::newton_krylov_init(
+		fx, var_list, offsets, vars_c, atoi(unknowns_c),
+		boundary_list[0], boundary_list[1], initial_point,
+		precond_input, process_input, atoi(process_n));
+	newton_krylov_instance.threads_c = threads_c;
 
-	/* = TOPIC SELECTION = */
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::newton_krylov_perform(&newton_krylov_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid function input."
+				  << std::endl
+				  << std::endl;
+			std::cout << newton_krylov_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid inputs or the iteration diverged."
+				<< std::endl
+				<< std::endl;
+			std::cout << newton_krylov_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_singular_matrix: {
+			std::cout
+				<< "[ERROR] The preconditioner can't be set up for the Jacobian."
+				<< std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << newton_krylov_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
 
-	/* Solution of Nonlinear Equations */
-	if (!strcmp(topic, "solution_of_nonlinear_equations") ||
-	    !strcmp(topic, "1")) {
-		if (!strcmp(process, "bisection") || !strcmp(process, "1")) {
-			if (f_info.non_flag_arguments_c < (2 + 5))
-				print_usage(stderr);
-			spl_flag_warn_ignored_args(f_info, stderr, 2 + 5);
+	/* output: n, ||f(x_n)||, linear iterations, linear residual and
+	 * ||x_(n+1)|| */
+	for (size_t i = 0; i < newton_krylov_instance.steps_c; i++) {
+		spnm::newton_krylov_s *step = newton_krylov_instance.steps + i;
+		printf("%lu\t%s\t%lu\t%s\t%s\n", step->n, step->residual_norm,
+		       step->linear_iterations_c, step->linear_residual_norm,
+		       step->x_norm);
+	}
 
-			perform_bisection(input1, input2, input3, input4,
-			                  input5);
+	spnm::newton_krylov_free(&newton_krylov_instance);
+}
 
-			exit(EXIT_SUCCESS);
+void
+perform_sweep(const char *fx, const char *param, char *params,
+              const char *points_c, const char *method, char *inputs,
+              const char *process, const char *process_n)
+{
+	/* parse process and method */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+	spnm::sweep_method_t method_input;
+	PARSE_METHOD(method_input);
+
+	/* parse the lists */
+	char *param_list[2];
+	char *input_list[2];
+	if (split_list(params, param_list, 2) != 2 ||
+	    split_list(inputs, input_list, 2) != 2) {
+		fprintf(stderr,
+		        "[ERROR] Need two parameters and two inputs.\n");
+		print_usage(stderr);
+	}
+
+	/* init */
+	spnm::sweep_t sweep_instance = spnm::sweep_init(
+		fx, param, param_list[0], param_list[1], atoi(points_c),
+		method_input, input_list[0], input_list[1], process_input,
+		atoi(process_n));
+	sweep_instance.threads_c = threads_c;
+
+	/* perform the process, failed points are in the output */
+	int ret;
+	if ((ret = spnm::sweep_perform(&sweep_instance)) != 0 &&
+	    !sweep_instance.points) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid function input."
+				  << std::endl
+				  << std::endl;
+			std::cout << sweep_instance.log.str() << std::endl;
+		} break;
+		case spnm::err_x_input: {
+			std::cout << "[ERROR] Invalid parameters or points."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << sweep_instance.log.str() << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output: point, parameter, root, steps and 'w' for warm started or
+	 * 'c' for cold */
+	for (size_t i = 0; i < sweep_instance.points_c; i++) {
+		spnm::sweep_s *point = sweep_instance.points + i;
+		printf("%lu\t%s\t%s\t%lu\t%c\n", i + 1, point->p,
+		       point->root ? point->root : "*", point->steps_c,
+		       point->is_warm ? 'w' : 'c');
+	}
+
+	spnm::sweep_free(&sweep_instance);
+
+	if (ret != 0) {
+		fprintf(stderr, "[ERROR] Some points failed to be solved.\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+void
+perform_isolate(const char *fx, const char *interval_lower,
+                const char *interval_upper, const char *tolerance,
+                const char *process, const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init */
+	spnm::isolate_t isolate_instance =
+		spnm::isolate_init(fx, interval_lower, interval_upper, tolerance,
+	                           process_input, atoi(process_n));
+	isolate_instance.threads_c = threads_c;
+
+	/* perform the process, failed bisections are in the output */
+	int ret;
+	if ((ret = spnm::isolate_perform(&isolate_instance)) != 0 &&
+	    !isolate_instance.enclosures) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid function input."
+				  << std::endl
+				  << std::endl;
+			std::cout << isolate_instance.log.str() << std::endl;
+		} break;
+		case spnm::err_x_input: {
+			std::cout << "[ERROR] Invalid interval or tolerance."
+				  << std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many subintervals required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << isolate_instance.log.str() << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output: every enclosure followed by the steps of its bisection */
+	const char *kinds[] = { "unique", "exists", "possible" };
+	for (size_t i = 0; i < isolate_instance.enclosures_c; i++) {
+		spnm::isolate_s *enclosure = isolate_instance.enclosures + i;
+		printf("%lu\t%s\t%s\t%s\n", i + 1, enclosure->lower,
+		       enclosure->upper, kinds[enclosure->kind]);
+		if (!enclosure->bisection)
+			continue;
+		if (enclosure->err) {
+			printf("\t*\n");
+			continue;
+		}
+
+		spnm::bisection_t *bisection = enclosure->bisection;
+		for (size_t j = 0; j < bisection->steps_c; j++) {
+			printf("\t%lu\t%s\t%c\t%s\t%c\t%s\t%c\n",
+			       bisection->steps[j].n, bisection->steps[j].a_n,
+			       bisection->steps[j].fa_n_sign,
+			       bisection->steps[j].b_n,
+			       bisection->steps[j].fb_n_sign,
+			       bisection->steps[j].c_n,
+			       bisection->steps[j].fc_n_sign);
+		}
+	}
+
+	spnm::isolate_free(&isolate_instance);
+
+	if (ret != 0) {
+		fprintf(stderr, "[ERROR] Some bisections failed.\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+void
+perform_polynomial_roots(const char *fx, const char *process,
+                         const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init */
+	spnm::polynomial_roots_t polynomial_roots_instance =
+		spnm::polynomial_roots_init(fx, process_input, atoi(process_n));
+	polynomial_roots_instance.threads_c = threads_c;
+
+	/* perform the process, failed bisections are in the output */
+	int ret;
+	if ((ret = spnm::polynomial_roots_perform(
+		     &polynomial_roots_instance)) != 0 &&
+	    !polynomial_roots_instance.enclosures) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid polynomial input."
+				  << std::endl
+				  << std::endl;
+			std::cout << polynomial_roots_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many subintervals required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << polynomial_roots_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output: the square-free part of f if bisected over roots of even
+	 * multiplicity, then every enclosure followed by the steps of its
+	 * bisection */
+	if (polynomial_roots_instance.square_free)
+		printf("square_free\t%s\n",
+		       polynomial_roots_instance.square_free);
+	const char *kinds[] = { "unique", "exists", "possible" };
+	for (size_t i = 0; i < polynomial_roots_instance.enclosures_c; i++) {
+		spnm::isolate_s *enclosure =
+			polynomial_roots_instance.enclosures + i;
+		printf("%lu\t%s\t%s\t%s\n", i + 1, enclosure->lower,
+		       enclosure->upper, kinds[enclosure->kind]);
+		if (enclosure->err) {
+			printf("\t*\n");
+			continue;
+		}
+
+		spnm::bisection_t *bisection = enclosure->bisection;
+		for (size_t j = 0; j < bisection->steps_c; j++) {
+			printf("\t%lu\t%s\t%c\t%s\t%c\t%s\t%c\n",
+			       bisection->steps[j].n, bisection->steps[j].a_n,
+			       bisection->steps[j].fa_n_sign,
+			       bisection->steps[j].b_n,
+			       bisection->steps[j].fb_n_sign,
+			       bisection->steps[j].c_n,
+			       bisection->steps[j].fc_n_sign);
+		}
+	}
+
+	spnm::polynomial_roots_free(&polynomial_roots_instance);
+
+	if (ret != 0) {
+		fprintf(stderr, "[ERROR] Some bisections failed.\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+/* == 2 - numerical integration == */
+
+void
+perform_integration(spnm::quadrature_t rule, const char *fx,
+                    const char *lower, const char *upper, const char *process,
+                    const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init */
+	spnm::integration_t integration_instance = spnm::integration_init(
+		fx, lower, upper, rule, process_input, atoi(process_n));
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::integration_perform(&integration_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid function input."
+				  << std::endl
+				  << std::endl;
+			std::cout << integration_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid limits or the function isn't finite on them."
+				<< std::endl
+				<< std::endl;
+			std::cout << integration_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << integration_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output, the row of the table in place of the integral for romberg */
+	for (size_t i = 0; i < integration_instance.steps_c; i++) {
+		spnm::integration_s *step = integration_instance.steps + i;
+		printf("%lu\t%lu\t%s", step->n, step->intervals_c, step->h);
+		if (rule != spnm::QUAD_ROMBERG) {
+			printf("\t%s\n", step->integral);
+			continue;
+		}
+		for (size_t j = 0; j < step->n; j++)
+			printf("\t%s", step->romberg[j]);
+		printf("\n");
+	}
+
+	spnm::integration_free(&integration_instance);
+}
+
+void
+perform_gauss_kronrod(const char *fx, const char *lower, const char *upper,
+                      const char *tolerance, const char *process,
+                      const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init */
+	spnm::gauss_kronrod_t gauss_kronrod_instance = spnm::gauss_kronrod_init(
+		fx, lower, upper, tolerance, process_input, atoi(process_n));
+	gauss_kronrod_instance.threads_c   = threads_c;
+	gauss_kronrod_instance.deadline_ms = deadline_ms;
+
+	/* perform the process, the rounds before the deadline are output */
+	int ret;
+	if ((ret = spnm::gauss_kronrod_perform(&gauss_kronrod_instance)) != 0 &&
+	    ret != spnm::err_deadline) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid function input."
+				  << std::endl
+				  << std::endl;
+			std::cout << gauss_kronrod_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid limits or tolerance, or the function isn't finite on them."
+				<< std::endl
+				<< std::endl;
+			std::cout << gauss_kronrod_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many rounds required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << gauss_kronrod_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output */
+	for (size_t i = 0; i < gauss_kronrod_instance.steps_c; i++) {
+		spnm::gauss_kronrod_s *step = gauss_kronrod_instance.steps + i;
+		printf("%lu\t%lu\t%lu\t%s\t%s\n", step->n, step->intervals_c,
+		       step->evals_c, step->integral, step->error);
+	}
+	fprintf(stderr, "evaluations: %lu, wall time: %.3f ms\n",
+	        gauss_kronrod_instance.evals_c,
+	        gauss_kronrod_instance.wall_ms);
+
+	spnm::gauss_kronrod_free(&gauss_kronrod_instance);
+
+	if (ret == spnm::err_deadline) {
+		fprintf(stderr, "[ERROR] Deadline passed.\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+/* == 3 - ordinary differential equations == */
+
+void
+perform_ode(spnm::ode_method_t method, const char *fxy, const char *initial_x,
+            const char *initial_y, const char *final_x, const char *h,
+            const char *tolerance, const char *process,
+            const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init, the steps are streamed as they come */
+	spnm::ode_t ode_instance =
+		spnm::ode_init(fxy, initial_x, initial_y, final_x, h, tolerance,
+	                       method, process_input, atoi(process_n));
+	ode_instance.on_step = spnm::ode_write_step;
+	ode_instance.data    = &std::cout;
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::ode_perform(&ode_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid function input."
+				  << std::endl
+				  << std::endl;
+			std::cout << ode_instance.log.str() << std::endl;
+		} break;
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid inputs or the solution isn't finite."
+				<< std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << ode_instance.log.str() << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	spnm::ode_free(&ode_instance);
+}
+
+/* == 4 - linear systems == */
+
+void
+perform_elimination(spnm::elimination_method_t method, const char *a,
+                    const char *b, const char *process, const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init, keeping the matrix of every step to show it */
+	spnm::elimination_t elimination_instance = spnm::elimination_init(
+		a, b, method, process_input, atoi(process_n));
+	elimination_instance.snapshots = 1;
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::elimination_perform(&elimination_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid or non-square system or the solution isn't finite."
+				<< std::endl;
+		} break;
+		case spnm::err_singular_matrix: {
+			std::cout << "[ERROR] The matrix is singular."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << elimination_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output: n, pivot row and pivot followed by the rows of the matrix
+	 * and finally x */
+	size_t rows_c = elimination_instance.rows_c;
+	size_t cols_c = rows_c + (method == spnm::ELIMINATION_GAUSS);
+	for (size_t i = 0; i < elimination_instance.steps_c; i++) {
+		spnm::elimination_s *step = elimination_instance.steps + i;
+
+		printf("%lu\t%lu\t%s\n", step->n, step->pivot, step->pivot_val);
+		for (size_t j = 0; j < rows_c; j++) {
+			for (size_t k = 0; k < cols_c; k++)
+				printf("\t%s", step->snapshot[j * cols_c + k]);
+			printf("\n");
+		}
+	}
+	printf("x");
+	for (size_t i = 0; i < rows_c; i++)
+		printf("\t%s", elimination_instance.x[i]);
+	printf("\n");
+
+	spnm::elimination_free(&elimination_instance);
+}
+
+void
+perform_iterative(spnm::iterative_method_t method, const char *a,
+                  const char *b, const char *initial_point,
+                  const char *relaxation, const char *process,
+                  const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init */
+	spnm::iterative_t iterative_instance =
+		spnm::iterative_init(a, b, initial_point, method, relaxation,
+	                             process_input, atoi(process_n));
+	iterative_instance.red_black = red_black;
+	iterative_instance.threads_c = threads_c;
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::iterative_perform(&iterative_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid system, initial point or relaxation factor, zero on the diagonal or the iteration diverged."
+				<< std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << iterative_instance.log.str() << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output */
+	for (size_t i = 0; i < iterative_instance.steps_c; i++) {
+		spnm::iterative_s *step = iterative_instance.steps + i;
+
+		printf("%lu", step->n);
+		for (size_t j = 0; j < iterative_instance.rows_c; j++)
+			printf("\t%s", step->x_next[j]);
+		printf("\n");
+	}
+
+	spnm::iterative_free(&iterative_instance);
+}
+
+void
+perform_conjugate_gradient(const char *a, const char *b,
+                           const char *initial_point, const char *precond,
+                           const char *process, const char *process_n)
+{
+	/* parse process and preconditioner */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+	spnm::precond_t precond_input;
+	PARSE_PRECOND(precond_input);
+
+	/* init, with the files of A and b marked by '@' and every b_i being 1
+	 * for any other b of a file of A */
+	spnm::conjugate_gradient_t conjugate_gradient_instance;
+	if (*a == '@')
+		conjugate_gradient_instance =
+			spnm::conjugate_gradient_init_file(
+				a + 1, *b == '@' ? b + 1 : NULL, initial_point,
+				precond_input, process_input, atoi(process_n));
+	else
+		conjugate_gradient_instance = spnm::conjugate_gradient_init(
+			a, b, initial_point, precond_input, process_input,
+			atoi(process_n));
+	conjugate_gradient_instance.threads_c = threads_c;
+
+	/* output: n, alpha, beta, ||r|| and ||x|| of every step as it's
+	 * taken */
+	conjugate_gradient_instance.on_step =
+		spnm::conjugate_gradient_write_step;
+	conjugate_gradient_instance.data = &std::cout;
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::conjugate_gradient_perform(
+		     &conjugate_gradient_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid system or initial point or the iteration diverged."
+				<< std::endl
+				<< std::endl;
+			std::cout << conjugate_gradient_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_condition_not_met: {
+			std::cout
+				<< "[ERROR] The matrix isn't symmetric positive definite."
+				<< std::endl;
+		} break;
+		case spnm::err_singular_matrix: {
+			std::cout
+				<< "[ERROR] The preconditioner can't be set up for the matrix."
+				<< std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << conjugate_gradient_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	spnm::conjugate_gradient_free(&conjugate_gradient_instance);
+}
+
+/* == 5 - interpolation == */
+
+void
+perform_interpolation(spnm::interpolation_method_t method, const char *x,
+                      const char *y, const char *at, const char *process,
+                      const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init */
+	spnm::interpolation_t interpolation_instance = spnm::interpolation_init(
+		x, y, at, method, process_input, atoi(process_n));
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::interpolation_perform(&interpolation_instance)) !=
+	    0) {
+		switch (ret) {
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid or repeated points, points not equally spaced or values that aren't finite."
+				<< std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << interpolation_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output: n followed by the column of the table, or the term for
+	 * lagrange, and finally the interpolated y */
+	for (size_t i = 0; i < interpolation_instance.steps_c; i++) {
+		spnm::interpolation_s *step = interpolation_instance.steps + i;
+
+		printf("%lu", step->n);
+		for (size_t j = 0; j < step->vals_c; j++)
+			printf("\t%s", step->vals[j]);
+		printf("\n");
+	}
+	printf("y\t%s\n", interpolation_instance.value);
+
+	spnm::interpolation_free(&interpolation_instance);
+}
+
+void
+perform_spline(spnm::spline_end_t ends, const char *x, const char *y,
+               const char *at, const char *slopes, const char *process,
+               const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init */
+	spnm::spline_t spline_instance = spnm::spline_init(
+		x, y, at, ends, slopes, process_input, atoi(process_n));
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::spline_perform(&spline_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid points or slopes, x not in increasing order or values that aren't finite."
+				<< std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << spline_instance.log.str() << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output: n, a, b, c and d of every segment and finally the
+	 * interpolated y */
+	for (size_t i = 0; i < spline_instance.steps_c; i++) {
+		spnm::spline_s *step = spline_instance.steps + i;
+
+		printf("%lu\t%s\t%s\t%s\t%s\n", step->n, step->a, step->b,
+		       step->c, step->d);
+	}
+	printf("y\t%s\n", spline_instance.value);
+
+	spnm::spline_free(&spline_instance);
+}
+
+/* == 6 - curve fitting == */
+
+void
+perform_fit(spnm::fit_model_t model, const char *x, const char *y,
+            const char *degree, const char *process, const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init, with the file of the points marked by '@' and its format
+	 * given in place of y */
+	spnm::fit_t fit_instance;
+	if (*x == '@') {
+		spnm::fit_format_t format = spnm::FIT_CSV;
+		if (!strcmp(y, "binary")) {
+			format = spnm::FIT_BINARY;
+		} else if (strcmp(y, "csv")) {
+			fprintf(stderr, "[ERROR] Invalid format given.\n");
+			print_usage(stderr);
+		}
+		fit_instance = spnm::fit_init_file(x + 1, format, model,
+		                                   atoi(degree), process_input,
+		                                   atoi(process_n));
+	} else {
+		fit_instance = spnm::fit_init(x, y, model, atoi(degree),
+		                              process_input, atoi(process_n));
+	}
+	fit_instance.threads_c = threads_c;
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::fit_perform(&fit_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid points, file or degree or values that aren't finite."
+				<< std::endl
+				<< std::endl;
+			std::cout << fit_instance.log.str() << std::endl;
+		} break;
+		case spnm::err_singular_matrix: {
+			std::cout
+				<< "[ERROR] Too few distinct x for the degree."
+				<< std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << fit_instance.log.str() << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output: n with the sums of x^(n-1) and of x^(n-1) y while there's
+	 * one, and finally the coefficients */
+	for (size_t i = 0; i < fit_instance.steps_c; i++) {
+		spnm::fit_s *step = fit_instance.steps + i;
+
+		printf("%lu\t%s", step->n, step->sum_x);
+		if (step->sum_xy)
+			printf("\t%s", step->sum_xy);
+		printf("\n");
+	}
+	printf("a");
+	for (size_t i = 0; i < fit_instance.coefs_c; i++)
+		printf("\t%s", fit_instance.coefs[i]);
+	printf("\n");
+
+	spnm::fit_free(&fit_instance);
+}
+
+/* == 7 - numerical differentiation == */
+
+void
+perform_differentiation(spnm::difference_t difference, const char *fx,
+                        const char *x, const char *h,
+                        const char *extrapolation, const char *process,
+                        const char *process_n)
+{
+	/* parse process and extrapolation */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+	spnm::extrapolation_t extrapolation_input;
+	PARSE_EXTRAPOLATION(extrapolation_input);
+
+	/* init */
+	spnm::differentiation_t differentiation_instance =
+		spnm::differentiation_init(fx, x, h, difference,
+	                                   extrapolation_input, process_input,
+	                                   atoi(process_n));
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::differentiation_perform(
+		     &differentiation_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_fx_parse: {
+			std::cout << "[ERROR] Invalid function input."
+				  << std::endl
+				  << std::endl;
+			std::cout << differentiation_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid point or step size or the function isn't finite around the point."
+				<< std::endl
+				<< std::endl;
+			std::cout << differentiation_instance.log.str()
+				  << std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << differentiation_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output, the row of the table in place of the derivative for
+	 * richardson */
+	for (size_t i = 0; i < differentiation_instance.steps_c; i++) {
+		spnm::differentiation_s *step =
+			differentiation_instance.steps + i;
+		printf("%lu\t%s", step->n, step->h);
+		if (extrapolation_input != spnm::EXTRAPOLATION_RICHARDSON) {
+			printf("\t%s\n", step->derivative);
+			continue;
+		}
+		for (size_t j = 0; j < step->n; j++)
+			printf("\t%s", step->richardson[j]);
+		printf("\n");
+	}
+
+	spnm::differentiation_free(&differentiation_instance);
+}
+
+/* == 8 - eigenvalues == */
+
+void
+perform_power_iteration(spnm::power_method_t method, const char *a,
+                        const char *initial_vector, const char *shift,
+                        const char *process, const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init */
+	spnm::power_iteration_t power_iteration_instance =
+		spnm::power_iteration_init(a, initial_vector, method, shift,
+	                                   process_input, atoi(process_n));
+	power_iteration_instance.threads_c = threads_c;
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::power_iteration_perform(
+		     &power_iteration_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_x_input: {
+			std::cout
+				<< "[ERROR] Invalid or non-square matrix, initial vector or shift or the iteration diverged."
+				<< std::endl;
+		} break;
+		case spnm::err_singular_matrix: {
+			std::cout
+				<< "[ERROR] The shifted matrix is singular, the shift being an eigenvalue."
+				<< std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many steps required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << power_iteration_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output: n and the eigenvalue followed by x_(n+1) */
+	for (size_t i = 0; i < power_iteration_instance.steps_c; i++) {
+		spnm::power_iteration_s *step =
+			power_iteration_instance.steps + i;
+
+		printf("%lu\t%s", step->n, step->eigenvalue);
+		for (size_t j = 0; j < power_iteration_instance.rows_c; j++)
+			printf("\t%s", step->x_next[j]);
+		printf("\n");
+	}
+
+	spnm::power_iteration_free(&power_iteration_instance);
+}
+
+void
+perform_qr_algorithm(const char *a, const char *process,
+                     const char *process_n)
+{
+	/* parse process */
+	spnm::process_t process_input;
+	PARSE_PROCESS(process_input);
+
+	/* init */
+	spnm::qr_algorithm_t qr_algorithm_instance =
+		spnm::qr_algorithm_init(a, process_input, atoi(process_n));
+	qr_algorithm_instance.threads_c = threads_c;
+
+	/* perform the process */
+	int ret;
+	if ((ret = spnm::qr_algorithm_perform(&qr_algorithm_instance)) != 0) {
+		switch (ret) {
+		case spnm::err_x_input: {
+			std::cout << "[ERROR] Invalid or non-square matrix."
+				  << std::endl;
+		} break;
+		case spnm::err_steps_max: {
+			std::cout << "[ERROR] Too many sweeps required."
+				  << std::endl;
+		} break;
+		default:
+			std::cout << "[ERROR] Unknown error." << std::endl
+				  << std::endl;
+			std::cout << qr_algorithm_instance.log.str()
+				  << std::endl;
+		}
+		exit(EXIT_FAILURE);
+	}
+
+	/* output: n, rows of the active block and its last subdiagonal entry
+	 * followed by the real and the imaginary parts of the eigenvalues */
+	for (size_t i = 0; i < qr_algorithm_instance.steps_c; i++) {
+		spnm::qr_algorithm_s *step = qr_algorithm_instance.steps + i;
+
+		printf("%lu\t%lu\t%s\n", step->n, step->active,
+		       step->subdiagonal);
+	}
+	printf("re");
+	for (size_t i = 0; i < qr_algorithm_instance.rows_c; i++)
+		printf("\t%s", qr_algorithm_instance.re[i]);
+	printf("\nim");
+	for (size_t i = 0; i < qr_algorithm_instance.rows_c; i++)
+		printf("\t%s", qr_algorithm_instance.im[i]);
+	printf("\n");
+
+	spnm::qr_algorithm_free(&qr_algorithm_instance);
+}
+
+/* = CORE = */
+
+void
+print_usage(FILE *stream)
+{
+	int exit_code = EXIT_SUCCESS;
+	if (stream == stderr)
+		exit_code = EXIT_FAILURE;
+
+	fprintf(stream, USAGE_STR);
+	spl_flag_print_help(stream);
+	exit(exit_code);
+}
+
+size_t
+split_list(char *list, char **out, size_t max)
+{
+	size_t out_c = 0;
+
+	for (char *item = list; item; out_c++) {
+		char *sep = strchr(item, ';');
+		if (sep)
+			*(sep++) = '\0';
+
+		/* trim */
+		while (*item == ' ')
+			item++;
+		char *end = item + strlen(item);
+		while (end > item && *(end - 1) == ' ')
+			*(--end) = '\0';
+
+		if (out_c < max)
+			out[out_c] = item;
+		item = sep;
+	}
+
+	return out_c;
+}
+
+int
+main(int argc, char **argv)
+{
+	prog = argv[0];
+
+	/* = FLAGS = */
+
+	/* initialize values on flags */
+	int to_print_help = 0;
+
+	/* set flags */
+	spl_flag_toggle(&to_print_help, 'h', "help", "Print the help message");
+	spl_flag_int(&threads_c, 'j', "threads",
+	             "Threads of the large solves, 0 for all cores");
+	spl_flag_int(&deadline_ms, 'd', "deadline",
+	             "Time limit of the adaptive integrations in ms, 0 for none");
+	spl_flag_toggle(&red_black, 'r', "red-black",
+	                "Red-black ordering of gauss-seidel and SOR");
+
+	spl_flag_info f_info = spl_flag_parse(argc, argv);
+
+	/* printing any gotchas in parsing */
+	if (spl_flag_print_gotchas(f_info, stderr))
+		exit(EXIT_FAILURE);
+
+	/* check if -h flag was passed */
+	if (to_print_help)
+		print_usage(stdout);
+
+	/* = ARGUMENT PARSING = */
+
+	if (f_info.non_flag_arguments_c < 3)
+		print_usage(stderr);
+
+	char *topic   = f_info.non_flag_arguments[0];
+	char *process = f_info.non_flag_arguments[1];
+	char *input1  = f_info.non_flag_arguments[2];
+	char *input2  = f_info.non_flag_arguments[3];
+	char *input3  = f_info.non_flag_arguments[4];
+	char *input4  = f_info.non_flag_arguments[5];
+	char *input5  = f_info.non_flag_arguments[6];
+
+	/* = TOPIC SELECTION = */
+
+	/* Solution of Nonlinear Equations */
+	if (!strcmp(topic, "solution_of_nonlinear_equations") ||
+	    !strcmp(topic, "1")) {
+		if (!strcmp(process, "bisection") || !strcmp(process, "1")) {
+			if (f_info.non_flag_arguments_c < (2 + 5))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 5);
+
+			perform_bisection(input1, input2, input3, input4,
+			                  input5);
+
+			exit(EXIT_SUCCESS);
 		}
 
 		if (!strcmp(process, "secant") || !strcmp(process, "2")) {
@@ -310,6 +1826,280 @@ main(int argc, char **argv)
 
 			exit(EXIT_SUCCESS);
 		}
+
+		if (!strcmp(process, "fixed_point") || !strcmp(process, "3")) {
+			if (f_info.non_flag_arguments_c < (2 + 5))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 5);
+
+			perform_fixed_point(input1, input2, input3, input4,
+			                    input5);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		if (!strcmp(process, "newton_system") || !strcmp(process, "4")) {
+			if (f_info.non_flag_arguments_c < (2 + 5))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 5);
+
+			perform_newton_system(input1, input2, input3, input4,
+			                      input5);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		if (!strcmp(process, "newton_krylov") || !strcmp(process, "5")) {
+			if (f_info.non_flag_arguments_c < (2 + 8))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 8);
+
+			perform_newton_krylov(
+				input1, input2, input3, input4, input5,
+				f_info.non_flag_arguments[7],
+				f_info.non_flag_arguments[8],
+				f_info.non_flag_arguments[9]);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		if (!strcmp(process, "sweep") || !strcmp(process, "6")) {
+			if (f_info.non_flag_arguments_c < (2 + 8))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 8);
+
+			perform_sweep(input1, input2, input3, input4, input5,
+			              f_info.non_flag_arguments[7],
+			              f_info.non_flag_arguments[8],
+			              f_info.non_flag_arguments[9]);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		if (!strcmp(process, "isolate") || !strcmp(process, "7")) {
+			if (f_info.non_flag_arguments_c < (2 + 6))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 6);
+
+			perform_isolate(input1, input2, input3, input4, input5,
+			                f_info.non_flag_arguments[7]);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		if (!strcmp(process, "polynomial_roots") ||
+		    !strcmp(process, "8")) {
+			if (f_info.non_flag_arguments_c < (2 + 3))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 3);
+
+			perform_polynomial_roots(input1, input2, input3);
+
+			exit(EXIT_SUCCESS);
+		}
+	}
+
+	/* Numerical Integration */
+	if (!strcmp(topic, "numerical_integration") || !strcmp(topic, "2")) {
+		if (!strcmp(process, "gauss_kronrod") || !strcmp(process, "5")) {
+			if (f_info.non_flag_arguments_c < (2 + 6))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 6);
+
+			perform_gauss_kronrod(input1, input2, input3, input4,
+			                      input5,
+			                      f_info.non_flag_arguments[7]);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		spnm::quadrature_t rule;
+		PARSE_RULE(rule);
+
+		if (f_info.non_flag_arguments_c < (2 + 5))
+			print_usage(stderr);
+		spl_flag_warn_ignored_args(f_info, stderr, 2 + 5);
+
+		perform_integration(rule, input1, input2, input3, input4, input5);
+
+		exit(EXIT_SUCCESS);
+	}
+
+	/* Ordinary Differential Equations */
+	if (!strcmp(topic, "ordinary_differential_equations") ||
+	    !strcmp(topic, "3")) {
+		spnm::ode_method_t method;
+		PARSE_ODE_METHOD(method);
+
+		/* only rk45 takes a tolerance */
+		int inputs_c = method == spnm::ODE_RK45 ? 8 : 7;
+		if (f_info.non_flag_arguments_c < (2 + inputs_c))
+			print_usage(stderr);
+		spl_flag_warn_ignored_args(f_info, stderr, 2 + inputs_c);
+
+		char **inputs = f_info.non_flag_arguments + 2;
+		if (method == spnm::ODE_RK45)
+			perform_ode(method, inputs[0], inputs[1], inputs[2],
+			            inputs[3], inputs[4], inputs[5], inputs[6],
+			            inputs[7]);
+		else
+			perform_ode(method, inputs[0], inputs[1], inputs[2],
+			            inputs[3], inputs[4], "0", inputs[5],
+			            inputs[6]);
+
+		exit(EXIT_SUCCESS);
+	}
+
+	/* Linear Systems */
+	if (!strcmp(topic, "linear_systems") || !strcmp(topic, "4")) {
+		if (!strcmp(process, "conjugate_gradient") ||
+		    !strcmp(process, "6")) {
+			if (f_info.non_flag_arguments_c < (2 + 6))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 6);
+
+			perform_conjugate_gradient(
+				input1, input2, input3, input4, input5,
+				f_info.non_flag_arguments[7]);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		if (strcmp(process, "gauss") && strcmp(process, "1") &&
+		    strcmp(process, "lu") && strcmp(process, "2")) {
+			spnm::iterative_method_t method;
+			PARSE_ITERATIVE_METHOD(method);
+
+			/* only sor takes a relaxation factor */
+			int inputs_c = method == spnm::ITERATIVE_SOR ? 6 : 5;
+			if (f_info.non_flag_arguments_c < (2 + inputs_c))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr,
+			                           2 + inputs_c);
+
+			if (method == spnm::ITERATIVE_SOR)
+				perform_iterative(method, input1, input2,
+				                  input3, input4, input5,
+				                  f_info.non_flag_arguments[7]);
+			else
+				perform_iterative(method, input1, input2,
+				                  input3, NULL, input4, input5);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		spnm::elimination_method_t method;
+		PARSE_ELIMINATION_METHOD(method);
+
+		if (f_info.non_flag_arguments_c < (2 + 4))
+			print_usage(stderr);
+		spl_flag_warn_ignored_args(f_info, stderr, 2 + 4);
+
+		perform_elimination(method, input1, input2, input3, input4);
+
+		exit(EXIT_SUCCESS);
+	}
+
+	/* Interpolation */
+	if (!strcmp(topic, "interpolation") || !strcmp(topic, "5")) {
+		if (!strcmp(process, "natural_spline") ||
+		    !strcmp(process, "5")) {
+			if (f_info.non_flag_arguments_c < (2 + 5))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 5);
+
+			perform_spline(spnm::SPLINE_NATURAL, input1, input2,
+			               input3, NULL, input4, input5);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		if (!strcmp(process, "clamped_spline") ||
+		    !strcmp(process, "6")) {
+			if (f_info.non_flag_arguments_c < (2 + 6))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 6);
+
+			perform_spline(spnm::SPLINE_CLAMPED, input1, input2,
+			               input3, input4, input5,
+			               f_info.non_flag_arguments[7]);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		spnm::interpolation_method_t method;
+		PARSE_INTERPOLATION_METHOD(method);
+
+		if (f_info.non_flag_arguments_c < (2 + 5))
+			print_usage(stderr);
+		spl_flag_warn_ignored_args(f_info, stderr, 2 + 5);
+
+		perform_interpolation(method, input1, input2, input3, input4,
+		                      input5);
+
+		exit(EXIT_SUCCESS);
+	}
+
+	/* Curve Fitting */
+	if (!strcmp(topic, "curve_fitting") || !strcmp(topic, "6")) {
+		spnm::fit_model_t model;
+		PARSE_FIT_MODEL(model);
+
+		/* only a polynomial takes a degree */
+		int inputs_c = model == spnm::FIT_POLYNOMIAL ? 5 : 4;
+		if (f_info.non_flag_arguments_c < (2 + inputs_c))
+			print_usage(stderr);
+		spl_flag_warn_ignored_args(f_info, stderr, 2 + inputs_c);
+
+		if (model == spnm::FIT_POLYNOMIAL)
+			perform_fit(model, input1, input2, input3, input4,
+			            input5);
+		else
+			perform_fit(model, input1, input2, "1", input3, input4);
+
+		exit(EXIT_SUCCESS);
+	}
+
+	/* Numerical Differentiation */
+	if (!strcmp(topic, "numerical_differentiation") ||
+	    !strcmp(topic, "7")) {
+		spnm::difference_t difference;
+		PARSE_DIFFERENCE(difference);
+
+		if (f_info.non_flag_arguments_c < (2 + 6))
+			print_usage(stderr);
+		spl_flag_warn_ignored_args(f_info, stderr, 2 + 6);
+
+		perform_differentiation(difference, input1, input2, input3,
+		                        input4, input5,
+		                        f_info.non_flag_arguments[7]);
+
+		exit(EXIT_SUCCESS);
+	}
+
+	/* Eigenvalues */
+	if (!strcmp(topic, "eigenvalues") || !strcmp(topic, "8")) {
+		if (!strcmp(process, "qr") || !strcmp(process, "3")) {
+			if (f_info.non_flag_arguments_c < (2 + 3))
+				print_usage(stderr);
+			spl_flag_warn_ignored_args(f_info, stderr, 2 + 3);
+
+			perform_qr_algorithm(input1, input2, input3);
+
+			exit(EXIT_SUCCESS);
+		}
+
+		spnm::power_method_t method;
+		PARSE_POWER_METHOD(method);
+
+		if (f_info.non_flag_arguments_c < (2 + 5))
+			print_usage(stderr);
+		spl_flag_warn_ignored_args(f_info, stderr, 2 + 5);
+
+		perform_power_iteration(method, input1, input2, input3, input4,
+		                        input5);
+
+		exit(EXIT_SUCCESS);
 	}
 
 	/* = EXIT = */
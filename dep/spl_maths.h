@@ -95,7 +95,8 @@ spl_maths_roundoff_signi_str(char *input, size_t n);
 int
 spl_maths_is_equal_deci_str(const char *input1, const char *input2, size_t n);
 
-/* Returns 1 if the two inputs are equal up to `n` significant digits. */
+/* Returns 1 if the two inputs have integer parts as long and are equal up to
+ * `n` significant digits. */
 int
 spl_maths_is_equal_signi_str(const char *input1, const char *input2, size_t n);
 
@@ -153,8 +154,9 @@ spl_maths_roundoff_int_str(char *input, size_t n)
 
 done:
 	if (round_c != 0) {
-		char rounded_digit_str[n];
-		sprintf(rounded_digit_str, "%d", rounded_digit);
+		char rounded_digit_str[32];
+		snprintf(rounded_digit_str, sizeof(rounded_digit_str), "%d",
+		         rounded_digit);
 		strncpy(input + (n - 1) - round_c + 1, rounded_digit_str,
 		        round_c);
 	}
@@ -179,6 +181,26 @@ spl_maths_roundoff_deci_str(char *input, size_t n)
 	if (deci_c <= n)
 		return;
 
+	/* carrying over to the integer part as in 1.9999 -> 2.0, which
+	 * `spl_maths_roundoff_int_str()` can't see */
+	if (strspn(dot + 1, "9") >= n && *(dot + n + 1) >= '5') {
+		*(dot + 1) = '0';
+		*(dot + 2) = '\0';
+
+		char *p = dot - 1;
+		while (p >= input && *p == '9')
+			*(p--) = '0';
+		if (p >= input && *p != '-') {
+			(*p)++;
+		} else {
+			/* one more integer digit, room taken from the chopped
+			 * decimals */
+			memmove(p + 2, p + 1, strlen(p + 1) + 1);
+			*(p + 1) = '1';
+		}
+		return;
+	}
+
 	int round_c = spl_maths_roundoff_int_str(dot + 1, n);
 
 	/* trim trailing 0's */
@@ -200,51 +222,98 @@ spl_maths_roundoff_signi_str(char *input, size_t n)
 	if (*input == '-')
 		integer_c--;
 
-	/* rounding off just the integer digits */
-	if (n == integer_c) {
-		/* it's just easier to remove the dot and shift all following
-		 * digits */
-		for (; *dot != '\0'; dot++) {
-			*dot = *(dot + 1);
-			spl_maths_roundoff_int_str(input, n);
+	/* rounding off just the integer digits, those rounded off being 0's
+	 * as in 12345.6 to 2 digits being 12000.0, and dropping the decimals */
+	if (n <= integer_c) {
+		size_t len    = strlen(input);
+		char  *digits = input + (*input == '-');
+		char   next   = n < integer_c ? *(digits + n)
+		                              : (dot ? *(dot + 1) : '\0');
+		int    up = next >= '5' &&
+		         !(next == '5' && (*(digits + n - 1) - '0') % 2 == 0);
+
+		char *p = digits + n - 1;
+		while (up && p >= digits && *p == '9')
+			p--;
+
+		/* no room for one more integer digit without decimals to
+		 * take it from, as in 999 to 2 digits */
+		if (up && p < digits && !dot)
+			return;
+
+		memset(digits + n, '0', integer_c - n);
+		if (up && p >= digits) {
+			(*p)++;
+			memset(p + 1, '0', digits + n - 1 - p);
+		} else if (up) {
+			/* one more integer digit, room taken from the chopped
+			 * decimals as in 99.9 to 1 digit being 100 */
+			*digits = '1';
+			memset(digits + 1, '0', integer_c);
+			integer_c++;
 		}
+
+		*(digits + integer_c) = '\0';
+		if (dot && digits + integer_c + 2 <= input + len)
+			strcat(input, ".0");
+		return;
 	}
 
-	if (n < integer_c)
-		spl_maths_roundoff_int_str(input, n);
-	else
-		spl_maths_roundoff_deci_str(input, n - integer_c);
+	spl_maths_roundoff_deci_str(input, n - integer_c);
 }
 
 /* = COMPARISON = */
 
-/* Returns 1 if the two inputs are equal up to `n` decimal places. */
+/* Returns 1 if the two inputs have the same sign and integer part and are
+ * equal up to `n` decimal places. */
 int
 spl_maths_is_equal_deci_str(const char *input1, const char *input2, size_t n)
 {
-	char *dot_input1 = strchr((char *)input1, '.');
-	char *dot_input2 = strchr((char *)input2, '.');
-
-	/* check if invalid inputs were given */
-	if (!dot_input1 || !dot_input2 || strlen(dot_input1 + 1) < n ||
-	    strlen(dot_input2 + 1) < n)
+	const char *dot_input1 = strchr(input1, '.');
+	const char *dot_input2 = strchr(input2, '.');
+
+	/* the sign and the integer part should match exactly */
+	size_t integer_c1 = dot_input1 ? (size_t)(dot_input1 - input1)
+	                               : strlen(input1);
+	size_t integer_c2 = dot_input2 ? (size_t)(dot_input2 - input2)
+	                               : strlen(input2);
+	if (integer_c1 != integer_c2 || strncmp(input1, input2, integer_c1))
 		return 0;
 
-	for (size_t i = 1; i <= n; i++) {
-		if (*(dot_input1 + i) != *(dot_input2 + i))
+	/* missing decimal digits are 0's as in "2.0" and "2.0000" */
+	const char *deci1 = dot_input1 ? dot_input1 + 1 : "";
+	const char *deci2 = dot_input2 ? dot_input2 + 1 : "";
+	for (size_t i = 0; i < n; i++) {
+		char digit1 = *deci1 ? *(deci1++) : '0';
+		char digit2 = *deci2 ? *(deci2++) : '0';
+		if (digit1 != digit2)
 			return 0;
 	}
 
 	return 1;
 }
 
-/* Returns 1 if the two inputs are equal up to `n` significant digits. */
+/* Returns 1 if the two inputs have integer parts as long and are equal up to
+ * `n` significant digits. */
 int
 spl_maths_is_equal_signi_str(const char *input1, const char *input2, size_t n)
 {
+	/* as in "2.0" and "2.0" which are too short for the check below */
+	if (!strcmp(input1, input2))
+		return 1;
+
 	char *dot_input1 = strchr((char *)input1, '.');
 	char *dot_input2 = strchr((char *)input2, '.');
 
+	/* the integer parts should be as long, as in "1200.0" and "120.0"
+	 * which only share their digits */
+	size_t integer_c1 = dot_input1 ? (size_t)(dot_input1 - input1)
+	                               : strlen(input1);
+	size_t integer_c2 = dot_input2 ? (size_t)(dot_input2 - input2)
+	                               : strlen(input2);
+	if (integer_c1 != integer_c2)
+		return 0;
+
 	size_t len_input1 = strlen(input1);
 	size_t len_input2 = strlen(input2);
 	if (dot_input1)
@@ -0,0 +1,31 @@
+/*
+ ===============================================================================
+ |                         License - GPL-3.0-or-later                          |
+ ===============================================================================
+ *
+ * spnm - C++ Library for Numerical Methods analysis
+ * Copyright (C) 2022  Safal Piya
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * The separately compiled spnm: the only translation unit that sees giac.
+ * Consumers include `spnm.hpp` without defining `SPNM_IMPL` and link with
+ * '-lspnm -lgiac -lgmp'.
+ */
+
+/* spnm - https://github.com/mrsafalpiya/spnm */
+#define SPNM_IMPL
+#include "../spnm.hpp"
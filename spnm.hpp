@@ -62,17 +62,47 @@
  * implementation.
  *
  * - Link with libgiac: '-lgiac -lgmp'
+ *
+ * Or build the separately compiled library in `lib/` and link with it instead:
+ * '-lspnm -lgiac -lgmp'. giac is only ever included in the implementation so
+ * the translation units including this file don't need giac's headers.
+ *
+ * - Link with '-pthread'.
+ */
+
+/*
+ ===============================================================================
+ |                                Thread Safety                                |
+ ===============================================================================
+ *
+ * All functions are reentrant: each solve keeps all of its state in its own
+ * `*_t` so different `*_t` can be used from different threads at the same
+ * time. A single `*_t` must not be used from two threads at once.
+ *
+ * The native evaluator has no shared state. giac isn't documented as thread
+ * safe, so every call into giac is serialized internally; solves falling back
+ * to giac are correct under concurrency but don't scale with threads.
+ *
+ * Solves of large systems (`newton_krylov_t`), parameter sweeps (`sweep_t`),
+ * root isolations (`isolate_t`, `polynomial_roots_t`), adaptive integrations
+ * (`gauss_kronrod_t`),
+ * eliminations (`elimination_t`), iterative linear solves (`iterative_t`,
+ * `conjugate_gradient_t`), evaluations of interpolations and splines
+ * (`interpolation_eval()`, `spline_eval()`), least squares fits (`fit_t`) and
+ * eigenvalues (`power_iteration_t`, `qr_algorithm_t`) also run on threads of
+ * their own, as many as their `threads_c`.
  */
 
 #ifndef SPNM_HPP
 #define SPNM_HPP
 
 #include <cstddef>
+#include <cstdlib>
 #include <string>
+#include <sstream>
 
-/* giac - https://www-fourier.ujf-grenoble.fr/~parisse/giac_us.html */
-#include <giac/config.h>
-#include <giac/giac.h>
+/* spl - https://github.com/mrsafalpiya/spl */
+#include "dep/spl_maths.h"
 
 /*
  ===============================================================================
@@ -97,14 +127,33 @@ namespace spnm
  ===============================================================================
  */
 
-const size_t STEPS_MAX = 100;
-const size_t STR_MAX   = 100;
+const size_t STEPS_MAX   = 100;
+const size_t STR_MAX     = 100;
+const size_t VARS_MAX    = 10; /* variables (and equations) of a system */
+const size_t SWEEP_CHUNK = 64; /* points of a sweep solved one after another */
+const size_t ISOLATE_BOXES_MAX = 1 << 20; /* subintervals of an isolation */
+const size_t POLYNOMIAL_DEGREE_MAX = 64; /* degree of a polynomial of roots */
+const size_t INTEGRATION_STEPS_MAX = 25; /* halvings of h of an integration */
+const size_t GAUSS_KRONROD_ROUND = 1024; /* subintervals refined at once */
+const size_t ELIMINATION_BLOCK = 64; /* columns of an elimination eliminated
+                                        at once without snapshots */
+const size_t DIVERGENCE_STEPS  = 10; /* steps of growing corrections of a
+                                        diverging iterative method */
+const size_t FIT_DEGREE_MAX = 10;      /* degree of a fitted polynomial */
+const size_t FIT_CHUNK      = 1 << 20; /* bytes of a file of points summed
+                                          one after another */
+const size_t FIT_ROUND      = 64;      /* chunks of a file summed at once */
+const size_t DIFFERENTIATION_STEPS_MAX = 20; /* halvings of h of a derivative */
+const size_t QR_SWEEPS_MAX = 30; /* sweeps of a qr algorithm per eigenvalue */
 
 /* = ERRORS = */
 
 const int err_fx_parse          = 1;
 const int err_x_input           = 2;
 const int err_condition_not_met = 3;
+const int err_steps_max         = 4;
+const int err_singular_matrix   = 5;
+const int err_deadline          = 6;
 
 /*
  ===============================================================================
@@ -118,12 +167,255 @@ enum process_t {
 	NO_OF_STEPS,        /* perform n number of steps */
 };
 
+enum accel_t {
+	ACCEL_NONE,       /* plain x_(n+1) = g(x_n) */
+	ACCEL_AITKEN,     /* Aitken's delta squared on the plain iterates */
+	ACCEL_STEFFENSEN, /* restart from the Aitken's iterate on every step */
+};
+
+enum precond_t {
+	PRECOND_NONE,   /* plain iterative solve */
+	PRECOND_JACOBI, /* inverse of the diagonal */
+	PRECOND_ILU0,   /* incomplete LU on the sparsity of the matrix */
+	PRECOND_IC0,    /* incomplete cholesky on the sparsity of the lower
+	                   triangle, for symmetric positive definite
+	                   matrices */
+};
+
+enum enclosure_t {
+	ENCLOSURE_UNIQUE,   /* exactly one root: f is monotone and changes sign */
+	ENCLOSURE_EXISTS,   /* at least one root: f changes sign */
+	ENCLOSURE_POSSIBLE, /* roots not ruled out down to the tolerance, as for
+	                       a root of even multiplicity */
+};
+
+enum sweep_method_t {
+	SWEEP_BISECTION, /* bisection method on every parameter */
+	SWEEP_SECANT,    /* secant method on every parameter */
+};
+
+enum quadrature_t {
+	QUAD_TRAPEZOIDAL, /* trapezoidal rule */
+	QUAD_SIMPSON_13,  /* simpson's 1/3 rule */
+	QUAD_SIMPSON_38,  /* simpson's 3/8 rule */
+	QUAD_ROMBERG,     /* richardson extrapolation of the trapezoidal rule */
+};
+
+enum ode_method_t {
+	ODE_EULER, /* euler's method */
+	ODE_HEUN,  /* heun's method, the improved euler's method */
+	ODE_RK4,   /* classical runge-kutta method of order 4 */
+	ODE_RK45,  /* dormand-prince 5(4) with adaptive step size */
+};
+
+enum elimination_method_t {
+	ELIMINATION_GAUSS, /* gaussian elimination with partial pivoting */
+	ELIMINATION_LU,    /* LU decomposition with partial pivoting */
+};
+
+enum iterative_method_t {
+	ITERATIVE_JACOBI,       /* jacobi's method */
+	ITERATIVE_GAUSS_SEIDEL, /* gauss-seidel method */
+	ITERATIVE_SOR,          /* successive over-relaxation */
+};
+
+enum interpolation_method_t {
+	INTERPOLATION_FORWARD,  /* newton's forward difference formula */
+	INTERPOLATION_BACKWARD, /* newton's backward difference formula */
+	INTERPOLATION_DIVIDED,  /* newton's divided difference formula */
+	INTERPOLATION_LAGRANGE, /* lagrange's interpolation formula */
+};
+
+enum spline_end_t {
+	SPLINE_NATURAL, /* S'' = 0 at both ends */
+	SPLINE_CLAMPED, /* S' given at both ends */
+};
+
+enum fit_model_t {
+	FIT_LINE,        /* y = a_0 + a_1 x */
+	FIT_POLYNOMIAL,  /* y = a_0 + a_1 x + ... + a_m x^m */
+	FIT_EXPONENTIAL, /* y = a e^(b x), by fitting ln y to a line */
+};
+
+enum fit_format_t {
+	FIT_CSV,    /* a point 'x,y' per line, the first line possibly a
+	               header */
+	FIT_BINARY, /* x and y of every point as native doubles one after
+	               another */
+};
+
+enum difference_t {
+	DIFFERENCE_FORWARD,  /* (f(x + h) - f(x)) / h */
+	DIFFERENCE_BACKWARD, /* (f(x) - f(x - h)) / h */
+	DIFFERENCE_CENTRAL,  /* (f(x + h) - f(x - h)) / 2h */
+};
+
+enum extrapolation_t {
+	EXTRAPOLATION_NONE,       /* plain differences */
+	EXTRAPOLATION_RICHARDSON, /* richardson's extrapolation of the
+	                             differences to h = 0 */
+};
+
+enum power_method_t {
+	POWER_DIRECT,  /* power method on A - s I, for the eigenvalue of A
+	                  farthest from the shift s */
+	POWER_INVERSE, /* inverse iteration on A - s I, for the eigenvalue of
+	                  A nearest to the shift s */
+};
+
 /*
  ===============================================================================
  |                                   Structs                                   |
  ===============================================================================
  */
 
+/* = CORE = */
+
+/* Parsed f(x) ready to be evaluated. Opaque to keep the evaluation backend
+ * (giac) out of this header. */
+struct fx_t;
+
+/* Parsed system of f_i(x_1, ..., x_n) along with its Jacobian. Opaque like
+ * `fx_t`. */
+struct fxs_t;
+
+/* Parsed stencil of a large sparse system along with the sparsity of its
+ * Jacobian. Opaque like `fx_t`. */
+struct sparse_fx_t;
+
+/* Linear system A x = b with A in compressed sparse rows. Opaque like
+ * `fx_t`. */
+struct sparse_system_t;
+
+/* Counters of the shadow mode, see `shadow_set_rate()`. */
+struct shadow_stats_t {
+	size_t solves;      /* number of shadowed solves */
+	size_t evals;       /* number of shadowed f(x) evaluations */
+	size_t divergences; /* evaluations where native and giac differ */
+};
+
+/*
+ * Input range over the steps of a solve.
+ *
+ * A step is only computed (by `STEP`) when the iteration reaches it, so the
+ * consumer can stop early, resume later or interleave several solves on a
+ * single thread. Already computed steps are never recomputed.
+ *
+ * Iteration stops on the process being done or on an error, in which case the
+ * error code is stored in `err`.
+ */
+template <typename T, typename S, int (*STEP)(T *)> struct steps_range {
+	T  *t;
+	int err; /* 0 or the error code of the last computed step */
+
+	struct iterator {
+		steps_range *r;
+		size_t       i;
+
+		const S &
+		operator*() const
+		{
+			return r->t->steps[i];
+		}
+
+		iterator &
+		operator++()
+		{
+			i++;
+			return *this;
+		}
+
+		bool
+		operator!=(const iterator &) const
+		{
+			/* compute the step only when asked for */
+			while (i >= r->t->steps_c) {
+				if (r->err || r->t->done)
+					return false;
+				r->err = STEP(r->t);
+			}
+			return true;
+		}
+	};
+
+	iterator
+	begin()
+	{
+		return { this, 0 };
+	}
+
+	iterator
+	end()
+	{
+		return { this, 0 };
+	}
+};
+
+/*
+ ===============================================================================
+ |                              Process Policies                               |
+ ===============================================================================
+ *
+ * A process policy decides how the values of a step are rounded off and when
+ * the process is done. The solvers are specialized on it at compile time so
+ * that `process_t` is only dispatched once per solve.
+ *
+ * A custom policy can be given to the templated solvers and needs:
+ *
+ *         static void manip(char *var, size_t process_n);
+ *         static int  is_done(const char *cur, const char *prev,
+ *                             size_t process_n, size_t steps_c);
+ *
+ * where `manip()` rounds off `var` in place and `is_done()` returns 1 if the
+ * process is complete with `cur` being the latest result after `steps_c` steps
+ * and `prev` the one before it.
+ */
+
+/* correct upto n decimal places */
+struct decimal_places_policy {
+	static void
+	manip(char *var, size_t process_n)
+	{
+		spl_maths_roundoff_deci_str(var, process_n + 1);
+	}
+
+	static int
+	is_done(const char *cur, const char *prev, size_t process_n, size_t)
+	{
+		return spl_maths_is_equal_deci_str(cur, prev, process_n);
+	}
+};
+
+/* correct upto n significant digits */
+struct significant_digits_policy {
+	static void
+	manip(char *var, size_t process_n)
+	{
+		spl_maths_roundoff_signi_str(var, process_n + 1);
+	}
+
+	static int
+	is_done(const char *cur, const char *prev, size_t process_n, size_t)
+	{
+		return spl_maths_is_equal_signi_str(cur, prev, process_n);
+	}
+};
+
+/* perform n number of steps */
+struct no_of_steps_policy {
+	static void
+	manip(char *var, size_t)
+	{
+		spl_maths_roundoff_deci_str(var, 6);
+	}
+
+	static int
+	is_done(const char *, const char *, size_t process_n, size_t steps_c)
+	{
+		return steps_c == process_n;
+	}
+};
+
 /* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
 
 /* == 1. bisection method == */
@@ -151,6 +443,14 @@ struct bisection_t {
 	size_t      steps_c; /* number of steps required for the process */
 	bisection_s steps[STEPS_MAX]; /* array of all steps required */
 	std::stringstream log;        /* output log */
+
+	/* === state === */
+	fx_t *f;       /* parsed f(x) */
+	char *a_n;     /* a_n of the next step */
+	char *b_n;     /* b_n of the next step */
+	char  fa_sign; /* sign of f(a_n) of the next step */
+	char  fb_sign; /* sign of f(b_n) of the next step */
+	int   done;    /* 1 if the process is complete */
 };
 
 /* == 2. secant method == */
@@ -178,567 +478,13490 @@ struct secant_t {
 	size_t   steps_c; /* number of steps required for the process */
 	secant_s steps[STEPS_MAX]; /* array of all steps required */
 	std::stringstream log;     /* output log */
+
+	/* === state === */
+	fx_t *f;       /* parsed f(x) */
+	char *x_prev;  /* x_(n-1) of the next step */
+	char *fx_prev; /* f(x_(n-1)) of the next step */
+	char *x_n;     /* x_n of the next step */
+	char *fx_n;    /* f(x_n) of the next step */
+	int   done;    /* 1 if the process is complete */
 };
 
-/*
- ===============================================================================
- |                            Function Declarations                            |
- ===============================================================================
- */
+/* == 3. fixed point iteration == */
+
+/* === fixed point step === */
+struct fixed_point_s {
+	size_t n;      /* step number */
+	char  *x_n;    /* string representation of x_n */
+	char  *gx_n;   /* string representation of g(x_n) */
+	char  *ggx_n;  /* string representation of g(g(x_n)), NULL for
+	                  ACCEL_NONE */
+	char  *x_next; /* string representation of the result of the step:
+	                  g(x_n) for ACCEL_NONE, the accelerated iterate
+	                  otherwise */
+};
 
-/* = CORE = */
+struct fixed_point_t {
+	/* === input === */
+	char     *gx;            /* input function g(x) of x = g(x) */
+	char     *initial_point; /* initial point */
+	process_t process;       /* how to perform the calculation */
+	size_t    process_n;     /* degree of n for the given process */
+	accel_t   accel;         /* acceleration of the iteration */
 
-/*
- * Initializes any prerequisites to use the library.
- *
- * Should be called before calling any other functions.
- *
- * Can be called multiple times.
- *
- * Returns 0 on error.
- */
-int
-init(void);
+	/* === output === */
+	size_t        steps_c; /* number of steps required for the process */
+	fixed_point_s steps[STEPS_MAX]; /* array of all steps required */
+	std::stringstream log;          /* output log */
+
+	/* === state === */
+	fx_t *f;    /* parsed g(x) */
+	char *x_n;  /* x_n of the next step */
+	int   done; /* 1 if the process is complete */
+};
 
-/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+/* == 4. newton's method for systems == */
 
-/* == 1. bisection method == */
+/* === newton system step === */
+struct newton_system_s {
+	size_t n;                /* step number */
+	char  *x_n[VARS_MAX];    /* string representations of x_n */
+	char  *fx_n[VARS_MAX];   /* string representations of f_i(x_n) */
+	char  *x_next[VARS_MAX]; /* string representations of x_(n+1) */
+};
 
-/*
- * Initializes a 'bisection_t' with the required values for the given options in
- * argument.
- *
- * Returns the initialized 'bisection_t'.
- */
-bisection_t
-bisection_init(const char *fx, const char *interval_lower,
-               const char *interval_upper, process_t process, size_t process_n);
+struct newton_system_t {
+	/* === input === */
+	char     *fx[VARS_MAX];   /* input functions f_i of f_i(x) = 0 */
+	char     *vars[VARS_MAX]; /* names of the variables */
+	char     *initial_point[VARS_MAX]; /* initial value of the variables */
+	size_t    vars_c;    /* number of variables and of equations */
+	process_t process;   /* how to perform the calculation */
+	size_t    process_n; /* degree of n for the given process */
 
-/*
- * Performs the bisection calculation for the given inputs in `t`.
- *
- * Returns 0 on success and an error code on failure. The error codes can be:
- * - err_fx_parse: Invalid input in f(x).
- * - err_x_input: Invalid inputs in interval.
- * - err_condition_not_met: f(a).f(b) > 0
- */
-int
-bisection_perform(bisection_t *t);
+	/* === output === */
+	size_t            steps_c; /* number of steps required for the process */
+	newton_system_s   steps[STEPS_MAX]; /* array of all steps required */
+	std::stringstream log;              /* output log */
+
+	/* === state === */
+	fxs_t *f;             /* parsed system */
+	char  *x_n[VARS_MAX]; /* x_n of the next step */
+	int    done;          /* 1 if the process is complete */
+};
 
-/* Free's dynamically allocated resources from the struct. */
-void
-bisection_free(bisection_t *t);
+/* == 5. newton-krylov method == */
+
+/* === newton-krylov step === */
+struct newton_krylov_s {
+	size_t n;             /* step number */
+	char  *residual_norm; /* string representation of ||f(x_n)|| */
+	size_t linear_iterations_c;  /* iterations of the linear solve */
+	char  *linear_residual_norm; /* string representation of the
+	                                ||J dx + f(x_n)|| it ended with */
+	char  *x_norm; /* string representation of ||x_(n+1)||, by which the
+	                  process is done */
+};
 
-/* == 2. secant method == */
+struct newton_krylov_t {
+	/* === input === */
+	char     *fx;                /* residual f_i of f_i(x) = 0 for every i */
+	char     *vars[VARS_MAX];    /* names of x_(i + offset) in `fx` */
+	int       offsets[VARS_MAX]; /* offsets of the variables */
+	size_t    vars_c;            /* number of variables */
+	size_t    unknowns_c;        /* number of unknowns x_1, ..., x_n */
+	char     *boundary_lower;    /* value of x_i for i < 1 */
+	char     *boundary_upper;    /* value of x_i for i > n */
+	char     *initial_point;     /* initial value of every unknown */
+	precond_t precond;           /* preconditioner of the linear solves */
+	process_t process;           /* how to perform the calculation */
+	size_t    process_n;         /* degree of n for the given process */
+	size_t    threads_c;         /* threads to use, 0 for all cores */
 
-/*
- * Initializes a 'secant_t' with the required values for the given options in
- * argument.
- *
- * Returns the initialized 'secant_t'.
- */
-secant_t
-secant_init(const char *fx, const char *initial_point1,
-            const char *initial_point2, process_t process, size_t process_n);
+	/* === output === */
+	size_t            steps_c; /* number of steps required for the process */
+	newton_krylov_s   steps[STEPS_MAX]; /* array of all steps required */
+	std::stringstream log;              /* output log */
+	double           *x;                /* the unknowns, x_(n+1) of the
+	                                       last step */
+
+	/* === state === */
+	sparse_fx_t *f;    /* parsed stencil */
+	int          done; /* 1 if the process is complete */
+};
 
-/*
- * Performs the secant calculation for the given inputs in `t`.
- *
- * Returns 0 on success and an error code on failure. The error codes can be:
- * - err_fx_parse: Invalid input in f(x).
- * - err_x_input: Invalid inputs in initial point.
- */
-int
-secant_perform(secant_t *t);
+/* == 6. parameter sweep == */
 
-/* Free's dynamically allocated resources from the struct. */
-void
-secant_free(secant_t *t);
+/* === sweep point === */
+struct sweep_s {
+	char  *p;       /* string representation of the parameter */
+	char  *root;    /* string representation of the root, NULL on error */
+	size_t steps_c; /* steps of the solves of the point, including a failed
+	                   warm start */
+	int    is_warm; /* 1 if started from the roots of the previous points */
+	int    err;     /* error of the solve, 0 on success */
+};
 
-} /* namespace spnm */
+struct sweep_t {
+	/* === input === */
+	char          *fx;          /* input function of x and the parameter */
+	char          *param;       /* name of the parameter in `fx` */
+	char          *param_lower; /* first parameter of the sweep */
+	char          *param_upper; /* last parameter of the sweep */
+	size_t         points_c;    /* number of parameters, evenly spaced */
+	sweep_method_t method;      /* method of every solve */
+	char          *input1;      /* interval lower or first initial point */
+	char          *input2;      /* interval upper or second initial point */
+	process_t      process;     /* how to perform every solve */
+	size_t         process_n;   /* degree of n for the given process */
+	int            warm_start;  /* 1 to start from the previous roots */
+	size_t         threads_c;   /* threads to use, 0 for all cores */
 
-/*
- ===============================================================================
- |                                    Utils                                    |
- ===============================================================================
- */
+	/* === output === */
+	sweep_s          *points; /* `points_c` points of the sweep */
+	std::stringstream log;    /* output log */
 
-namespace spnm_utils
-{
+	/* === state === */
+	fx_t *f; /* parsed f(x; p) */
+};
 
-/* = STRING = */
+/* == 7. root isolation == */
 
-char *
-strdup(const char *str);
+/* === root enclosure === */
+struct isolate_s {
+	char        *lower; /* string representation of the lower bound */
+	char        *upper; /* string representation of the upper bound */
+	enclosure_t  kind;  /* what is known of the roots in [lower, upper] */
+	bisection_t *bisection; /* bisection method on [lower, upper] when f
+	                           changes sign, NULL otherwise */
+	int          err;       /* error of the bisection, 0 on success */
+};
 
-/* = GIAC = */
+struct isolate_t {
+	/* === input === */
+	char     *fx;             /* input function */
+	char     *interval_lower; /* lower interval */
+	char     *interval_upper; /* upper interval */
+	char     *tolerance; /* width below which subintervals aren't split */
+	process_t process;   /* how to perform the bisections */
+	size_t    process_n; /* degree of n for the given process */
+	size_t    threads_c; /* threads to use, 0 for all cores */
 
-/* Returns 0 on error. */
-int
-giac_fx_parse(const char *fx, giac::context *ct);
+	/* === output === */
+	size_t            enclosures_c; /* number of root enclosures */
+	isolate_s        *enclosures;   /* enclosures in increasing order */
+	size_t            boxes_c;      /* subintervals examined */
+	std::stringstream log;          /* output log */
 
-/* Returns an empty string "" on error. */
-std::string
-giac_fx_val_string(const char *x, giac::context *ct);
+	/* === state === */
+	fx_t *f; /* parsed f(x) */
+};
 
-/* Returns NaN on error. */
-double
-giac_fx_val_double(const char *x, giac::context *ct);
+/* == 8. polynomial roots == */
 
-/* Returns '*' on error. */
-char
-giac_fx_val_sign(const char *x, giac::context *ct);
+struct polynomial_roots_t {
+	/* === input === */
+	char     *fx;        /* input polynomial */
+	process_t process;   /* how to perform the bisections */
+	size_t    process_n; /* degree of n for the given process */
+	size_t    threads_c; /* threads to use, 0 for all cores */
 
-/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+	/* === output === */
+	size_t            degree;       /* degree of f */
+	size_t            sequence_c;   /* polynomials of the sturm sequence */
+	char             *square_free;  /* f over the gcd of f and f', of the
+	                                   same roots all simple, NULL if f has
+	                                   no multiple root */
+	size_t            enclosures_c; /* number of distinct real roots */
+	isolate_s        *enclosures;   /* enclosures in increasing order */
+	size_t            boxes_c;      /* subintervals examined */
+	std::stringstream log;          /* output log */
+
+	/* === state === */
+	fx_t *f; /* parsed f(x) */
+};
 
-/* == 1. bisection == */
+/* = 2 - NUMERICAL INTEGRATION = */
+
+/* == 1. newton-cotes and romberg == */
+
+/* === integration step === */
+struct integration_s {
+	size_t n;           /* step number */
+	size_t intervals_c; /* number of subintervals */
+	char  *h;           /* string representation of the width of a
+	                       subinterval */
+	char  *integral;    /* string representation of the integral */
+	char  *romberg[INTEGRATION_STEPS_MAX]; /* string representations of
+	                                          R(n-1, 0), ..., R(n-1, n-1)
+	                                          for QUAD_ROMBERG, NULL
+	                                          otherwise */
+};
 
-/* Returns an empty string "" on error. */
-std::string
-bisection_get_c(const char *a, const char *b);
+struct integration_t {
+	/* === input === */
+	char        *fx;        /* input function */
+	char        *lower;     /* lower limit */
+	char        *upper;     /* upper limit */
+	quadrature_t rule;      /* rule of the integration */
+	process_t    process;   /* how to perform the calculation */
+	size_t       process_n; /* degree of n for the given process */
 
-/* == 2. secant == */
+	/* === output === */
+	size_t        steps_c; /* number of steps required for the process */
+	integration_s steps[INTEGRATION_STEPS_MAX]; /* array of all steps
+	                                               required */
+	std::stringstream log; /* output log */
+
+	/* === state === */
+	fx_t  *f;           /* parsed f(x) */
+	double a;           /* lower limit */
+	double b;           /* upper limit */
+	size_t intervals_c; /* subintervals of `trapezoid` */
+	double trapezoid;   /* trapezoidal rule on `intervals_c` subintervals */
+	double romberg[INTEGRATION_STEPS_MAX]; /* last row of the romberg
+	                                          table */
+	int    done;        /* 1 if the process is complete */
+};
 
-/* Returns an empty string "" on error. */
-std::string
-secant_get_x_next(const char *x_prev, const char *fx_prev, const char *x_n,
-                  const char *fx_n);
+/* == 2. adaptive gauss-kronrod == */
 
-} // namespace spnm_utils
+/* Subintervals of a 'gauss_kronrod_t' ordered by their error. Opaque like
+ * `fx_t`. */
+struct gauss_kronrod_queue_t;
 
-#endif /* SPNM_H */
+/* === gauss-kronrod round === */
+struct gauss_kronrod_s {
+	size_t n;           /* round number */
+	size_t intervals_c; /* number of subintervals */
+	size_t evals_c;     /* evaluations of f up to the round */
+	char  *integral;    /* string representation of the integral */
+	char  *error;       /* string representation of the estimate of the
+	                       error, not rounded off */
+};
 
-/*
- ===============================================================================
- |                             IMPLEMENTATION MODE                             |
- ===============================================================================
- */
+struct gauss_kronrod_t {
+	/* === input === */
+	char     *fx;          /* input function */
+	char     *lower;       /* lower limit */
+	char     *upper;       /* upper limit */
+	char     *tolerance;   /* estimate of the error to reach */
+	process_t process;     /* how to perform the calculation */
+	size_t    process_n;   /* degree of n for the given process */
+	size_t    threads_c;   /* threads to use, 0 for all cores */
+	double    deadline_ms; /* time after which no round is started, 0 for
+	                          none */
 
-#ifdef SPNM_IMPL
+	/* === output === */
+	size_t            steps_c; /* number of rounds required for the
+	                              process */
+	gauss_kronrod_s   steps[STEPS_MAX]; /* array of all rounds required */
+	size_t            evals_c;          /* evaluations of f */
+	double            wall_ms;          /* time spent on the rounds */
+	std::stringstream log;              /* output log */
+
+	/* === state === */
+	fx_t                  *f;         /* parsed f(x) */
+	gauss_kronrod_queue_t *queue;     /* subintervals */
+	double                 a;         /* lower limit */
+	double                 b;         /* upper limit */
+	double                 error_max; /* tolerance */
+	int                    done;      /* 1 if the process is complete */
+};
 
-#include <cstdlib>
-#include <cstring>
-#include <cmath>
+/* = 3 - ORDINARY DIFFERENTIAL EQUATIONS = */
 
-/* spl - https://github.com/mrsafalpiya/spl */
-#define SPL_MATHS_IMPL
-#include "dep/spl_maths.h"
+/* == 1. initial value problems == */
 
-/*
- ===============================================================================
- |                                   Macros                                    |
- ===============================================================================
- */
+/* === ode step === */
+struct ode_s {
+	size_t n;     /* step number */
+	char  *h;     /* string representation of the step size taken */
+	char  *x_n;   /* string representation of x_n */
+	char  *y_n;   /* string representation of y_n */
+	char  *error; /* string representation of the estimate of the local
+	                 error, not rounded off, for ODE_RK45 and NULL
+	                 otherwise */
+};
 
-/* Performs roundoff on `VAR` with respect to decimal places or significant
- * digits according to the given `PROCESS` which is a 'spnm_process' and
- * `PROCESS_N` which is the degree of n for the given process. */
-#define SPNM_MANIP(PROCESS, PROCESS_N, VAR)                       \
-	switch (PROCESS) {                                        \
-	case DECIMAL_PLACES: {                                    \
-		spl_maths_roundoff_deci_str(VAR, PROCESS_N + 1);  \
-	} break;                                                  \
-	case SIGNIFICANT_DIGITS: {                                \
-		spl_maths_roundoff_signi_str(VAR, PROCESS_N + 1); \
-	} break;                                                  \
-	case NO_OF_STEPS: {                                       \
-		spl_maths_roundoff_deci_str(VAR, 6);              \
-	} break;                                                  \
-	}
-
-#define SPNM_CMP(PROCESS, PROCESS_N, VAR1, VAR2)                           \
-	switch (PROCESS) {                                                 \
-	case DECIMAL_PLACES: {                                             \
-		if (spl_maths_is_equal_deci_str(VAR1, VAR2, PROCESS_N)) {  \
-			done = 1;                                          \
-			continue;                                          \
-		}                                                          \
-	} break;                                                           \
-	case SIGNIFICANT_DIGITS: {                                         \
-		if (spl_maths_is_equal_signi_str(VAR1, VAR2, PROCESS_N)) { \
-			done = 1;                                          \
-			continue;                                          \
-		}                                                          \
-	} break;                                                           \
-	case NO_OF_STEPS: {                                                \
-		if (steps_c == PROCESS_N) {                                \
-			done = 1;                                          \
-			continue;                                          \
-		}                                                          \
-	} break;                                                           \
-	}
+struct ode_t {
+	/* === input === */
+	char        *fx;        /* f(x, y) of y' = f(x, y) */
+	char        *initial_x; /* x_0 */
+	char        *initial_y; /* y_0 = y(x_0) */
+	char        *final_x;   /* x at which the solve ends */
+	char        *h;         /* step size, the first one for ODE_RK45 */
+	char        *tolerance; /* local error of a step for ODE_RK45 */
+	ode_method_t method;    /* method of the solve */
+	process_t    process;   /* how to round off the steps */
+	size_t       process_n; /* degree of n for the given process */
+	int (*on_step)(const ode_s *step, void *data); /* called on every
+	                                                  step, NULL for
+	                                                  none */
+	void *data; /* passed to `on_step` */
 
-namespace spnm
-{
+	/* === output === */
+	size_t            steps_c;    /* number of steps taken */
+	ode_s             step;       /* the last step */
+	size_t            rejected_c; /* steps of ODE_RK45 redone with a
+	                                 smaller h */
+	std::stringstream log;        /* output log */
 
-/*
- ===============================================================================
- |                          Function Implementations                           |
- ===============================================================================
- */
+	/* === state === */
+	fx_t  *f;         /* parsed f(x, y) */
+	double x_0;       /* x_0 */
+	double x_end;     /* final x */
+	double h_0;       /* given step size */
+	double error_max; /* tolerance */
+	double x_n;       /* x of the next step */
+	double y_n;       /* y of the next step */
+	double h_n;       /* step size of the next step for ODE_RK45 */
+	double f_n;       /* f(x_n, y_n) once known */
+	int    is_f_n;    /* 1 if `f_n` is known */
+	int    done;      /* 1 if the solve is complete */
+};
 
-/* = CORE = */
+/* = 4 - LINEAR SYSTEMS = */
 
-int
-init(void)
+/* == 1. gaussian elimination and lu decomposition == */
+
+/* === elimination step === */
+struct elimination_s {
+	size_t n;         /* step number, the column eliminated */
+	size_t pivot;     /* row swapped with the n-th for the pivot */
+	char  *pivot_val; /* string representation of the pivot */
+	char **snapshot;  /* string representations of the matrix after the
+	                     step row by row, NULL if not kept. [A|b] of
+	                     `rows_c` + 1 columns for ELIMINATION_GAUSS, L
+	                     below the diagonal and U on and above it of
+	                     `rows_c` columns for ELIMINATION_LU */
+};
+
+struct elimination_t {
+	/* === input === */
+	char                *a;         /* rows of A of A x = b separated by ';'
+	                                   with the entries of a row by ',',
+	                                   NULL if given as values */
+	char                *b;         /* entries of b separated by ';', NULL
+	                                   if given as values */
+	elimination_method_t method;    /* method of the solve */
+	process_t            process;   /* how to round off the steps */
+	size_t               process_n; /* degree of n for the given process */
+	size_t               threads_c; /* threads to use, 0 for all cores */
+	int                  snapshots; /* 1 to keep the matrix of every step */
+
+	/* === output === */
+	size_t            rows_c;  /* number of equations and of unknowns */
+	size_t            steps_c; /* number of steps, one per column */
+	elimination_s    *steps;   /* `rows_c` steps */
+	char            **x;       /* `rows_c` string representations of the
+	                              solution once done */
+	std::stringstream log;     /* output log */
+
+	/* === state === */
+	double *lu;   /* A being factorized in place, row major */
+	double *y;    /* b with the row swaps and eliminations so far */
+	size_t *perm; /* row swapped with the k-th for the k-th pivot */
+	int     done; /* 1 if the solve is complete */
+};
+
+/* == 2. iterative methods == */
+
+/* === iterative step === */
+struct iterative_s {
+	size_t n;      /* step number */
+	char **x_next; /* `rows_c` string representations of x_(n+1) */
+};
+
+struct iterative_t {
+	/* === input === */
+	char              *a;    /* A as of `elimination_t`, NULL if given in
+	                            compressed sparse rows */
+	char              *b;    /* b as of `elimination_t`, NULL if given in
+	                            compressed sparse rows */
+	char              *initial_point; /* initial value of every unknown */
+	iterative_method_t method;        /* method of the solve */
+	char              *relaxation;    /* relaxation factor of
+	                                     ITERATIVE_SOR */
+	int                red_black;     /* 1 to update the even rows and then
+	                                     the odd rows, each all at once, for
+	                                     ITERATIVE_GAUSS_SEIDEL and
+	                                     ITERATIVE_SOR */
+	process_t          process;       /* how to perform the calculation */
+	size_t             process_n;     /* degree of n for the given
+	                                     process */
+	size_t             threads_c;     /* threads to use, 0 for all cores */
+
+	/* === output === */
+	size_t            rows_c;  /* number of equations and of unknowns */
+	size_t            steps_c; /* number of steps required for the process */
+	iterative_s       steps[STEPS_MAX]; /* array of all steps required */
+	std::stringstream log;              /* output log */
+
+	/* === state === */
+	sparse_system_t *system; /* parsed A and b */
+	double          *x;      /* x_n of the next step */
+	double           omega;  /* relaxation factor, 1 but for
+	                            ITERATIVE_SOR */
+	double           correction; /* max |x_n - x_(n-1)| of the last step */
+	size_t           growths_c;  /* consecutive steps of a growing
+	                                correction */
+	int              done;   /* 1 if the process is complete */
+};
+
+/* == 3. conjugate gradient == */
+
+/* === conjugate gradient step === */
+struct conjugate_gradient_s {
+	size_t n;             /* step number */
+	char  *alpha;         /* string representation of the step length along
+	                         the direction */
+	char  *beta;          /* string representation of the factor of the
+	                         direction in the next one */
+	char  *residual_norm; /* string representation of ||b - A x_(n+1)|| */
+	char  *x_norm; /* string representation of ||x_(n+1)||, by which the
+	                  process is done */
+};
+
+struct conjugate_gradient_t {
+	/* === input === */
+	char     *a;      /* A as of `elimination_t`, NULL if given otherwise */
+	char     *b;      /* b as of `elimination_t`, NULL if given otherwise */
+	char     *a_file; /* path of A in the matrix market format, NULL if
+	                     given otherwise */
+	char     *b_file; /* path of b in the matrix market format, NULL for
+	                     every b_i being 1 or if given otherwise */
+	char     *initial_point;  /* initial value of every unknown */
+	precond_t precond;        /* preconditioner M of the solve */
+	process_t process;        /* how to perform the calculation */
+	size_t    process_n;      /* degree of n for the given process */
+	size_t    iterations_max; /* steps before giving up, 0 for `STEPS_MAX`
+	                             more than the unknowns, the round off
+	                             keeping it from being done within as many
+	                             steps as the unknowns */
+	size_t    threads_c;      /* threads to use, 0 for all cores */
+	/* called on every step, NULL for none */
+	int (*on_step)(const conjugate_gradient_s *step, void *data);
+	void *data; /* passed to `on_step` */
+
+	/* === output === */
+	size_t               rows_c;  /* number of equations and of unknowns */
+	size_t               steps_c; /* number of steps taken */
+	conjugate_gradient_s step;    /* the last step */
+	std::stringstream    log;     /* output log */
+	double              *x;       /* the unknowns, x_(n+1) of the last
+	                                 step */
+
+	/* === state === */
+	sparse_system_t *system; /* parsed A and b */
+	double           rz;     /* r_n . M^-1 r_n */
+	int              done;   /* 1 if the process is complete */
+};
+
+/* = 5 - INTERPOLATION = */
+
+/* == 1. newton's and lagrange's interpolation == */
+
+/* === interpolation step === */
+struct interpolation_s {
+	size_t n;      /* step number, the order of the differences or for
+	                  INTERPOLATION_LAGRANGE the point of the term */
+	size_t vals_c; /* number of values */
+	char **vals;   /* string representations of the column of order n of
+	                  the difference table in the order of x: delta^n y_i,
+	                  the same as nabla^n y_(i+n), for
+	                  INTERPOLATION_FORWARD and INTERPOLATION_BACKWARD and
+	                  f[x_i, ..., x_(i+n)] for INTERPOLATION_DIVIDED. For
+	                  INTERPOLATION_LAGRANGE L_i(at) and y_i L_i(at) of
+	                  the point i = n - 1 */
+};
+
+struct interpolation_t {
+	/* === input === */
+	char *x;  /* x of the points separated by ';', equally spaced for
+	             INTERPOLATION_FORWARD and INTERPOLATION_BACKWARD */
+	char *y;  /* y of the points separated by ';' */
+	char *at; /* x to interpolate y at */
+	interpolation_method_t method;    /* method of the interpolation */
+	process_t              process;   /* how to round off the steps */
+	size_t                 process_n; /* degree of n for the given
+	                                     process */
+	size_t                 threads_c; /* threads of `interpolation_eval()`,
+	                                     0 for all cores */
+
+	/* === output === */
+	size_t            points_c; /* number of points */
+	size_t            steps_c;  /* number of steps */
+	interpolation_s  *steps;    /* `points_c` - 1 steps, one per order, or
+	                               `points_c` for INTERPOLATION_LAGRANGE,
+	                               one per term */
+	char             *value;    /* string representation of the
+	                               interpolated y at `at` once done */
+	std::stringstream log;      /* output log */
+
+	/* === state === */
+	double *xs;         /* x of the points */
+	double *ys;         /* y of the points */
+	double *column;     /* differences of the last order computed */
+	double *diagonal;   /* last difference of every order, the bottom
+	                       diagonal of the table, of divided differences
+	                       for INTERPOLATION_LAGRANGE */
+	double *coefs;      /* f[x_0, ..., x_k] of every order k, the
+	                       coefficients of the newton's form */
+	double *basis;      /* L_i(at) of every point, only for
+	                       INTERPOLATION_LAGRANGE */
+	double  at_val;     /* value of `at` */
+	size_t  points_max; /* points the state has room for */
+	int     done;       /* 1 if the table is complete */
+};
+
+/* == 2. cubic splines == */
+
+/* === spline step === */
+struct spline_s {
+	size_t n; /* step number, the segment from x_(n-1) to x_n */
+	char  *a; /* string representations of the coefficients of */
+	char  *b; /*   S_n(x) = a + b (x - x_(n-1)) + c (x - x_(n-1))^2 */
+	char  *c; /*            + d (x - x_(n-1))^3 */
+	char  *d; /* on the segment */
+};
+
+struct spline_t {
+	/* === input === */
+	char        *x;         /* x of the points separated by ';' in
+	                           increasing order, NULL if given as
+	                           values */
+	char        *y;         /* y of the points separated by ';', NULL if
+	                           given as values */
+	char        *at;        /* x to interpolate y at */
+	spline_end_t ends;      /* conditions at the ends */
+	char        *slopes;    /* S'(x_0) and S'(x_n) separated by ';' for
+	                           SPLINE_CLAMPED, else NULL */
+	process_t    process;   /* how to round off the steps */
+	size_t       process_n; /* degree of n for the given process */
+	size_t       threads_c; /* threads of `spline_eval()`, 0 for all
+	                           cores */
+
+	/* === output === */
+	size_t            points_c; /* number of points */
+	size_t            steps_c;  /* number of steps */
+	spline_s         *steps;    /* `points_c` - 1 steps, one per segment */
+	char             *value;    /* string representation of the
+	                               interpolated y at `at` once done */
+	std::stringstream log;      /* output log */
+
+	/* === state === */
+	double *xs;      /* x of the points */
+	double *ys;      /* y of the points */
+	double *coefs;   /* a, b, c and d of every segment one after
+	                    another */
+	size_t *buckets; /* segments by the equal buckets of [x_0, x_n], NULL
+	                    until begun */
+	double  at_val;  /* value of `at` */
+	int     done;    /* 1 if every segment is stepped through */
+};
+
+/* = 6 - CURVE FITTING = */
+
+/* == 1. least squares == */
+
+/* === least squares step === */
+struct fit_s {
+	size_t n;      /* step number, the power k = n - 1 of x */
+	char  *sum_x;  /* string representation of the sum of x^k */
+	char  *sum_xy; /* string representation of the sum of x^k y, x^k ln y
+	                  for FIT_EXPONENTIAL, or NULL for k above the
+	                  degree */
+};
+
+struct fit_t {
+	/* === input === */
+	char        *x;         /* x of the points separated by ';', NULL if
+	                           given as a file */
+	char        *y;         /* y of the points separated by ';', NULL if
+	                           given as a file */
+	char        *file;      /* path of the points, NULL if given
+	                           otherwise */
+	fit_format_t format;    /* format of `file` */
+	fit_model_t  model;     /* model fitted to the points */
+	size_t       degree;    /* degree m of the polynomial, 1 for FIT_LINE
+	                           and FIT_EXPONENTIAL */
+	process_t    process;   /* how to round off the steps */
+	size_t       process_n; /* degree of n for the given process */
+	size_t       threads_c; /* threads of the pass over the points, 0 for
+	                           all cores */
+
+	/* === output === */
+	size_t            points_c; /* number of points */
+	size_t            steps_c;  /* number of steps */
+	fit_s            *steps;    /* 2m + 1 steps, one per power of x */
+	size_t            coefs_c;  /* number of coefficients */
+	char            **coefs;    /* string representations of a_0, ...,
+	                               a_m, or a and b for FIT_EXPONENTIAL,
+	                               once done */
+	std::stringstream log;      /* output log */
+
+	/* === state === */
+	double *sums; /* sums of x^k for k up to 2m then of x^k y for k up to
+	                 m, NULL until begun */
+	int     done; /* 1 if the coefficients are solved for */
+};
+
+/* = 7 - NUMERICAL DIFFERENTIATION = */
+
+/* == 1. finite differences and richardson == */
+
+/* === differentiation step === */
+struct differentiation_s {
+	size_t n;          /* step number */
+	char  *h;          /* string representation of the step size */
+	char  *derivative; /* string representation of the derivative, the
+	                      last of the row for EXTRAPOLATION_RICHARDSON */
+	char  *richardson[DIFFERENTIATION_STEPS_MAX]; /* D(n-1, 0), ...,
+	                                                 D(n-1, n-1) of the
+	                                                 richardson table,
+	                                                 NULL otherwise */
+};
+
+struct differentiation_t {
+	/* === input === */
+	char           *fx;            /* input function */
+	char           *x;             /* point of the derivative */
+	char           *h;             /* step size of the first step */
+	difference_t    difference;    /* difference of the derivative */
+	extrapolation_t extrapolation; /* extrapolation of the differences */
+	process_t       process;       /* how to perform the calculation */
+	size_t          process_n;     /* degree of n for the given process */
+
+	/* === output === */
+	size_t            steps_c; /* number of steps required for the
+	                              process */
+	differentiation_s steps[DIFFERENTIATION_STEPS_MAX]; /* array of all
+	                                                       steps required */
+	std::stringstream log;     /* output log */
+
+	/* === state === */
+	fx_t  *f;     /* parsed f(x) */
+	double x_val; /* value of `x` */
+	double h_val; /* value of `h` */
+	double fx_x;  /* f(x) */
+	double fx_plus[DIFFERENTIATION_STEPS_MAX];  /* f(x + h / 2^k) */
+	double fx_minus[DIFFERENTIATION_STEPS_MAX]; /* f(x - h / 2^k) */
+	double richardson[DIFFERENTIATION_STEPS_MAX]; /* last row of the
+	                                                 richardson table */
+	int    done; /* 1 if the process is complete */
+};
+
+/* = 8 - EIGENVALUES = */
+
+/* == 1. power method and inverse iteration == */
+
+/* === power iteration step === */
+struct power_iteration_s {
+	size_t n;          /* step number */
+	char  *eigenvalue; /* string representation of the estimate of the
+	                      eigenvalue of A */
+	char **x_next;     /* `rows_c` string representations of x_(n+1), the
+	                      estimate of the eigenvector scaled for its entry
+	                      of the largest magnitude to be 1 */
+};
+
+struct power_iteration_t {
+	/* === input === */
+	char          *a;              /* A as of `elimination_t`, NULL if given
+	                                  as values */
+	char          *initial_vector; /* entries of x_0 separated by ';', NULL
+	                                  if given as values */
+	power_method_t method;         /* method of the iteration */
+	char          *shift;          /* shift s */
+	process_t      process;        /* how to perform the calculation */
+	size_t         process_n;      /* degree of n for the given process */
+	size_t         threads_c;      /* threads to use, 0 for all cores */
+
+	/* === output === */
+	size_t            rows_c;  /* number of rows (and of columns) of A */
+	size_t            steps_c; /* number of steps required for the process */
+	power_iteration_s steps[STEPS_MAX]; /* array of all steps required */
+	std::stringstream log;              /* output log */
+
+	/* === state === */
+	double *shifted;   /* A - s I, row major, factorized in place for
+	                      POWER_INVERSE */
+	size_t *perm;      /* row swapped with the k-th for the k-th pivot of
+	                      the factorization */
+	double *x;         /* x_n of the next step */
+	double *y;         /* (A - s I) x_n, or its inverse times x_n */
+	double  shift_val; /* value of the shift */
+	int     done;      /* 1 if the process is complete */
+};
+
+/* == 2. qr algorithm == */
+
+/* === qr algorithm step === */
+struct qr_algorithm_s {
+	size_t n;           /* step number */
+	size_t active;      /* rows of H whose eigenvalues are yet to be found
+	                       after the step */
+	char  *subdiagonal; /* string representation of the last subdiagonal
+	                       entry of those rows, which the steps drive to 0,
+	                       "0" once there are none */
+};
+
+struct qr_algorithm_t {
+	/* === input === */
+	char     *a;         /* A as of `elimination_t`, NULL if given as
+	                        values */
+	process_t process;   /* how to round off the steps */
+	size_t    process_n; /* degree of n for the given process */
+	size_t    threads_c; /* threads to use, 0 for all cores */
+
+	/* === output === */
+	size_t            rows_c;  /* number of rows (and of columns) of A */
+	size_t            steps_c; /* number of steps, one per sweep */
+	qr_algorithm_s   *steps;   /* `steps_c` steps */
+	char            **re;      /* `rows_c` string representations of the
+	                              real parts of the eigenvalues once done */
+	char            **im;      /* `rows_c` string representations of the
+	                              imaginary parts of the eigenvalues once
+	                              done, a complex conjugate pair being one
+	                              after the other */
+	std::stringstream log;     /* output log */
+
+	/* === state === */
+	double *h;         /* A reduced to upper hessenberg form H, row major,
+	                      being swept to quasi triangular */
+	double *wr;        /* real parts of the eigenvalues found */
+	double *wi;        /* imaginary parts of the eigenvalues found */
+	double  norm;      /* sum of the magnitudes of the entries of H */
+	size_t  lo;        /* first row of the block swept next */
+	size_t  hi;        /* rows whose eigenvalues are yet to be found */
+	size_t  sweeps_c;  /* sweeps since the last eigenvalue was found */
+	size_t  steps_max; /* steps `steps` has room for */
+	int     done;      /* 1 if every eigenvalue is found */
+};
+
+/*
+ ===============================================================================
+ |                            Function Declarations                            |
+ ===============================================================================
+ */
+
+/* = CORE = */
+
+/*
+ * Initializes any prerequisites to use the library, setting up giac up front.
+ *
+ * Calling it is optional, f(x) being evaluated natively whenever possible and
+ * giac being set up, once, by the first expression that needs it. Long running
+ * processes can call it to not pay for that setup in the middle of a solve.
+ *
+ * Can be called multiple times. Returns 0 on error.
+ */
+int
+init(void);
+
+/*
+ * Sets the fraction `rate` (0 to 1) of solves to run in shadow mode. A
+ * shadowed solve still uses the native evaluator for its results but also
+ * evaluates every f(x) with giac, counting and logging any divergence.
+ *
+ * Solves are sampled evenly, e.g. every 100th solve for a rate of 0.01. The
+ * default rate is 0.
+ */
+void
+shadow_set_rate(double rate);
+
+/* Returns the counters of the shadow mode so far. */
+shadow_stats_t
+shadow_stats(void);
+
+/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+
+/* == 1. bisection method == */
+
+/*
+ * Initializes a 'bisection_t' with the required values for the given options in
+ * argument.
+ *
+ * Returns the initialized 'bisection_t'.
+ */
+bisection_t
+bisection_init(const char *fx, const char *interval_lower,
+               const char *interval_upper, process_t process, size_t process_n);
+
+/*
+ * Performs the bisection calculation for the given inputs in `t`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in f(x).
+ * - err_x_input: Invalid inputs in interval.
+ * - err_condition_not_met: f(a).f(b) > 0
+ */
+int
+bisection_perform(bisection_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `bisection_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `bisection_perform()`.
+ */
+int
+bisection_begin(bisection_t *t);
+
+/*
+ * Computes the next step of the bisection calculation and appends it to
+ * `t->steps`. Sets `t->done` once the given process is satisfied, after which
+ * the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid inputs in interval.
+ * - err_steps_max: `STEPS_MAX` steps are not enough.
+ */
+int
+bisection_step(bisection_t *t);
+
+/*
+ * Returns a range over the steps of the bisection calculation where each step
+ * is only computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<bisection_t, bisection_s, bisection_step>
+bisection_steps(bisection_t *t);
+
+/*
+ * Same as `bisection_perform()`, `bisection_step()` and `bisection_steps()` but
+ * with the rounding off and the termination of the process decided at compile
+ * time by the process policy `P` (see "Process Policies") instead of by
+ * `t->process`.
+ */
+template <typename P>
+int
+bisection_perform(bisection_t *t);
+
+template <typename P>
+int
+bisection_step(bisection_t *t);
+
+template <typename P>
+steps_range<bisection_t, bisection_s, bisection_step<P>>
+bisection_steps(bisection_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+bisection_free(bisection_t *t);
+
+/* == 2. secant method == */
+
+/*
+ * Initializes a 'secant_t' with the required values for the given options in
+ * argument.
+ *
+ * Returns the initialized 'secant_t'.
+ */
+secant_t
+secant_init(const char *fx, const char *initial_point1,
+            const char *initial_point2, process_t process, size_t process_n);
+
+/*
+ * Performs the secant calculation for the given inputs in `t`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in f(x).
+ * - err_x_input: Invalid inputs in initial point.
+ */
+int
+secant_perform(secant_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `secant_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `secant_perform()`.
+ */
+int
+secant_begin(secant_t *t);
+
+/*
+ * Computes the next step of the secant calculation and appends it to
+ * `t->steps`. Sets `t->done` once the given process is satisfied, after which
+ * the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid inputs in initial point.
+ * - err_steps_max: `STEPS_MAX` steps are not enough.
+ */
+int
+secant_step(secant_t *t);
+
+/*
+ * Returns a range over the steps of the secant calculation where each step is
+ * only computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<secant_t, secant_s, secant_step>
+secant_steps(secant_t *t);
+
+/*
+ * Same as `secant_perform()`, `secant_begin()`, `secant_step()` and
+ * `secant_steps()` but with the rounding off and the termination of the
+ * process decided at compile time by the process policy `P` (see "Process
+ * Policies") instead of by `t->process`.
+ */
+template <typename P>
+int
+secant_perform(secant_t *t);
+
+template <typename P>
+int
+secant_begin(secant_t *t);
+
+template <typename P>
+int
+secant_step(secant_t *t);
+
+template <typename P>
+steps_range<secant_t, secant_s, secant_step<P>>
+secant_steps(secant_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+secant_free(secant_t *t);
+
+/* == 3. fixed point iteration == */
+
+/*
+ * Initializes a 'fixed_point_t' with the required values for the given options
+ * in argument.
+ *
+ * Returns the initialized 'fixed_point_t'.
+ */
+fixed_point_t
+fixed_point_init(const char *gx, const char *initial_point, process_t process,
+                 size_t process_n, accel_t accel);
+
+/*
+ * Performs the fixed point iteration x_(n+1) = g(x_n) for the given inputs in
+ * `t`, accelerated as per `t->accel`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in g(x).
+ * - err_x_input: Invalid initial point or the iteration diverged.
+ * - err_steps_max: `STEPS_MAX` steps are not enough.
+ */
+int
+fixed_point_perform(fixed_point_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `fixed_point_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `fixed_point_perform()`.
+ */
+int
+fixed_point_begin(fixed_point_t *t);
+
+/*
+ * Computes the next step of the fixed point iteration and appends it to
+ * `t->steps`. Sets `t->done` once the given process is satisfied, after which
+ * the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `fixed_point_perform()`.
+ */
+int
+fixed_point_step(fixed_point_t *t);
+
+/*
+ * Returns a range over the steps of the fixed point iteration where each step
+ * is only computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<fixed_point_t, fixed_point_s, fixed_point_step>
+fixed_point_steps(fixed_point_t *t);
+
+/*
+ * Same as `fixed_point_perform()`, `fixed_point_begin()`, `fixed_point_step()`
+ * and `fixed_point_steps()` but with the rounding off and the termination of
+ * the process decided at compile time by the process policy `P` (see "Process
+ * Policies") instead of by `t->process`.
+ */
+template <typename P>
+int
+fixed_point_perform(fixed_point_t *t);
+
+template <typename P>
+int
+fixed_point_begin(fixed_point_t *t);
+
+template <typename P>
+int
+fixed_point_step(fixed_point_t *t);
+
+template <typename P>
+steps_range<fixed_point_t, fixed_point_s, fixed_point_step<P>>
+fixed_point_steps(fixed_point_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+fixed_point_free(fixed_point_t *t);
+
+/* == 4. newton's method for systems == */
+
+/*
+ * Initializes a 'newton_system_t' for the system f_i(x) = 0 of `vars_c`
+ * equations `fx` in the `vars_c` variables `vars` starting at
+ * `initial_point`.
+ *
+ * Returns the initialized 'newton_system_t'.
+ */
+newton_system_t
+newton_system_init(const char *const *fx, const char *const *vars,
+                   const char *const *initial_point, size_t vars_c,
+                   process_t process, size_t process_n);
+
+/*
+ * Performs the newton's method for the given system in `t`.
+ *
+ * The system and its Jacobian are compiled once by the native evaluator, the
+ * Jacobian by automatic differentiation, and every step solves
+ * J(x_n) (x_(n+1) - x_n) = -f(x_n) by LU factorization. The process is done
+ * once every variable satisfies it.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in, or no native support for, some f_i.
+ * - err_x_input: Invalid initial point, number of variables or the iteration
+ *   diverged.
+ * - err_singular_matrix: The Jacobian is singular at some x_n.
+ * - err_steps_max: `STEPS_MAX` steps are not enough.
+ */
+int
+newton_system_perform(newton_system_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `newton_system_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `newton_system_perform()`.
+ */
+int
+newton_system_begin(newton_system_t *t);
+
+/*
+ * Computes the next step of the newton's method and appends it to
+ * `t->steps`. Sets `t->done` once the given process is satisfied, after which
+ * the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `newton_system_perform()`.
+ */
+int
+newton_system_step(newton_system_t *t);
+
+/*
+ * Returns a range over the steps of the newton's method where each step is
+ * only computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<newton_system_t, newton_system_s, newton_system_step>
+newton_system_steps(newton_system_t *t);
+
+/*
+ * Same as `newton_system_perform()`, `newton_system_begin()`,
+ * `newton_system_step()` and `newton_system_steps()` but with the process
+ * policy `P` (see "Process Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+newton_system_perform(newton_system_t *t);
+
+template <typename P>
+int
+newton_system_begin(newton_system_t *t);
+
+template <typename P>
+int
+newton_system_step(newton_system_t *t);
+
+template <typename P>
+steps_range<newton_system_t, newton_system_s, newton_system_step<P>>
+newton_system_steps(newton_system_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+newton_system_free(newton_system_t *t);
+
+/* == 5. newton-krylov method == */
+
+/*
+ * Initializes a 'newton_krylov_t' for the `unknowns_c` equations f_i(x) = 0
+ * where every f_i is the same stencil `fx` in the `vars_c` variables `vars`,
+ * the k-th of which being x_(i + offsets[k]), along with `i` and `n`, the
+ * number of unknowns. The unknowns past either end take the boundary values.
+ *
+ * For example u'' + e^u = 0 on [0, 1] with u(0) = u(1) = 0 discretized on n
+ * points is `fx` "l - 2c + r + e^c/(n + 1)^2" with the variables "l", "c",
+ * "r" at offsets -1, 0, 1 and both boundaries "0".
+ *
+ * `threads_c` is 0 (all cores) and can be changed before performing.
+ *
+ * Returns the initialized 'newton_krylov_t'.
+ */
+newton_krylov_t
+newton_krylov_init(const char *fx, const char *const *vars, const int *offsets,
+                   size_t vars_c, size_t unknowns_c,
+                   const char *boundary_lower, const char *boundary_upper,
+                   const char *initial_point, precond_t precond,
+                   process_t process, size_t process_n);
+
+/*
+ * Performs the newton-krylov method for the given system in `t`.
+ *
+ * The Jacobian is assembled in CSR form, by automatic differentiation of the
+ * stencil, on `t->threads_c` threads. Every step solves J dx = -f(x_n) by
+ * BiCGSTAB preconditioned as per `t->precond`, so the memory is proportional
+ * to the nonzeros of J. The process is done when ||x_(n+1)|| satisfies it.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in, or no native support for, `fx`.
+ * - err_x_input: Invalid initial point, boundaries, stencil or the iteration
+ *   diverged.
+ * - err_singular_matrix: The preconditioner can't be set up for J(x_n).
+ * - err_steps_max: `STEPS_MAX` steps are not enough.
+ */
+int
+newton_krylov_perform(newton_krylov_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `newton_krylov_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `newton_krylov_perform()`.
+ */
+int
+newton_krylov_begin(newton_krylov_t *t);
+
+/*
+ * Computes the next step of the newton-krylov method and appends it to
+ * `t->steps`. Sets `t->done` once the given process is satisfied, after which
+ * the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `newton_krylov_perform()`.
+ */
+int
+newton_krylov_step(newton_krylov_t *t);
+
+/*
+ * Returns a range over the steps of the newton-krylov method where each step
+ * is only computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<newton_krylov_t, newton_krylov_s, newton_krylov_step>
+newton_krylov_steps(newton_krylov_t *t);
+
+/*
+ * Same as `newton_krylov_perform()`, `newton_krylov_begin()`,
+ * `newton_krylov_step()` and `newton_krylov_steps()` but with the process
+ * policy `P` (see "Process Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+newton_krylov_perform(newton_krylov_t *t);
+
+template <typename P>
+int
+newton_krylov_begin(newton_krylov_t *t);
+
+template <typename P>
+int
+newton_krylov_step(newton_krylov_t *t);
+
+template <typename P>
+steps_range<newton_krylov_t, newton_krylov_s, newton_krylov_step<P>>
+newton_krylov_steps(newton_krylov_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+newton_krylov_free(newton_krylov_t *t);
+
+/* == 6. parameter sweep == */
+
+/*
+ * Initializes a 'sweep_t' solving f(x; p) = 0 for the `points_c` evenly spaced
+ * values of the parameter `param` from `param_lower` to `param_upper`, each
+ * with `method` from `input1` and `input2` as in `bisection_init()` and
+ * `secant_init()`.
+ *
+ * `warm_start` is 1 and `threads_c` is 0 (all cores), both of which can be
+ * changed before performing.
+ *
+ * Returns the initialized 'sweep_t'.
+ */
+sweep_t
+sweep_init(const char *fx, const char *param, const char *param_lower,
+           const char *param_upper, size_t points_c, sweep_method_t method,
+           const char *input1, const char *input2, process_t process,
+           size_t process_n);
+
+/*
+ * Performs the sweep for the given inputs in `t`, filling `t->points`.
+ *
+ * `fx` is compiled once. The points are solved in chunks of `SWEEP_CHUNK` on
+ * `t->threads_c` threads. With `t->warm_start`, every point but the first of
+ * each chunk starts from the roots of the points before it: the secant method
+ * from the previous root and the linear prediction of the next one, the
+ * bisection method from an interval around the prediction. A point falls back
+ * to `input1` and `input2` if that fails. The chunks being fixed, the points
+ * don't depend on the number of threads.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in, or no native support for, `fx`.
+ * - err_x_input: Invalid parameters or inputs, or `points_c` being 0.
+ * - The error of the first point that failed, the rest of which are still
+ *   solved.
+ */
+int
+sweep_perform(sweep_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+sweep_free(sweep_t *t);
+
+/* == 7. root isolation == */
+
+/*
+ * Initializes an 'isolate_t' for the roots of `fx` in the interval
+ * [`interval_lower`, `interval_upper`], bisected with `process` and
+ * `process_n` as in `bisection_init()`.
+ *
+ * `threads_c` is 0 (all cores) and can be changed before performing.
+ *
+ * Returns the initialized 'isolate_t'.
+ */
+isolate_t
+isolate_init(const char *fx, const char *interval_lower,
+             const char *interval_upper, const char *tolerance,
+             process_t process, size_t process_n);
+
+/*
+ * Isolates the roots of f by branch and prune, filling `t->enclosures`.
+ *
+ * f and its derivative are evaluated in interval arithmetic with outward
+ * rounding over subintervals taken from a work queue shared by `t->threads_c`
+ * threads. A subinterval is discarded when the image of f excludes 0, or when
+ * f is monotone over it without changing sign. It is kept as a unique root
+ * when f is monotone and changes sign, else it is split until narrower than
+ * `tolerance`. Unlike sampling the sign of f, no root is ever missed: every
+ * root is in one of the enclosures. A sign change only counts where f is
+ * bounded, so poles are left as possible roots.
+ *
+ * Every enclosure over which f changes sign is then solved by the bisection
+ * method, the steps of which are in its `bisection`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in, or no native support for, f(x).
+ * - err_x_input: Invalid interval or tolerance.
+ * - err_steps_max: `ISOLATE_BOXES_MAX` subintervals are not enough.
+ * - The error of the first bisection that failed, the rest of which are still
+ *   performed.
+ */
+int
+isolate_perform(isolate_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+isolate_free(isolate_t *t);
+
+/* == 8. polynomial roots == */
+
+/*
+ * Initializes a 'polynomial_roots_t' for every real root of the polynomial
+ * `fx`, bisected with `process` and `process_n` as in `bisection_init()`.
+ *
+ * `threads_c` is 0 (all cores) and can be changed before performing.
+ *
+ * Returns the initialized 'polynomial_roots_t'.
+ */
+polynomial_roots_t
+polynomial_roots_init(const char *fx, process_t process, size_t process_n);
+
+/*
+ * Isolates every real root of the polynomial f by its sturm sequence, filling
+ * `t->enclosures`, with no interval to be given.
+ *
+ * The sturm sequence of f, f' and the negated remainders of their euclidean
+ * algorithm is built once, the sign changes it loses from a point to another
+ * counting the distinct roots between them. Starting from a bound on the
+ * magnitude of every root, subintervals of more than one root are split in
+ * half, those of none dropped and those of one kept, the subintervals being
+ * shared by `t->threads_c` threads once there are enough of them. Unlike
+ * `isolate_perform()` no tolerance is needed and roots of even multiplicity
+ * are enclosed as well as the others. Roots too close to be told apart in
+ * double precision are left together, as ENCLOSURE_EXISTS. An enclosure of a
+ * single root in which the last polynomial of the sequence, the gcd of f and
+ * f', has a root too, as counted by its own sturm sequence, may as well hold
+ * close roots taken for a multiple one: it is ENCLOSURE_EXISTS if f changes
+ * sign over it and ENCLOSURE_POSSIBLE if not. The sequence being
+ * in double precision too, the coefficients of its remainders far smaller than
+ * those they are computed from are taken for 0, which badly conditioned
+ * polynomials such as (x - 1)(x - 2)...(x - 20) lose roots to.
+ *
+ * Every enclosure is then solved by the bisection method on `t->threads_c`
+ * threads, the steps of which are in its `bisection`. f is bisected where it
+ * changes sign over the enclosure, and `t->square_free` where it doesn't as
+ * around a root of even multiplicity.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in f(x), or f isn't natively a polynomial in
+ *   x of a degree from 1 to `POLYNOMIAL_DEGREE_MAX`.
+ * - err_steps_max: `ISOLATE_BOXES_MAX` subintervals are not enough.
+ * - The error of the first bisection that failed, the rest of which are still
+ *   performed.
+ */
+int
+polynomial_roots_perform(polynomial_roots_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+polynomial_roots_free(polynomial_roots_t *t);
+
+/* = 2 - NUMERICAL INTEGRATION = */
+
+/* == 1. newton-cotes and romberg == */
+
+/*
+ * Initializes an 'integration_t' for the integral of `fx` from `lower` to
+ * `upper` by `rule`.
+ *
+ * Returns the initialized 'integration_t'.
+ */
+integration_t
+integration_init(const char *fx, const char *lower, const char *upper,
+                 quadrature_t rule, process_t process, size_t process_n);
+
+/*
+ * Performs the integration for the given inputs in `t`.
+ *
+ * Every step halves the width of the subintervals, starting from the fewest
+ * the rule takes: 1 for the trapezoidal rule and romberg, 2 for simpson's 1/3
+ * and 3 for simpson's 3/8 rule. The trapezoidal rule, and so simpson's 1/3
+ * rule and romberg built on it, only evaluates f at the new midpoints. The
+ * process is done when the integral satisfies it.
+ *
+ * f is compiled once and evaluated over the nodes in batches.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in f(x).
+ * - err_x_input: Invalid limits or f isn't finite at a node.
+ * - err_steps_max: `INTEGRATION_STEPS_MAX` steps are not enough.
+ */
+int
+integration_perform(integration_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `integration_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `integration_perform()`.
+ */
+int
+integration_begin(integration_t *t);
+
+/*
+ * Computes the next step of the integration and appends it to `t->steps`.
+ * Sets `t->done` once the given process is satisfied, after which the call
+ * does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `integration_perform()`.
+ */
+int
+integration_step(integration_t *t);
+
+/*
+ * Returns a range over the steps of the integration where each step is only
+ * computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<integration_t, integration_s, integration_step>
+integration_steps(integration_t *t);
+
+/*
+ * Same as `integration_perform()`, `integration_begin()`,
+ * `integration_step()` and `integration_steps()` but with the process policy
+ * `P` (see "Process Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+integration_perform(integration_t *t);
+
+template <typename P>
+int
+integration_begin(integration_t *t);
+
+template <typename P>
+int
+integration_step(integration_t *t);
+
+template <typename P>
+steps_range<integration_t, integration_s, integration_step<P>>
+integration_steps(integration_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+integration_free(integration_t *t);
+
+/* == 2. adaptive gauss-kronrod == */
+
+/*
+ * Initializes a 'gauss_kronrod_t' for the integral of `fx` from `lower` to
+ * `upper` to within `tolerance`.
+ *
+ * `threads_c` is 0 (all cores) and `deadline_ms` 0 (none), both of which can
+ * be changed before performing.
+ *
+ * Returns the initialized 'gauss_kronrod_t'.
+ */
+gauss_kronrod_t
+gauss_kronrod_init(const char *fx, const char *lower, const char *upper,
+                   const char *tolerance, process_t process, size_t process_n);
+
+/*
+ * Performs the adaptive gauss-kronrod integration for the given inputs in
+ * `t`.
+ *
+ * Every subinterval is integrated by the 7 point gauss and 15 point kronrod
+ * rules, the difference of which estimates its error. The subintervals are
+ * kept in a priority queue on their error. The first round integrates the
+ * whole interval, then every round bisects the worst subintervals, up to
+ * `GAUSS_KRONROD_ROUND` of them and stopping at the first whose error is
+ * within its share of `tolerance`. The halves are integrated on
+ * `t->threads_c` threads, f being evaluated over their nodes in batches. So
+ * the evaluations go where f peaks or is singular, and the rounds don't
+ * depend on the number of threads.
+ *
+ * The process is done when the estimate of the error is at most `tolerance`
+ * or the integral satisfies the process.
+ *
+ * `t->evals_c` and `t->wall_ms` keep the evaluations of f and the time spent.
+ * With `t->deadline_ms` set, no round is started past it.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in f(x).
+ * - err_x_input: Invalid limits or tolerance, or f isn't finite at a node.
+ * - err_deadline: `t->deadline_ms` passed, the rounds done so far are in
+ *   `t->steps`.
+ * - err_steps_max: `STEPS_MAX` rounds are not enough.
+ */
+int
+gauss_kronrod_perform(gauss_kronrod_t *t);
+
+/*
+ * Prepares `t` for round by round evaluation with `gauss_kronrod_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `gauss_kronrod_perform()`.
+ */
+int
+gauss_kronrod_begin(gauss_kronrod_t *t);
+
+/*
+ * Computes the next round of the integration and appends it to `t->steps`.
+ * Sets `t->done` once the given process is satisfied, after which the call
+ * does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `gauss_kronrod_perform()`.
+ */
+int
+gauss_kronrod_step(gauss_kronrod_t *t);
+
+/*
+ * Returns a range over the rounds of the integration where each round is only
+ * computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<gauss_kronrod_t, gauss_kronrod_s, gauss_kronrod_step>
+gauss_kronrod_steps(gauss_kronrod_t *t);
+
+/*
+ * Same as `gauss_kronrod_perform()`, `gauss_kronrod_begin()`,
+ * `gauss_kronrod_step()` and `gauss_kronrod_steps()` but with the process
+ * policy `P` (see "Process Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+gauss_kronrod_perform(gauss_kronrod_t *t);
+
+template <typename P>
+int
+gauss_kronrod_begin(gauss_kronrod_t *t);
+
+template <typename P>
+int
+gauss_kronrod_step(gauss_kronrod_t *t);
+
+template <typename P>
+steps_range<gauss_kronrod_t, gauss_kronrod_s, gauss_kronrod_step<P>>
+gauss_kronrod_steps(gauss_kronrod_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+gauss_kronrod_free(gauss_kronrod_t *t);
+
+/* = 3 - ORDINARY DIFFERENTIAL EQUATIONS = */
+
+/* == 1. initial value problems == */
+
+/*
+ * Initializes an 'ode_t' for y' = `fx` with y(`initial_x`) = `initial_y`
+ * from `initial_x` to `final_x`, where `fx` is a function of x and y.
+ * `tolerance` is only used by ODE_RK45.
+ *
+ * `on_step` and `data` are NULL and can be set before performing.
+ *
+ * Returns the initialized 'ode_t'.
+ */
+ode_t
+ode_init(const char *fx, const char *initial_x, const char *initial_y,
+         const char *final_x, const char *h, const char *tolerance,
+         ode_method_t method, process_t process, size_t process_n);
+
+/*
+ * Solves the initial value problem in `t` up to `final_x`.
+ *
+ * f(x, y) is compiled once and the steps are computed unrounded; the process
+ * only rounds off the values of the steps. A trajectory can have any number
+ * of steps so they aren't kept: every step is passed to `t->on_step`, which
+ * can stop the solve by returning non-zero, and only the last one is kept in
+ * `t->step`. The fixed step methods take steps of `h` with the last one cut
+ * short to end on `final_x`. ODE_RK45 takes each step of the size that keeps
+ * its estimated local error within `tolerance`, redoing it with a smaller h
+ * otherwise.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in, or no native support for, f(x, y).
+ * - err_x_input: Invalid inputs in the initial value, `final_x`, `h` or
+ *   `tolerance`, or the solution overflows to a value that isn't finite.
+ */
+int
+ode_perform(ode_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `ode_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `ode_perform()`.
+ */
+int
+ode_begin(ode_t *t);
+
+/*
+ * Computes the next step of the solve into `t->step` and passes it to
+ * `t->on_step`. Sets `t->done` once `final_x` is reached or `t->on_step`
+ * returns non-zero, after which the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `ode_perform()`.
+ */
+int
+ode_step(ode_t *t);
+
+/*
+ * Same as `ode_perform()`, `ode_begin()` and `ode_step()` but with the process
+ * policy `P` (see "Process Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+ode_perform(ode_t *t);
+
+template <typename P>
+int
+ode_begin(ode_t *t);
+
+template <typename P>
+int
+ode_step(ode_t *t);
+
+/*
+ * An `on_step` writing `step` as a line of n, h, x_n, y_n and the error, if
+ * any, separated by tabs to the 'std::ostream' `data`, e.g. a
+ * 'std::ofstream' to stream the steps to a file.
+ *
+ * Returns 0 so that the solve goes on.
+ */
+int
+ode_write_step(const ode_s *step, void *data);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+ode_free(ode_t *t);
+
+/* = 4 - LINEAR SYSTEMS = */
+
+/* == 1. gaussian elimination and lu decomposition == */
+
+/*
+ * Initializes an 'elimination_t' for A x = b with the rows of `a` separated by
+ * ';' and the entries of a row by ',', as in "2, 1; 1, 3", and the entries of
+ * `b` by ';'. Every entry is a constant like "1/3" or "sqrt(2)".
+ *
+ * `threads_c` is 0 (all cores) and `snapshots` 0, both can be changed before
+ * performing.
+ *
+ * Returns the initialized 'elimination_t'.
+ */
+elimination_t
+elimination_init(const char *a, const char *b, elimination_method_t method,
+                 process_t process, size_t process_n);
+
+/*
+ * Same as `elimination_init()` but for the `n` x `n` row major A `a` and the
+ * `n` entries of b `b` as values, which are copied, for systems too large to
+ * be written out.
+ */
+elimination_t
+elimination_init_values(const double *a, const double *b, size_t n,
+                        elimination_method_t method, process_t process,
+                        size_t process_n);
+
+/*
+ * Solves the linear system in `t` by eliminating its columns one after
+ * another, each step swapping in the row of the largest pivot of the column,
+ * and then back substituting for x.
+ *
+ * Both methods compute the same factorization P A = L U, unrounded; the
+ * process only rounds off the values of the steps. They differ in the
+ * snapshots of the matrix: ELIMINATION_GAUSS shows the augmented [A|b] being
+ * reduced to upper triangular and ELIMINATION_LU the multipliers of L filling
+ * in below U.
+ *
+ * The snapshots are only kept if `t->snapshots` is 1, as they take `rows_c`
+ * strings per step. Without them the columns are eliminated in panels of
+ * `ELIMINATION_BLOCK`, with the rest of the matrix updated tile by tile from
+ * the cache on `t->threads_c` threads, so that large systems are solved fast.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid or non-square A, or b, or x isn't finite.
+ * - err_singular_matrix: A is singular.
+ */
+int
+elimination_perform(elimination_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `elimination_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `elimination_perform()`.
+ */
+int
+elimination_begin(elimination_t *t);
+
+/*
+ * Eliminates the next column of the system, or the next panel of columns
+ * without snapshots, and appends the steps to `t->steps`. Sets `t->x` and
+ * `t->done` once every column is eliminated, after which the call does
+ * nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `elimination_perform()`.
+ */
+int
+elimination_step(elimination_t *t);
+
+/*
+ * Returns a range over the steps of the elimination where each step is only
+ * computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<elimination_t, elimination_s, elimination_step>
+elimination_steps(elimination_t *t);
+
+/*
+ * Same as `elimination_perform()`, `elimination_begin()`,
+ * `elimination_step()` and `elimination_steps()` but with the process policy
+ * `P` (see "Process Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+elimination_perform(elimination_t *t);
+
+template <typename P>
+int
+elimination_begin(elimination_t *t);
+
+template <typename P>
+int
+elimination_step(elimination_t *t);
+
+template <typename P>
+steps_range<elimination_t, elimination_s, elimination_step<P>>
+elimination_steps(elimination_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+elimination_free(elimination_t *t);
+
+/* == 2. iterative methods == */
+
+/*
+ * Initializes an 'iterative_t' for A x = b with `a` and `b` as of
+ * `elimination_init()`, starting with every unknown at `initial_point`.
+ * `relaxation` is only used by ITERATIVE_SOR and can be NULL otherwise.
+ *
+ * `red_black` is 0 and `threads_c` 0 (all cores), both can be changed before
+ * performing.
+ *
+ * Returns the initialized 'iterative_t'.
+ */
+iterative_t
+iterative_init(const char *a, const char *b, const char *initial_point,
+               iterative_method_t method, const char *relaxation,
+               process_t process, size_t process_n);
+
+/*
+ * Same as `iterative_init()` but for the `n` rows of A in compressed sparse
+ * rows, row i having the values `vals` in the columns `cols` from
+ * `row_ptr[i]` to `row_ptr[i + 1]`, and the `n` entries of b `b`, all of
+ * which are copied, for systems too large to be written out.
+ */
+iterative_t
+iterative_init_csr(const size_t *row_ptr, const size_t *cols,
+                   const double *vals, const double *b, size_t n,
+                   const char *initial_point, iterative_method_t method,
+                   const char *relaxation, process_t process,
+                   size_t process_n);
+
+/*
+ * Performs the iterative method for the given system in `t`.
+ *
+ * A is kept in compressed sparse rows. Every step solves the i-th equation
+ * for x_i: jacobi's method from x_n alone, updating the rows all at once on
+ * `t->threads_c` threads, and the gauss-seidel method from the x_i already
+ * updated in the step, one row after another. With `t->red_black` the
+ * gauss-seidel method updates the even rows all at once and then the odd
+ * rows from them, on threads; for systems like the discretized PDEs, where
+ * the even unknowns only depend on the odd ones, this is the same as
+ * ordering the even rows first. ITERATIVE_SOR moves x_i from the gauss-seidel
+ * value by the relaxation factor. The process is done once every unknown
+ * satisfies it.
+ *
+ * The iteration is taken as diverged once x_(n+1) isn't finite or the
+ * correction x_(n+1) - x_n, the residual of x_n preconditioned by the
+ * splitting of the method, grew over `DIVERGENCE_STEPS` steps in a row.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid A, b, initial point or relaxation factor, a zero on
+ *   the diagonal of A or the iteration diverged.
+ * - err_steps_max: `STEPS_MAX` steps are not enough.
+ */
+int
+iterative_perform(iterative_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `iterative_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `iterative_perform()`.
+ */
+int
+iterative_begin(iterative_t *t);
+
+/*
+ * Computes the next step of the iterative method and appends it to
+ * `t->steps`. Sets `t->done` once the given process is satisfied, after which
+ * the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `iterative_perform()`.
+ */
+int
+iterative_step(iterative_t *t);
+
+/*
+ * Returns a range over the steps of the iterative method where each step is
+ * only computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<iterative_t, iterative_s, iterative_step>
+iterative_steps(iterative_t *t);
+
+/*
+ * Same as `iterative_perform()`, `iterative_begin()`, `iterative_step()` and
+ * `iterative_steps()` but with the process policy `P` (see "Process
+ * Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+iterative_perform(iterative_t *t);
+
+template <typename P>
+int
+iterative_begin(iterative_t *t);
+
+template <typename P>
+int
+iterative_step(iterative_t *t);
+
+template <typename P>
+steps_range<iterative_t, iterative_s, iterative_step<P>>
+iterative_steps(iterative_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+iterative_free(iterative_t *t);
+
+/* == 3. conjugate gradient == */
+
+/*
+ * Initializes a 'conjugate_gradient_t' for A x = b with A symmetric positive
+ * definite and `a` and `b` as of `elimination_init()`, starting with every
+ * unknown at `initial_point`.
+ *
+ * `iterations_max` is 0, `threads_c` 0 (all cores) and `on_step` and `data`
+ * NULL, all of which can be changed before performing.
+ *
+ * Returns the initialized 'conjugate_gradient_t'.
+ */
+conjugate_gradient_t
+conjugate_gradient_init(const char *a, const char *b, const char *initial_point,
+                        precond_t precond, process_t process,
+                        size_t process_n);
+
+/*
+ * Same as `conjugate_gradient_init()` but for A and b in compressed sparse rows
+ * as of `iterative_init_csr()`.
+ */
+conjugate_gradient_t
+conjugate_gradient_init_csr(const size_t *row_ptr, const size_t *cols,
+                            const double *vals, const double *b, size_t n,
+                            const char *initial_point, precond_t precond,
+                            process_t process, size_t process_n);
+
+/*
+ * Same as `conjugate_gradient_init()` but for A in the matrix market file
+ * `a_file`, real or integer coordinates, general or symmetric, and b in the
+ * matrix market array `b_file`, or every b_i being 1 if `b_file` is NULL. The
+ * files are read on beginning.
+ */
+conjugate_gradient_t
+conjugate_gradient_init_file(const char *a_file, const char *b_file,
+                             const char *initial_point, precond_t precond,
+                             process_t process, size_t process_n);
+
+/*
+ * Performs the preconditioned conjugate gradient method for the given system
+ * in `t`.
+ *
+ * A is kept in compressed sparse rows; the matrix market files are mapped into
+ * memory and parsed in place rather than read into a buffer. Every step takes
+ * a product of A on `t->threads_c` threads and applies the preconditioner
+ * `t->precond`, with the dot products summed in fixed chunks so that the steps
+ * don't depend on the number of threads. The steps aren't kept: every step is
+ * passed to `t->on_step`, which can stop the solve by returning non-zero, and
+ * only the last one is kept in `t->step`. The process is done when ||x_(n+1)||
+ * satisfies it or the residual vanishes.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid A, b, files or initial point or the iteration
+ *   diverged.
+ * - err_condition_not_met: A isn't symmetric positive definite, as found by a
+ *   direction p with p . A p <= 0.
+ * - err_singular_matrix: The preconditioner can't be set up for A.
+ * - err_steps_max: `t->iterations_max` steps are not enough.
+ */
+int
+conjugate_gradient_perform(conjugate_gradient_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `conjugate_gradient_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `conjugate_gradient_perform()`.
+ */
+int
+conjugate_gradient_begin(conjugate_gradient_t *t);
+
+/*
+ * Computes the next step of the conjugate gradient method into `t->step` and
+ * passes it to `t->on_step`. Sets `t->done` once the given process is
+ * satisfied or `t->on_step` returns non-zero, after which the call does
+ * nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `conjugate_gradient_perform()`.
+ */
+int
+conjugate_gradient_step(conjugate_gradient_t *t);
+
+/*
+ * Same as `conjugate_gradient_perform()`, `conjugate_gradient_begin()` and
+ * `conjugate_gradient_step()` but with the process policy `P` (see "Process
+ * Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+conjugate_gradient_perform(conjugate_gradient_t *t);
+
+template <typename P>
+int
+conjugate_gradient_begin(conjugate_gradient_t *t);
+
+template <typename P>
+int
+conjugate_gradient_step(conjugate_gradient_t *t);
+
+/*
+ * An `on_step` writing `step` as a line of n, alpha, beta, the residual norm
+ * and the norm of x separated by tabs to the 'std::ostream' `data`.
+ *
+ * Returns 0 so that the solve goes on.
+ */
+int
+conjugate_gradient_write_step(const conjugate_gradient_s *step, void *data);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+conjugate_gradient_free(conjugate_gradient_t *t);
+
+/* = 5 - INTERPOLATION = */
+
+/* == 1. newton's and lagrange's interpolation == */
+
+/*
+ * Initializes an 'interpolation_t' for the points of x `x` and y `y`, lists of
+ * constants separated by ';' as in "1; 2; 3" and "1; 8; 27", to interpolate
+ * y at `at`.
+ *
+ * `threads_c` is 0 (all cores), which can be changed before evaluating.
+ *
+ * Returns the initialized 'interpolation_t'.
+ */
+interpolation_t
+interpolation_init(const char *x, const char *y, const char *at,
+                   interpolation_method_t method, process_t process,
+                   size_t process_n);
+
+/*
+ * Interpolates the points in `t` by the polynomial through all of them, with
+ * the difference table as the steps, a column of the table per step, and the
+ * interpolated y at `t->at` in `t->value`.
+ *
+ * All the methods give the same polynomial; the process only rounds off the
+ * values of the steps. INTERPOLATION_FORWARD and INTERPOLATION_BACKWARD show
+ * the table of plain differences, the former taking the top diagonal of it
+ * and the latter the bottom one. INTERPOLATION_LAGRANGE shows the terms of
+ * the lagrange's polynomial at `t->at` rather than a table.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid x, y or `at`, less than 2 points, a repeated x, x not
+ *   equally spaced for INTERPOLATION_FORWARD and INTERPOLATION_BACKWARD, or
+ *   values that aren't finite.
+ */
+int
+interpolation_perform(interpolation_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `interpolation_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `interpolation_perform()`.
+ */
+int
+interpolation_begin(interpolation_t *t);
+
+/*
+ * Computes the next column of the difference table, or the next term for
+ * INTERPOLATION_LAGRANGE. Sets `t->value` and `t->done` once the table is
+ * complete, after which the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `interpolation_perform()`.
+ */
+int
+interpolation_step(interpolation_t *t);
+
+/*
+ * Returns a range over the steps of the interpolation where each step is only
+ * computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<interpolation_t, interpolation_s, interpolation_step>
+interpolation_steps(interpolation_t *t);
+
+/*
+ * Adds the point (`x`, `y`) after the points of the performed `t`, appending
+ * them to `t->x` and `t->y`.
+ *
+ * Only the new bottom diagonal of the difference table is computed, from the
+ * one before it, so that a point is added in O(n) rather than the table being
+ * rebuilt: every step gets the new difference of its order and a step is
+ * added for the new order. For INTERPOLATION_LAGRANGE every term is updated
+ * in place instead and the new term added. `t->value` is updated likewise.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_condition_not_met: `t` isn't performed.
+ * - err_x_input: Invalid `x` or `y`, `x` being one of the x, not spaced equally
+ *   after the last x for INTERPOLATION_FORWARD and INTERPOLATION_BACKWARD, or
+ *   values that aren't finite. `t` is then left as it was.
+ */
+int
+interpolation_add_point(interpolation_t *t, const char *x, const char *y);
+
+/*
+ * Same as `interpolation_perform()`, `interpolation_begin()`,
+ * `interpolation_step()`, `interpolation_steps()` and
+ * `interpolation_add_point()` but with the process policy `P` (see "Process
+ * Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+interpolation_perform(interpolation_t *t);
+
+template <typename P>
+int
+interpolation_begin(interpolation_t *t);
+
+template <typename P>
+int
+interpolation_step(interpolation_t *t);
+
+template <typename P>
+steps_range<interpolation_t, interpolation_s, interpolation_step<P>>
+interpolation_steps(interpolation_t *t);
+
+template <typename P>
+int
+interpolation_add_point(interpolation_t *t, const char *x, const char *y);
+
+/*
+ * Evaluates the polynomial of the performed `t` at the `n` points `x` into
+ * `y`, unrounded, for evaluating it at many points at once.
+ *
+ * The polynomial is evaluated in its newton's form by nested multiplication
+ * over blocks of points, a block at a time through every coefficient so that
+ * the loops vectorize, with the blocks shared out to `t->threads_c` threads.
+ *
+ * Returns 0 on success and err_condition_not_met if `t` isn't performed.
+ */
+int
+interpolation_eval(const interpolation_t *t, const double *x, size_t n,
+                   double *y);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+interpolation_free(interpolation_t *t);
+
+/* == 2. cubic splines == */
+
+/*
+ * Initializes a 'spline_t' for the points of x `x` and y `y` as of
+ * `interpolation_init()`, x in increasing order, to interpolate y at `at`.
+ * `slopes` is "S'(x_0); S'(x_n)" for SPLINE_CLAMPED and else ignored.
+ *
+ * `threads_c` is 0 (all cores), which can be changed before evaluating.
+ *
+ * Returns the initialized 'spline_t'.
+ */
+spline_t
+spline_init(const char *x, const char *y, const char *at, spline_end_t ends,
+            const char *slopes, process_t process, size_t process_n);
+
+/*
+ * Same as `spline_init()` but for the `n` points of x `x` and y `y` as values,
+ * which are copied, for splines through too many points to be written out.
+ */
+spline_t
+spline_init_values(const double *x, const double *y, size_t n, const char *at,
+                   spline_end_t ends, const char *slopes, process_t process,
+                   size_t process_n);
+
+/*
+ * Interpolates the points in `t` by the cubic spline through them, with the
+ * coefficients of the cubic of every segment as the steps and the
+ * interpolated y at `t->at` in `t->value`.
+ *
+ * The second derivatives at the points are solved for at once on beginning,
+ * the system being tridiagonal, by the thomas algorithm in O(n). The steps
+ * then only round off the coefficients of a segment each.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid x, y, `at` or slopes, less than 2 points, x not in
+ *   increasing order, or values that aren't finite.
+ */
+int
+spline_perform(spline_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `spline_step()`, solving for
+ * the coefficients of every segment.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `spline_perform()`.
+ */
+int
+spline_begin(spline_t *t);
+
+/*
+ * Appends the coefficients of the next segment to `t->steps`. Sets `t->value`
+ * and `t->done` after the last segment, after which the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `spline_perform()`.
+ */
+int
+spline_step(spline_t *t);
+
+/*
+ * Returns a range over the steps of the spline where each step is only
+ * computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<spline_t, spline_s, spline_step>
+spline_steps(spline_t *t);
+
+/*
+ * Same as `spline_perform()`, `spline_begin()`, `spline_step()` and
+ * `spline_steps()` but with the process policy `P` (see "Process Policies")
+ * instead of `t->process`.
+ */
+template <typename P>
+int
+spline_perform(spline_t *t);
+
+template <typename P>
+int
+spline_begin(spline_t *t);
+
+template <typename P>
+int
+spline_step(spline_t *t);
+
+template <typename P>
+steps_range<spline_t, spline_s, spline_step<P>>
+spline_steps(spline_t *t);
+
+/*
+ * Evaluates the spline of the begun or performed `t` at the `n` points `x`,
+ * sorted or not, into `y`, unrounded, for evaluating it at many points at
+ * once. Points outside of [x_0, x_n] take the cubic of the nearest segment.
+ *
+ * The segment of a point is looked up in an index of equal buckets of [x_0,
+ * x_n] and searched for among the few segments of its bucket. The cubics of
+ * `POLYNOMIAL_BLOCK` points are then evaluated together so that the loop
+ * vectorizes, with the blocks shared out to `t->threads_c` threads.
+ *
+ * Returns 0 on success and err_condition_not_met if `t` isn't begun.
+ */
+int
+spline_eval(const spline_t *t, const double *x, size_t n, double *y);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+spline_free(spline_t *t);
+
+/* = 6 - CURVE FITTING = */
+
+/* == 1. least squares == */
+
+/*
+ * Initializes a 'fit_t' for the points of x `x` and y `y` separated by ';' to
+ * fit `model` to, `degree` being the degree of FIT_POLYNOMIAL and else
+ * ignored.
+ *
+ * `threads_c` is 0 (all cores), which can be changed before performing.
+ *
+ * Returns the initialized 'fit_t'.
+ */
+fit_t
+fit_init(const char *x, const char *y, fit_model_t model, size_t degree,
+         process_t process, size_t process_n);
+
+/*
+ * Same as `fit_init()` but for the points in the file `file` of `format`,
+ * which is read on beginning, for more points than can be held in memory.
+ */
+fit_t
+fit_init_file(const char *file, fit_format_t format, fit_model_t model,
+              size_t degree, process_t process, size_t process_n);
+
+/*
+ * Fits `t->model` to the points in `t` by least squares, with the sums of the
+ * normal equations as the steps, a power of x each, and the coefficients in
+ * `t->coefs`.
+ *
+ * The sums are accumulated on beginning in a single pass over the points. A
+ * file is mapped into memory and parsed in place in chunks of `FIT_CHUNK`
+ * bytes, `FIT_ROUND` at a time on `t->threads_c` threads, with the pages of a
+ * round dropped once summed so that the memory doesn't grow with the points.
+ * The sums of the chunks are added in order so that they don't depend on the
+ * number of threads. The normal equations are solved after the last step.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid x, y or file, a degree of 0 or above
+ *   `FIT_DEGREE_MAX`, y <= 0 for FIT_EXPONENTIAL or values that aren't
+ *   finite.
+ * - err_singular_matrix: Too few distinct x for the degree.
+ */
+int
+fit_perform(fit_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `fit_step()`, summing over the
+ * points.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `fit_perform()`.
+ */
+int
+fit_begin(fit_t *t);
+
+/*
+ * Appends the sums of the next power of x to `t->steps`. Sets `t->coefs` and
+ * `t->done` after the last power, after which the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `fit_perform()`.
+ */
+int
+fit_step(fit_t *t);
+
+/*
+ * Returns a range over the steps of the fit where each step is only computed
+ * when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<fit_t, fit_s, fit_step>
+fit_steps(fit_t *t);
+
+/*
+ * Same as `fit_perform()`, `fit_begin()`, `fit_step()` and `fit_steps()` but
+ * with the process policy `P` (see "Process Policies") instead of
+ * `t->process`.
+ */
+template <typename P>
+int
+fit_perform(fit_t *t);
+
+template <typename P>
+int
+fit_begin(fit_t *t);
+
+template <typename P>
+int
+fit_step(fit_t *t);
+
+template <typename P>
+steps_range<fit_t, fit_s, fit_step<P>>
+fit_steps(fit_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+fit_free(fit_t *t);
+
+/* = 7 - NUMERICAL DIFFERENTIATION = */
+
+/* == 1. finite differences and richardson == */
+
+/*
+ * Initializes a 'differentiation_t' for the derivative of `fx` at `x` by
+ * `difference` starting with the step size `h`, extrapolated by
+ * `extrapolation`.
+ *
+ * Returns the initialized 'differentiation_t'.
+ */
+differentiation_t
+differentiation_init(const char *fx, const char *x, const char *h,
+                     difference_t difference, extrapolation_t extrapolation,
+                     process_t process, size_t process_n);
+
+/*
+ * Performs the differentiation for the given inputs in `t`.
+ *
+ * Every step halves h. With EXTRAPOLATION_RICHARDSON every step adds a row to
+ * the richardson table, D(k, j) = D(k, j-1) + (D(k, j-1) - D(k-1, j-1)) /
+ * (r^j - 1), r being 4 for DIFFERENCE_CENTRAL, whose error is in the even
+ * powers of h, and else 2. The process is done when the derivative satisfies
+ * it.
+ *
+ * f is compiled once and evaluated at every node of the whole table, all the
+ * step sizes up to `DIFFERENTIATION_STEPS_MAX`, in a single batch on
+ * beginning.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_fx_parse: Invalid input in f(x).
+ * - err_x_input: Invalid x or h or f isn't finite at a node.
+ * - err_steps_max: `DIFFERENTIATION_STEPS_MAX` steps are not enough.
+ */
+int
+differentiation_perform(differentiation_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `differentiation_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `differentiation_perform()`.
+ */
+int
+differentiation_begin(differentiation_t *t);
+
+/*
+ * Computes the next step of the differentiation and appends it to `t->steps`.
+ * Sets `t->done` once the given process is satisfied, after which the call
+ * does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `differentiation_perform()`.
+ */
+int
+differentiation_step(differentiation_t *t);
+
+/*
+ * Returns a range over the steps of the differentiation where each step is
+ * only computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<differentiation_t, differentiation_s, differentiation_step>
+differentiation_steps(differentiation_t *t);
+
+/*
+ * Same as `differentiation_perform()`, `differentiation_begin()`,
+ * `differentiation_step()` and `differentiation_steps()` but with the process
+ * policy `P` (see "Process Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+differentiation_perform(differentiation_t *t);
+
+template <typename P>
+int
+differentiation_begin(differentiation_t *t);
+
+template <typename P>
+int
+differentiation_step(differentiation_t *t);
+
+template <typename P>
+steps_range<differentiation_t, differentiation_s, differentiation_step<P>>
+differentiation_steps(differentiation_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+differentiation_free(differentiation_t *t);
+
+/* = 8 - EIGENVALUES = */
+
+/* == 1. power method and inverse iteration == */
+
+/*
+ * Initializes a 'power_iteration_t' for an eigenvalue of A, with `a` as of
+ * `elimination_init()`, starting with x_0 of the entries of `initial_vector`
+ * separated by ';' and shifted by `shift`, "0" for the plain methods.
+ *
+ * `threads_c` is 0 (all cores), which can be changed before performing.
+ *
+ * Returns the initialized 'power_iteration_t'.
+ */
+power_iteration_t
+power_iteration_init(const char *a, const char *initial_vector,
+                     power_method_t method, const char *shift,
+                     process_t process, size_t process_n);
+
+/*
+ * Same as `power_iteration_init()` but for the `n` x `n` row major A `a` and
+ * the `n` entries of x_0 `initial_vector` as values, which are copied, for
+ * matrices too large to be written out.
+ */
+power_iteration_t
+power_iteration_init_values(const double *a, const double *initial_vector,
+                            size_t n, power_method_t method, const char *shift,
+                            process_t process, size_t process_n);
+
+/*
+ * Performs the power method or the inverse iteration for the given matrix in
+ * `t`.
+ *
+ * Every step takes y = (A - s I) x_n, with the rows on `t->threads_c`
+ * threads, for POWER_DIRECT and solves (A - s I) y = x_n for POWER_INVERSE,
+ * A - s I being factorized once on beginning as of `elimination_perform()`.
+ * x_(n+1) is y scaled by its entry of the largest magnitude m, m + s being
+ * the estimate of the eigenvalue for POWER_DIRECT and s + 1 / m for
+ * POWER_INVERSE. The process is done when the eigenvalue and every entry of
+ * x_(n+1) satisfy it, and so do the eigenvalue minus and plus the residual
+ * ||A x - eigenvalue x|| of the step, x_n for POWER_DIRECT and x_(n+1) for
+ * POWER_INVERSE: estimates alike without x being an eigenvector, as for a
+ * rotation, go on up to `STEPS_MAX`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid or non-square A, initial vector or shift, x_0 being
+ *   0 or x_(n+1) isn't finite.
+ * - err_singular_matrix: A - s I is singular for POWER_INVERSE, the shift
+ *   being an eigenvalue.
+ * - err_steps_max: `STEPS_MAX` steps are not enough.
+ */
+int
+power_iteration_perform(power_iteration_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `power_iteration_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `power_iteration_perform()`.
+ */
+int
+power_iteration_begin(power_iteration_t *t);
+
+/*
+ * Computes the next step of the iteration and appends it to `t->steps`. Sets
+ * `t->done` once the given process is satisfied, after which the call does
+ * nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `power_iteration_perform()`.
+ */
+int
+power_iteration_step(power_iteration_t *t);
+
+/*
+ * Returns a range over the steps of the iteration where each step is only
+ * computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<power_iteration_t, power_iteration_s, power_iteration_step>
+power_iteration_steps(power_iteration_t *t);
+
+/*
+ * Same as `power_iteration_perform()`, `power_iteration_begin()`,
+ * `power_iteration_step()` and `power_iteration_steps()` but with the process
+ * policy `P` (see "Process Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+power_iteration_perform(power_iteration_t *t);
+
+template <typename P>
+int
+power_iteration_begin(power_iteration_t *t);
+
+template <typename P>
+int
+power_iteration_step(power_iteration_t *t);
+
+template <typename P>
+steps_range<power_iteration_t, power_iteration_s, power_iteration_step<P>>
+power_iteration_steps(power_iteration_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+power_iteration_free(power_iteration_t *t);
+
+/* == 2. qr algorithm == */
+
+/*
+ * Initializes a 'qr_algorithm_t' for every eigenvalue of A, with `a` as of
+ * `elimination_init()`.
+ *
+ * `threads_c` is 0 (all cores), which can be changed before performing.
+ *
+ * Returns the initialized 'qr_algorithm_t'.
+ */
+qr_algorithm_t
+qr_algorithm_init(const char *a, process_t process, size_t process_n);
+
+/*
+ * Same as `qr_algorithm_init()` but for the `n` x `n` row major A `a` as
+ * values, which are copied, for matrices too large to be written out.
+ */
+qr_algorithm_t
+qr_algorithm_init_values(const double *a, size_t n, process_t process,
+                         size_t process_n);
+
+/*
+ * Finds every eigenvalue of the matrix in `t` by the shifted QR algorithm.
+ *
+ * A is reduced on beginning to the upper hessenberg form H = Q^T A Q, of the
+ * same eigenvalues, by a householder reflector per column, the products of
+ * every reflector with the rest of the matrix being taken tile by tile on
+ * `t->threads_c` threads. Every step is then a francis double shift sweep
+ * over the last unreduced block of H, the shifts being the eigenvalues of
+ * its trailing 2 x 2 block so that complex conjugate pairs are found in real
+ * arithmetic. Once a subdiagonal entry is negligible next to its neighbours
+ * on the diagonal the block splits there, giving an eigenvalue off a 1 x 1
+ * block or a pair off a 2 x 2 one.
+ *
+ * The process only rounds off the values of the steps and of the
+ * eigenvalues, the algorithm going on until every eigenvalue is found. The
+ * eigenvalues are in the order of the rows of H they are found at.
+ *
+ * Returns 0 on success and an error code on failure. The error codes can be:
+ * - err_x_input: Invalid or non-square A.
+ * - err_steps_max: `QR_SWEEPS_MAX` sweeps don't find the next eigenvalue.
+ */
+int
+qr_algorithm_perform(qr_algorithm_t *t);
+
+/*
+ * Prepares `t` for step by step evaluation with `qr_algorithm_step()`.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `qr_algorithm_perform()`.
+ */
+int
+qr_algorithm_begin(qr_algorithm_t *t);
+
+/*
+ * Performs the next sweep of the QR algorithm and appends it to `t->steps`.
+ * Sets `t->re`, `t->im` and `t->done` once every eigenvalue is found, after
+ * which the call does nothing.
+ *
+ * Returns 0 on success and an error code on failure. The error codes are the
+ * same as of `qr_algorithm_perform()`.
+ */
+int
+qr_algorithm_step(qr_algorithm_t *t);
+
+/*
+ * Returns a range over the steps of the QR algorithm where each step is only
+ * computed when the iteration reaches it.
+ *
+ * Any error is stored in the `err` of the returned range.
+ */
+steps_range<qr_algorithm_t, qr_algorithm_s, qr_algorithm_step>
+qr_algorithm_steps(qr_algorithm_t *t);
+
+/*
+ * Same as `qr_algorithm_perform()`, `qr_algorithm_begin()`,
+ * `qr_algorithm_step()` and `qr_algorithm_steps()` but with the process
+ * policy `P` (see "Process Policies") instead of `t->process`.
+ */
+template <typename P>
+int
+qr_algorithm_perform(qr_algorithm_t *t);
+
+template <typename P>
+int
+qr_algorithm_begin(qr_algorithm_t *t);
+
+template <typename P>
+int
+qr_algorithm_step(qr_algorithm_t *t);
+
+template <typename P>
+steps_range<qr_algorithm_t, qr_algorithm_s, qr_algorithm_step<P>>
+qr_algorithm_steps(qr_algorithm_t *t);
+
+/* Free's dynamically allocated resources from the struct. */
+void
+qr_algorithm_free(qr_algorithm_t *t);
+
+} /* namespace spnm */
+
+/*
+ ===============================================================================
+ |                                    Utils                                    |
+ ===============================================================================
+ */
+
+namespace spnm_utils
+{
+
+/* = STRING = */
+
+char *
+strdup(const char *str);
+
+/* = F(X) = */
+
+/* Parses `fx` as f(x) logging any error to `log`. Returns NULL on error. */
+spnm::fx_t *
+fx_parse(const char *fx, std::ostream *log);
+
+/* Returns an empty string "" on error. */
+std::string
+fx_val_string(const char *x, spnm::fx_t *f);
+
+/* Returns '*' on error. */
+char
+fx_val_sign(const char *x, spnm::fx_t *f);
+
+/* Returns f(x) formatted as an approximated value for use as the next x.
+ * Returns an empty string "" on error or if the value isn't finite. */
+std::string
+fx_val_approx(const char *x, spnm::fx_t *f);
+
+/*
+ * Parses f(x; p) with the parameter named `param` for the native evaluator
+ * only, with `param` being 0 until set with `fx_set_param()`. Returns NULL on
+ * error.
+ */
+spnm::fx_t *
+fx_parse_param(const char *fx, const char *param, std::ostream *log);
+
+/* = F(X) SYSTEMS = */
+
+/* Parses the system of the `vars_c` functions `fx` in the variables `vars`
+ * logging any error to `log`. Systems are only evaluated natively so any f_i
+ * the native evaluator can't handle is an error. Returns NULL on error. */
+spnm::fxs_t *
+fxs_parse(const char *const *fx, const char *const *vars, size_t vars_c,
+          std::ostream *log);
+
+/* Parses the stencil `fx` of a `newton_krylov_t` (see `newton_krylov_init()`)
+ * logging any error to `log`. Only evaluated natively like the systems.
+ * Returns NULL on error. */
+spnm::sparse_fx_t *
+sparse_fx_parse(const char *fx, const char *const *vars, const int *offsets,
+                size_t vars_c, size_t unknowns_c, const char *boundary_lower,
+                const char *boundary_upper, std::ostream *log);
+
+/* = SPARSE SYSTEMS = */
+
+/* Parses A and b given as of `spnm::elimination_init()` into a sparse system
+ * logging any error to `log`. Returns NULL on error. */
+spnm::sparse_system_t *
+sparse_system_parse(const char *a, const char *b, std::ostream *log);
+
+/* Reads A from the matrix market file `a_file` and b from `b_file`, or every
+ * b_i being 1 if NULL, as of `spnm::conjugate_gradient_init_file()` into a
+ * sparse system logging any error to `log`. Returns NULL on error. */
+spnm::sparse_system_t *
+sparse_system_read(const char *a_file, const char *b_file, std::ostream *log);
+
+/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+
+/* == 1. bisection == */
+
+/* Returns an empty string "" on error. */
+std::string
+bisection_get_c(const char *a, const char *b);
+
+/* == 2. secant == */
+
+/* Returns an empty string "" on error. */
+std::string
+secant_get_x_next(const char *x_prev, const char *fx_prev, const char *x_n,
+                  const char *fx_n);
+
+/* == 3. fixed point == */
+
+/* Returns the Aitken's delta squared extrapolation of the iterates `x0`, `x1`
+ * and `x2`. Returns an empty string "" on error. */
+std::string
+fixed_point_get_x_acc(const char *x0, const char *x1, const char *x2);
+
+/* == 4. newton system == */
+
+/* Evaluates the system `f` at `x_n` into `fx_n` and the next iterate of the
+ * newton's method into `x_next`. Returns 0 on success and err_x_input or
+ * err_singular_matrix on error. */
+int
+newton_system_get_x_next(const char *const *x_n, spnm::fxs_t *f,
+                         std::string *fx_n, std::string *x_next);
+
+/* == 5. newton-krylov == */
+
+/* Sets all the `x_c` values of `x` to `initial_point`. Returns 0 on error. */
+int
+newton_krylov_set_x(const char *initial_point, double *x, size_t x_c);
+
+/* Performs a step of the newton-krylov method on the stencil `f` from `x` to
+ * x_(n+1) in place, on `threads_c` threads, with the norms of the step being
+ * formatted as approximated values. Returns 0 on success and err_x_input or
+ * err_singular_matrix on error. */
+int
+newton_krylov_get_x_next(spnm::sparse_fx_t *f, double *x,
+                         spnm::precond_t precond, size_t threads_c,
+                         std::string *residual_norm,
+                         size_t      *linear_iterations_c,
+                         std::string *linear_residual_norm,
+                         std::string *x_norm);
+
+/* = 2 - NUMERICAL INTEGRATION = */
+
+/* == 1. newton-cotes and romberg == */
+
+/* Evaluates the limits of `t` into `t->a` and `t->b`. Returns 0 on error. */
+int
+integration_set_limits(spnm::integration_t *t);
+
+/* Computes the next step of the integration `t` from its state, with `h`, the
+ * integral and for QUAD_ROMBERG the `t->steps_c + 1` values of the row of the
+ * table `row` formatted as approximated values. Returns 0 on success and
+ * err_x_input on error. */
+int
+integration_get_next(spnm::integration_t *t, std::string *h,
+                     std::string *integral, std::string *row);
+
+/* == 2. adaptive gauss-kronrod == */
+
+/* Evaluates the limits and the tolerance of `t` and sets up its queue.
+ * Returns 0 on error. */
+int
+gauss_kronrod_set_up(spnm::gauss_kronrod_t *t);
+
+/* Performs the next round of `t` with the integral and the estimate of its
+ * error `error_val` formatted as approximated values. Returns 0 on success
+ * and err_x_input or err_deadline on error. */
+int
+gauss_kronrod_get_next(spnm::gauss_kronrod_t *t, std::string *integral,
+                       std::string *error, double *error_val);
+
+/* Returns the number of subintervals of `t`. */
+size_t
+gauss_kronrod_intervals_c(const spnm::gauss_kronrod_t *t);
+
+/* = 3 - ORDINARY DIFFERENTIAL EQUATIONS = */
+
+/* == 1. initial value problems == */
+
+/* Evaluates the inputs of `t` into its state. Returns 0 on error. */
+int
+ode_set_up(spnm::ode_t *t);
+
+/* Takes the next step of `t` with its size `h`, x_n, y_n and, only for
+ * ODE_RK45, the estimate of the local error formatted as approximated values.
+ * Sets `is_end` to 1 on reaching the final x. Returns 0 on success and
+ * err_x_input on error. */
+int
+ode_get_next(spnm::ode_t *t, std::string *h, std::string *x_n,
+             std::string *y_n, std::string *error, int *is_end);
+
+/* = 4 - LINEAR SYSTEMS = */
+
+/* == 1. gaussian elimination and lu decomposition == */
+
+/* Evaluates the inputs of `t`, if given as strings, and sets up its state.
+ * Returns 0 on error. */
+int
+elimination_set_up(spnm::elimination_t *t);
+
+/* Eliminates the next column of `t`, or the next `ELIMINATION_BLOCK` columns
+ * if it keeps no snapshots, setting `columns_c` to their number. The row
+ * swapped in and the pivot of every column go to `pivot` and `pivot_val`,
+ * formatted as an approximated value, and if kept the matrix after it to
+ * `snapshot` as newly allocated strings, else NULL. Returns 0 on success and
+ * err_singular_matrix on error. */
+int
+elimination_get_next(spnm::elimination_t *t, size_t *columns_c,
+                     size_t *pivot, std::string *pivot_val,
+                     char ***snapshot);
+
+/* Back substitutes for x once every column of `t` is eliminated, into `t->x`
+ * as newly allocated strings of approximated values. Returns 0 on success and
+ * err_x_input if x isn't finite. */
+int
+elimination_get_x(spnm::elimination_t *t);
+
+/* == 2. iterative methods == */
+
+/* Evaluates the relaxation factor of `t` and sets x to its initial point.
+ * Returns 0 on error. */
+int
+iterative_set_up(spnm::iterative_t *t);
+
+/* Performs a step of `t` from x_n to x_(n+1) in place, on `t->threads_c`
+ * threads, with the `rows_c` entries of x_(n+1) into `x_next` as newly
+ * allocated strings of approximated values rounded off by `manip`. Returns 0
+ * on success and err_x_input if x_(n+1) isn't finite or the corrections
+ * diverge. */
+int
+iterative_get_next(spnm::iterative_t *t, char **x_next,
+                   void (*manip)(char *, size_t));
+
+/* == 3. conjugate gradient == */
+
+/* Sets x to the initial point of `t` with the first residual, preconditioned
+ * residual and direction. Returns 0 on success and else err_x_input or
+ * err_singular_matrix as of `spnm::conjugate_gradient_perform()`. */
+int
+conjugate_gradient_set_up(spnm::conjugate_gradient_t *t);
+
+/* Performs a step of `t` from x_n to x_(n+1) in place, on `t->threads_c`
+ * threads, with the values of the step as strings of approximated values.
+ * `is_solved` is set to 1 if the residual vanishes. Returns 0 on success and
+ * else err_x_input or err_condition_not_met as of
+ * `spnm::conjugate_gradient_perform()`. */
+int
+conjugate_gradient_get_next(spnm::conjugate_gradient_t *t, std::string *alpha,
+                            std::string *beta, std::string *residual_norm,
+                            std::string *x_norm, int *is_solved);
+
+/* = 5 - INTERPOLATION = */
+
+/* == 1. newton's and lagrange's interpolation == */
+
+/* Evaluates the points and `at` of `t` and sets up its state. Returns 0 on
+ * error. */
+int
+interpolation_set_up(spnm::interpolation_t *t);
+
+/* Computes the next column of the table of `t`, or the next term for
+ * INTERPOLATION_LAGRANGE, into `vals` as `vals_c` newly allocated strings of
+ * approximated values. Returns 0 on success and err_x_input if a value isn't
+ * finite. */
+int
+interpolation_get_next(spnm::interpolation_t *t, char ***vals,
+                       size_t *vals_c);
+
+/* Sets `value` to the interpolated y at `at` of the complete table of `t`
+ * formatted as an approximated value. Returns 0 on success and err_x_input if
+ * it isn't finite. */
+int
+interpolation_get_value(spnm::interpolation_t *t, std::string *value);
+
+/* Adds the point (`x`, `y`) to the complete table of `t` with the new
+ * differences of every order, or for INTERPOLATION_LAGRANGE the updated terms
+ * of every point, into `vals` as `vals_c` newly allocated strings of
+ * approximated values. Returns 0 on success and err_x_input on error, `t`
+ * being left as it was. */
+int
+interpolation_push_point(spnm::interpolation_t *t, const char *x,
+                         const char *y, char ***vals, size_t *vals_c);
+
+/* Appends `val` to the values of `step`, doubling the room for them as
+ * needed. */
+void
+interpolation_push_val(spnm::interpolation_s *step, char *val);
+
+/* == 2. cubic splines == */
+
+/* Evaluates the inputs of `t`, if given as strings, and solves for the
+ * coefficients of every segment. Returns 0 on error. */
+int
+spline_set_up(spnm::spline_t *t);
+
+/* Formats the coefficients of the next segment of `t` as approximated values.
+ */
+void
+spline_get_next(spnm::spline_t *t, std::string *a, std::string *b,
+                std::string *c, std::string *d);
+
+/* Sets `value` to the interpolated y at `at` of `t` formatted as an
+ * approximated value. Returns 0 on success and err_x_input if it isn't
+ * finite. */
+int
+spline_get_value(spnm::spline_t *t, std::string *value);
+
+/* Drops the sign of `str` if it is rounded off to 0, as -0.00000 of a
+ * coefficient which is 0 up to the round-off of the solve. */
+void
+spline_unsigned_zero(char *str);
+
+/* = 6 - CURVE FITTING = */
+
+/* == 1. least squares == */
+
+/* Sums over the points of `t`, read from its file if given as one, into
+ * `t->sums` logging any error to `t->log`. Returns 0 on error. */
+int
+fit_set_up(spnm::fit_t *t);
+
+/* Formats the sums of the next power of x of `t` as approximated values, the
+ * sum of x^k y being "" above the degree. */
+void
+fit_get_next(spnm::fit_t *t, std::string *sum_x, std::string *sum_xy);
+
+/* Solves the normal equations of `t` for the coefficients into `coefs` as
+ * `coefs_c` newly allocated strings of approximated values. Returns 0 on
+ * success and else err_x_input or err_singular_matrix as of
+ * `spnm::fit_perform()`. */
+int
+fit_get_coefs(spnm::fit_t *t, char ***coefs, size_t *coefs_c);
+
+/* = 7 - NUMERICAL DIFFERENTIATION = */
+
+/* == 1. finite differences and richardson == */
+
+/* Evaluates x and h of `t` and f at every node of its table at once. Returns
+ * 0 on error. */
+int
+differentiation_set_up(spnm::differentiation_t *t);
+
+/* Computes the next step of `t` with the step size `h`, the derivative
+ * `derivative` and for EXTRAPOLATION_RICHARDSON the row `row` of the table as
+ * strings of approximated values. Returns 0 on success and err_x_input if f
+ * isn't finite at a node of the step. */
+int
+differentiation_get_next(spnm::differentiation_t *t, std::string *h,
+                         std::string *derivative, std::string *row);
+
+/* = 8 - EIGENVALUES = */
+
+/* == 1. power method and inverse iteration == */
+
+/* Evaluates the inputs of `t`, if given as strings, and sets up A - s I,
+ * factorized for POWER_INVERSE. Returns 0 on success and err_x_input or
+ * err_singular_matrix on error. */
+int
+power_iteration_set_up(spnm::power_iteration_t *t);
+
+/* Performs a step of `t` from x_n to x_(n+1) in place, with the estimate of
+ * the eigenvalue `eigenvalue`, it minus and plus the residual of the step in
+ * the maximum norm `bounds` and the `rows_c` entries of x_(n+1) into
+ * `x_next` as newly allocated strings of approximated values rounded off by
+ * `manip`. Returns 0 on success and err_x_input if x_(n+1) isn't finite. */
+int
+power_iteration_get_next(spnm::power_iteration_t *t, std::string *eigenvalue,
+                         std::string bounds[2], char **x_next,
+                         void (*manip)(char *, size_t));
+
+/* == 2. qr algorithm == */
+
+/* Evaluates A of `t`, if given as a string, reduces it to hessenberg form and
+ * finds the eigenvalues it already gives. Returns 0 on error. */
+int
+qr_algorithm_set_up(spnm::qr_algorithm_t *t);
+
+/* Performs the next sweep of `t` and finds the eigenvalues it gives, with
+ * the rows left `active` and their last subdiagonal entry `subdiagonal`
+ * formatted as an approximated value. Returns 0 on success and err_steps_max
+ * if `spnm::QR_SWEEPS_MAX` sweeps don't find the next eigenvalue. */
+int
+qr_algorithm_get_next(spnm::qr_algorithm_t *t, size_t *active,
+                      std::string *subdiagonal);
+
+/* Formats the eigenvalues of `t` once every one is found into `t->re` and
+ * `t->im` as newly allocated strings of approximated values. */
+void
+qr_algorithm_get_eigenvalues(spnm::qr_algorithm_t *t);
+
+} // namespace spnm_utils
+
+/*
+ ===============================================================================
+ |                                  Templates                                  |
+ ===============================================================================
+ */
+
+namespace spnm
+{
+
+/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+
+/* == 1. bisection method == */
+
+template <typename P>
+int
+bisection_perform(bisection_t *t)
+{
+	int ret;
+	if ((ret = bisection_begin(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = bisection_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+bisection_step(bisection_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == STEPS_MAX)
+		return err_steps_max;
+
+	bisection_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	P::manip(t->a_n, t->process_n);
+	P::manip(t->b_n, t->process_n);
+
+	std::string c_n_string = spnm_utils::bisection_get_c(t->a_n, t->b_n);
+	if (c_n_string == "")
+		return err_x_input;
+	char *c_n = spnm_utils::strdup(c_n_string.c_str());
+	P::manip(c_n, t->process_n);
+	char fc_sign = spnm_utils::fx_val_sign(c_n, t->f);
+	if (fc_sign == '*') {
+		free(c_n);
+		return err_x_input;
+	}
+
+	/* = FILLING DATA = */
+
+	cur_step->n         = t->steps_c + 1;
+	cur_step->a_n       = t->a_n;
+	cur_step->b_n       = t->b_n;
+	cur_step->fa_n_sign = t->fa_sign;
+	cur_step->fb_n_sign = t->fb_sign;
+	cur_step->c_n       = c_n;
+	cur_step->fc_n_sign = fc_sign;
+
+	/* the step owns the strings now */
+	t->a_n = NULL;
+	t->b_n = NULL;
+
+	t->steps_c++;
+
+	if (t->steps_c != 1 && /* avoid checking on first step */
+	    P::is_done(cur_step->c_n, (cur_step - 1)->c_n, t->process_n,
+	               t->steps_c)) {
+		t->done = 1;
+		return 0;
+	}
+
+	/* = FOR NEXT STEP = */
+
+	if (cur_step->fc_n_sign == cur_step->fa_n_sign) {
+		t->a_n     = spnm_utils::strdup(cur_step->c_n);
+		t->b_n     = spnm_utils::strdup(cur_step->b_n);
+		t->fa_sign = cur_step->fc_n_sign;
+	} else {
+		t->a_n     = spnm_utils::strdup(cur_step->a_n);
+		t->b_n     = spnm_utils::strdup(cur_step->c_n);
+		t->fb_sign = cur_step->fc_n_sign;
+	}
+
+	return 0;
+}
+
+template <typename P>
+steps_range<bisection_t, bisection_s, bisection_step<P>>
+bisection_steps(bisection_t *t)
+{
+	steps_range<bisection_t, bisection_s, bisection_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = bisection_begin(t);
+
+	return ret;
+}
+
+/* == 2. secant method == */
+
+template <typename P>
+int
+secant_perform(secant_t *t)
+{
+	int ret;
+	if ((ret = secant_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = secant_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+secant_begin(secant_t *t)
+{
+	/* = PARSE F(X) = */
+
+	if (!t->f && !(t->f = spnm_utils::fx_parse(t->fx, &(t->log))))
+		return err_fx_parse;
+
+	/* resumed, x_(n-1) and x_n being those of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	char *x_prev = spnm_utils::strdup(t->initial_point1);
+	char *x_n    = spnm_utils::strdup(t->initial_point2);
+	P::manip(x_prev, t->process_n);
+	P::manip(x_n, t->process_n);
+
+	std::string fx_prev_string =
+		spnm_utils::fx_val_string(x_prev, t->f);
+	std::string fx_n_string = spnm_utils::fx_val_string(x_n, t->f);
+	if (fx_prev_string == "" || fx_n_string == "") {
+		free(x_prev);
+		free(x_n);
+		return err_x_input;
+	}
+	char *fx_prev = spnm_utils::strdup(fx_prev_string.c_str());
+	char *fx_n    = spnm_utils::strdup(fx_n_string.c_str());
+	P::manip(fx_prev, t->process_n);
+	P::manip(fx_n, t->process_n);
+
+	free(t->x_prev);
+	free(t->fx_prev);
+	free(t->x_n);
+	free(t->fx_n);
+	t->x_prev  = x_prev;
+	t->fx_prev = fx_prev;
+	t->x_n     = x_n;
+	t->fx_n    = fx_n;
+
+	return 0;
+}
+
+template <typename P>
+int
+secant_step(secant_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == STEPS_MAX)
+		return err_steps_max;
+
+	secant_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	std::string x_next_string = spnm_utils::secant_get_x_next(
+		t->x_prev, t->fx_prev, t->x_n, t->fx_n);
+	if (x_next_string == "")
+		return err_x_input;
+	char *x_next = spnm_utils::strdup(x_next_string.c_str());
+	P::manip(x_next, t->process_n);
+
+	std::string fx_next_string =
+		spnm_utils::fx_val_string(x_next, t->f);
+	if (fx_next_string == "") {
+		free(x_next);
+		return err_x_input;
+	}
+	char *fx_next = spnm_utils::strdup(fx_next_string.c_str());
+	P::manip(fx_next, t->process_n);
+
+	/* = FILLING DATA = */
+
+	cur_step->n       = t->steps_c + 1;
+	cur_step->x_prev  = t->x_prev;
+	cur_step->fx_prev = t->fx_prev;
+	cur_step->x_n     = t->x_n;
+	cur_step->fx_n    = t->fx_n;
+	cur_step->x_next  = x_next;
+	cur_step->fx_next = fx_next;
+
+	t->steps_c++;
+
+	if (t->steps_c != 1 && /* avoid checking on first step */
+	    P::is_done(cur_step->x_next, (cur_step - 1)->x_next, t->process_n,
+	               t->steps_c))
+		t->done = 1;
+
+	/* = FOR NEXT STEP = */
+
+	t->x_prev  = t->x_n;
+	t->fx_prev = t->fx_n;
+	t->x_n     = x_next;
+	t->fx_n    = fx_next;
+
+	return 0;
+}
+
+template <typename P>
+steps_range<secant_t, secant_s, secant_step<P>>
+secant_steps(secant_t *t)
+{
+	steps_range<secant_t, secant_s, secant_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = secant_begin<P>(t);
+
+	return ret;
+}
+
+/* == 3. fixed point iteration == */
+
+template <typename P>
+int
+fixed_point_perform(fixed_point_t *t)
+{
+	int ret;
+	if ((ret = fixed_point_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = fixed_point_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+fixed_point_begin(fixed_point_t *t)
+{
+	/* = PARSE G(X) = */
+
+	if (!t->f && !(t->f = spnm_utils::fx_parse(t->gx, &(t->log))))
+		return err_fx_parse;
+
+	/* resumed, x_n being that of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	free(t->x_n);
+	t->x_n = spnm_utils::strdup(t->initial_point);
+	P::manip(t->x_n, t->process_n);
+
+	return 0;
+}
+
+template <typename P>
+int
+fixed_point_step(fixed_point_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == STEPS_MAX)
+		return err_steps_max;
+
+	fixed_point_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	std::string gx_n_string = spnm_utils::fx_val_approx(t->x_n, t->f);
+	if (gx_n_string == "")
+		return err_x_input;
+	char *gx_n = spnm_utils::strdup(gx_n_string.c_str());
+	P::manip(gx_n, t->process_n);
+
+	char *ggx_n  = NULL;
+	char *x_next = NULL;
+	if (t->accel == ACCEL_NONE) {
+		x_next = spnm_utils::strdup(gx_n);
+	} else {
+		std::string ggx_n_string = spnm_utils::fx_val_approx(gx_n, t->f);
+		std::string x_next_string =
+			ggx_n_string == ""
+				? ""
+				: spnm_utils::fixed_point_get_x_acc(
+					  t->x_n, gx_n, ggx_n_string.c_str());
+		if (x_next_string == "") {
+			free(gx_n);
+			return err_x_input;
+		}
+		ggx_n  = spnm_utils::strdup(ggx_n_string.c_str());
+		x_next = spnm_utils::strdup(x_next_string.c_str());
+		P::manip(ggx_n, t->process_n);
+		P::manip(x_next, t->process_n);
+	}
+
+	/* = FILLING DATA = */
+
+	cur_step->n      = t->steps_c + 1;
+	cur_step->x_n    = t->x_n;
+	cur_step->gx_n   = gx_n;
+	cur_step->ggx_n  = ggx_n;
+	cur_step->x_next = x_next;
+
+	/* the step owns the string now */
+	t->x_n = NULL;
+
+	t->steps_c++;
+
+	if (t->steps_c != 1 && /* avoid checking on first step */
+	    P::is_done(cur_step->x_next, (cur_step - 1)->x_next, t->process_n,
+	               t->steps_c)) {
+		t->done = 1;
+		return 0;
+	}
+
+	/* = FOR NEXT STEP = */
+
+	/* Aitken's accelerates the plain iterates while Steffensen's iterates
+	 * on the accelerated ones */
+	if (t->accel == ACCEL_STEFFENSEN)
+		t->x_n = spnm_utils::strdup(cur_step->x_next);
+	else
+		t->x_n = spnm_utils::strdup(cur_step->gx_n);
+
+	return 0;
+}
+
+template <typename P>
+steps_range<fixed_point_t, fixed_point_s, fixed_point_step<P>>
+fixed_point_steps(fixed_point_t *t)
+{
+	steps_range<fixed_point_t, fixed_point_s, fixed_point_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = fixed_point_begin<P>(t);
+
+	return ret;
+}
+
+/* == 4. newton's method for systems == */
+
+template <typename P>
+int
+newton_system_perform(newton_system_t *t)
+{
+	int ret;
+	if ((ret = newton_system_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = newton_system_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+newton_system_begin(newton_system_t *t)
+{
+	/* = CHECK THE SYSTEM = */
+
+	if (t->vars_c == 0 || t->vars_c > VARS_MAX) {
+		t->log << "A system needs 1 to " << VARS_MAX << " variables."
+		       << std::endl;
+		return err_x_input;
+	}
+
+	/* = PARSE F(X) = */
+
+	if (!t->f && !(t->f = spnm_utils::fxs_parse(t->fx, t->vars, t->vars_c,
+	                                            &(t->log))))
+		return err_fx_parse;
+
+	/* resumed, x_n being that of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	for (size_t i = 0; i < t->vars_c; i++) {
+		free(t->x_n[i]);
+		t->x_n[i] = spnm_utils::strdup(t->initial_point[i]);
+		P::manip(t->x_n[i], t->process_n);
+	}
+
+	return 0;
+}
+
+template <typename P>
+int
+newton_system_step(newton_system_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == STEPS_MAX)
+		return err_steps_max;
+
+	newton_system_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	std::string fx_n_string[VARS_MAX];
+	std::string x_next_string[VARS_MAX];
+
+	int ret;
+	if ((ret = spnm_utils::newton_system_get_x_next(
+		     t->x_n, t->f, fx_n_string, x_next_string)) != 0)
+		return ret;
+
+	/* = FILLING DATA = */
+
+	cur_step->n = t->steps_c + 1;
+	for (size_t i = 0; i < t->vars_c; i++) {
+		cur_step->x_n[i]    = t->x_n[i];
+		cur_step->fx_n[i]   = spnm_utils::strdup(fx_n_string[i].c_str());
+		cur_step->x_next[i] = spnm_utils::strdup(x_next_string[i].c_str());
+		P::manip(cur_step->fx_n[i], t->process_n);
+		P::manip(cur_step->x_next[i], t->process_n);
+
+		/* the step owns the string now */
+		t->x_n[i] = NULL;
+	}
+
+	t->steps_c++;
+
+	if (t->steps_c != 1) { /* avoid checking on first step */
+		int done = 1;
+		for (size_t i = 0; i < t->vars_c && done; i++)
+			done = P::is_done(cur_step->x_next[i],
+			                  (cur_step - 1)->x_next[i], t->process_n,
+			                  t->steps_c);
+		if (done) {
+			t->done = 1;
+			return 0;
+		}
+	}
+
+	/* = FOR NEXT STEP = */
+
+	for (size_t i = 0; i < t->vars_c; i++)
+		t->x_n[i] = spnm_utils::strdup(cur_step->x_next[i]);
+
+	return 0;
+}
+
+template <typename P>
+steps_range<newton_system_t, newton_system_s, newton_system_step<P>>
+newton_system_steps(newton_system_t *t)
+{
+	steps_range<newton_system_t, newton_system_s, newton_system_step<P>>
+		ret;
+
+	ret.t   = t;
+	ret.err = newton_system_begin<P>(t);
+
+	return ret;
+}
+
+/* == 5. newton-krylov method == */
+
+template <typename P>
+int
+newton_krylov_perform(newton_krylov_t *t)
+{
+	int ret;
+	if ((ret = newton_krylov_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = newton_krylov_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+newton_krylov_begin(newton_krylov_t *t)
+{
+	/* = PARSE F(X) = */
+
+	if (!t->f &&
+	    !(t->f = spnm_utils::sparse_fx_parse(
+		      t->fx, t->vars, t->offsets, t->vars_c, t->unknowns_c,
+		      t->boundary_lower, t->boundary_upper, &(t->log))))
+		return err_fx_parse;
+
+	/* = FOR FIRST STEP = */
+
+	if (t->steps_c == 0 &&
+	    !spnm_utils::newton_krylov_set_x(t->initial_point, t->x,
+	                                     t->unknowns_c))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+newton_krylov_step(newton_krylov_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == STEPS_MAX)
+		return err_steps_max;
+
+	newton_krylov_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	std::string residual_norm, linear_residual_norm, x_norm;
+	size_t      linear_iterations_c;
+
+	int ret;
+	if ((ret = spnm_utils::newton_krylov_get_x_next(
+		     t->f, t->x, t->precond, t->threads_c, &residual_norm,
+		     &linear_iterations_c, &linear_residual_norm, &x_norm)) != 0)
+		return ret;
+
+	/* = FILLING DATA = */
+
+	cur_step->n                   = t->steps_c + 1;
+	cur_step->residual_norm       = spnm_utils::strdup(residual_norm.c_str());
+	cur_step->linear_iterations_c = linear_iterations_c;
+	cur_step->linear_residual_norm =
+		spnm_utils::strdup(linear_residual_norm.c_str());
+	cur_step->x_norm = spnm_utils::strdup(x_norm.c_str());
+	P::manip(cur_step->residual_norm, t->process_n);
+	P::manip(cur_step->linear_residual_norm, t->process_n);
+	P::manip(cur_step->x_norm, t->process_n);
+
+	t->steps_c++;
+
+	if (t->steps_c != 1 && /* avoid checking on first step */
+	    P::is_done(cur_step->x_norm, (cur_step - 1)->x_norm, t->process_n,
+	               t->steps_c))
+		t->done = 1;
+
+	return 0;
+}
+
+template <typename P>
+steps_range<newton_krylov_t, newton_krylov_s, newton_krylov_step<P>>
+newton_krylov_steps(newton_krylov_t *t)
+{
+	steps_range<newton_krylov_t, newton_krylov_s, newton_krylov_step<P>>
+		ret;
+
+	ret.t   = t;
+	ret.err = newton_krylov_begin<P>(t);
+
+	return ret;
+}
+
+/* = 2 - NUMERICAL INTEGRATION = */
+
+/* == 1. newton-cotes and romberg == */
+
+template <typename P>
+int
+integration_perform(integration_t *t)
+{
+	int ret;
+	if ((ret = integration_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = integration_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+integration_begin(integration_t *t)
+{
+	/* = PARSE F(X) = */
+
+	if (!t->f && !(t->f = spnm_utils::fx_parse(t->fx, &(t->log))))
+		return err_fx_parse;
+
+	/* resumed, the nodes being those of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	if (!spnm_utils::integration_set_limits(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+integration_step(integration_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == INTEGRATION_STEPS_MAX)
+		return err_steps_max;
+
+	integration_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	std::string h_string, integral_string;
+	std::string row_strings[INTEGRATION_STEPS_MAX];
+	if (spnm_utils::integration_get_next(t, &h_string, &integral_string,
+	                                     row_strings) != 0)
+		return err_x_input;
+
+	/* = FILLING DATA = */
+
+	cur_step->n           = t->steps_c + 1;
+	cur_step->intervals_c = t->intervals_c;
+	cur_step->h           = spnm_utils::strdup(h_string.c_str());
+	cur_step->integral    = spnm_utils::strdup(integral_string.c_str());
+	P::manip(cur_step->h, t->process_n);
+	P::manip(cur_step->integral, t->process_n);
+	for (size_t i = 0; i < INTEGRATION_STEPS_MAX; i++) {
+		cur_step->romberg[i] = NULL;
+		if (t->rule != QUAD_ROMBERG || i > t->steps_c)
+			continue;
+		cur_step->romberg[i] =
+			spnm_utils::strdup(row_strings[i].c_str());
+		P::manip(cur_step->romberg[i], t->process_n);
+	}
+
+	t->steps_c++;
+
+	if (t->steps_c != 1 && /* avoid checking on first step */
+	    P::is_done(cur_step->integral, (cur_step - 1)->integral,
+	               t->process_n, t->steps_c))
+		t->done = 1;
+
+	return 0;
+}
+
+template <typename P>
+steps_range<integration_t, integration_s, integration_step<P>>
+integration_steps(integration_t *t)
+{
+	steps_range<integration_t, integration_s, integration_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = integration_begin<P>(t);
+
+	return ret;
+}
+
+/* == 2. adaptive gauss-kronrod == */
+
+template <typename P>
+int
+gauss_kronrod_perform(gauss_kronrod_t *t)
+{
+	int ret;
+	if ((ret = gauss_kronrod_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = gauss_kronrod_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+gauss_kronrod_begin(gauss_kronrod_t *t)
+{
+	/* = PARSE F(X) = */
+
+	if (!t->f && !(t->f = spnm_utils::fx_parse(t->fx, &(t->log))))
+		return err_fx_parse;
+
+	/* resumed, the subintervals being those of the last round */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST ROUND = */
+
+	if (!spnm_utils::gauss_kronrod_set_up(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+gauss_kronrod_step(gauss_kronrod_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == STEPS_MAX)
+		return err_steps_max;
+
+	gauss_kronrod_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	std::string integral_string, error_string;
+	double      error_val;
+	int         ret;
+	if ((ret = spnm_utils::gauss_kronrod_get_next(
+		     t, &integral_string, &error_string, &error_val)) != 0)
+		return ret;
+
+	/* = FILLING DATA = */
+
+	cur_step->n           = t->steps_c + 1;
+	cur_step->intervals_c = spnm_utils::gauss_kronrod_intervals_c(t);
+	cur_step->evals_c     = t->evals_c;
+	cur_step->integral    = spnm_utils::strdup(integral_string.c_str());
+	cur_step->error       = spnm_utils::strdup(error_string.c_str());
+	P::manip(cur_step->integral, t->process_n);
+
+	t->steps_c++;
+
+	if (error_val <= t->error_max ||
+	    (t->steps_c != 1 && /* avoid checking on first round */
+	     P::is_done(cur_step->integral, (cur_step - 1)->integral,
+	                t->process_n, t->steps_c)))
+		t->done = 1;
+
+	return 0;
+}
+
+template <typename P>
+steps_range<gauss_kronrod_t, gauss_kronrod_s, gauss_kronrod_step<P>>
+gauss_kronrod_steps(gauss_kronrod_t *t)
+{
+	steps_range<gauss_kronrod_t, gauss_kronrod_s, gauss_kronrod_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = gauss_kronrod_begin<P>(t);
+
+	return ret;
+}
+
+/* = 3 - ORDINARY DIFFERENTIAL EQUATIONS = */
+
+/* == 1. initial value problems == */
+
+template <typename P>
+int
+ode_perform(ode_t *t)
+{
+	int ret;
+	if ((ret = ode_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = ode_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+ode_begin(ode_t *t)
+{
+	/* = PARSE F(X, Y) = */
+
+	if (!t->f && !(t->f = spnm_utils::fx_parse_param(t->fx, "y",
+	                                                 &(t->log))))
+		return err_fx_parse;
+
+	/* resumed, x_n and y_n being those of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	if (!spnm_utils::ode_set_up(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+ode_step(ode_t *t)
+{
+	if (t->done)
+		return 0;
+
+	ode_s *cur_step = &(t->step);
+
+	/* = ARITHMETIC = */
+
+	std::string h_string, x_n_string, y_n_string, error_string;
+	int         is_end;
+	if (spnm_utils::ode_get_next(t, &h_string, &x_n_string, &y_n_string,
+	                             &error_string, &is_end) != 0)
+		return err_x_input;
+
+	/* = FILLING DATA = */
+
+	/* only the last step is kept */
+	free(cur_step->h);
+	free(cur_step->x_n);
+	free(cur_step->y_n);
+	free(cur_step->error);
+
+	cur_step->n     = t->steps_c + 1;
+	cur_step->h     = spnm_utils::strdup(h_string.c_str());
+	cur_step->x_n   = spnm_utils::strdup(x_n_string.c_str());
+	cur_step->y_n   = spnm_utils::strdup(y_n_string.c_str());
+	cur_step->error = NULL;
+	if (t->method == ODE_RK45)
+		cur_step->error = spnm_utils::strdup(error_string.c_str());
+	P::manip(cur_step->h, t->process_n);
+	P::manip(cur_step->x_n, t->process_n);
+	P::manip(cur_step->y_n, t->process_n);
+
+	t->steps_c++;
+
+	if (is_end)
+		t->done = 1;
+
+	/* = STREAMING = */
+
+	if (t->on_step && t->on_step(cur_step, t->data) != 0)
+		t->done = 1;
+
+	return 0;
+}
+
+/* = 4 - LINEAR SYSTEMS = */
+
+/* == 1. gaussian elimination and lu decomposition == */
+
+template <typename P>
+int
+elimination_perform(elimination_t *t)
+{
+	int ret;
+	if ((ret = elimination_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = elimination_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+elimination_begin(elimination_t *t)
+{
+	/* resumed, the matrix being that of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	if (!spnm_utils::elimination_set_up(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+elimination_step(elimination_t *t)
+{
+	if (t->done)
+		return 0;
+
+	/* = ARITHMETIC = */
+
+	size_t      columns_c, pivot[ELIMINATION_BLOCK];
+	std::string pivot_val[ELIMINATION_BLOCK];
+	char      **snapshot;
+	int         ret;
+	if ((ret = spnm_utils::elimination_get_next(t, &columns_c, pivot,
+	                                            pivot_val, &snapshot)) != 0)
+		return ret;
+
+	/* = FILLING DATA = */
+
+	for (size_t i = 0; i < columns_c; i++) {
+		elimination_s *cur_step = t->steps + t->steps_c;
+
+		cur_step->n         = t->steps_c + 1;
+		cur_step->pivot     = pivot[i] + 1;
+		cur_step->pivot_val = spnm_utils::strdup(pivot_val[i].c_str());
+		cur_step->snapshot  = NULL;
+		P::manip(cur_step->pivot_val, t->process_n);
+
+		t->steps_c++;
+	}
+
+	/* snapshots are of single columns */
+	if (snapshot) {
+		size_t cols_c = t->rows_c + (t->method == ELIMINATION_GAUSS);
+		for (size_t i = 0; i < t->rows_c * cols_c; i++)
+			P::manip(snapshot[i], t->process_n);
+		t->steps[t->steps_c - 1].snapshot = snapshot;
+	}
+
+	/* = BACK SUBSTITUTION = */
+
+	if (t->steps_c == t->rows_c) {
+		if ((ret = spnm_utils::elimination_get_x(t)) != 0)
+			return ret;
+		for (size_t i = 0; i < t->rows_c; i++)
+			P::manip(t->x[i], t->process_n);
+		t->done = 1;
+	}
+
+	return 0;
+}
+
+template <typename P>
+steps_range<elimination_t, elimination_s, elimination_step<P>>
+elimination_steps(elimination_t *t)
+{
+	steps_range<elimination_t, elimination_s, elimination_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = elimination_begin<P>(t);
+
+	return ret;
+}
+
+/* == 2. iterative methods == */
+
+template <typename P>
+int
+iterative_perform(iterative_t *t)
+{
+	int ret;
+	if ((ret = iterative_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = iterative_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+iterative_begin(iterative_t *t)
+{
+	/* = PARSE A AND B = */
+
+	if (!t->system && !(t->system = spnm_utils::sparse_system_parse(
+				    t->a, t->b, &(t->log))))
+		return err_x_input;
+
+	/* resumed, x_n being that of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	if (!spnm_utils::iterative_set_up(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+iterative_step(iterative_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == STEPS_MAX)
+		return err_steps_max;
+
+	iterative_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	char **x_next = (char **)malloc(t->rows_c * sizeof(char *));
+	if (spnm_utils::iterative_get_next(t, x_next, P::manip) != 0) {
+		free(x_next);
+		return err_x_input;
+	}
+
+	/* = FILLING DATA = */
+
+	cur_step->n      = t->steps_c + 1;
+	cur_step->x_next = x_next;
+
+	t->steps_c++;
+
+	/* = CHECK = */
+
+	if (t->steps_c == 1) /* avoid checking on first step */
+		return 0;
+
+	/* done once every unknown is */
+	for (size_t i = 0; i < t->rows_c; i++)
+		if (!P::is_done(x_next[i], (cur_step - 1)->x_next[i],
+		                t->process_n, t->steps_c))
+			return 0;
+	t->done = 1;
+
+	return 0;
+}
+
+template <typename P>
+steps_range<iterative_t, iterative_s, iterative_step<P>>
+iterative_steps(iterative_t *t)
+{
+	steps_range<iterative_t, iterative_s, iterative_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = iterative_begin<P>(t);
+
+	return ret;
+}
+
+/* == 3. conjugate gradient == */
+
+template <typename P>
+int
+conjugate_gradient_perform(conjugate_gradient_t *t)
+{
+	int ret;
+	if ((ret = conjugate_gradient_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = conjugate_gradient_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+conjugate_gradient_begin(conjugate_gradient_t *t)
+{
+	/* = PARSE OR READ A AND B = */
+
+	if (!t->system) {
+		if (t->a_file)
+			t->system = spnm_utils::sparse_system_read(
+				t->a_file, t->b_file, &(t->log));
+		else
+			t->system = spnm_utils::sparse_system_parse(
+				t->a, t->b, &(t->log));
+		if (!t->system)
+			return err_x_input;
+	}
+
+	/* resumed, x and the residual being those of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	return spnm_utils::conjugate_gradient_set_up(t);
+}
+
+template <typename P>
+int
+conjugate_gradient_step(conjugate_gradient_t *t)
+{
+	if (t->done)
+		return 0;
+	size_t steps_max =
+		t->iterations_max ? t->iterations_max : t->rows_c + STEPS_MAX;
+	if (t->steps_c == steps_max)
+		return err_steps_max;
+
+	conjugate_gradient_s *cur_step = &(t->step);
+
+	/* = ARITHMETIC = */
+
+	std::string alpha_string, beta_string, residual_norm_string,
+		x_norm_string;
+	int is_solved, ret;
+	if ((ret = spnm_utils::conjugate_gradient_get_next(
+		     t, &alpha_string, &beta_string, &residual_norm_string,
+		     &x_norm_string, &is_solved)) != 0)
+		return ret;
+
+	/* = FILLING DATA = */
+
+	/* only the last step is kept, but for ||x_n|| to check against */
+	char *x_norm_prev = cur_step->x_norm;
+	free(cur_step->alpha);
+	free(cur_step->beta);
+	free(cur_step->residual_norm);
+
+	cur_step->n             = t->steps_c + 1;
+	cur_step->alpha         = spnm_utils::strdup(alpha_string.c_str());
+	cur_step->beta          = spnm_utils::strdup(beta_string.c_str());
+	cur_step->residual_norm =
+		spnm_utils::strdup(residual_norm_string.c_str());
+	cur_step->x_norm = spnm_utils::strdup(x_norm_string.c_str());
+	P::manip(cur_step->alpha, t->process_n);
+	P::manip(cur_step->beta, t->process_n);
+	P::manip(cur_step->residual_norm, t->process_n);
+	P::manip(cur_step->x_norm, t->process_n);
+
+	t->steps_c++;
+
+	/* = CHECK = */
+
+	/* avoid checking on first step */
+	if (is_solved ||
+	    (t->steps_c > 1 && P::is_done(cur_step->x_norm, x_norm_prev,
+	                                  t->process_n, t->steps_c)))
+		t->done = 1;
+	free(x_norm_prev);
+
+	/* = STREAMING = */
+
+	if (t->on_step && t->on_step(cur_step, t->data) != 0)
+		t->done = 1;
+
+	return 0;
+}
+
+/* = 5 - INTERPOLATION = */
+
+/* == 1. newton's and lagrange's interpolation == */
+
+template <typename P>
+int
+interpolation_perform(interpolation_t *t)
+{
+	int ret;
+	if ((ret = interpolation_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = interpolation_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+interpolation_begin(interpolation_t *t)
+{
+	/* resumed, the table being that of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	if (!spnm_utils::interpolation_set_up(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+interpolation_step(interpolation_t *t)
+{
+	if (t->done)
+		return 0;
+
+	/* = ARITHMETIC = */
+
+	char **vals;
+	size_t vals_c;
+	int    ret;
+	if ((ret = spnm_utils::interpolation_get_next(t, &vals, &vals_c)) != 0)
+		return ret;
+
+	/* = FILLING DATA = */
+
+	interpolation_s *cur_step = t->steps + t->steps_c;
+
+	cur_step->n      = t->steps_c + 1;
+	cur_step->vals_c = 0;
+	cur_step->vals   = NULL;
+	for (size_t i = 0; i < vals_c; i++) {
+		P::manip(vals[i], t->process_n);
+		spnm_utils::interpolation_push_val(cur_step, vals[i]);
+	}
+	free(vals);
+
+	t->steps_c++;
+
+	/* = INTERPOLATED VALUE = */
+
+	size_t steps_c = t->points_c - (t->method != INTERPOLATION_LAGRANGE);
+	if (t->steps_c == steps_c) {
+		std::string value;
+		if ((ret = spnm_utils::interpolation_get_value(t, &value)) != 0)
+			return ret;
+		t->value = spnm_utils::strdup(value.c_str());
+		P::manip(t->value, t->process_n);
+		t->done = 1;
+	}
+
+	return 0;
+}
+
+template <typename P>
+steps_range<interpolation_t, interpolation_s, interpolation_step<P>>
+interpolation_steps(interpolation_t *t)
+{
+	steps_range<interpolation_t, interpolation_s, interpolation_step<P>>
+		ret;
+
+	ret.t   = t;
+	ret.err = interpolation_begin<P>(t);
+
+	return ret;
+}
+
+template <typename P>
+int
+interpolation_add_point(interpolation_t *t, const char *x, const char *y)
+{
+	if (!t->done)
+		return err_condition_not_met;
+
+	/* = ARITHMETIC = */
+
+	char **vals;
+	size_t vals_c;
+	int    ret;
+	if ((ret = spnm_utils::interpolation_push_point(t, x, y, &vals,
+	                                                &vals_c)) != 0)
+		return ret;
+	for (size_t i = 0; i < vals_c; i++)
+		P::manip(vals[i], t->process_n);
+
+	/* = FILLING DATA = */
+
+	interpolation_s *new_step = t->steps + t->steps_c;
+
+	new_step->n      = t->steps_c + 1;
+	new_step->vals_c = 0;
+	new_step->vals   = NULL;
+
+	if (t->method == INTERPOLATION_LAGRANGE) {
+		/* every term has the factor of the new point */
+		for (size_t i = 0; i < t->steps_c; i++) {
+			interpolation_s *step = t->steps + i;
+			free(step->vals[0]);
+			free(step->vals[1]);
+			step->vals[0] = vals[2 * i];
+			step->vals[1] = vals[2 * i + 1];
+		}
+		spnm_utils::interpolation_push_val(new_step, vals[vals_c - 2]);
+		spnm_utils::interpolation_push_val(new_step, vals[vals_c - 1]);
+	} else {
+		/* a difference more of every order and the new order */
+		for (size_t i = 0; i < t->steps_c; i++)
+			spnm_utils::interpolation_push_val(t->steps + i,
+			                                   vals[i]);
+		spnm_utils::interpolation_push_val(new_step, vals[vals_c - 1]);
+	}
+	free(vals);
+
+	t->steps_c++;
+
+	/* = INTERPOLATED VALUE = */
+
+	std::string value;
+	if ((ret = spnm_utils::interpolation_get_value(t, &value)) != 0)
+		return ret;
+	free(t->value);
+	t->value = spnm_utils::strdup(value.c_str());
+	P::manip(t->value, t->process_n);
+
+	return 0;
+}
+
+/* == 2. cubic splines == */
+
+template <typename P>
+int
+spline_perform(spline_t *t)
+{
+	int ret;
+	if ((ret = spline_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = spline_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+spline_begin(spline_t *t)
+{
+	/* resumed, the system being that of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	if (!spnm_utils::spline_set_up(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+spline_step(spline_t *t)
+{
+	if (t->done)
+		return 0;
+
+	/* = ARITHMETIC = */
+
+	std::string a, b, c, d;
+	spnm_utils::spline_get_next(t, &a, &b, &c, &d);
+
+	/* = FILLING DATA = */
+
+	spline_s *cur_step = t->steps + t->steps_c;
+
+	cur_step->n = t->steps_c + 1;
+	cur_step->a = spnm_utils::strdup(a.c_str());
+	cur_step->b = spnm_utils::strdup(b.c_str());
+	cur_step->c = spnm_utils::strdup(c.c_str());
+	cur_step->d = spnm_utils::strdup(d.c_str());
+	P::manip(cur_step->a, t->process_n);
+	P::manip(cur_step->b, t->process_n);
+	P::manip(cur_step->c, t->process_n);
+	P::manip(cur_step->d, t->process_n);
+	spnm_utils::spline_unsigned_zero(cur_step->a);
+	spnm_utils::spline_unsigned_zero(cur_step->b);
+	spnm_utils::spline_unsigned_zero(cur_step->c);
+	spnm_utils::spline_unsigned_zero(cur_step->d);
+
+	t->steps_c++;
+
+	/* = INTERPOLATED VALUE = */
+
+	if (t->steps_c == t->points_c - 1) {
+		std::string value;
+		int         ret;
+		if ((ret = spnm_utils::spline_get_value(t, &value)) != 0)
+			return ret;
+		t->value = spnm_utils::strdup(value.c_str());
+		P::manip(t->value, t->process_n);
+		spnm_utils::spline_unsigned_zero(t->value);
+		t->done = 1;
+	}
+
+	return 0;
+}
+
+template <typename P>
+steps_range<spline_t, spline_s, spline_step<P>>
+spline_steps(spline_t *t)
+{
+	steps_range<spline_t, spline_s, spline_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = spline_begin<P>(t);
+
+	return ret;
+}
+
+/* = 6 - CURVE FITTING = */
+
+/* == 1. least squares == */
+
+template <typename P>
+int
+fit_perform(fit_t *t)
+{
+	int ret;
+	if ((ret = fit_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = fit_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+fit_begin(fit_t *t)
+{
+	/* resumed, the sums being those of the last steps */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	if (!spnm_utils::fit_set_up(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+fit_step(fit_t *t)
+{
+	if (t->done)
+		return 0;
+
+	/* all the sums are taken once the coefficients failed, which are only
+	 * tried again */
+	if (t->steps_c < 2 * t->degree + 1) {
+		/* = ARITHMETIC = */
+
+		std::string sum_x, sum_xy;
+		spnm_utils::fit_get_next(t, &sum_x, &sum_xy);
+
+		/* = FILLING DATA = */
+
+		fit_s *cur_step = t->steps + t->steps_c;
+
+		cur_step->n      = t->steps_c + 1;
+		cur_step->sum_x  = spnm_utils::strdup(sum_x.c_str());
+		cur_step->sum_xy = NULL;
+		P::manip(cur_step->sum_x, t->process_n);
+		if (t->steps_c <= t->degree) {
+			cur_step->sum_xy = spnm_utils::strdup(sum_xy.c_str());
+			P::manip(cur_step->sum_xy, t->process_n);
+		}
+
+		t->steps_c++;
+	}
+
+	/* = COEFFICIENTS = */
+
+	if (t->steps_c == 2 * t->degree + 1) {
+		int ret;
+		if ((ret = spnm_utils::fit_get_coefs(t, &(t->coefs),
+		                                     &(t->coefs_c))) != 0)
+			return ret;
+		for (size_t i = 0; i < t->coefs_c; i++)
+			P::manip(t->coefs[i], t->process_n);
+		t->done = 1;
+	}
+
+	return 0;
+}
+
+template <typename P>
+steps_range<fit_t, fit_s, fit_step<P>>
+fit_steps(fit_t *t)
+{
+	steps_range<fit_t, fit_s, fit_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = fit_begin<P>(t);
+
+	return ret;
+}
+
+/* = 7 - NUMERICAL DIFFERENTIATION = */
+
+/* == 1. finite differences and richardson == */
+
+template <typename P>
+int
+differentiation_perform(differentiation_t *t)
+{
+	int ret;
+	if ((ret = differentiation_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = differentiation_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+differentiation_begin(differentiation_t *t)
+{
+	/* = PARSE F(X) = */
+
+	if (!t->f && !(t->f = spnm_utils::fx_parse(t->fx, &(t->log))))
+		return err_fx_parse;
+
+	/* resumed, the table being that of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	if (!spnm_utils::differentiation_set_up(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+differentiation_step(differentiation_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == DIFFERENTIATION_STEPS_MAX)
+		return err_steps_max;
+
+	differentiation_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	std::string h_string, derivative_string;
+	std::string row_strings[DIFFERENTIATION_STEPS_MAX];
+	if (spnm_utils::differentiation_get_next(t, &h_string,
+	                                         &derivative_string,
+	                                         row_strings) != 0)
+		return err_x_input;
+
+	/* = FILLING DATA = */
+
+	cur_step->n          = t->steps_c + 1;
+	cur_step->h          = spnm_utils::strdup(h_string.c_str());
+	cur_step->derivative = spnm_utils::strdup(derivative_string.c_str());
+	P::manip(cur_step->h, t->process_n);
+	P::manip(cur_step->derivative, t->process_n);
+	for (size_t i = 0; i < DIFFERENTIATION_STEPS_MAX; i++) {
+		cur_step->richardson[i] = NULL;
+		if (t->extrapolation != EXTRAPOLATION_RICHARDSON ||
+		    i > t->steps_c)
+			continue;
+		cur_step->richardson[i] =
+			spnm_utils::strdup(row_strings[i].c_str());
+		P::manip(cur_step->richardson[i], t->process_n);
+	}
+
+	t->steps_c++;
+
+	if (t->steps_c != 1 && /* avoid checking on first step */
+	    P::is_done(cur_step->derivative, (cur_step - 1)->derivative,
+	               t->process_n, t->steps_c))
+		t->done = 1;
+
+	return 0;
+}
+
+template <typename P>
+steps_range<differentiation_t, differentiation_s, differentiation_step<P>>
+differentiation_steps(differentiation_t *t)
+{
+	steps_range<differentiation_t, differentiation_s,
+	            differentiation_step<P>>
+		ret;
+
+	ret.t   = t;
+	ret.err = differentiation_begin<P>(t);
+
+	return ret;
+}
+
+/* = 8 - EIGENVALUES = */
+
+/* == 1. power method and inverse iteration == */
+
+template <typename P>
+int
+power_iteration_perform(power_iteration_t *t)
+{
+	int ret;
+	if ((ret = power_iteration_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = power_iteration_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+power_iteration_begin(power_iteration_t *t)
+{
+	/* resumed, x_n being that of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	return spnm_utils::power_iteration_set_up(t);
+}
+
+template <typename P>
+int
+power_iteration_step(power_iteration_t *t)
+{
+	if (t->done)
+		return 0;
+	if (t->steps_c == STEPS_MAX)
+		return err_steps_max;
+
+	power_iteration_s *cur_step = t->steps + t->steps_c;
+
+	/* = ARITHMETIC = */
+
+	std::string eigenvalue_string;
+	std::string bounds[2];
+	char      **x_next = (char **)malloc(t->rows_c * sizeof(char *));
+	if (spnm_utils::power_iteration_get_next(t, &eigenvalue_string, bounds,
+	                                         x_next, P::manip) != 0) {
+		free(x_next);
+		return err_x_input;
+	}
+
+	/* = FILLING DATA = */
+
+	cur_step->n          = t->steps_c + 1;
+	cur_step->eigenvalue = spnm_utils::strdup(eigenvalue_string.c_str());
+	cur_step->x_next     = x_next;
+	P::manip(cur_step->eigenvalue, t->process_n);
+
+	t->steps_c++;
+
+	if (t->steps_c != 1) { /* avoid checking on first step */
+		int done = P::is_done(cur_step->eigenvalue,
+		                      (cur_step - 1)->eigenvalue, t->process_n,
+		                      t->steps_c);
+		for (size_t i = 0; i < t->rows_c && done; i++)
+			done = P::is_done(cur_step->x_next[i],
+			                  (cur_step - 1)->x_next[i], t->process_n,
+			                  t->steps_c);
+
+		/* the eigenvalue is only known to within the residual, which
+		 * stays large for x cycling as of a rotation */
+		if (done) {
+			char *lower = spnm_utils::strdup(bounds[0].c_str());
+			char *upper = spnm_utils::strdup(bounds[1].c_str());
+			P::manip(lower, t->process_n);
+			P::manip(upper, t->process_n);
+			done = P::is_done(lower, upper, t->process_n,
+			                  t->steps_c);
+			free(lower);
+			free(upper);
+		}
+		t->done = done;
+	}
+
+	return 0;
+}
+
+template <typename P>
+steps_range<power_iteration_t, power_iteration_s, power_iteration_step<P>>
+power_iteration_steps(power_iteration_t *t)
+{
+	steps_range<power_iteration_t, power_iteration_s,
+	            power_iteration_step<P>>
+		ret;
+
+	ret.t   = t;
+	ret.err = power_iteration_begin<P>(t);
+
+	return ret;
+}
+
+/* == 2. qr algorithm == */
+
+template <typename P>
+int
+qr_algorithm_perform(qr_algorithm_t *t)
+{
+	int ret;
+	if ((ret = qr_algorithm_begin<P>(t)) != 0)
+		return ret;
+
+	while (!t->done)
+		if ((ret = qr_algorithm_step<P>(t)) != 0)
+			return ret;
+
+	return 0;
+}
+
+template <typename P>
+int
+qr_algorithm_begin(qr_algorithm_t *t)
+{
+	/* resumed, A_k being that of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	if (!spnm_utils::qr_algorithm_set_up(t))
+		return err_x_input;
+
+	return 0;
+}
+
+template <typename P>
+int
+qr_algorithm_step(qr_algorithm_t *t)
+{
+	if (t->done)
+		return 0;
+
+	/* = ARITHMETIC = */
+
+	/* no sweep if the hessenberg form already gives every eigenvalue */
+	if (t->hi > 0) {
+		size_t      active;
+		std::string subdiagonal_string;
+		int         ret;
+		if ((ret = spnm_utils::qr_algorithm_get_next(
+			     t, &active, &subdiagonal_string)) != 0)
+			return ret;
+
+		/* = FILLING DATA = */
+
+		qr_algorithm_s *cur_step = t->steps + t->steps_c;
+
+		cur_step->n      = t->steps_c + 1;
+		cur_step->active = active;
+		cur_step->subdiagonal =
+			spnm_utils::strdup(subdiagonal_string.c_str());
+		P::manip(cur_step->subdiagonal, t->process_n);
+
+		t->steps_c++;
+	}
+
+	/* = EIGENVALUES = */
+
+	if (t->hi == 0) {
+		spnm_utils::qr_algorithm_get_eigenvalues(t);
+		for (size_t i = 0; i < t->rows_c; i++) {
+			P::manip(t->re[i], t->process_n);
+			P::manip(t->im[i], t->process_n);
+		}
+		t->done = 1;
+	}
+
+	return 0;
+}
+
+template <typename P>
+steps_range<qr_algorithm_t, qr_algorithm_s, qr_algorithm_step<P>>
+qr_algorithm_steps(qr_algorithm_t *t)
+{
+	steps_range<qr_algorithm_t, qr_algorithm_s, qr_algorithm_step<P>> ret;
+
+	ret.t   = t;
+	ret.err = qr_algorithm_begin<P>(t);
+
+	return ret;
+}
+
+} /* namespace spnm */
+
+#endif /* SPNM_H */
+
+/*
+ ===============================================================================
+ |                             IMPLEMENTATION MODE                             |
+ ===============================================================================
+ */
+
+#ifdef SPNM_IMPL
+
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+#include <cstdio>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+#include <thread>
+#include <functional>
+#include <chrono>
+
+/* posix, for the memory mapped files */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* giac - https://www-fourier.ujf-grenoble.fr/~parisse/giac_us.html */
+#include <giac/config.h>
+#include <giac/giac.h>
+
+/* spl - https://github.com/mrsafalpiya/spl */
+#define SPL_MATHS_IMPL
+#include "dep/spl_maths.h"
+
+/*
+ ===============================================================================
+ |                                   Macros                                    |
+ ===============================================================================
+ */
+
+/* Calls `FUNC<P>(ARGS)` with the process policy `P` of the given `PROCESS`
+ * which is a 'process_t'. */
+#define SPNM_DISPATCH(PROCESS, FUNC, ARGS)                        \
+	switch (PROCESS) {                                        \
+	case DECIMAL_PLACES:                                      \
+		return FUNC<decimal_places_policy> ARGS;          \
+	case SIGNIFICANT_DIGITS:                                  \
+		return FUNC<significant_digits_policy> ARGS;      \
+	case NO_OF_STEPS:                                         \
+		return FUNC<no_of_steps_policy> ARGS;             \
+	}
+
+/*
+ ===============================================================================
+ |                                Private Utils                                |
+ ===============================================================================
+ */
+
+namespace spnm_utils
+{
+
+/* = GIAC = */
+
+/* Performs the one time setup of giac. Called before any use of giac so that
+ * the processes not needing it never pay for it. */
+void
+giac_init(void);
+
+/* Serializes every use of giac, including creating and destroying contexts. */
+extern std::mutex giac_mutex;
+
+/* Returns 0 on error. */
+int
+giac_fx_parse(const char *fx, giac::context *ct);
+
+/* Returns NaN on error. */
+double
+giac_fx_val_double(const char *x, giac::context *ct);
+
+/* Evaluates `formula` with giac. Returns an empty string "" on error. */
+std::string
+giac_approx_string(const std::string &formula);
+
+/* = EXPRESSION = */
+
+/*
+ * The native evaluator: a compiled expression is a list of instructions where
+ * the i-th instruction writes the i-th slot from the slots before it. The value
+ * of the expression is the slot of the last instruction.
+ *
+ * It handles the common subset of giac's syntax (numbers, the variables, `e`,
+ * `pi`, + - * / ^, implicit multiplication as in `3x` and the elementary
+ * functions). Anything else is left to giac.
+ */
+
+enum expr_op {
+	EXPR_CONST, /* val */
+	EXPR_VAR,   /* vars[a] */
+	EXPR_NEG,
+	EXPR_ADD,
+	EXPR_SUB,
+	EXPR_MUL,
+	EXPR_DIV,
+	EXPR_POW,
+	EXPR_SIN,
+	EXPR_COS,
+	EXPR_TAN,
+	EXPR_ASIN,
+	EXPR_ACOS,
+	EXPR_ATAN,
+	EXPR_SINH,
+	EXPR_COSH,
+	EXPR_TANH,
+	EXPR_EXP,
+	EXPR_LOG,
+	EXPR_LOG10,
+	EXPR_SQRT,
+	EXPR_ABS,
+};
+
+struct expr_ins {
+	expr_op op;
+	size_t  a;   /* slot of the first operand or index of the variable */
+	size_t  b;   /* slot of the second operand */
+	double  val; /* value of the constant */
+};
+
+struct expr_t {
+	std::vector<expr_ins> ins; /* instructions in order of evaluation */
+	size_t                vars_c; /* number of variables */
+	size_t invariant_c; /* leading instructions left out by
+	                       `expr_eval_varying()` */
+};
+
+/*
+ * Compiles `src` into `e` with `vars` being the names of the variables in
+ * order.
+ *
+ * Returns 0 if `src` can't be handled by the native evaluator.
+ */
+int
+expr_compile(const char *src, const char *const *vars, size_t vars_c,
+             expr_t *e);
+
+/* Largest integer power turned into a chain of multiplications by
+ * `expr_optimize()`. */
+const double EXPR_POW_CHAIN_MAX = 16;
+
+/*
+ * Optimizes the compiled `e` for evaluation, the first `varying_c` variables
+ * being those changing from an evaluation to the next:
+ * - operations on constants are folded, as are identities exact in floating
+ *   point such as x * 1 or -(-x),
+ * - common subexpressions are evaluated once,
+ * - integer powers up to `EXPR_POW_CHAIN_MAX` in magnitude become chains of
+ *   multiplications by squaring, x^2 being x * x and x^-3 being 1 / (x * x *
+ *   x),
+ * - instructions left unused are dropped and those on constants and the
+ *   other variables only are moved to the front as the first
+ *   `e->invariant_c` ones, to be evaluated once by `expr_eval_invariant()`
+ *   and skipped by `expr_eval_varying()`.
+ *
+ * The value of `e` only changes by rounding, but the interval enclosures of
+ * the chains are wider than those of the powers they replace, so `e` isn't to
+ * be evaluated with `expr_eval_interval()` afterwards.
+ */
+void
+expr_optimize(expr_t *e, size_t varying_c);
+
+/* Evaluates `e` for the values `vars` of the variables using `slots` which
+ * has room for `e->ins.size()` values. */
+double
+expr_eval(const expr_t *e, const double *vars, double *slots);
+
+/* Evaluates the first `e->invariant_c` instructions of `e` into `slots`, as
+ * `expr_eval()` does. */
+void
+expr_eval_invariant(const expr_t *e, const double *vars, double *slots);
+
+/* Same as `expr_eval()` but leaving out the first `e->invariant_c`
+ * instructions, their slots holding their values from
+ * `expr_eval_invariant()` for the same values of the variables past the first
+ * `varying_c` of `expr_optimize()`. */
+double
+expr_eval_varying(const expr_t *e, const double *vars, double *slots);
+
+/* Same as `expr_eval()` but also writes the partial derivatives of `e` with
+ * respect to each of the variables to `grad`, by reverse mode automatic
+ * differentiation over the instructions. `adjs` has room for
+ * `e->ins.size()` values. */
+double
+expr_eval_grad(const expr_t *e, const double *vars, double *slots,
+               double *adjs, double *grad);
+
+/* Number of sets of values of the variables evaluated at once by
+ * `expr_eval_batch()`. */
+const size_t EXPR_BATCH = 64;
+
+/* Evaluates `e` for the `n` (at most `EXPR_BATCH`) sets of values of the
+ * variables, `vars[k]` holding the `n` values of the k-th one, into `out`.
+ * Every instruction is applied to all the sets at once so that the loops
+ * vectorize. `slots` has room for `e->ins.size()` * `EXPR_BATCH` values. */
+void
+expr_eval_batch(const expr_t *e, const double *const *vars, size_t n,
+                double *slots, double *out);
+
+/* Same as `expr_eval_batch()` but leaving out the first `e->invariant_c`
+ * instructions as `expr_eval_varying()` does, their slots holding their
+ * values in every one of the `n` lanes. */
+void
+expr_eval_batch_varying(const expr_t *e, const double *const *vars, size_t n,
+                        double *slots, double *out);
+
+/* Evaluates a constant expression like "1.25" or "pi/4" natively. Returns 0 if
+ * it can't be done. */
+int
+expr_const_val(const char *src, double *val);
+
+/* When set, everything on the calling thread is evaluated with giac as if the
+ * native evaluator didn't exist. Used to compare the two. */
+extern thread_local int native_off;
+
+/* = F(X) = */
+
+/* Returns NaN on error. */
+double
+fx_val_double(const char *x, spnm::fx_t *f);
+
+void
+fx_free(spnm::fx_t *f);
+
+/* Returns a copy of `f` to be evaluated from another thread. */
+spnm::fx_t *
+fx_clone(const spnm::fx_t *f);
+
+/* Sets the parameter of f(x; p), evaluating what of f doesn't depend on x
+ * once for every evaluation after. */
+void
+fx_set_param(spnm::fx_t *f, double param);
+
+/* Evaluates f at the `n` points `x` into `fx`, natively in batches over which
+ * the instructions vectorize. Values are NaN on error. */
+void
+fx_val_batch(spnm::fx_t *f, const double *x, size_t n, double *fx);
+
+/* = F(X) SYSTEMS = */
+
+void
+fxs_free(spnm::fxs_t *f);
+
+void
+sparse_fx_free(spnm::sparse_fx_t *f);
+
+/* = SPARSE SYSTEMS = */
+
+/* Returns a sparse system of the `n` rows of A in compressed sparse rows and
+ * b, as of `spnm::iterative_init_csr()`, copying them. Returns NULL if the
+ * columns of a row aren't increasing or any value isn't finite. */
+spnm::sparse_system_t *
+sparse_system_from_csr(const size_t *row_ptr, const size_t *cols,
+                       const double *vals, const double *b, size_t n);
+
+/* Returns the number of equations of `s`. */
+size_t
+sparse_system_rows_c(const spnm::sparse_system_t *s);
+
+void
+sparse_system_free(spnm::sparse_system_t *s);
+
+/* = SHADOW MODE = */
+
+/* Relative difference above which native and giac values diverge. */
+const double SHADOW_TOLERANCE = 1e-9;
+
+/* sampling rate and counters */
+extern std::atomic<double> shadow_rate;
+extern std::atomic<size_t> shadow_solves_c;
+extern std::atomic<size_t> shadow_evals_c;
+extern std::atomic<size_t> shadow_divergences_c;
+
+/* Returns 1 if the next solve is to be shadowed. */
+int
+shadow_sample(void);
+
+/* Compares the native value `native` of f(x) with giac's `giac` for the
+ * shadowed `f` at `x`, logging any divergence to the log of `f`. */
+void
+shadow_check(spnm::fx_t *f, const char *x, double native, double giac);
+
+/* = STRING = */
+
+/* Returns `val` formatted as the value of f(x) in a step. */
+std::string
+val_string(double val);
+
+/* Returns `val` formatted as giac prints an approximated value. */
+std::string
+approx_string(double val);
+
+/* = LINEAR ALGEBRA = */
+
+/* Factorizes the `n` x `n` row major `a` in place into L and U with partial
+ * pivoting, the row swapped with the k-th on the k-th column going to
+ * `perm[k]`. Returns 0 if `a` is singular. */
+int
+lu_factor(double *a, size_t n, size_t *perm);
+
+/* Eliminates the columns [k, k_end) of `a` as `lu_factor()` does, swapping
+ * whole rows but only updating the columns before `cols_end`. `y`, if not
+ * NULL, has its rows swapped and eliminated along. Returns 0 if a pivot is 0.
+ */
+int
+lu_factor_panel(double *a, size_t n, size_t k, size_t k_end, size_t cols_end,
+                size_t *perm, double *y);
+
+/* Columns of `a` updated at once by `lu_update()`, for the rows of U of a
+ * panel to stay in the cache while the rows below go through it. */
+const size_t LU_TILE  = 256;
+const size_t LU_CHUNK = 8;
+
+/* Updates the columns from `k_end` on once the columns [k, k_end) of `a` are
+ * eliminated by `lu_factor_panel()`, turning the rows of the panel into U and
+ * taking L times them from the rows below, tile by tile on `threads_c`
+ * threads. */
+void
+lu_update(double *a, size_t n, size_t k, size_t k_end, size_t threads_c);
+
+/* Solves a x = b in place of `b` with `a` and `perm` from `lu_factor()`. */
+void
+lu_solve(const double *a, const size_t *perm, size_t n, double *b);
+
+/* Evaluates A and b given as of `spnm::elimination_init()` into the `n` x `n`
+ * row major `a` and `b`. Returns 0 on error. */
+int
+linear_system_vals(const char *a_src, const char *b_src, std::vector<double> *a,
+                   std::vector<double> *b, size_t *n);
+
+/* Evaluates A alone as of `linear_system_vals()`. Returns 0 on error. */
+int
+matrix_vals(const char *a_src, std::vector<double> *a, size_t *n);
+
+/* Rows and columns of `a` taken at once by `hessenberg_reduce()`, for the
+ * entries of a tile to stay in the cache between the two passes over it. */
+const size_t HOUSEHOLDER_TILE = 64;
+
+/* Reduces the `n` x `n` row major `a` in place to the upper hessenberg form
+ * Q^T A Q by a householder reflector per column, each reflector being taken
+ * from the left and then from the right tile by tile on `threads_c` threads.
+ */
+void
+hessenberg_reduce(double *a, size_t n, size_t threads_c);
+
+/* = PARALLEL = */
+
+/* Least number of items worth a thread of their own, as starting a thread
+ * costs about as much as evaluating a thousand expressions or multiplying
+ * tens of thousands of sparse rows. */
+const size_t PARALLEL_GRAIN_EVAL = 1024;
+const size_t PARALLEL_GRAIN_ROWS = 32768;
+
+/* Calls `fn(begin, end)` for contiguous chunks covering [0, n) on up to
+ * `threads_c` threads (0 for all cores), one chunk per thread and no less
+ * than `grain` items per chunk. The calling thread takes the first chunk. */
+void
+parallel_for(size_t n, size_t grain, size_t threads_c,
+             const std::function<void(size_t, size_t)> &fn);
+
+/* = SPARSE = */
+
+/* Relative residual at which the iterative linear solves stop. */
+const double LINEAR_TOLERANCE = 1e-10;
+
+/* Sparse matrix in compressed sparse row form with the columns of every row
+ * in increasing order. */
+struct csr_t {
+	size_t              rows_c;  /* number of rows (and of columns) */
+	std::vector<size_t> row_ptr; /* row i is [row_ptr[i], row_ptr[i + 1]) */
+	std::vector<size_t> cols;    /* column of every nonzero */
+	std::vector<double> vals;    /* value of every nonzero */
+};
+
+/* y = a x on `threads_c` threads. */
+void
+csr_mul(const csr_t *a, const double *x, double *y, size_t threads_c);
+
+struct precond_state_t {
+	spnm::precond_t     kind;
+	size_t              n;        /* size of the matrix */
+	std::vector<double> inv_diag; /* PRECOND_JACOBI */
+	csr_t               lu;       /* PRECOND_ILU0, L below the diagonal,
+	                                 PRECOND_IC0, L on and below it */
+	std::vector<size_t> diag;     /* PRECOND_ILU0 and PRECOND_IC0, position
+	                                 of a_ii */
+};
+
+/* Sets `p` up as the preconditioner `kind` of `a`. Returns 0 on a zero
+ * pivot, or a pivot that isn't positive for PRECOND_IC0. */
+int
+precond_setup(spnm::precond_t kind, const csr_t *a, precond_state_t *p);
+
+/* z = M^-1 r */
+void
+precond_apply(const precond_state_t *p, const double *r, double *z);
+
+/*
+ * Solves a x = b by BiCGSTAB, right preconditioned by `p`, starting from `x`
+ * until ||b - a x|| <= `tol` max(||b||, 1) or `iterations_max` iterations.
+ * The tolerance is absolute for small b so that a nearly solved system
+ * doesn't iterate on round off.
+ *
+ * Returns the number of iterations with the norm of the last residual in
+ * `res_norm`.
+ */
+size_t
+bicgstab(const csr_t *a, const precond_state_t *p, const double *b, double *x,
+         double tol, size_t iterations_max, size_t threads_c,
+         double *res_norm);
+
+/* Returns the euclidean norm of the `n` values `x`. */
+double
+norm2(const double *x, size_t n);
+
+/* Returns the dot product of the `n` values `x` and `y` on `threads_c` threads,
+ * summed in fixed chunks so that it doesn't depend on the threads. */
+double
+dot(const double *x, const double *y, size_t n, size_t threads_c);
+
+/* = INTERVAL = */
+
+/* Closed interval [lo, hi] of the reals, empty when lo > hi as for the image
+ * of a function outside of its domain. The bounds may be infinite. */
+struct interval_t {
+	double lo;
+	double hi;
+};
+
+/*
+ * Evaluates `e` over the intervals `vars` of the variables with outward
+ * rounding so that the result contains every value of `e` over them. With
+ * `dslots` not NULL, the result of `e` differentiated with respect to the
+ * first variable is written to `dval` likewise, by forward mode automatic
+ * differentiation. `slots` and `dslots` have room for `e->ins.size()`
+ * intervals.
+ */
+interval_t
+expr_eval_interval(const expr_t *e, const interval_t *vars, interval_t *slots,
+                   interval_t *dslots, interval_t *dval);
+
+/* Returns 1 if `x` is empty or doesn't contain 0. */
+int
+interval_excludes_zero(interval_t x);
+
+/* = POLYNOMIALS = */
+
+/* Points at which a polynomial is evaluated at once. */
+const size_t POLYNOMIAL_BLOCK = 64;
+
+/* Evaluates the polynomial c_0 + c_1 (x - x_0) + c_2 (x - x_0) (x - x_1) + ...
+ * of the `m` coefficients `coefs` of its newton's form about `xs` at the `n`
+ * points `x` into `y` by nested multiplication, `POLYNOMIAL_BLOCK` points at
+ * once through every coefficient so that the loops vectorize, with the blocks
+ * shared out to `threads_c` threads. */
+void
+newton_form_eval(const double *xs, const double *coefs, size_t m,
+                 const double *x, size_t n, double *y, size_t threads_c);
+
+/* Sets the `segments_c` + 1 `buckets` of the segments between the `segments_c`
+ * + 1 increasing `xs` to the segment at the start of every one of
+ * `segments_c` equal buckets of [x_0, x_n], and lastly to the last segment,
+ * so that the segment of a point is only searched for among the few reaching
+ * into its bucket. */
+void
+segments_index(const double *xs, size_t segments_c, size_t *buckets);
+
+/* Returns the segment of `x` between the `segments_c` + 1 increasing `xs` by
+ * the `buckets` of `segments_index()`, the first or the last one outside of
+ * [x_0, x_n]. */
+size_t
+segments_find(const double *xs, size_t segments_c, const size_t *buckets,
+              double x);
+
+/* Evaluates the piecewise cubic a + b (x - x_i) + c (x - x_i)^2 + d (x -
+ * x_i)^3 of the coefficients a, b, c and d of every segment i one after
+ * another in `coefs` at the `n` points `x` into `y`, `POLYNOMIAL_BLOCK` points
+ * at once: the segments are found one point at a time and the cubics of the
+ * block then evaluated together by nested multiplication so that the loop
+ * vectorizes, with the blocks shared out to `threads_c` threads. */
+void
+cubic_segments_eval(const double *xs, const double *coefs, size_t segments_c,
+                    const size_t *buckets, const double *x, size_t n,
+                    double *y, size_t threads_c);
+
+/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+
+/* == 6. parameter sweep == */
+
+/* Solves `point` of the sweep `t` with the parameter `p` set in `f`, warm
+ * started from the previous points `prev1` and `prev2` if not NULL. */
+void
+sweep_solve_point(const spnm::sweep_t *t, spnm::fx_t *f, double p,
+                  spnm::sweep_s *point, const spnm::sweep_s *prev1,
+                  const spnm::sweep_s *prev2);
+
+/* == 7. root isolation == */
+
+/* Runs the branch and prune of `t` over [lower, upper], filling
+ * `t->enclosures` and `t->boxes_c`. Returns 0 on success and err_fx_parse or
+ * err_steps_max on error. */
+int
+isolate_get_enclosures(spnm::isolate_t *t, double lower, double upper,
+                       double tolerance);
+
+/* == 8. polynomial roots == */
+
+/* Reads f of `t` as a polynomial, builds its sturm sequence and isolates its
+ * roots, filling `t->degree`, `t->sequence_c`, `t->square_free`,
+ * `t->enclosures` and `t->boxes_c`. Returns 0 on success and err_fx_parse or
+ * err_steps_max on error. */
+int
+polynomial_roots_get_enclosures(spnm::polynomial_roots_t *t);
+
+} /* namespace spnm_utils */
+
+namespace spnm
+{
+
+/*
+ ===============================================================================
+ |                                   Structs                                   |
+ ===============================================================================
+ */
+
+/* = CORE = */
+
+struct fx_t {
+	/* === native === */
+	int                   is_native; /* 1 if `expr` is used */
+	spnm_utils::expr_t    expr;      /* compiled f(x) */
+	std::vector<double>   slots;     /* evaluation space for `expr` */
+	std::vector<double>   batch_slots; /* evaluation space for batches
+	                                      of `expr` */
+	int                   shadow;    /* 1 if also evaluated with giac */
+	double                param;     /* value of the parameter of f(x; p) */
+
+	/* === giac === */
+	std::string    src; /* f(x) as given */
+	std::ostream  *log; /* log of giac */
+	giac::context *ct;  /* context holding the definition of f(x), only
+	                       created when needed */
+};
+
+struct fxs_t {
+	size_t                          vars_c;   /* number of variables */
+	std::vector<spnm_utils::expr_t> exprs;    /* compiled f_i */
+	std::vector<double>             slots;    /* evaluation space */
+	std::vector<double>             adjs;     /* adjoints of the slots */
+	std::vector<double>             jacobian; /* row major, LU in place */
+	std::vector<size_t>             perm;     /* pivoting of the LU */
+};
+
+struct sparse_fx_t {
+	spnm_utils::expr_t  expr;       /* compiled stencil, the variables
+	                                   followed by `i` and `n` */
+	std::vector<int>    offsets;    /* offset of every variable */
+	size_t              unknowns_c; /* number of unknowns */
+	double              boundary_lower;
+	double              boundary_upper;
+	spnm_utils::csr_t   jacobian; /* sparsity fixed on parsing */
+	spnm_utils::precond_state_t precond;
+	std::vector<double> fx; /* f(x_n) */
+	std::vector<double> dx; /* x_(n+1) - x_n */
+};
+
+struct sparse_system_t {
+	spnm_utils::csr_t   a;
+	std::vector<size_t> diag;   /* position of a_ii, `cols.size()` if
+	                               there's none */
+	std::vector<double> b;
+	std::vector<double> x_next; /* space for the next x of the iterative
+	                               methods */
+
+	/* === conjugate gradient === */
+	spnm_utils::precond_state_t precond;
+	std::vector<double>         r; /* residual b - A x_n */
+	std::vector<double>         z; /* M^-1 r */
+	std::vector<double>         p; /* direction */
+	std::vector<double>         q; /* A p */
+};
+
+/* = 2 - NUMERICAL INTEGRATION = */
+
+/* subinterval of a gauss-kronrod integration */
+struct gauss_kronrod_box_t {
+	double lower;
+	double upper;
+	double integral; /* by the kronrod rule */
+	double error;    /* estimate of the error of `integral` */
+};
+
+struct gauss_kronrod_queue_t {
+	std::vector<gauss_kronrod_box_t> heap; /* max heap on the error */
+};
+
+/*
+ ===============================================================================
+ |                          Function Implementations                           |
+ ===============================================================================
+ */
+
+/* = CORE = */
+
+int
+init(void)
+{
+	spnm_utils::giac_init();
+	return 1;
+}
+
+void
+shadow_set_rate(double rate)
+{
+	if (rate < 0)
+		rate = 0;
+	if (rate > 1)
+		rate = 1;
+	spnm_utils::shadow_rate = rate;
+}
+
+shadow_stats_t
+shadow_stats(void)
+{
+	shadow_stats_t ret;
+
+	ret.solves      = spnm_utils::shadow_solves_c;
+	ret.evals       = spnm_utils::shadow_evals_c;
+	ret.divergences = spnm_utils::shadow_divergences_c;
+
+	return ret;
+}
+
+/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+
+/* == 1. bisection method == */
+
+bisection_t
+bisection_init(const char *fx, const char *interval_lower,
+               const char *interval_upper, process_t process, size_t process_n)
+{
+	bisection_t ret;
+
+	ret.fx             = spnm_utils::strdup(fx);
+	ret.interval_lower = spnm_utils::strdup(interval_lower);
+	ret.interval_upper = spnm_utils::strdup(interval_upper);
+	ret.process        = process;
+	ret.process_n      = process_n;
+
+	ret.steps_c = 0;
+
+	ret.f    = NULL;
+	ret.a_n  = NULL;
+	ret.b_n  = NULL;
+	ret.done = 0;
+
+	return ret;
+}
+
+int
+bisection_perform(bisection_t *t)
+{
+	SPNM_DISPATCH(t->process, bisection_perform, (t));
+	return err_x_input;
+}
+
+int
+bisection_begin(bisection_t *t)
+{
+	/* = PARSE F(X) = */
+
+	if (!t->f && !(t->f = spnm_utils::fx_parse(t->fx, &(t->log))))
+		return err_fx_parse;
+
+	/* resumed, the interval and its signs being those of the last step */
+	if (t->steps_c > 0)
+		return 0;
+
+	/* = CHECK IF CONDITION FOR BISECTION METHOD IS MET = */
+
+	t->fa_sign = spnm_utils::fx_val_sign(t->interval_lower, t->f);
+	t->fb_sign = spnm_utils::fx_val_sign(t->interval_upper, t->f);
+	if (t->fa_sign == '*' || t->fb_sign == '*')
+		return err_x_input;
+	if (t->fa_sign == t->fb_sign)
+		return err_condition_not_met;
+
+	/* = FOR FIRST STEP = */
+
+	free(t->a_n);
+	free(t->b_n);
+	t->a_n = spnm_utils::strdup(t->interval_lower);
+	t->b_n = spnm_utils::strdup(t->interval_upper);
+
+	return 0;
+}
+
+int
+bisection_step(bisection_t *t)
+{
+	SPNM_DISPATCH(t->process, bisection_step, (t));
+	return err_x_input;
+}
+
+steps_range<bisection_t, bisection_s, bisection_step>
+bisection_steps(bisection_t *t)
+{
+	steps_range<bisection_t, bisection_s, bisection_step> ret;
+
+	ret.t   = t;
+	ret.err = bisection_begin(t);
+
+	return ret;
+}
+
+/* Free's dynamically allocated resources from the struct. */
+void
+bisection_free(bisection_t *t)
+{
+	free(t->fx);
+	free(t->interval_lower);
+	free(t->interval_upper);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].a_n);
+		free(t->steps[i].b_n);
+		free(t->steps[i].c_n);
+	}
+
+	/* strings prepared for a step that was never computed */
+	free(t->a_n);
+	free(t->b_n);
+
+	spnm_utils::fx_free(t->f);
+}
+
+/* == 2. secant method == */
+
+secant_t
+secant_init(const char *fx, const char *initial_point1,
+            const char *initial_point2, process_t process, size_t process_n)
+{
+	secant_t ret;
+
+	ret.fx             = spnm_utils::strdup(fx);
+	ret.initial_point1 = spnm_utils::strdup(initial_point1);
+	ret.initial_point2 = spnm_utils::strdup(initial_point2);
+	ret.process        = process;
+	ret.process_n      = process_n;
+
+	ret.steps_c = 0;
+
+	ret.f       = NULL;
+	ret.x_prev  = NULL;
+	ret.fx_prev = NULL;
+	ret.x_n     = NULL;
+	ret.fx_n    = NULL;
+	ret.done    = 0;
+
+	return ret;
+}
+
+int
+secant_perform(secant_t *t)
+{
+	SPNM_DISPATCH(t->process, secant_perform, (t));
+	return err_x_input;
+}
+
+int
+secant_begin(secant_t *t)
+{
+	SPNM_DISPATCH(t->process, secant_begin, (t));
+	return err_x_input;
+}
+
+int
+secant_step(secant_t *t)
+{
+	SPNM_DISPATCH(t->process, secant_step, (t));
+	return err_x_input;
+}
+
+steps_range<secant_t, secant_s, secant_step>
+secant_steps(secant_t *t)
+{
+	steps_range<secant_t, secant_s, secant_step> ret;
+
+	ret.t   = t;
+	ret.err = secant_begin(t);
+
+	return ret;
+}
+
+void
+secant_free(secant_t *t)
+{
+	free(t->fx);
+	free(t->initial_point1);
+	free(t->initial_point2);
+
+	spnm_utils::fx_free(t->f);
+
+	/* the consecutive steps share their strings */
+	if (t->steps_c == 0) {
+		free(t->x_prev);
+		free(t->fx_prev);
+		free(t->x_n);
+		free(t->fx_n);
+		return;
+	}
+
+	size_t i;
+	for (i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].x_prev);
+		free(t->steps[i].fx_prev);
+	}
+	free(t->steps[i - 1].x_n);
+	free(t->steps[i - 1].fx_n);
+	free(t->steps[i - 1].x_next);
+	free(t->steps[i - 1].fx_next);
+}
+
+/* == 3. fixed point iteration == */
+
+fixed_point_t
+fixed_point_init(const char *gx, const char *initial_point, process_t process,
+                 size_t process_n, accel_t accel)
+{
+	fixed_point_t ret;
+
+	ret.gx            = spnm_utils::strdup(gx);
+	ret.initial_point = spnm_utils::strdup(initial_point);
+	ret.process       = process;
+	ret.process_n     = process_n;
+	ret.accel         = accel;
+
+	ret.steps_c = 0;
+
+	ret.f    = NULL;
+	ret.x_n  = NULL;
+	ret.done = 0;
+
+	return ret;
+}
+
+int
+fixed_point_perform(fixed_point_t *t)
+{
+	SPNM_DISPATCH(t->process, fixed_point_perform, (t));
+	return err_x_input;
+}
+
+int
+fixed_point_begin(fixed_point_t *t)
+{
+	SPNM_DISPATCH(t->process, fixed_point_begin, (t));
+	return err_x_input;
+}
+
+int
+fixed_point_step(fixed_point_t *t)
+{
+	SPNM_DISPATCH(t->process, fixed_point_step, (t));
+	return err_x_input;
+}
+
+steps_range<fixed_point_t, fixed_point_s, fixed_point_step>
+fixed_point_steps(fixed_point_t *t)
+{
+	steps_range<fixed_point_t, fixed_point_s, fixed_point_step> ret;
+
+	ret.t   = t;
+	ret.err = fixed_point_begin(t);
+
+	return ret;
+}
+
+void
+fixed_point_free(fixed_point_t *t)
+{
+	free(t->gx);
+	free(t->initial_point);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].x_n);
+		free(t->steps[i].gx_n);
+		free(t->steps[i].ggx_n);
+		free(t->steps[i].x_next);
+	}
+
+	/* string prepared for a step that was never computed */
+	free(t->x_n);
+
+	spnm_utils::fx_free(t->f);
+}
+
+/* == 4. newton's method for systems == */
+
+newton_system_t
+newton_system_init(const char *const *fx, const char *const *vars,
+                   const char *const *initial_point, size_t vars_c,
+                   process_t process, size_t process_n)
+{
+	newton_system_t ret;
+
+	for (size_t i = 0; i < VARS_MAX; i++) {
+		int given = i < vars_c;
+
+		ret.fx[i]   = given ? spnm_utils::strdup(fx[i]) : NULL;
+		ret.vars[i] = given ? spnm_utils::strdup(vars[i]) : NULL;
+		ret.initial_point[i] =
+			given ? spnm_utils::strdup(initial_point[i]) : NULL;
+		ret.x_n[i] = NULL;
+	}
+	ret.vars_c    = vars_c;
+	ret.process   = process;
+	ret.process_n = process_n;
+
+	ret.steps_c = 0;
+
+	ret.f    = NULL;
+	ret.done = 0;
+
+	return ret;
+}
+
+int
+newton_system_perform(newton_system_t *t)
+{
+	SPNM_DISPATCH(t->process, newton_system_perform, (t));
+	return err_x_input;
+}
+
+int
+newton_system_begin(newton_system_t *t)
+{
+	SPNM_DISPATCH(t->process, newton_system_begin, (t));
+	return err_x_input;
+}
+
+int
+newton_system_step(newton_system_t *t)
+{
+	SPNM_DISPATCH(t->process, newton_system_step, (t));
+	return err_x_input;
+}
+
+steps_range<newton_system_t, newton_system_s, newton_system_step>
+newton_system_steps(newton_system_t *t)
+{
+	steps_range<newton_system_t, newton_system_s, newton_system_step> ret;
+
+	ret.t   = t;
+	ret.err = newton_system_begin(t);
+
+	return ret;
+}
+
+void
+newton_system_free(newton_system_t *t)
+{
+	for (size_t i = 0; i < VARS_MAX; i++) {
+		free(t->fx[i]);
+		free(t->vars[i]);
+		free(t->initial_point[i]);
+
+		/* string prepared for a step that was never computed */
+		free(t->x_n[i]);
+	}
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		for (size_t j = 0; j < t->vars_c; j++) {
+			free(t->steps[i].x_n[j]);
+			free(t->steps[i].fx_n[j]);
+			free(t->steps[i].x_next[j]);
+		}
+	}
+
+	spnm_utils::fxs_free(t->f);
+}
+
+/* == 5. newton-krylov method == */
+
+newton_krylov_t
+newton_krylov_init(const char *fx, const char *const *vars, const int *offsets,
+                   size_t vars_c, size_t unknowns_c,
+                   const char *boundary_lower, const char *boundary_upper,
+                   const char *initial_point, precond_t precond,
+                   process_t process, size_t process_n)
+{
+	newton_krylov_t ret;
+
+	ret.fx = spnm_utils::strdup(fx);
+	for (size_t i = 0; i < VARS_MAX; i++) {
+		int given = i < vars_c;
+
+		ret.vars[i]    = given ? spnm_utils::strdup(vars[i]) : NULL;
+		ret.offsets[i] = given ? offsets[i] : 0;
+	}
+	ret.vars_c         = vars_c;
+	ret.unknowns_c     = unknowns_c;
+	ret.boundary_lower = spnm_utils::strdup(boundary_lower);
+	ret.boundary_upper = spnm_utils::strdup(boundary_upper);
+	ret.initial_point  = spnm_utils::strdup(initial_point);
+	ret.precond        = precond;
+	ret.process        = process;
+	ret.process_n      = process_n;
+	ret.threads_c      = 0;
+
+	ret.steps_c = 0;
+	ret.x       = (double *)malloc(unknowns_c * sizeof(double));
+
+	ret.f    = NULL;
+	ret.done = 0;
+
+	return ret;
+}
+
+int
+newton_krylov_perform(newton_krylov_t *t)
+{
+	SPNM_DISPATCH(t->process, newton_krylov_perform, (t));
+	return err_x_input;
+}
+
+int
+newton_krylov_begin(newton_krylov_t *t)
+{
+	SPNM_DISPATCH(t->process, newton_krylov_begin, (t));
+	return err_x_input;
+}
+
+int
+newton_krylov_step(newton_krylov_t *t)
+{
+	SPNM_DISPATCH(t->process, newton_krylov_step, (t));
+	return err_x_input;
+}
+
+steps_range<newton_krylov_t, newton_krylov_s, newton_krylov_step>
+newton_krylov_steps(newton_krylov_t *t)
+{
+	steps_range<newton_krylov_t, newton_krylov_s, newton_krylov_step> ret;
+
+	ret.t   = t;
+	ret.err = newton_krylov_begin(t);
+
+	return ret;
+}
+
+void
+newton_krylov_free(newton_krylov_t *t)
+{
+	free(t->fx);
+	for (size_t i = 0; i < VARS_MAX; i++)
+		free(t->vars[i]);
+	free(t->boundary_lower);
+	free(t->boundary_upper);
+	free(t->initial_point);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].residual_norm);
+		free(t->steps[i].linear_residual_norm);
+		free(t->steps[i].x_norm);
+	}
+	free(t->x);
+
+	spnm_utils::sparse_fx_free(t->f);
+}
+
+/* == 6. parameter sweep == */
+
+sweep_t
+sweep_init(const char *fx, const char *param, const char *param_lower,
+           const char *param_upper, size_t points_c, sweep_method_t method,
+           const char *input1, const char *input2, process_t process,
+           size_t process_n)
+{
+	sweep_t ret;
+
+	ret.fx          = spnm_utils::strdup(fx);
+	ret.param       = spnm_utils::strdup(param);
+	ret.param_lower = spnm_utils::strdup(param_lower);
+	ret.param_upper = spnm_utils::strdup(param_upper);
+	ret.points_c    = points_c;
+	ret.method      = method;
+	ret.input1      = spnm_utils::strdup(input1);
+	ret.input2      = spnm_utils::strdup(input2);
+	ret.process     = process;
+	ret.process_n   = process_n;
+	ret.warm_start  = 1;
+	ret.threads_c   = 0;
+
+	ret.points = NULL;
+
+	ret.f = NULL;
+
+	return ret;
+}
+
+/* Free's the points of `t` from a previous perform. */
+static void
+sweep_points_free(sweep_t *t)
+{
+	if (!t->points)
+		return;
+
+	for (size_t i = 0; i < t->points_c; i++) {
+		free(t->points[i].p);
+		free(t->points[i].root);
+	}
+	free(t->points);
+	t->points = NULL;
+}
+
+int
+sweep_perform(sweep_t *t)
+{
+	/* = PARSE F(X; P) = */
+
+	if (!t->f &&
+	    !(t->f = spnm_utils::fx_parse_param(t->fx, t->param, &(t->log))))
+		return err_fx_parse;
+
+	/* = PARAMETERS = */
+
+	double lower, upper;
+	if (t->points_c == 0 ||
+	    !spnm_utils::expr_const_val(t->param_lower, &lower) ||
+	    !spnm_utils::expr_const_val(t->param_upper, &upper))
+		return err_x_input;
+
+	sweep_points_free(t);
+	t->points = (sweep_s *)calloc(t->points_c, sizeof(sweep_s));
+
+	std::vector<double> params(t->points_c);
+	for (size_t i = 0; i < t->points_c; i++) {
+		params[i] = t->points_c == 1 ? lower
+		                             : lower + (upper - lower) * i /
+		                                               (t->points_c - 1);
+		t->points[i].p = spnm_utils::strdup(
+			spnm_utils::approx_string(params[i]).c_str());
+	}
+
+	/* = SOLVES = */
+
+	size_t chunks_c = (t->points_c + SWEEP_CHUNK - 1) / SWEEP_CHUNK;
+	spnm_utils::parallel_for(
+		chunks_c, 1, t->threads_c, [&](size_t begin, size_t end) {
+			spnm::fx_t *f = spnm_utils::fx_clone(t->f);
+
+			for (size_t c = begin; c < end; c++) {
+				size_t first = c * SWEEP_CHUNK;
+				size_t last =
+					std::min(first + SWEEP_CHUNK, t->points_c);
+
+				for (size_t i = first; i < last; i++) {
+					/* warm started only from the chunk */
+					sweep_s *prev1 = NULL, *prev2 = NULL;
+					if (t->warm_start && i > first &&
+					    !t->points[i - 1].err) {
+						prev1 = t->points + i - 1;
+						if (i - 1 > first &&
+						    !t->points[i - 2].err)
+							prev2 = t->points + i - 2;
+					}
+
+					spnm_utils::sweep_solve_point(
+						t, f, params[i], t->points + i,
+						prev1, prev2);
+				}
+			}
+
+			spnm_utils::fx_free(f);
+		});
+
+	for (size_t i = 0; i < t->points_c; i++)
+		if (t->points[i].err)
+			return t->points[i].err;
+
+	return 0;
+}
+
+void
+sweep_free(sweep_t *t)
+{
+	free(t->fx);
+	free(t->param);
+	free(t->param_lower);
+	free(t->param_upper);
+	free(t->input1);
+	free(t->input2);
+
+	sweep_points_free(t);
+
+	spnm_utils::fx_free(t->f);
+}
+
+/* == 7. root isolation == */
+
+isolate_t
+isolate_init(const char *fx, const char *interval_lower,
+             const char *interval_upper, const char *tolerance,
+             process_t process, size_t process_n)
+{
+	isolate_t ret;
+
+	ret.fx             = spnm_utils::strdup(fx);
+	ret.interval_lower = spnm_utils::strdup(interval_lower);
+	ret.interval_upper = spnm_utils::strdup(interval_upper);
+	ret.tolerance      = spnm_utils::strdup(tolerance);
+	ret.process        = process;
+	ret.process_n      = process_n;
+	ret.threads_c      = 0;
+
+	ret.enclosures_c = 0;
+	ret.enclosures   = NULL;
+	ret.boxes_c      = 0;
+
+	ret.f = NULL;
+
+	return ret;
+}
+
+/* Free's the enclosures of `t` from a previous perform. */
+static void
+isolate_enclosures_free(isolate_t *t)
+{
+	for (size_t i = 0; i < t->enclosures_c; i++) {
+		isolate_s *enclosure = t->enclosures + i;
+
+		free(enclosure->lower);
+		free(enclosure->upper);
+		if (enclosure->bisection) {
+			/* `f` is shared by the bisections */
+			enclosure->bisection->f = NULL;
+			bisection_free(enclosure->bisection);
+			delete enclosure->bisection;
+		}
+	}
+	free(t->enclosures);
+
+	t->enclosures_c = 0;
+	t->enclosures   = NULL;
+}
+
+int
+isolate_perform(isolate_t *t)
+{
+	/* = PARSE F(X) = */
+
+	if (!t->f && !(t->f = spnm_utils::fx_parse(t->fx, &(t->log))))
+		return err_fx_parse;
+
+	/* = ISOLATION = */
+
+	double lower, upper, tolerance;
+	if (!spnm_utils::expr_const_val(t->interval_lower, &lower) ||
+	    !spnm_utils::expr_const_val(t->interval_upper, &upper) ||
+	    !spnm_utils::expr_const_val(t->tolerance, &tolerance) ||
+	    !(lower < upper) || !(tolerance > 0))
+		return err_x_input;
+
+	isolate_enclosures_free(t);
+
+	int ret;
+	if ((ret = spnm_utils::isolate_get_enclosures(t, lower, upper,
+	                                              tolerance)) != 0)
+		return ret;
+
+	/* = BISECTIONS = */
+
+	ret = 0;
+	for (size_t i = 0; i < t->enclosures_c; i++) {
+		isolate_s *enclosure = t->enclosures + i;
+		if (enclosure->kind == ENCLOSURE_POSSIBLE)
+			continue;
+
+		enclosure->bisection = new bisection_t(
+			bisection_init(t->fx, enclosure->lower, enclosure->upper,
+		                       t->process, t->process_n));
+		enclosure->bisection->f = t->f;
+		enclosure->err = bisection_perform(enclosure->bisection);
+		if (enclosure->err && !ret)
+			ret = enclosure->err;
+	}
+
+	return ret;
+}
+
+void
+isolate_free(isolate_t *t)
+{
+	free(t->fx);
+	free(t->interval_lower);
+	free(t->interval_upper);
+	free(t->tolerance);
+
+	isolate_enclosures_free(t);
+
+	spnm_utils::fx_free(t->f);
+}
+
+/* == 8. polynomial roots == */
+
+polynomial_roots_t
+polynomial_roots_init(const char *fx, process_t process, size_t process_n)
+{
+	polynomial_roots_t ret;
+
+	ret.fx        = spnm_utils::strdup(fx);
+	ret.process   = process;
+	ret.process_n = process_n;
+	ret.threads_c = 0;
+
+	ret.degree       = 0;
+	ret.sequence_c   = 0;
+	ret.square_free  = NULL;
+	ret.enclosures_c = 0;
+	ret.enclosures   = NULL;
+	ret.boxes_c      = 0;
+
+	ret.f = NULL;
+
+	return ret;
+}
+
+/* Free's the enclosures of `t` from a previous perform. */
+static void
+polynomial_roots_enclosures_free(polynomial_roots_t *t)
+{
+	for (size_t i = 0; i < t->enclosures_c; i++) {
+		isolate_s *enclosure = t->enclosures + i;
+
+		free(enclosure->lower);
+		free(enclosure->upper);
+		if (enclosure->bisection) {
+			bisection_free(enclosure->bisection);
+			delete enclosure->bisection;
+		}
+	}
+	free(t->enclosures);
+	free(t->square_free);
+
+	t->enclosures_c = 0;
+	t->enclosures   = NULL;
+	t->square_free  = NULL;
+}
+
+int
+polynomial_roots_perform(polynomial_roots_t *t)
+{
+	/* = PARSE F(X) = */
+
+	if (!t->f && !(t->f = spnm_utils::fx_parse(t->fx, &(t->log))))
+		return err_fx_parse;
+
+	/* = ISOLATION = */
+
+	polynomial_roots_enclosures_free(t);
+
+	int ret;
+	if ((ret = spnm_utils::polynomial_roots_get_enclosures(t)) != 0)
+		return ret;
+
+	/* = BISECTIONS = */
+
+	for (size_t i = 0; i < t->enclosures_c; i++) {
+		isolate_s  *enclosure = t->enclosures + i;
+		const char *fx        = t->fx;
+		if (t->square_free &&
+		    spnm_utils::fx_val_sign(enclosure->lower, t->f) ==
+		            spnm_utils::fx_val_sign(enclosure->upper, t->f))
+			fx = t->square_free;
+
+		enclosure->bisection = new bisection_t(
+			bisection_init(fx, enclosure->lower, enclosure->upper,
+		                       t->process, t->process_n));
+	}
+
+	/* every bisection parses f of its own for the threads not to share
+	 * the slots of its evaluation */
+	auto bisections = [t](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; i++)
+			t->enclosures[i].err =
+				bisection_perform(t->enclosures[i].bisection);
+	};
+	spnm_utils::parallel_for(t->enclosures_c, 1, t->threads_c, bisections);
+
+	ret = 0;
+	for (size_t i = 0; i < t->enclosures_c && !ret; i++)
+		ret = t->enclosures[i].err;
+
+	return ret;
+}
+
+void
+polynomial_roots_free(polynomial_roots_t *t)
+{
+	free(t->fx);
+
+	polynomial_roots_enclosures_free(t);
+
+	spnm_utils::fx_free(t->f);
+}
+
+/* = 2 - NUMERICAL INTEGRATION = */
+
+/* == 1. newton-cotes and romberg == */
+
+integration_t
+integration_init(const char *fx, const char *lower, const char *upper,
+                 quadrature_t rule, process_t process, size_t process_n)
+{
+	integration_t ret;
+
+	ret.fx        = spnm_utils::strdup(fx);
+	ret.lower     = spnm_utils::strdup(lower);
+	ret.upper     = spnm_utils::strdup(upper);
+	ret.rule      = rule;
+	ret.process   = process;
+	ret.process_n = process_n;
+
+	ret.steps_c = 0;
+
+	ret.f           = NULL;
+	ret.a           = 0;
+	ret.b           = 0;
+	ret.intervals_c = 0;
+	ret.trapezoid   = 0;
+	ret.done        = 0;
+
+	return ret;
+}
+
+int
+integration_perform(integration_t *t)
+{
+	SPNM_DISPATCH(t->process, integration_perform, (t));
+	return err_x_input;
+}
+
+int
+integration_begin(integration_t *t)
+{
+	SPNM_DISPATCH(t->process, integration_begin, (t));
+	return err_x_input;
+}
+
+int
+integration_step(integration_t *t)
+{
+	SPNM_DISPATCH(t->process, integration_step, (t));
+	return err_x_input;
+}
+
+steps_range<integration_t, integration_s, integration_step>
+integration_steps(integration_t *t)
+{
+	steps_range<integration_t, integration_s, integration_step> ret;
+
+	ret.t   = t;
+	ret.err = integration_begin(t);
+
+	return ret;
+}
+
+void
+integration_free(integration_t *t)
+{
+	free(t->fx);
+	free(t->lower);
+	free(t->upper);
+
+	spnm_utils::fx_free(t->f);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].h);
+		free(t->steps[i].integral);
+		for (size_t j = 0; j < INTEGRATION_STEPS_MAX; j++)
+			free(t->steps[i].romberg[j]);
+	}
+}
+
+/* == 2. adaptive gauss-kronrod == */
+
+gauss_kronrod_t
+gauss_kronrod_init(const char *fx, const char *lower, const char *upper,
+                   const char *tolerance, process_t process, size_t process_n)
+{
+	gauss_kronrod_t ret;
+
+	ret.fx          = spnm_utils::strdup(fx);
+	ret.lower       = spnm_utils::strdup(lower);
+	ret.upper       = spnm_utils::strdup(upper);
+	ret.tolerance   = spnm_utils::strdup(tolerance);
+	ret.process     = process;
+	ret.process_n   = process_n;
+	ret.threads_c   = 0;
+	ret.deadline_ms = 0;
+
+	ret.steps_c = 0;
+	ret.evals_c = 0;
+	ret.wall_ms = 0;
+
+	ret.f         = NULL;
+	ret.queue     = NULL;
+	ret.a         = 0;
+	ret.b         = 0;
+	ret.error_max = 0;
+	ret.done      = 0;
+
+	return ret;
+}
+
+int
+gauss_kronrod_perform(gauss_kronrod_t *t)
+{
+	SPNM_DISPATCH(t->process, gauss_kronrod_perform, (t));
+	return err_x_input;
+}
+
+int
+gauss_kronrod_begin(gauss_kronrod_t *t)
+{
+	SPNM_DISPATCH(t->process, gauss_kronrod_begin, (t));
+	return err_x_input;
+}
+
+int
+gauss_kronrod_step(gauss_kronrod_t *t)
+{
+	SPNM_DISPATCH(t->process, gauss_kronrod_step, (t));
+	return err_x_input;
+}
+
+steps_range<gauss_kronrod_t, gauss_kronrod_s, gauss_kronrod_step>
+gauss_kronrod_steps(gauss_kronrod_t *t)
+{
+	steps_range<gauss_kronrod_t, gauss_kronrod_s, gauss_kronrod_step> ret;
+
+	ret.t   = t;
+	ret.err = gauss_kronrod_begin(t);
+
+	return ret;
+}
+
+void
+gauss_kronrod_free(gauss_kronrod_t *t)
+{
+	free(t->fx);
+	free(t->lower);
+	free(t->upper);
+	free(t->tolerance);
+
+	spnm_utils::fx_free(t->f);
+	delete t->queue;
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].integral);
+		free(t->steps[i].error);
+	}
+}
+
+/* = 3 - ORDINARY DIFFERENTIAL EQUATIONS = */
+
+/* == 1. initial value problems == */
+
+ode_t
+ode_init(const char *fx, const char *initial_x, const char *initial_y,
+         const char *final_x, const char *h, const char *tolerance,
+         ode_method_t method, process_t process, size_t process_n)
+{
+	ode_t ret;
+
+	ret.fx        = spnm_utils::strdup(fx);
+	ret.initial_x = spnm_utils::strdup(initial_x);
+	ret.initial_y = spnm_utils::strdup(initial_y);
+	ret.final_x   = spnm_utils::strdup(final_x);
+	ret.h         = spnm_utils::strdup(h);
+	ret.tolerance = spnm_utils::strdup(tolerance);
+	ret.method    = method;
+	ret.process   = process;
+	ret.process_n = process_n;
+	ret.on_step   = NULL;
+	ret.data      = NULL;
+
+	ret.steps_c    = 0;
+	ret.step.n     = 0;
+	ret.step.h     = NULL;
+	ret.step.x_n   = NULL;
+	ret.step.y_n   = NULL;
+	ret.step.error = NULL;
+	ret.rejected_c = 0;
+
+	ret.f         = NULL;
+	ret.x_0       = 0;
+	ret.x_end     = 0;
+	ret.h_0       = 0;
+	ret.error_max = 0;
+	ret.x_n       = 0;
+	ret.y_n       = 0;
+	ret.h_n       = 0;
+	ret.f_n       = 0;
+	ret.is_f_n    = 0;
+	ret.done      = 0;
+
+	return ret;
+}
+
+int
+ode_perform(ode_t *t)
+{
+	SPNM_DISPATCH(t->process, ode_perform, (t));
+	return err_x_input;
+}
+
+int
+ode_begin(ode_t *t)
+{
+	SPNM_DISPATCH(t->process, ode_begin, (t));
+	return err_x_input;
+}
+
+int
+ode_step(ode_t *t)
+{
+	SPNM_DISPATCH(t->process, ode_step, (t));
+	return err_x_input;
+}
+
+int
+ode_write_step(const ode_s *step, void *data)
+{
+	std::ostream *out = (std::ostream *)data;
+
+	*out << step->n << '\t' << step->h << '\t' << step->x_n << '\t'
+	     << step->y_n;
+	if (step->error)
+		*out << '\t' << step->error;
+	*out << '\n';
+
+	return 0;
+}
+
+void
+ode_free(ode_t *t)
+{
+	free(t->fx);
+	free(t->initial_x);
+	free(t->initial_y);
+	free(t->final_x);
+	free(t->h);
+	free(t->tolerance);
+
+	spnm_utils::fx_free(t->f);
+
+	free(t->step.h);
+	free(t->step.x_n);
+	free(t->step.y_n);
+	free(t->step.error);
+}
+
+/* = 4 - LINEAR SYSTEMS = */
+
+/* == 1. gaussian elimination and lu decomposition == */
+
+elimination_t
+elimination_init(const char *a, const char *b, elimination_method_t method,
+                 process_t process, size_t process_n)
+{
+	elimination_t ret;
+
+	ret.a         = spnm_utils::strdup(a);
+	ret.b         = spnm_utils::strdup(b);
+	ret.method    = method;
+	ret.process   = process;
+	ret.process_n = process_n;
+	ret.threads_c = 0;
+	ret.snapshots = 0;
+
+	ret.rows_c  = 0;
+	ret.steps_c = 0;
+	ret.steps   = NULL;
+	ret.x       = NULL;
+
+	ret.lu   = NULL;
+	ret.y    = NULL;
+	ret.perm = NULL;
+	ret.done = 0;
+
+	return ret;
+}
+
+elimination_t
+elimination_init_values(const double *a, const double *b, size_t n,
+                        elimination_method_t method, process_t process,
+                        size_t process_n)
+{
+	elimination_t ret;
+
+	ret.a         = NULL;
+	ret.b         = NULL;
+	ret.method    = method;
+	ret.process   = process;
+	ret.process_n = process_n;
+	ret.threads_c = 0;
+	ret.snapshots = 0;
+
+	ret.rows_c  = n;
+	ret.steps_c = 0;
+	ret.steps   = NULL;
+	ret.x       = NULL;
+
+	ret.lu = (double *)malloc(n * n * sizeof(double));
+	ret.y  = (double *)malloc(n * sizeof(double));
+	std::copy(a, a + n * n, ret.lu);
+	std::copy(b, b + n, ret.y);
+	ret.perm = NULL;
+	ret.done = 0;
+
+	return ret;
+}
+
+int
+elimination_perform(elimination_t *t)
+{
+	SPNM_DISPATCH(t->process, elimination_perform, (t));
+	return err_x_input;
+}
+
+int
+elimination_begin(elimination_t *t)
+{
+	SPNM_DISPATCH(t->process, elimination_begin, (t));
+	return err_x_input;
+}
+
+int
+elimination_step(elimination_t *t)
+{
+	SPNM_DISPATCH(t->process, elimination_step, (t));
+	return err_x_input;
+}
+
+steps_range<elimination_t, elimination_s, elimination_step>
+elimination_steps(elimination_t *t)
+{
+	steps_range<elimination_t, elimination_s, elimination_step> ret;
+
+	ret.t   = t;
+	ret.err = elimination_begin(t);
+
+	return ret;
+}
+
+void
+elimination_free(elimination_t *t)
+{
+	free(t->a);
+	free(t->b);
+
+	free(t->lu);
+	free(t->y);
+	free(t->perm);
+
+	size_t cols_c = t->rows_c + (t->method == ELIMINATION_GAUSS);
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].pivot_val);
+		if (!t->steps[i].snapshot)
+			continue;
+		for (size_t j = 0; j < t->rows_c * cols_c; j++)
+			free(t->steps[i].snapshot[j]);
+		free(t->steps[i].snapshot);
+	}
+	free(t->steps);
+
+	if (t->x)
+		for (size_t i = 0; i < t->rows_c; i++)
+			free(t->x[i]);
+	free(t->x);
+}
+
+/* == 2. iterative methods == */
+
+iterative_t
+iterative_init(const char *a, const char *b, const char *initial_point,
+               iterative_method_t method, const char *relaxation,
+               process_t process, size_t process_n)
+{
+	iterative_t ret;
+
+	ret.a             = spnm_utils::strdup(a);
+	ret.b             = spnm_utils::strdup(b);
+	ret.initial_point = spnm_utils::strdup(initial_point);
+	ret.method        = method;
+	ret.relaxation    = relaxation ? spnm_utils::strdup(relaxation) : NULL;
+	ret.red_black     = 0;
+	ret.process       = process;
+	ret.process_n     = process_n;
+	ret.threads_c     = 0;
+
+	ret.rows_c  = 0;
+	ret.steps_c = 0;
+
+	ret.system     = NULL;
+	ret.x          = NULL;
+	ret.omega      = 1;
+	ret.correction = 0;
+	ret.growths_c  = 0;
+	ret.done       = 0;
+
+	return ret;
+}
+
+iterative_t
+iterative_init_csr(const size_t *row_ptr, const size_t *cols,
+                   const double *vals, const double *b, size_t n,
+                   const char *initial_point, iterative_method_t method,
+                   const char *relaxation, process_t process,
+                   size_t process_n)
+{
+	iterative_t ret;
+
+	ret.a             = NULL;
+	ret.b             = NULL;
+	ret.initial_point = spnm_utils::strdup(initial_point);
+	ret.method        = method;
+	ret.relaxation    = relaxation ? spnm_utils::strdup(relaxation) : NULL;
+	ret.red_black     = 0;
+	ret.process       = process;
+	ret.process_n     = process_n;
+	ret.threads_c     = 0;
+
+	ret.rows_c  = 0;
+	ret.steps_c = 0;
+
+	/* a NULL system fails on beginning as for invalid strings */
+	ret.system =
+		spnm_utils::sparse_system_from_csr(row_ptr, cols, vals, b, n);
+	ret.x          = NULL;
+	ret.omega      = 1;
+	ret.correction = 0;
+	ret.growths_c  = 0;
+	ret.done       = 0;
+
+	return ret;
+}
+
+int
+iterative_perform(iterative_t *t)
+{
+	SPNM_DISPATCH(t->process, iterative_perform, (t));
+	return err_x_input;
+}
+
+int
+iterative_begin(iterative_t *t)
+{
+	SPNM_DISPATCH(t->process, iterative_begin, (t));
+	return err_x_input;
+}
+
+int
+iterative_step(iterative_t *t)
+{
+	SPNM_DISPATCH(t->process, iterative_step, (t));
+	return err_x_input;
+}
+
+steps_range<iterative_t, iterative_s, iterative_step>
+iterative_steps(iterative_t *t)
+{
+	steps_range<iterative_t, iterative_s, iterative_step> ret;
+
+	ret.t   = t;
+	ret.err = iterative_begin(t);
+
+	return ret;
+}
+
+void
+iterative_free(iterative_t *t)
+{
+	free(t->a);
+	free(t->b);
+	free(t->initial_point);
+	free(t->relaxation);
+
+	spnm_utils::sparse_system_free(t->system);
+	free(t->x);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		for (size_t j = 0; j < t->rows_c; j++)
+			free(t->steps[i].x_next[j]);
+		free(t->steps[i].x_next);
+	}
+}
+
+/* == 3. conjugate gradient == */
+
+/* Returns a 'conjugate_gradient_t' of no system with the common inputs. */
+static conjugate_gradient_t
+conjugate_gradient_init_common(const char *initial_point, precond_t precond,
+                               process_t process, size_t process_n)
+{
+	conjugate_gradient_t ret;
+
+	ret.a              = NULL;
+	ret.b              = NULL;
+	ret.a_file         = NULL;
+	ret.b_file         = NULL;
+	ret.initial_point  = spnm_utils::strdup(initial_point);
+	ret.precond        = precond;
+	ret.process        = process;
+	ret.process_n      = process_n;
+	ret.iterations_max = 0;
+	ret.threads_c      = 0;
+	ret.on_step        = NULL;
+	ret.data           = NULL;
+
+	ret.rows_c  = 0;
+	ret.steps_c = 0;
+	ret.step    = { 0, NULL, NULL, NULL, NULL };
+	ret.x       = NULL;
+
+	ret.system = NULL;
+	ret.rz     = 0;
+	ret.done   = 0;
+
+	return ret;
+}
+
+conjugate_gradient_t
+conjugate_gradient_init(const char *a, const char *b, const char *initial_point,
+                        precond_t precond, process_t process,
+                        size_t process_n)
+{
+	conjugate_gradient_t ret = conjugate_gradient_init_common(
+		initial_point, precond, process, process_n);
+
+	ret.a = spnm_utils::strdup(a);
+	ret.b = spnm_utils::strdup(b);
+
+	return ret;
+}
+
+conjugate_gradient_t
+conjugate_gradient_init_csr(const size_t *row_ptr, const size_t *cols,
+                            const double *vals, const double *b, size_t n,
+                            const char *initial_point, precond_t precond,
+                            process_t process, size_t process_n)
+{
+	conjugate_gradient_t ret = conjugate_gradient_init_common(
+		initial_point, precond, process, process_n);
+
+	/* a NULL system fails on beginning as for invalid strings */
+	ret.system =
+		spnm_utils::sparse_system_from_csr(row_ptr, cols, vals, b, n);
+
+	return ret;
+}
+
+conjugate_gradient_t
+conjugate_gradient_init_file(const char *a_file, const char *b_file,
+                             const char *initial_point, precond_t precond,
+                             process_t process, size_t process_n)
+{
+	conjugate_gradient_t ret = conjugate_gradient_init_common(
+		initial_point, precond, process, process_n);
+
+	ret.a_file = spnm_utils::strdup(a_file);
+	ret.b_file = b_file ? spnm_utils::strdup(b_file) : NULL;
+
+	return ret;
+}
+
+int
+conjugate_gradient_perform(conjugate_gradient_t *t)
+{
+	SPNM_DISPATCH(t->process, conjugate_gradient_perform, (t));
+	return err_x_input;
+}
+
+int
+conjugate_gradient_begin(conjugate_gradient_t *t)
+{
+	SPNM_DISPATCH(t->process, conjugate_gradient_begin, (t));
+	return err_x_input;
+}
+
+int
+conjugate_gradient_step(conjugate_gradient_t *t)
+{
+	SPNM_DISPATCH(t->process, conjugate_gradient_step, (t));
+	return err_x_input;
+}
+
+int
+conjugate_gradient_write_step(const conjugate_gradient_s *step, void *data)
+{
+	std::ostream *out = (std::ostream *)data;
+
+	*out << step->n << '\t' << step->alpha << '\t' << step->beta << '\t'
+	     << step->residual_norm << '\t' << step->x_norm << '\n';
+
+	return 0;
+}
+
+void
+conjugate_gradient_free(conjugate_gradient_t *t)
+{
+	free(t->a);
+	free(t->b);
+	free(t->a_file);
+	free(t->b_file);
+	free(t->initial_point);
+
+	spnm_utils::sparse_system_free(t->system);
+	free(t->x);
+
+	free(t->step.alpha);
+	free(t->step.beta);
+	free(t->step.residual_norm);
+	free(t->step.x_norm);
+}
+
+/* = 5 - INTERPOLATION = */
+
+/* == 1. newton's and lagrange's interpolation == */
+
+interpolation_t
+interpolation_init(const char *x, const char *y, const char *at,
+                   interpolation_method_t method, process_t process,
+                   size_t process_n)
+{
+	interpolation_t ret;
+
+	ret.x         = x ? spnm_utils::strdup(x) : NULL;
+	ret.y         = y ? spnm_utils::strdup(y) : NULL;
+	ret.at        = at ? spnm_utils::strdup(at) : NULL;
+	ret.method    = method;
+	ret.process   = process;
+	ret.process_n = process_n;
+	ret.threads_c = 0;
+
+	ret.points_c = 0;
+	ret.steps_c  = 0;
+	ret.steps    = NULL;
+	ret.value    = NULL;
+
+	ret.xs         = NULL;
+	ret.ys         = NULL;
+	ret.column     = NULL;
+	ret.diagonal   = NULL;
+	ret.coefs      = NULL;
+	ret.basis      = NULL;
+	ret.at_val     = 0;
+	ret.points_max = 0;
+	ret.done       = 0;
+
+	return ret;
+}
+
+int
+interpolation_perform(interpolation_t *t)
+{
+	SPNM_DISPATCH(t->process, interpolation_perform, (t));
+	return err_x_input;
+}
+
+int
+interpolation_begin(interpolation_t *t)
+{
+	SPNM_DISPATCH(t->process, interpolation_begin, (t));
+	return err_x_input;
+}
+
+int
+interpolation_step(interpolation_t *t)
+{
+	SPNM_DISPATCH(t->process, interpolation_step, (t));
+	return err_x_input;
+}
+
+steps_range<interpolation_t, interpolation_s, interpolation_step>
+interpolation_steps(interpolation_t *t)
+{
+	steps_range<interpolation_t, interpolation_s, interpolation_step> ret;
+
+	ret.t   = t;
+	ret.err = interpolation_begin(t);
+
+	return ret;
+}
+
+int
+interpolation_add_point(interpolation_t *t, const char *x, const char *y)
+{
+	SPNM_DISPATCH(t->process, interpolation_add_point, (t, x, y));
+	return err_x_input;
+}
+
+int
+interpolation_eval(const interpolation_t *t, const double *x, size_t n,
+                   double *y)
+{
+	if (!t->done)
+		return err_condition_not_met;
+
+	spnm_utils::newton_form_eval(t->xs, t->coefs, t->points_c, x, n, y,
+	                             t->threads_c);
+	return 0;
+}
+
+void
+interpolation_free(interpolation_t *t)
+{
+	free(t->x);
+	free(t->y);
+	free(t->at);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		for (size_t j = 0; j < t->steps[i].vals_c; j++)
+			free(t->steps[i].vals[j]);
+		free(t->steps[i].vals);
+	}
+	free(t->steps);
+	free(t->value);
+
+	free(t->xs);
+	free(t->ys);
+	free(t->column);
+	free(t->diagonal);
+	free(t->coefs);
+	free(t->basis);
+}
+
+/* == 2. cubic splines == */
+
+spline_t
+spline_init(const char *x, const char *y, const char *at, spline_end_t ends,
+            const char *slopes, process_t process, size_t process_n)
+{
+	spline_t ret;
+
+	ret.x         = x ? spnm_utils::strdup(x) : NULL;
+	ret.y         = y ? spnm_utils::strdup(y) : NULL;
+	ret.at        = at ? spnm_utils::strdup(at) : NULL;
+	ret.ends      = ends;
+	ret.slopes    = slopes ? spnm_utils::strdup(slopes) : NULL;
+	ret.process   = process;
+	ret.process_n = process_n;
+	ret.threads_c = 0;
+
+	ret.points_c = 0;
+	ret.steps_c  = 0;
+	ret.steps    = NULL;
+	ret.value    = NULL;
+
+	ret.xs      = NULL;
+	ret.ys      = NULL;
+	ret.coefs   = NULL;
+	ret.buckets = NULL;
+	ret.at_val  = 0;
+	ret.done    = 0;
+
+	return ret;
+}
+
+spline_t
+spline_init_values(const double *x, const double *y, size_t n, const char *at,
+                   spline_end_t ends, const char *slopes, process_t process,
+                   size_t process_n)
+{
+	spline_t ret = spline_init(NULL, NULL, at, ends, slopes, process,
+	                           process_n);
+
+	ret.points_c = n;
+	ret.xs       = (double *)malloc(n * sizeof(double));
+	ret.ys       = (double *)malloc(n * sizeof(double));
+	std::copy(x, x + n, ret.xs);
+	std::copy(y, y + n, ret.ys);
+
+	return ret;
+}
+
+int
+spline_perform(spline_t *t)
+{
+	SPNM_DISPATCH(t->process, spline_perform, (t));
+	return err_x_input;
+}
+
+int
+spline_begin(spline_t *t)
+{
+	SPNM_DISPATCH(t->process, spline_begin, (t));
+	return err_x_input;
+}
+
+int
+spline_step(spline_t *t)
+{
+	SPNM_DISPATCH(t->process, spline_step, (t));
+	return err_x_input;
+}
+
+steps_range<spline_t, spline_s, spline_step>
+spline_steps(spline_t *t)
+{
+	steps_range<spline_t, spline_s, spline_step> ret;
+
+	ret.t   = t;
+	ret.err = spline_begin(t);
+
+	return ret;
+}
+
+int
+spline_eval(const spline_t *t, const double *x, size_t n, double *y)
+{
+	if (!t->buckets)
+		return err_condition_not_met;
+
+	spnm_utils::cubic_segments_eval(t->xs, t->coefs, t->points_c - 1,
+	                                t->buckets, x, n, y, t->threads_c);
+	return 0;
+}
+
+void
+spline_free(spline_t *t)
+{
+	free(t->x);
+	free(t->y);
+	free(t->at);
+	free(t->slopes);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].a);
+		free(t->steps[i].b);
+		free(t->steps[i].c);
+		free(t->steps[i].d);
+	}
+	free(t->steps);
+	free(t->value);
+
+	free(t->xs);
+	free(t->ys);
+	free(t->coefs);
+	free(t->buckets);
+}
+
+/* = 6 - CURVE FITTING = */
+
+/* == 1. least squares == */
+
+fit_t
+fit_init(const char *x, const char *y, fit_model_t model, size_t degree,
+         process_t process, size_t process_n)
+{
+	fit_t ret;
+
+	ret.x         = x ? spnm_utils::strdup(x) : NULL;
+	ret.y         = y ? spnm_utils::strdup(y) : NULL;
+	ret.file      = NULL;
+	ret.format    = FIT_CSV;
+	ret.model     = model;
+	ret.degree    = model == FIT_POLYNOMIAL ? degree : 1;
+	ret.process   = process;
+	ret.process_n = process_n;
+	ret.threads_c = 0;
+
+	ret.points_c = 0;
+	ret.steps_c  = 0;
+	ret.steps    = NULL;
+	ret.coefs_c  = 0;
+	ret.coefs    = NULL;
+
+	ret.sums = NULL;
+	ret.done = 0;
+
+	return ret;
+}
+
+fit_t
+fit_init_file(const char *file, fit_format_t format, fit_model_t model,
+              size_t degree, process_t process, size_t process_n)
+{
+	fit_t ret = fit_init(NULL, NULL, model, degree, process, process_n);
+
+	ret.file   = file ? spnm_utils::strdup(file) : NULL;
+	ret.format = format;
+
+	return ret;
+}
+
+int
+fit_perform(fit_t *t)
+{
+	SPNM_DISPATCH(t->process, fit_perform, (t));
+	return err_x_input;
+}
+
+int
+fit_begin(fit_t *t)
+{
+	SPNM_DISPATCH(t->process, fit_begin, (t));
+	return err_x_input;
+}
+
+int
+fit_step(fit_t *t)
+{
+	SPNM_DISPATCH(t->process, fit_step, (t));
+	return err_x_input;
+}
+
+steps_range<fit_t, fit_s, fit_step>
+fit_steps(fit_t *t)
+{
+	steps_range<fit_t, fit_s, fit_step> ret;
+
+	ret.t   = t;
+	ret.err = fit_begin(t);
+
+	return ret;
+}
+
+void
+fit_free(fit_t *t)
+{
+	free(t->x);
+	free(t->y);
+	free(t->file);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].sum_x);
+		free(t->steps[i].sum_xy);
+	}
+	free(t->steps);
+	for (size_t i = 0; i < t->coefs_c; i++)
+		free(t->coefs[i]);
+	free(t->coefs);
+
+	free(t->sums);
+}
+
+/* = 7 - NUMERICAL DIFFERENTIATION = */
+
+/* == 1. finite differences and richardson == */
+
+differentiation_t
+differentiation_init(const char *fx, const char *x, const char *h,
+                     difference_t difference, extrapolation_t extrapolation,
+                     process_t process, size_t process_n)
+{
+	differentiation_t ret;
+
+	ret.fx            = spnm_utils::strdup(fx);
+	ret.x             = spnm_utils::strdup(x);
+	ret.h             = spnm_utils::strdup(h);
+	ret.difference    = difference;
+	ret.extrapolation = extrapolation;
+	ret.process       = process;
+	ret.process_n     = process_n;
+
+	ret.steps_c = 0;
+
+	ret.f     = NULL;
+	ret.x_val = 0;
+	ret.h_val = 0;
+	ret.fx_x  = 0;
+	ret.done  = 0;
+
+	return ret;
+}
+
+int
+differentiation_perform(differentiation_t *t)
+{
+	SPNM_DISPATCH(t->process, differentiation_perform, (t));
+	return err_x_input;
+}
+
+int
+differentiation_begin(differentiation_t *t)
+{
+	SPNM_DISPATCH(t->process, differentiation_begin, (t));
+	return err_x_input;
+}
+
+int
+differentiation_step(differentiation_t *t)
+{
+	SPNM_DISPATCH(t->process, differentiation_step, (t));
+	return err_x_input;
+}
+
+steps_range<differentiation_t, differentiation_s, differentiation_step>
+differentiation_steps(differentiation_t *t)
+{
+	steps_range<differentiation_t, differentiation_s, differentiation_step>
+		ret;
+
+	ret.t   = t;
+	ret.err = differentiation_begin(t);
+
+	return ret;
+}
+
+void
+differentiation_free(differentiation_t *t)
+{
+	free(t->fx);
+	free(t->x);
+	free(t->h);
+
+	spnm_utils::fx_free(t->f);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].h);
+		free(t->steps[i].derivative);
+		for (size_t j = 0; j < DIFFERENTIATION_STEPS_MAX; j++)
+			free(t->steps[i].richardson[j]);
+	}
+}
+
+
+/* = 8 - EIGENVALUES = */
+
+/* == 1. power method and inverse iteration == */
+
+power_iteration_t
+power_iteration_init(const char *a, const char *initial_vector,
+                     power_method_t method, const char *shift,
+                     process_t process, size_t process_n)
+{
+	power_iteration_t ret;
+
+	ret.a              = spnm_utils::strdup(a);
+	ret.initial_vector = spnm_utils::strdup(initial_vector);
+	ret.method         = method;
+	ret.shift          = spnm_utils::strdup(shift);
+	ret.process        = process;
+	ret.process_n      = process_n;
+	ret.threads_c      = 0;
+
+	ret.rows_c  = 0;
+	ret.steps_c = 0;
+
+	ret.shifted   = NULL;
+	ret.perm      = NULL;
+	ret.x         = NULL;
+	ret.y         = NULL;
+	ret.shift_val = 0;
+	ret.done      = 0;
+
+	return ret;
+}
+
+power_iteration_t
+power_iteration_init_values(const double *a, const double *initial_vector,
+                            size_t n, power_method_t method, const char *shift,
+                            process_t process, size_t process_n)
+{
+	power_iteration_t ret;
+
+	ret.a              = NULL;
+	ret.initial_vector = NULL;
+	ret.method         = method;
+	ret.shift          = spnm_utils::strdup(shift);
+	ret.process        = process;
+	ret.process_n      = process_n;
+	ret.threads_c      = 0;
+
+	ret.rows_c  = n;
+	ret.steps_c = 0;
+
+	ret.shifted = (double *)malloc(n * n * sizeof(double));
+	ret.x       = (double *)malloc(n * sizeof(double));
+	std::copy(a, a + n * n, ret.shifted);
+	std::copy(initial_vector, initial_vector + n, ret.x);
+	ret.perm      = NULL;
+	ret.y         = NULL;
+	ret.shift_val = 0;
+	ret.done      = 0;
+
+	return ret;
+}
+
+int
+power_iteration_perform(power_iteration_t *t)
+{
+	SPNM_DISPATCH(t->process, power_iteration_perform, (t));
+	return err_x_input;
+}
+
+int
+power_iteration_begin(power_iteration_t *t)
+{
+	SPNM_DISPATCH(t->process, power_iteration_begin, (t));
+	return err_x_input;
+}
+
+int
+power_iteration_step(power_iteration_t *t)
+{
+	SPNM_DISPATCH(t->process, power_iteration_step, (t));
+	return err_x_input;
+}
+
+steps_range<power_iteration_t, power_iteration_s, power_iteration_step>
+power_iteration_steps(power_iteration_t *t)
+{
+	steps_range<power_iteration_t, power_iteration_s, power_iteration_step>
+		ret;
+
+	ret.t   = t;
+	ret.err = power_iteration_begin(t);
+
+	return ret;
+}
+
+void
+power_iteration_free(power_iteration_t *t)
+{
+	free(t->a);
+	free(t->initial_vector);
+	free(t->shift);
+
+	free(t->shifted);
+	free(t->perm);
+	free(t->x);
+	free(t->y);
+
+	for (size_t i = 0; i < t->steps_c; i++) {
+		free(t->steps[i].eigenvalue);
+		for (size_t j = 0; j < t->rows_c; j++)
+			free(t->steps[i].x_next[j]);
+		free(t->steps[i].x_next);
+	}
+}
+
+/* == 2. qr algorithm == */
+
+qr_algorithm_t
+qr_algorithm_init(const char *a, process_t process, size_t process_n)
+{
+	qr_algorithm_t ret;
+
+	ret.a         = spnm_utils::strdup(a);
+	ret.process   = process;
+	ret.process_n = process_n;
+	ret.threads_c = 0;
+
+	ret.rows_c  = 0;
+	ret.steps_c = 0;
+	ret.steps   = NULL;
+	ret.re      = NULL;
+	ret.im      = NULL;
+
+	ret.h         = NULL;
+	ret.wr        = NULL;
+	ret.wi        = NULL;
+	ret.norm      = 0;
+	ret.lo        = 0;
+	ret.hi        = 0;
+	ret.sweeps_c  = 0;
+	ret.steps_max = 0;
+	ret.done      = 0;
+
+	return ret;
+}
+
+qr_algorithm_t
+qr_algorithm_init_values(const double *a, size_t n, process_t process,
+                         size_t process_n)
+{
+	qr_algorithm_t ret;
+
+	ret.a         = NULL;
+	ret.process   = process;
+	ret.process_n = process_n;
+	ret.threads_c = 0;
+
+	ret.rows_c  = n;
+	ret.steps_c = 0;
+	ret.steps   = NULL;
+	ret.re      = NULL;
+	ret.im      = NULL;
+
+	ret.h = (double *)malloc(n * n * sizeof(double));
+	std::copy(a, a + n * n, ret.h);
+	ret.wr        = NULL;
+	ret.wi        = NULL;
+	ret.norm      = 0;
+	ret.lo        = 0;
+	ret.hi        = 0;
+	ret.sweeps_c  = 0;
+	ret.steps_max = 0;
+	ret.done      = 0;
+
+	return ret;
+}
+
+int
+qr_algorithm_perform(qr_algorithm_t *t)
+{
+	SPNM_DISPATCH(t->process, qr_algorithm_perform, (t));
+	return err_x_input;
+}
+
+int
+qr_algorithm_begin(qr_algorithm_t *t)
+{
+	SPNM_DISPATCH(t->process, qr_algorithm_begin, (t));
+	return err_x_input;
+}
+
+int
+qr_algorithm_step(qr_algorithm_t *t)
+{
+	SPNM_DISPATCH(t->process, qr_algorithm_step, (t));
+	return err_x_input;
+}
+
+steps_range<qr_algorithm_t, qr_algorithm_s, qr_algorithm_step>
+qr_algorithm_steps(qr_algorithm_t *t)
+{
+	steps_range<qr_algorithm_t, qr_algorithm_s, qr_algorithm_step> ret;
+
+	ret.t   = t;
+	ret.err = qr_algorithm_begin(t);
+
+	return ret;
+}
+
+void
+qr_algorithm_free(qr_algorithm_t *t)
+{
+	free(t->a);
+
+	free(t->h);
+	free(t->wr);
+	free(t->wi);
+
+	for (size_t i = 0; i < t->steps_c; i++)
+		free(t->steps[i].subdiagonal);
+	free(t->steps);
+
+	for (size_t i = 0; t->re && i < t->rows_c; i++) {
+		free(t->re[i]);
+		free(t->im[i]);
+	}
+	free(t->re);
+	free(t->im);
+}
+} /* namespace spnm */
+
+/*
+ ===============================================================================
+ |                                    Utils                                    |
+ ===============================================================================
+ */
+
+namespace spnm_utils
+{
+
+/* = STRING = */
+
+char *
+strdup(const char *str)
+{
+	size_t str_len = strlen(str) + 1;
+
+	char *out = (char *)malloc(str_len);
+	memcpy(out, str, str_len);
+
+	return out;
+}
+
+std::string
+val_string(double val)
+{
+	/* creating string off the double makes it easier to deal with very
+	 * small numbers -- avoid 6e-09 case for example. */
+
+	/* get for example "4.000000" as "4" */
+	if (std::floor(val) == val)
+		return std::to_string((int)val);
+	return std::to_string(val);
+}
+
+std::string
+approx_string(double val)
+{
+	char buffer[64];
+	snprintf(buffer, sizeof(buffer), "%.12g", val);
+
+	/* the steps are rounded off as decimal strings so small values can't
+	 * have an exponent as in "1.2e-05", which would be read as 1.2 */
+	if (strchr(buffer, 'e') && fabs(val) < 1) {
+		int decimals = 11 - (int)std::floor(std::log10(fabs(val)));
+		snprintf(buffer, sizeof(buffer), "%.*f", std::min(decimals, 40),
+		         val);
+
+		size_t len = strlen(buffer);
+		while (buffer[len - 1] == '0' && buffer[len - 2] != '.')
+			buffer[--len] = '\0';
+	}
+
+	/* nor can large values as in "1.2e+20", written out in full to their
+	 * 12 significant digits */
+	if (strchr(buffer, 'e') && fabs(val) >= 1) {
+		snprintf(buffer, sizeof(buffer), "%.11e", fabs(val));
+		int exponent = atoi(strchr(buffer, 'e') + 1);
+
+		std::string ret = val < 0 ? "-" : "";
+		ret += buffer[0];
+		ret.append(buffer + 2, 11);
+		ret.append(std::max(exponent - 11, 0), '0');
+		return ret + ".0";
+	}
+
+	/* giac keeps the point of an approximated integer, "2.0" and not "2" */
+	if (!strpbrk(buffer, ".e"))
+		strcat(buffer, ".0");
+	return buffer;
+}
+
+/* = F(X) = */
+
+/* Returns the giac context of `f` setting it up if this is the first time it
+ * is needed. Returns NULL on error. */
+static giac::context *
+fx_giac_ct(spnm::fx_t *f)
+{
+	if (f->ct)
+		return f->ct;
+
+	giac_init();
+	{
+		std::lock_guard<std::mutex> lock(giac_mutex);
+		f->ct = new giac::context;
+		giac::logptr(f->log, f->ct);
+	}
+
+	if (!giac_fx_parse(f->src.c_str(), f->ct)) {
+		std::lock_guard<std::mutex> lock(giac_mutex);
+		delete f->ct;
+		f->ct = NULL;
+	}
+	return f->ct;
+}
+
+spnm::fx_t *
+fx_parse(const char *fx, std::ostream *log)
+{
+	spnm::fx_t *f = new spnm::fx_t;
+	f->src    = fx;
+	f->log    = log;
+	f->ct     = NULL;
+	f->shadow = 0;
+	f->param  = 0;
+
+	const char *vars[] = { "x" };
+	f->is_native = !native_off && expr_compile(fx, vars, 1, &(f->expr));
+	if (f->is_native) {
+		expr_optimize(&(f->expr), 1);
+		f->slots.resize(f->expr.ins.size());
+		fx_set_param(f, 0);
+		if (shadow_sample() && fx_giac_ct(f)) {
+			f->shadow = 1;
+			shadow_solves_c++;
+		}
+		return f;
+	}
+
+	/* not for the native evaluator, leave it to giac */
+	if (!fx_giac_ct(f)) {
+		delete f;
+		return NULL;
+	}
+	return f;
+}
+
+std::string
+fx_val_string(const char *x, spnm::fx_t *f)
+{
+	double val = fx_val_double(x, f);
+	if (std::isnan(val))
+		return "";
+
+	return val_string(val);
+}
+
+double
+fx_val_double(const char *x, spnm::fx_t *f)
+{
+	double x_val;
+	if (f->is_native && expr_const_val(x, &x_val)) {
+		double vars[] = { x_val, f->param };
+		double val    = expr_eval_varying(&(f->expr), vars,
+		                                  f->slots.data());
+		if (f->shadow)
+			shadow_check(f, x, val, giac_fx_val_double(x, f->ct));
+		return val;
+	}
+
+	giac::context *ct = fx_giac_ct(f);
+	if (!ct)
+		return NAN;
+	return giac_fx_val_double(x, ct);
+}
+
+char
+fx_val_sign(const char *x, spnm::fx_t *f)
+{
+	double val = fx_val_double(x, f);
+	if (std::isnan(val))
+		return '*';
+
+	if (val < 0)
+		return '-';
+	return '+';
+}
+
+std::string
+fx_val_approx(const char *x, spnm::fx_t *f)
+{
+	double val = fx_val_double(x, f);
+	if (!std::isfinite(val))
+		return "";
+
+	return approx_string(val);
+}
+
+spnm::fx_t *
+fx_parse_param(const char *fx, const char *param, std::ostream *log)
+{
+	spnm::fx_t *f = new spnm::fx_t;
+	f->src       = fx;
+	f->log       = log;
+	f->ct        = NULL;
+	f->shadow    = 0;
+	f->param     = 0;
+	f->is_native = 1;
+
+	/* giac knows nothing of the parameter */
+	const char *vars[] = { "x", param };
+	if (!expr_compile(fx, vars, 2, &(f->expr))) {
+		*log << "Can't evaluate '" << fx
+		     << "' natively as a function of x and " << param << "."
+		     << std::endl;
+		delete f;
+		return NULL;
+	}
+	expr_optimize(&(f->expr), 1);
+	f->slots.resize(f->expr.ins.size());
+	fx_set_param(f, 0);
+
+	return f;
+}
+
+spnm::fx_t *
+fx_clone(const spnm::fx_t *f)
+{
+	spnm::fx_t *clone = new spnm::fx_t(*f);
+	clone->ct         = NULL;
+	clone->shadow     = 0;
+
+	return clone;
+}
+
+void
+fx_set_param(spnm::fx_t *f, double param)
+{
+	f->param = param;
+
+	/* what doesn't depend on x is only evaluated again here */
+	if (f->is_native) {
+		double vars[] = { 0, param };
+		expr_eval_invariant(&(f->expr), vars, f->slots.data());
+	}
+}
+
+void
+fx_val_batch(spnm::fx_t *f, const double *x, size_t n, double *fx)
+{
+	if (!f->is_native) {
+		giac::context *ct = fx_giac_ct(f);
+		for (size_t i = 0; i < n; i++)
+			fx[i] = ct ? giac_fx_val_double(
+					     approx_string(x[i]).c_str(), ct)
+			           : NAN;
+		return;
+	}
+
+	f->batch_slots.resize(f->expr.ins.size() * EXPR_BATCH);
+
+	double params[EXPR_BATCH];
+	for (size_t i = 0; i < EXPR_BATCH; i++)
+		params[i] = f->param;
+
+	/* the invariant slots are the same in every lane of every batch */
+	for (size_t i = 0; i < f->expr.invariant_c; i++)
+		std::fill_n(f->batch_slots.data() + i * EXPR_BATCH, EXPR_BATCH,
+		            f->slots[i]);
+
+	for (size_t i = 0; i < n; i += EXPR_BATCH) {
+		size_t        batch_c = std::min(EXPR_BATCH, n - i);
+		const double *vars[]  = { x + i, params };
+		expr_eval_batch_varying(&(f->expr), vars, batch_c,
+		                        f->batch_slots.data(), fx + i);
+
+		/* one point of every batch is enough for the sampling */
+		if (f->shadow) {
+			std::string x_string = approx_string(x[i]);
+			shadow_check(f, x_string.c_str(), fx[i],
+			             giac_fx_val_double(x_string.c_str(),
+			                                f->ct));
+		}
+	}
+}
+
+void
+fx_free(spnm::fx_t *f)
+{
+	if (!f)
+		return;
+
+	if (f->ct) {
+		std::lock_guard<std::mutex> lock(giac_mutex);
+		delete f->ct;
+	}
+	delete f;
+}
+
+/* = F(X) SYSTEMS = */
+
+spnm::fxs_t *
+fxs_parse(const char *const *fx, const char *const *vars, size_t vars_c,
+          std::ostream *log)
+{
+	spnm::fxs_t *f = new spnm::fxs_t;
+	f->vars_c      = vars_c;
+	f->exprs.resize(vars_c);
+
+	size_t slots_c = 0;
+	for (size_t i = 0; i < vars_c; i++) {
+		if (!expr_compile(fx[i], vars, vars_c, &(f->exprs[i]))) {
+			*log << "Can't evaluate '" << fx[i]
+			     << "' natively as a function of the variables."
+			     << std::endl;
+			delete f;
+			return NULL;
+		}
+		expr_optimize(&(f->exprs[i]), vars_c);
+		slots_c = std::max(slots_c, f->exprs[i].ins.size());
+	}
+
+	f->slots.resize(slots_c);
+	f->adjs.resize(slots_c);
+	f->jacobian.resize(vars_c * vars_c);
+	f->perm.resize(vars_c);
+
+	return f;
+}
+
+/* Evaluates the system `f` at `x` into `fx` and its Jacobian into
+ * `f->jacobian`. Returns 0 if any value isn't finite. */
+static int
+fxs_val_jacobian(spnm::fxs_t *f, const double *x, double *fx)
+{
+	size_t n = f->vars_c;
+
+	for (size_t i = 0; i < n; i++) {
+		fx[i] = expr_eval_grad(&(f->exprs[i]), x, f->slots.data(),
+		                       f->adjs.data(), f->jacobian.data() + i * n);
+		if (!std::isfinite(fx[i]))
+			return 0;
+	}
+	for (size_t i = 0; i < n * n; i++)
+		if (!std::isfinite(f->jacobian[i]))
+			return 0;
+
+	return 1;
+}
+
+void
+fxs_free(spnm::fxs_t *f)
+{
+	delete f;
+}
+
+spnm::sparse_fx_t *
+sparse_fx_parse(const char *fx, const char *const *vars, const int *offsets,
+                size_t vars_c, size_t unknowns_c, const char *boundary_lower,
+                const char *boundary_upper, std::ostream *log)
+{
+	/* = CHECK THE STENCIL = */
+
+	if (vars_c == 0 || vars_c > spnm::VARS_MAX - 2 || unknowns_c == 0) {
+		*log << "A stencil needs 1 to " << spnm::VARS_MAX - 2
+		     << " variables and at least 1 unknown." << std::endl;
+		return NULL;
+	}
+
+	spnm::sparse_fx_t *f = new spnm::sparse_fx_t;
+	f->unknowns_c        = unknowns_c;
+	f->offsets.assign(offsets, offsets + vars_c);
+
+	if (!expr_const_val(boundary_lower, &(f->boundary_lower)) ||
+	    !expr_const_val(boundary_upper, &(f->boundary_upper))) {
+		*log << "Invalid boundary values." << std::endl;
+		delete f;
+		return NULL;
+	}
+
+	/* = COMPILE = */
+
+	const char *all_vars[spnm::VARS_MAX];
+	for (size_t k = 0; k < vars_c; k++)
+		all_vars[k] = vars[k];
+	all_vars[vars_c]     = "i";
+	all_vars[vars_c + 1] = "n";
+
+	if (!expr_compile(fx, all_vars, vars_c + 2, &(f->expr))) {
+		*log << "Can't evaluate '" << fx
+		     << "' natively as a function of the variables." << std::endl;
+		delete f;
+		return NULL;
+	}
+	expr_optimize(&(f->expr), vars_c + 2);
+
+	/* = SPARSITY OF THE JACOBIAN = */
+
+	std::vector<int> row_offsets(f->offsets);
+	std::sort(row_offsets.begin(), row_offsets.end());
+	row_offsets.erase(std::unique(row_offsets.begin(), row_offsets.end()),
+	                  row_offsets.end());
+
+	spnm_utils::csr_t *a = &(f->jacobian);
+	a->rows_c            = unknowns_c;
+	a->row_ptr.assign(1, 0);
+	for (size_t i = 0; i < unknowns_c; i++) {
+		for (int offset : row_offsets) {
+			long j = (long)i + offset;
+			if (j >= 0 && j < (long)unknowns_c)
+				a->cols.push_back(j);
+		}
+		a->row_ptr.push_back(a->cols.size());
+	}
+	a->vals.resize(a->cols.size());
+
+	f->fx.resize(unknowns_c);
+	f->dx.resize(unknowns_c);
+
+	return f;
+}
+
+/* Evaluates the stencil `f` at `x` into `f->fx` and its Jacobian into
+ * `f->jacobian` on `threads_c` threads. Returns 0 if any value isn't finite.
+ */
+static int
+sparse_fx_val_jacobian(spnm::sparse_fx_t *f, const double *x,
+                       size_t threads_c)
+{
+	spnm_utils::csr_t *a      = &(f->jacobian);
+	size_t             n      = f->unknowns_c;
+	size_t             vars_c = f->offsets.size();
+
+	std::atomic<int> ok(1);
+	auto rows = [&](size_t begin, size_t end) {
+		/* evaluation space of this thread */
+		std::vector<double> slots(f->expr.ins.size());
+		std::vector<double> adjs(f->expr.ins.size());
+		double              vars[spnm::VARS_MAX];
+		double              grad[spnm::VARS_MAX];
+
+		for (size_t i = begin; i < end; i++) {
+			for (size_t k = 0; k < vars_c; k++) {
+				long j = (long)i + f->offsets[k];
+				if (j < 0)
+					vars[k] = f->boundary_lower;
+				else if (j >= (long)n)
+					vars[k] = f->boundary_upper;
+				else
+					vars[k] = x[j];
+			}
+			vars[vars_c]     = i + 1;
+			vars[vars_c + 1] = n;
+
+			f->fx[i] = expr_eval_grad(&(f->expr), vars,
+			                          slots.data(), adjs.data(), grad);
+
+			/* = FILLING THE ROW = */
+
+			size_t row_begin = a->row_ptr[i];
+			size_t row_end   = a->row_ptr[i + 1];
+			for (size_t p = row_begin; p < row_end; p++)
+				a->vals[p] = 0;
+			for (size_t k = 0; k < vars_c; k++) {
+				long j = (long)i + f->offsets[k];
+				if (j < 0 || j >= (long)n)
+					continue; /* boundaries are constants */
+
+				size_t p = row_begin;
+				while (a->cols[p] != (size_t)j)
+					p++;
+				a->vals[p] += grad[k];
+			}
+
+			if (!std::isfinite(f->fx[i]))
+				ok = 0;
+			for (size_t p = row_begin; p < row_end; p++)
+				if (!std::isfinite(a->vals[p]))
+					ok = 0;
+		}
+	};
+	parallel_for(n, PARALLEL_GRAIN_EVAL, threads_c, rows);
+
+	return ok;
+}
+
+void
+sparse_fx_free(spnm::sparse_fx_t *f)
+{
+	delete f;
+}
+
+/* = SPARSE SYSTEMS = */
+
+/* Sets the position of the diagonal of every row of `s`. */
+static void
+sparse_system_set_diag(spnm::sparse_system_t *s)
+{
+	const csr_t *a = &(s->a);
+
+	s->diag.assign(a->rows_c, a->cols.size());
+	for (size_t i = 0; i < a->rows_c; i++)
+		for (size_t p = a->row_ptr[i]; p < a->row_ptr[i + 1]; p++)
+			if (a->cols[p] == i)
+				s->diag[i] = p;
+}
+
+spnm::sparse_system_t *
+sparse_system_parse(const char *a, const char *b, std::ostream *log)
+{
+	std::vector<double> a_vals, b_vals;
+	size_t              n;
+	if (!a || !b || !linear_system_vals(a, b, &a_vals, &b_vals, &n)) {
+		*log << "Invalid entries of A or b or A isn't square"
+		     << std::endl;
+		return NULL;
+	}
+
+	/* only the nonzeros are kept */
+	spnm::sparse_system_t *s = new spnm::sparse_system_t;
+	s->a.rows_c              = n;
+	s->a.row_ptr.push_back(0);
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j < n; j++) {
+			if (a_vals[i * n + j] == 0)
+				continue;
+			s->a.cols.push_back(j);
+			s->a.vals.push_back(a_vals[i * n + j]);
+		}
+		s->a.row_ptr.push_back(s->a.cols.size());
+	}
+	s->b = b_vals;
+	sparse_system_set_diag(s);
+
+	return s;
+}
+
+spnm::sparse_system_t *
+sparse_system_from_csr(const size_t *row_ptr, const size_t *cols,
+                       const double *vals, const double *b, size_t n)
+{
+	if (n == 0 || row_ptr[0] != 0)
+		return NULL;
+	for (size_t i = 0; i < n; i++) {
+		if (row_ptr[i + 1] < row_ptr[i] || !std::isfinite(b[i]))
+			return NULL;
+		for (size_t p = row_ptr[i]; p < row_ptr[i + 1]; p++)
+			if (cols[p] >= n || !std::isfinite(vals[p]) ||
+			    (p > row_ptr[i] && cols[p] <= cols[p - 1]))
+				return NULL;
+	}
+
+	spnm::sparse_system_t *s = new spnm::sparse_system_t;
+	s->a.rows_c              = n;
+	s->a.row_ptr.assign(row_ptr, row_ptr + n + 1);
+	s->a.cols.assign(cols, cols + row_ptr[n]);
+	s->a.vals.assign(vals, vals + row_ptr[n]);
+	s->b.assign(b, b + n);
+	sparse_system_set_diag(s);
+
+	return s;
+}
+
+/* Read only mapping of a whole file. */
+struct mapped_file_t {
+	const char *data;
+	size_t      size;
+};
+
+/* Maps the file `path` into `f`. Returns 0 on error. */
+static int
+mapped_file_open(const char *path, mapped_file_t *f)
+{
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return 0;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		close(fd);
+		return 0;
+	}
+	f->size    = st.st_size;
+	void *data = mmap(NULL, f->size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); /* the mapping stays */
+	if (data == MAP_FAILED)
+		return 0;
+
+	madvise(data, f->size, MADV_SEQUENTIAL);
+	f->data = (const char *)data;
+	return 1;
+}
+
+static void
+mapped_file_close(mapped_file_t *f)
+{
+	munmap((void *)f->data, f->size);
+}
+
+/* Returns 1 if `ch` separates the numbers of a matrix market file, not by
+ * isspace() for the speed. */
+static inline int
+mm_is_blank(char ch)
+{
+	return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r';
+}
+
+/* Moves `*c` past the blanks and the comment lines of a matrix market file
+ * ending at `end`. */
+static void
+mm_skip(const char **c, const char *end)
+{
+	while (*c < end) {
+		if (**c == '%')
+			while (*c < end && **c != '\n')
+				(*c)++;
+		else if (mm_is_blank(**c))
+			(*c)++;
+		else
+			break;
+	}
+}
+
+/* Reads the `len` characters at `c` of a mapped file as a number into `val`.
+ * Returns 0 if they aren't a finite one. */
+static int
+mapped_number(const char *c, size_t len, double *val)
+{
+	if (len == 0)
+		return 0;
+
+	/* the indices and most values are short integers or decimals, read
+	 * directly: below 10^15 the digits and the power of 10 are exact so
+	 * the quotient is rounded as by strtod() */
+	static const double powers[16] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+		                           1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+		                           1e12, 1e13, 1e14, 1e15 };
+	const char *digits   = c + (*c == '-' || *c == '+');
+	size_t      digits_c = c + len - digits;
+	if (digits_c > 0 && digits_c < 16) {
+		long long num      = 0;
+		size_t    k        = 0, frac_c = 0;
+		int       is_point = 0;
+		for (; k < digits_c; k++) {
+			if (digits[k] >= '0' && digits[k] <= '9') {
+				num = num * 10 + (digits[k] - '0');
+				frac_c += is_point;
+			} else if (digits[k] == '.' && !is_point) {
+				is_point = 1;
+			} else {
+				break;
+			}
+		}
+		if (k == digits_c && digits_c > (size_t)is_point) {
+			*val = (*c == '-' ? -num : num) / powers[frac_c];
+			return 1;
+		}
+	}
+
+	/* the mapping doesn't end in a '\0' for strtod() */
+	char buffer[64];
+	if (len >= sizeof(buffer))
+		return 0;
+	memcpy(buffer, c, len);
+	buffer[len] = '\0';
+
+	char *num_end;
+	*val = strtod(buffer, &num_end);
+	return *num_end == '\0' && std::isfinite(*val);
+}
+
+/* Reads the number at `*c` of a matrix market file ending at `end` into
+ * `val`, moving `*c` past it. Returns 0 if there's none. */
+static int
+mm_read(const char **c, const char *end, double *val)
+{
+	mm_skip(c, end);
+
+	size_t len = 0;
+	while (*c + len < end && !mm_is_blank((*c)[len]))
+		len++;
+	if (!mapped_number(*c, len, val))
+		return 0;
+
+	*c += len;
+	return 1;
+}
+
+/* Reads the index at `*c` of a matrix market file ending at `end`, 1 based,
+ * into the 0 based `i` below `n`. Returns 0 on error. */
+static int
+mm_read_index(const char **c, const char *end, size_t n, size_t *i)
+{
+	double val;
+	if (!mm_read(c, end, &val) || val < 1 || val > n ||
+	    val != floor(val))
+		return 0;
+
+	*i = (size_t)val - 1;
+	return 1;
+}
+
+/* Checks the banner of the matrix market file `f` to be of `object` with the
+ * field real or integer, setting `is_symmetric`, and moves `*c` past it.
+ * Returns 0 on error. */
+static int
+mm_banner(const mapped_file_t *f, const char *object, const char **c,
+          int *is_symmetric)
+{
+	const char *end      = f->data + f->size;
+	const char *line_end = (const char *)memchr(f->data, '\n', f->size);
+	if (!line_end)
+		line_end = end;
+
+	std::istringstream banner(std::string(f->data, line_end));
+	std::string        words[5];
+	for (std::string &word : words) {
+		banner >> word;
+		for (char &ch : word)
+			ch = tolower((unsigned char)ch);
+	}
+	if (words[0] != "%%matrixmarket" || words[1] != "matrix" ||
+	    words[2] != object ||
+	    (words[3] != "real" && words[3] != "integer") ||
+	    (words[4] != "general" && words[4] != "symmetric"))
+		return 0;
+
+	*is_symmetric = words[4] == "symmetric";
+	*c            = line_end;
+	return 1;
+}
+
+/* Reads A of the matrix market file `f` into `s`. Returns 0 on error. */
+static int
+sparse_system_read_a(const mapped_file_t *f, spnm::sparse_system_t *s)
+{
+	const char *c, *end = f->data + f->size;
+	int         is_symmetric;
+	if (!mm_banner(f, "coordinate", &c, &is_symmetric))
+		return 0;
+
+	double rows_c, cols_c, entries_c;
+	if (!mm_read(&c, end, &rows_c) || !mm_read(&c, end, &cols_c) ||
+	    !mm_read(&c, end, &entries_c) || rows_c < 1 || rows_c != cols_c ||
+	    rows_c != floor(rows_c) || entries_c != floor(entries_c) ||
+	    entries_c < 0)
+		return 0;
+
+	size_t n   = rows_c;
+	csr_t *a   = &(s->a);
+	a->rows_c  = n;
+	const char *entries = c;
+
+	/* = NONZEROS OF EVERY ROW = */
+
+	/* the file is parsed twice in place rather than copied as triplets,
+	 * first for the sizes of the rows */
+	std::vector<size_t> row_c(n, 0);
+	for (size_t k = 0; k < entries_c; k++) {
+		size_t i, j;
+		double val;
+		if (!mm_read_index(&c, end, n, &i) ||
+		    !mm_read_index(&c, end, n, &j) || !mm_read(&c, end, &val))
+			return 0;
+		row_c[i]++;
+		if (is_symmetric && i != j)
+			row_c[j]++;
+	}
+
+	a->row_ptr.assign(n + 1, 0);
+	for (size_t i = 0; i < n; i++)
+		a->row_ptr[i + 1] = a->row_ptr[i] + row_c[i];
+	a->cols.resize(a->row_ptr[n]);
+	a->vals.resize(a->row_ptr[n]);
+
+	/* = ENTRIES = */
+
+	c = entries;
+	std::vector<size_t> next(a->row_ptr.begin(), a->row_ptr.end() - 1);
+	for (size_t k = 0; k < entries_c; k++) {
+		size_t i, j;
+		double val;
+		mm_read_index(&c, end, n, &i);
+		mm_read_index(&c, end, n, &j);
+		mm_read(&c, end, &val);
+
+		a->cols[next[i]]   = j;
+		a->vals[next[i]++] = val;
+		if (is_symmetric && i != j) {
+			a->cols[next[j]]   = i;
+			a->vals[next[j]++] = val;
+		}
+	}
+
+	/* = ROWS IN INCREASING COLUMNS = */
+
+	std::vector<std::pair<size_t, double>> row;
+	for (size_t i = 0; i < n; i++) {
+		size_t row_begin = a->row_ptr[i], row_end = a->row_ptr[i + 1];
+		row.clear();
+		for (size_t q = row_begin; q < row_end; q++)
+			row.emplace_back(a->cols[q], a->vals[q]);
+		std::sort(row.begin(), row.end());
+
+		for (size_t q = row_begin; q < row_end; q++) {
+			/* an entry given twice */
+			if (q > row_begin &&
+			    row[q - row_begin].first == a->cols[q - 1])
+				return 0;
+			a->cols[q] = row[q - row_begin].first;
+			a->vals[q] = row[q - row_begin].second;
+		}
+	}
+
+	return 1;
+}
+
+/* Reads b of the matrix market file `f` into `s`. Returns 0 on error. */
+static int
+sparse_system_read_b(const mapped_file_t *f, spnm::sparse_system_t *s)
+{
+	const char *c, *end = f->data + f->size;
+	int         is_symmetric;
+	if (!mm_banner(f, "array", &c, &is_symmetric) || is_symmetric)
+		return 0;
+
+	double rows_c, cols_c;
+	if (!mm_read(&c, end, &rows_c) || !mm_read(&c, end, &cols_c) ||
+	    rows_c != s->a.rows_c || cols_c != 1)
+		return 0;
+
+	s->b.resize(s->a.rows_c);
+	for (size_t i = 0; i < s->a.rows_c; i++)
+		if (!mm_read(&c, end, &(s->b[i])))
+			return 0;
+
+	return 1;
+}
+
+spnm::sparse_system_t *
+sparse_system_read(const char *a_file, const char *b_file, std::ostream *log)
+{
+	spnm::sparse_system_t *s = new spnm::sparse_system_t;
+	mapped_file_t          f;
+
+	if (!mapped_file_open(a_file, &f)) {
+		*log << "Can't read '" << a_file << "'" << std::endl;
+		delete s;
+		return NULL;
+	}
+	int is_read = sparse_system_read_a(&f, s);
+	mapped_file_close(&f);
+	if (!is_read) {
+		*log << "Invalid matrix market coordinates in '" << a_file
+		     << "'" << std::endl;
+		delete s;
+		return NULL;
+	}
+
+	if (!b_file) {
+		s->b.assign(s->a.rows_c, 1);
+	} else {
+		if (!mapped_file_open(b_file, &f)) {
+			*log << "Can't read '" << b_file << "'" << std::endl;
+			delete s;
+			return NULL;
+		}
+		is_read = sparse_system_read_b(&f, s);
+		mapped_file_close(&f);
+		if (!is_read) {
+			*log << "Invalid matrix market array of the size of A "
+			        "in '"
+			     << b_file << "'" << std::endl;
+			delete s;
+			return NULL;
+		}
+	}
+	sparse_system_set_diag(s);
+
+	return s;
+}
+
+size_t
+sparse_system_rows_c(const spnm::sparse_system_t *s)
+{
+	return s->a.rows_c;
+}
+
+void
+sparse_system_free(spnm::sparse_system_t *s)
+{
+	delete s;
+}
+
+/* = EXPRESSION = */
+
+struct expr_parser {
+	const char        *p;      /* current position in the source */
+	const char *const *vars;   /* names of the variables */
+	size_t             vars_c; /* number of variables */
+	expr_t            *e;      /* output */
+	int                ok;     /* 0 once anything unsupported is found */
+};
+
+/* functions with a single argument */
+static const struct {
+	const char *name;
+	expr_op     op;
+} expr_funcs[] = {
+	{ "sin", EXPR_SIN },   { "cos", EXPR_COS },     { "tan", EXPR_TAN },
+	{ "asin", EXPR_ASIN }, { "acos", EXPR_ACOS },   { "atan", EXPR_ATAN },
+	{ "sinh", EXPR_SINH }, { "cosh", EXPR_COSH },   { "tanh", EXPR_TANH },
+	{ "exp", EXPR_EXP },   { "log", EXPR_LOG },     { "ln", EXPR_LOG },
+	{ "log10", EXPR_LOG10 }, { "sqrt", EXPR_SQRT }, { "abs", EXPR_ABS },
+};
+
+static size_t
+expr_emit(expr_parser *ps, expr_op op, size_t a, size_t b, double val)
+{
+	expr_ins ins;
+	ins.op  = op;
+	ins.a   = a;
+	ins.b   = b;
+	ins.val = val;
+	ps->e->ins.push_back(ins);
+
+	return ps->e->ins.size() - 1;
+}
+
+static void
+expr_skip_space(expr_parser *ps)
+{
+	while (*(ps->p) == ' ' || *(ps->p) == '\t' || *(ps->p) == '\n')
+		ps->p++;
+}
+
+static size_t
+expr_parse_sum(expr_parser *ps);
+
+static size_t
+expr_parse_unary(expr_parser *ps);
+
+/* primary := number | constant | variable | function '(' sum ')' |
+ *            '(' sum ')' */
+static size_t
+expr_parse_primary(expr_parser *ps)
+{
+	expr_skip_space(ps);
+	const char *p = ps->p;
+
+	/* = NUMBER = */
+
+	if (isdigit(*p) || (*p == '.' && isdigit(*(p + 1)))) {
+		while (isdigit(*p))
+			p++;
+		if (*p == '.')
+			p++;
+		while (isdigit(*p))
+			p++;
+		/* exponent only if it really is one, "2e^x" is 2*e^x */
+		if ((*p == 'e' || *p == 'E') &&
+		    (isdigit(*(p + 1)) ||
+		     ((*(p + 1) == '-' || *(p + 1) == '+') && isdigit(*(p + 2))))) {
+			p += 2;
+			while (isdigit(*p))
+				p++;
+		}
+
+		std::string number(ps->p, p - ps->p);
+		ps->p = p;
+		return expr_emit(ps, EXPR_CONST, 0, 0, strtod(number.c_str(), NULL));
+	}
+
+	/* = PARENTHESIS = */
+
+	if (*p == '(') {
+		ps->p++;
+		size_t ret = expr_parse_sum(ps);
+		expr_skip_space(ps);
+		if (*(ps->p) != ')') {
+			ps->ok = 0;
+			return 0;
+		}
+		ps->p++;
+		return ret;
+	}
+
+	/* = IDENTIFIER = */
+
+	if (!isalpha(*p) && *p != '_') {
+		ps->ok = 0;
+		return 0;
+	}
+	while (isalnum(*p) || *p == '_')
+		p++;
+	std::string name(ps->p, p - ps->p);
+	ps->p = p;
+
+	for (size_t i = 0; i < ps->vars_c; i++)
+		if (name == ps->vars[i])
+			return expr_emit(ps, EXPR_VAR, i, 0, 0);
+
+	expr_skip_space(ps);
+	if (*(ps->p) == '(') {
+		for (size_t i = 0; i < sizeof(expr_funcs) / sizeof(*expr_funcs);
+		     i++) {
+			if (name != expr_funcs[i].name)
+				continue;
+
+			ps->p++;
+			size_t arg = expr_parse_sum(ps);
+			expr_skip_space(ps);
+			if (*(ps->p) != ')') {
+				ps->ok = 0;
+				return 0;
+			}
+			ps->p++;
+			return expr_emit(ps, expr_funcs[i].op, arg, 0, 0);
+		}
+	} else {
+		if (name == "e")
+			return expr_emit(ps, EXPR_CONST, 0, 0, M_E);
+		if (name == "pi")
+			return expr_emit(ps, EXPR_CONST, 0, 0, M_PI);
+	}
+
+	ps->ok = 0;
+	return 0;
+}
+
+/* power := primary ('^' unary)? */
+static size_t
+expr_parse_power(expr_parser *ps)
+{
+	size_t base = expr_parse_primary(ps);
+	if (!ps->ok)
+		return 0;
+
+	expr_skip_space(ps);
+	if (*(ps->p) != '^')
+		return base;
+	ps->p++;
+
+	size_t exponent = expr_parse_unary(ps);
+	return expr_emit(ps, EXPR_POW, base, exponent, 0);
+}
+
+/* unary := ('-' | '+') unary | power */
+static size_t
+expr_parse_unary(expr_parser *ps)
+{
+	expr_skip_space(ps);
+	if (*(ps->p) == '-') {
+		ps->p++;
+		size_t a = expr_parse_unary(ps);
+		return expr_emit(ps, EXPR_NEG, a, 0, 0);
+	}
+	if (*(ps->p) == '+') {
+		ps->p++;
+		return expr_parse_unary(ps);
+	}
+	return expr_parse_power(ps);
+}
+
+/* product := unary (('*' | '/') unary | power)* where a power right after
+ * a factor is an implicit multiplication as in "3x" or "2 sin(x)" */
+static size_t
+expr_parse_product(expr_parser *ps)
+{
+	size_t a = expr_parse_unary(ps);
+
+	while (ps->ok) {
+		expr_skip_space(ps);
+		char c = *(ps->p);
+
+		if (c == '*' || c == '/') {
+			ps->p++;
+			size_t b = expr_parse_unary(ps);
+			a = expr_emit(ps, c == '*' ? EXPR_MUL : EXPR_DIV, a, b,
+			              0);
+		} else if (isalnum(c) || c == '_' || c == '.' || c == '(') {
+			size_t b = expr_parse_power(ps);
+			a        = expr_emit(ps, EXPR_MUL, a, b, 0);
+		} else {
+			break;
+		}
+	}
+
+	return a;
+}
+
+/* sum := product (('+' | '-') product)* */
+static size_t
+expr_parse_sum(expr_parser *ps)
+{
+	size_t a = expr_parse_product(ps);
+
+	while (ps->ok) {
+		expr_skip_space(ps);
+		char c = *(ps->p);
+		if (c != '+' && c != '-')
+			break;
+
+		ps->p++;
+		size_t b = expr_parse_product(ps);
+		a = expr_emit(ps, c == '+' ? EXPR_ADD : EXPR_SUB, a, b, 0);
+	}
+
+	return a;
+}
+
+int
+expr_compile(const char *src, const char *const *vars, size_t vars_c,
+             expr_t *e)
+{
+	e->ins.clear();
+	e->vars_c      = vars_c;
+	e->invariant_c = 0;
+
+	expr_parser ps;
+	ps.p      = src;
+	ps.vars   = vars;
+	ps.vars_c = vars_c;
+	ps.e      = e;
+	ps.ok     = 1;
+
+	expr_parse_sum(&ps);
+	expr_skip_space(&ps);
+	if (!ps.ok || *(ps.p) != '\0' || e->ins.empty()) {
+		e->ins.clear();
+		return 0;
+	}
+	return 1;
+}
+
+/* = OPTIMIZATION = */
+
+/* Returns `op` of the constants `a` and `b`, `b` being ignored by the one
+ * operand ops. */
+static double
+expr_fold(expr_op op, double a, double b)
+{
+	expr_t c;
+	c.vars_c      = 0;
+	c.invariant_c = 0;
+	c.ins         = { { EXPR_CONST, 0, 0, a },
+		          { EXPR_CONST, 0, 0, b },
+		          { op, 0, 1, 0 } };
+	double slots[3];
+
+	return expr_eval(&c, NULL, slots);
+}
+
+static int
+expr_is_binary(expr_op op)
+{
+	return op >= EXPR_ADD && op <= EXPR_POW;
+}
+
+/* Returns 1 if the slot `a` of `ins` is the constant `val` to the bit, -0
+ * not being 0. */
+static int
+expr_is_const(const std::vector<expr_ins> &ins, size_t a, double val)
+{
+	return ins[a].op == EXPR_CONST &&
+	       !memcmp(&(ins[a].val), &val, sizeof(double));
+}
+
+/* Appends `op` of the slots `a` and `b` to the optimized `ins`, or rather what
+ * it folds into, returning the slot of its value. */
+static size_t
+expr_optimize_emit(std::vector<expr_ins> *ins, expr_op op, size_t a, size_t b,
+                   double val)
+{
+	int binary = expr_is_binary(op);
+	if (op != EXPR_CONST && op != EXPR_VAR && !binary)
+		b = 0;
+	if (op == EXPR_CONST)
+		a = b = 0;
+	if (op != EXPR_CONST)
+		val = 0;
+
+	/* = CONSTANTS = */
+
+	if (op != EXPR_CONST && op != EXPR_VAR &&
+	    (*ins)[a].op == EXPR_CONST &&
+	    (!binary || (*ins)[b].op == EXPR_CONST))
+		return expr_optimize_emit(ins, EXPR_CONST, 0, 0,
+		                          expr_fold(op, (*ins)[a].val,
+		                                    (*ins)[b].val));
+
+	/* = IDENTITIES = */
+
+	/* only those holding for every value, -0, infinities and NaN too */
+	if ((op == EXPR_MUL || op == EXPR_DIV || op == EXPR_POW) &&
+	    expr_is_const(*ins, b, 1))
+		return a;
+	if (op == EXPR_MUL && expr_is_const(*ins, a, 1))
+		return b;
+	if (op == EXPR_SUB && expr_is_const(*ins, b, 0))
+		return a;
+	if (op == EXPR_NEG && (*ins)[a].op == EXPR_NEG)
+		return (*ins)[a].a;
+
+	/* = STRENGTH REDUCTION = */
+
+	if (op == EXPR_POW && (*ins)[b].op == EXPR_CONST) {
+		double n = (*ins)[b].val;
+		if (n == 0)
+			return expr_optimize_emit(ins, EXPR_CONST, 0, 0, 1);
+		if (n == std::floor(n) && fabs(n) <= EXPR_POW_CHAIN_MAX) {
+			/* by squaring, from the highest bit of |n| down */
+			size_t k = fabs(n), r = a;
+			size_t bit = 1;
+			while (bit * 2 <= k)
+				bit *= 2;
+			for (bit /= 2; bit > 0; bit /= 2) {
+				r = expr_optimize_emit(ins, EXPR_MUL, r, r, 0);
+				if (k & bit)
+					r = expr_optimize_emit(ins, EXPR_MUL, r,
+					                       a, 0);
+			}
+			if (n > 0)
+				return r;
+			size_t one = expr_optimize_emit(ins, EXPR_CONST, 0, 0,
+			                                1);
+			return expr_optimize_emit(ins, EXPR_DIV, one, r, 0);
+		}
+	}
+
+	/* = COMMON SUBEXPRESSIONS = */
+
+	if ((op == EXPR_ADD || op == EXPR_MUL) && a > b)
+		std::swap(a, b);
+
+	/* expressions are short enough for a linear search, their operands
+	 * being found already so that equal subtrees end up in the same slot */
+	for (size_t i = 0; i < ins->size(); i++) {
+		const expr_ins *in = &((*ins)[i]);
+		if (in->op == op && in->a == a && in->b == b &&
+		    (op != EXPR_CONST ||
+		     !memcmp(&(in->val), &val, sizeof(double))))
+			return i;
+	}
+
+	ins->push_back({ op, a, b, val });
+	return ins->size() - 1;
+}
+
+void
+expr_optimize(expr_t *e, size_t varying_c)
+{
+	size_t ins_c = e->ins.size();
+
+	/* = FOLDING = */
+
+	std::vector<expr_ins> ins;
+	std::vector<size_t>   slot_of(ins_c); /* of the instructions of `e` */
+	for (size_t i = 0; i < ins_c; i++) {
+		const expr_ins *in = &(e->ins[i]);
+		int operands = in->op != EXPR_CONST && in->op != EXPR_VAR;
+		slot_of[i] = expr_optimize_emit(
+			&ins, in->op, operands ? slot_of[in->a] : in->a,
+			operands && expr_is_binary(in->op) ? slot_of[in->b] : 0,
+			in->val);
+	}
+
+	/* = DEAD INSTRUCTIONS = */
+
+	/* the value being the last slot, everything used comes before it */
+	size_t            last = slot_of[ins_c - 1];
+	std::vector<char> used(last + 1, 0);
+	used[last] = 1;
+	for (size_t i = last + 1; i-- > 0;) {
+		const expr_ins *in = &(ins[i]);
+		if (!used[i] || in->op == EXPR_CONST || in->op == EXPR_VAR)
+			continue;
+		used[in->a] = 1;
+		if (expr_is_binary(in->op))
+			used[in->b] = 1;
+	}
+
+	/* = HOISTING = */
+
+	std::vector<char> invariant(last + 1, 0);
+	for (size_t i = 0; i <= last; i++) {
+		const expr_ins *in = &(ins[i]);
+		if (in->op == EXPR_CONST)
+			invariant[i] = 1;
+		else if (in->op == EXPR_VAR)
+			invariant[i] = in->a >= varying_c;
+		else
+			invariant[i] = invariant[in->a] &&
+			               (!expr_is_binary(in->op) ||
+			                invariant[in->b]);
+	}
+
+	/* the invariant ones first, both keeping their order so that operands
+	 * still come before the instructions using them */
+	std::vector<size_t> order;
+	for (int pass = 1; pass >= 0; pass--)
+		for (size_t i = 0; i <= last; i++)
+			if (used[i] && invariant[i] == pass)
+				order.push_back(i);
+
+	std::vector<size_t> new_slot(last + 1);
+	e->ins.clear();
+	e->invariant_c = 0;
+	for (size_t i : order) {
+		expr_ins in = ins[i];
+		if (in.op != EXPR_CONST && in.op != EXPR_VAR) {
+			in.a = new_slot[in.a];
+			if (expr_is_binary(in.op))
+				in.b = new_slot[in.b];
+		}
+		new_slot[i] = e->ins.size();
+		e->ins.push_back(in);
+		e->invariant_c += invariant[i];
+	}
+}
+
+/* Evaluates the instructions [begin, end) of `e` into `slots`. */
+static inline void
+expr_eval_range(const expr_t *e, const double *vars, double *slots,
+                size_t begin, size_t end)
+{
+	const expr_ins *ins = e->ins.data();
+
+	for (size_t i = begin; i < end; i++) {
+		const expr_ins *in = ins + i;
+		double         *r  = slots + i;
+
+		switch (in->op) {
+		case EXPR_CONST: *r = in->val; break;
+		case EXPR_VAR:   *r = vars[in->a]; break;
+		case EXPR_NEG:   *r = -slots[in->a]; break;
+		case EXPR_ADD:   *r = slots[in->a] + slots[in->b]; break;
+		case EXPR_SUB:   *r = slots[in->a] - slots[in->b]; break;
+		case EXPR_MUL:   *r = slots[in->a] * slots[in->b]; break;
+		case EXPR_DIV:   *r = slots[in->a] / slots[in->b]; break;
+		case EXPR_POW:   *r = pow(slots[in->a], slots[in->b]); break;
+		case EXPR_SIN:   *r = sin(slots[in->a]); break;
+		case EXPR_COS:   *r = cos(slots[in->a]); break;
+		case EXPR_TAN:   *r = tan(slots[in->a]); break;
+		case EXPR_ASIN:  *r = asin(slots[in->a]); break;
+		case EXPR_ACOS:  *r = acos(slots[in->a]); break;
+		case EXPR_ATAN:  *r = atan(slots[in->a]); break;
+		case EXPR_SINH:  *r = sinh(slots[in->a]); break;
+		case EXPR_COSH:  *r = cosh(slots[in->a]); break;
+		case EXPR_TANH:  *r = tanh(slots[in->a]); break;
+		case EXPR_EXP:   *r = exp(slots[in->a]); break;
+		case EXPR_LOG:   *r = log(slots[in->a]); break;
+		case EXPR_LOG10: *r = log10(slots[in->a]); break;
+		case EXPR_SQRT:  *r = sqrt(slots[in->a]); break;
+		case EXPR_ABS:   *r = fabs(slots[in->a]); break;
+		}
+	}
+}
+
+double
+expr_eval(const expr_t *e, const double *vars, double *slots)
+{
+	size_t ins_c = e->ins.size();
+	expr_eval_range(e, vars, slots, 0, ins_c);
+
+	return slots[ins_c - 1];
+}
+
+void
+expr_eval_invariant(const expr_t *e, const double *vars, double *slots)
+{
+	expr_eval_range(e, vars, slots, 0, e->invariant_c);
+}
+
+double
+expr_eval_varying(const expr_t *e, const double *vars, double *slots)
+{
+	size_t ins_c = e->ins.size();
+	expr_eval_range(e, vars, slots, e->invariant_c, ins_c);
+
+	return slots[ins_c - 1];
+}
+
+double
+expr_eval_grad(const expr_t *e, const double *vars, double *slots,
+               double *adjs, double *grad)
+{
+	double ret = expr_eval(e, vars, slots);
+
+	const expr_ins *ins   = e->ins.data();
+	size_t          ins_c = e->ins.size();
+
+	for (size_t i = 0; i < e->vars_c; i++)
+		grad[i] = 0;
+	for (size_t i = 0; i < ins_c; i++)
+		adjs[i] = 0;
+	adjs[ins_c - 1] = 1;
+
+	/* every slot only depends on the ones before it, so going backwards
+	 * each adjoint is complete by the time it is propagated */
+	for (size_t i = ins_c; i-- > 0;) {
+		const expr_ins *in = ins + i;
+		double          g  = adjs[i];
+		if (g == 0)
+			continue;
+
+		double a = slots[in->a];
+		double r = slots[i];
+
+		switch (in->op) {
+		case EXPR_CONST: break;
+		case EXPR_VAR:   grad[in->a] += g; break;
+		case EXPR_NEG:   adjs[in->a] -= g; break;
+		case EXPR_ADD:
+			adjs[in->a] += g;
+			adjs[in->b] += g;
+			break;
+		case EXPR_SUB:
+			adjs[in->a] += g;
+			adjs[in->b] -= g;
+			break;
+		case EXPR_MUL:
+			adjs[in->a] += g * slots[in->b];
+			adjs[in->b] += g * a;
+			break;
+		case EXPR_DIV:
+			adjs[in->a] += g / slots[in->b];
+			adjs[in->b] -= g * r / slots[in->b];
+			break;
+		case EXPR_POW: {
+			double b = slots[in->b];
+			adjs[in->a] += g * b * pow(a, b - 1);
+			/* d/db only exists for a positive base, as in "x^2" the
+			 * exponent is usually a constant anyway */
+			if (a > 0)
+				adjs[in->b] += g * r * log(a);
+		} break;
+		case EXPR_SIN:   adjs[in->a] += g * cos(a); break;
+		case EXPR_COS:   adjs[in->a] -= g * sin(a); break;
+		case EXPR_TAN:   adjs[in->a] += g * (1 + r * r); break;
+		case EXPR_ASIN:  adjs[in->a] += g / sqrt(1 - a * a); break;
+		case EXPR_ACOS:  adjs[in->a] -= g / sqrt(1 - a * a); break;
+		case EXPR_ATAN:  adjs[in->a] += g / (1 + a * a); break;
+		case EXPR_SINH:  adjs[in->a] += g * cosh(a); break;
+		case EXPR_COSH:  adjs[in->a] += g * sinh(a); break;
+		case EXPR_TANH:  adjs[in->a] += g * (1 - r * r); break;
+		case EXPR_EXP:   adjs[in->a] += g * r; break;
+		case EXPR_LOG:   adjs[in->a] += g / a; break;
+		case EXPR_LOG10: adjs[in->a] += g / (a * M_LN10); break;
+		case EXPR_SQRT:  adjs[in->a] += g / (2 * r); break;
+		case EXPR_ABS:   adjs[in->a] += g * ((a > 0) - (a < 0)); break;
+		}
+	}
+
+	return ret;
+}
+
+int
+expr_const_val(const char *src, double *val)
+{
+	if (native_off)
+		return 0;
+
+	/* plain numbers are by far the most common */
+	char  *end;
+	double ret = strtod(src, &end);
+	if (end != src && *end == '\0' && std::isfinite(ret)) {
+		*val = ret;
+		return 1;
+	}
+
+	expr_t e;
+	if (!expr_compile(src, NULL, 0, &e))
+		return 0;
+
+	std::vector<double> slots(e.ins.size());
+	*val = expr_eval(&e, NULL, slots.data());
+	return 1;
+}
+
+/* Evaluates the instructions of `e` from `begin` on for the `n` sets of
+ * values of the variables `vars` into `out`. */
+static void
+expr_eval_batch_from(const expr_t *e, const double *const *vars, size_t n,
+                     double *slots, double *out, size_t begin)
+{
+	const expr_ins *ins   = e->ins.data();
+	size_t          ins_c = e->ins.size();
+
+/* sets every lane `j` of the slot `r` to `VAL` */
+#define EXPR_LANES(VAL)                  \
+	for (size_t j = 0; j < n; j++) { \
+		r[j] = VAL;              \
+	}
+
+	for (size_t i = begin; i < ins_c; i++) {
+		const expr_ins *in = ins + i;
+		double         *r  = slots + i * EXPR_BATCH;
+
+		if (in->op == EXPR_CONST) {
+			EXPR_LANES(in->val);
+			continue;
+		}
+		if (in->op == EXPR_VAR) {
+			const double *v = vars[in->a];
+			EXPR_LANES(v[j]);
+			continue;
+		}
+
+		const double *a = slots + in->a * EXPR_BATCH;
+		const double *b = slots + in->b * EXPR_BATCH;
+
+		switch (in->op) {
+		case EXPR_CONST: break;
+		case EXPR_VAR:   break;
+		case EXPR_NEG:   EXPR_LANES(-a[j]); break;
+		case EXPR_ADD:   EXPR_LANES(a[j] + b[j]); break;
+		case EXPR_SUB:   EXPR_LANES(a[j] - b[j]); break;
+		case EXPR_MUL:   EXPR_LANES(a[j] * b[j]); break;
+		case EXPR_DIV:   EXPR_LANES(a[j] / b[j]); break;
+		case EXPR_POW:   EXPR_LANES(pow(a[j], b[j])); break;
+		case EXPR_SIN:   EXPR_LANES(sin(a[j])); break;
+		case EXPR_COS:   EXPR_LANES(cos(a[j])); break;
+		case EXPR_TAN:   EXPR_LANES(tan(a[j])); break;
+		case EXPR_ASIN:  EXPR_LANES(asin(a[j])); break;
+		case EXPR_ACOS:  EXPR_LANES(acos(a[j])); break;
+		case EXPR_ATAN:  EXPR_LANES(atan(a[j])); break;
+		case EXPR_SINH:  EXPR_LANES(sinh(a[j])); break;
+		case EXPR_COSH:  EXPR_LANES(cosh(a[j])); break;
+		case EXPR_TANH:  EXPR_LANES(tanh(a[j])); break;
+		case EXPR_EXP:   EXPR_LANES(exp(a[j])); break;
+		case EXPR_LOG:   EXPR_LANES(log(a[j])); break;
+		case EXPR_LOG10: EXPR_LANES(log10(a[j])); break;
+		case EXPR_SQRT:  EXPR_LANES(sqrt(a[j])); break;
+		case EXPR_ABS:   EXPR_LANES(fabs(a[j])); break;
+		}
+	}
+
+#undef EXPR_LANES
+
+	const double *r = slots + (ins_c - 1) * EXPR_BATCH;
+	for (size_t j = 0; j < n; j++)
+		out[j] = r[j];
+}
+
+void
+expr_eval_batch(const expr_t *e, const double *const *vars, size_t n,
+                double *slots, double *out)
+{
+	expr_eval_batch_from(e, vars, n, slots, out, 0);
+}
+
+void
+expr_eval_batch_varying(const expr_t *e, const double *const *vars, size_t n,
+                        double *slots, double *out)
+{
+	expr_eval_batch_from(e, vars, n, slots, out, e->invariant_c);
+}
+
+thread_local int native_off = 0;
+
+/* = SHADOW MODE = */
+
+std::atomic<double> shadow_rate(0);
+std::atomic<size_t> shadow_solves_c(0);
+std::atomic<size_t> shadow_evals_c(0);
+std::atomic<size_t> shadow_divergences_c(0);
+
+int
+shadow_sample(void)
+{
+	static std::atomic<size_t> solves_c(0);
+
+	double rate = shadow_rate;
+	if (rate <= 0)
+		return 0;
+
+	/* shadow the n-th solve if it crosses a multiple of 1 / rate */
+	size_t n = solves_c++;
+	return floor((n + 1) * rate) > floor(n * rate);
+}
+
+void
+shadow_check(spnm::fx_t *f, const char *x, double native, double giac)
+{
+	shadow_evals_c++;
+
+	if (std::isnan(native) && std::isnan(giac))
+		return;
+	double scale = std::max(1.0, std::max(fabs(native), fabs(giac)));
+	if (fabs(native - giac) <= SHADOW_TOLERANCE * scale)
+		return;
+
+	shadow_divergences_c++;
+	*(f->log) << "[SHADOW] f(" << x << ") of '" << f->src
+		  << "' diverges, native: " << native << ", giac: " << giac
+		  << std::endl;
+}
+
+/* = GIAC = */
+
+std::mutex giac_mutex;
+
+void
+giac_init(void)
+{
+	static std::once_flag once;
+	std::call_once(once, []() {
+		/* giac's own globals are set up when its first context is
+		 * created, do it here once rather than racing for it */
+		std::lock_guard<std::mutex> lock(giac_mutex);
+		giac::context ct;
+	});
+}
+
+int
+giac_fx_parse(const char *fx, giac::context *ct)
+{
+	/* construct f(x) */
+	std::string expr = "f(x) := ";
+	expr += fx;
+
+	std::lock_guard<std::mutex> lock(giac_mutex);
+	giac::eval(giac::gen(expr, ct), 1, ct);
+	if (giac::first_error_line(ct))
+		return 0;
+	return 1;
+}
+
+double
+giac_fx_val_double(const char *x, giac::context *ct)
+{
+	std::string input = "approx(f(";
+	input += x;
+	input += "))";
+
+	std::lock_guard<std::mutex> lock(giac_mutex);
+	giac::gen f = giac::eval(giac::gen(input, ct), 1, ct);
+
+	return f.to_double(ct);
+}
+
+std::string
+giac_approx_string(const std::string &formula)
+{
+	giac_init();
+	std::lock_guard<std::mutex> lock(giac_mutex);
+	giac::context ct;
+
+	giac::gen c = giac::eval(giac::gen(formula, &ct), 1, &ct);
+	if (giac::first_error_line(&ct))
+		return "";
+
+	return c.print();
+}
+
+/* = PARALLEL = */
+
+void
+parallel_for(size_t n, size_t grain, size_t threads_c,
+             const std::function<void(size_t, size_t)> &fn)
+{
+	if (threads_c == 0)
+		threads_c = std::thread::hardware_concurrency();
+	threads_c = std::min(threads_c, n / grain);
+	if (threads_c <= 1) {
+		fn(0, n);
+		return;
+	}
+
+	std::vector<std::thread> threads;
+	size_t                   chunk = (n + threads_c - 1) / threads_c;
+	for (size_t begin = chunk; begin < n; begin += chunk)
+		threads.emplace_back(fn, begin, std::min(begin + chunk, n));
+	fn(0, chunk);
+
+	for (std::thread &thread : threads)
+		thread.join();
+}
+
+/* = SPARSE = */
+
+void
+csr_mul(const csr_t *a, const double *x, double *y, size_t threads_c)
+{
+	auto rows = [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; i++) {
+			double sum = 0;
+			for (size_t p = a->row_ptr[i]; p < a->row_ptr[i + 1]; p++)
+				sum += a->vals[p] * x[a->cols[p]];
+			y[i] = sum;
+		}
+	};
+	parallel_for(a->rows_c, PARALLEL_GRAIN_ROWS, threads_c, rows);
+}
+
+int
+precond_setup(spnm::precond_t kind, const csr_t *a, precond_state_t *p)
+{
+	size_t n = a->rows_c;
+	p->kind  = kind;
+	p->n     = n;
+
+	switch (kind) {
+	case spnm::PRECOND_NONE:
+		return 1;
+
+	case spnm::PRECOND_JACOBI: {
+		p->inv_diag.assign(n, 0);
+		for (size_t i = 0; i < n; i++)
+			for (size_t q = a->row_ptr[i]; q < a->row_ptr[i + 1]; q++)
+				if (a->cols[q] == i && a->vals[q] != 0)
+					p->inv_diag[i] = 1 / a->vals[q];
+		for (size_t i = 0; i < n; i++)
+			if (p->inv_diag[i] == 0)
+				return 0;
+		return 1;
+	}
+
+	case spnm::PRECOND_ILU0: {
+		csr_t *lu = &(p->lu);
+		*lu       = *a;
+
+		/* = DIAGONAL = */
+
+		p->diag.assign(n, 0);
+		for (size_t i = 0; i < n; i++) {
+			size_t q = lu->row_ptr[i];
+			while (q < lu->row_ptr[i + 1] && lu->cols[q] < i)
+				q++;
+			if (q == lu->row_ptr[i + 1] || lu->cols[q] != i)
+				return 0;
+			p->diag[i] = q;
+		}
+
+		/* = ELIMINATION ON THE NONZEROS OF A = */
+
+		std::vector<size_t> pos(n, (size_t)-1); /* in the row i */
+		for (size_t i = 0; i < n; i++) {
+			size_t row_begin = lu->row_ptr[i];
+			size_t row_end   = lu->row_ptr[i + 1];
+			for (size_t q = row_begin; q < row_end; q++)
+				pos[lu->cols[q]] = q;
+
+			for (size_t q = row_begin; q < p->diag[i]; q++) {
+				size_t k     = lu->cols[q];
+				double pivot = lu->vals[p->diag[k]];
+				if (pivot == 0)
+					return 0;
+
+				double l = (lu->vals[q] /= pivot);
+				for (size_t r = p->diag[k] + 1;
+				     r < lu->row_ptr[k + 1]; r++)
+					if (pos[lu->cols[r]] != (size_t)-1)
+						lu->vals[pos[lu->cols[r]]] -=
+							l * lu->vals[r];
+			}
+
+			for (size_t q = row_begin; q < row_end; q++)
+				pos[lu->cols[q]] = (size_t)-1;
+			if (lu->vals[p->diag[i]] == 0)
+				return 0;
+		}
+		return 1;
+	}
+
+	case spnm::PRECOND_IC0: {
+		csr_t *l = &(p->lu);
+
+		/* = LOWER TRIANGLE = */
+
+		l->rows_c = n;
+		l->row_ptr.assign(1, 0);
+		l->cols.clear();
+		l->vals.clear();
+		p->diag.assign(n, 0);
+		for (size_t i = 0; i < n; i++) {
+			for (size_t q = a->row_ptr[i];
+			     q < a->row_ptr[i + 1] && a->cols[q] <= i; q++) {
+				l->cols.push_back(a->cols[q]);
+				l->vals.push_back(a->vals[q]);
+			}
+			if (l->cols.size() == l->row_ptr[i] ||
+			    l->cols.back() != i)
+				return 0;
+			p->diag[i] = l->cols.size() - 1;
+			l->row_ptr.push_back(l->cols.size());
+		}
+
+		/* = FACTORIZATION ON THE NONZEROS OF IT = */
+
+		std::vector<size_t> pos(n, (size_t)-1); /* in the row i */
+		for (size_t i = 0; i < n; i++) {
+			size_t row_begin = l->row_ptr[i];
+			for (size_t q = row_begin; q <= p->diag[i]; q++)
+				pos[l->cols[q]] = q;
+
+			/* l_ik = (a_ik - sum_(j < k) l_ij l_kj) / l_kk and
+			 * l_ii = sqrt(a_ii - sum_(j < i) l_ij^2) */
+			for (size_t q = row_begin; q <= p->diag[i]; q++) {
+				size_t k   = l->cols[q];
+				double sum = l->vals[q];
+				for (size_t r = l->row_ptr[k]; r < p->diag[k];
+				     r++) {
+					size_t j = l->cols[r];
+					if (pos[j] != (size_t)-1)
+						sum -= l->vals[pos[j]] *
+						       l->vals[r];
+				}
+
+				if (k < i)
+					l->vals[q] = sum / l->vals[p->diag[k]];
+				else if (sum > 0)
+					l->vals[q] = sqrt(sum);
+				else
+					return 0;
+			}
+
+			for (size_t q = row_begin; q <= p->diag[i]; q++)
+				pos[l->cols[q]] = (size_t)-1;
+		}
+		return 1;
+	}
+	}
+
+	return 0;
+}
+
+void
+precond_apply(const precond_state_t *p, const double *r, double *z)
+{
+	switch (p->kind) {
+	case spnm::PRECOND_NONE:
+		std::copy(r, r + p->n, z);
+		return;
+
+	case spnm::PRECOND_JACOBI:
+		for (size_t i = 0; i < p->n; i++)
+			z[i] = p->inv_diag[i] * r[i];
+		return;
+
+	case spnm::PRECOND_ILU0: {
+		const csr_t *lu = &(p->lu);
+		size_t       n  = lu->rows_c;
+
+		/* L y = r, L having a unit diagonal */
+		for (size_t i = 0; i < n; i++) {
+			double sum = r[i];
+			for (size_t q = lu->row_ptr[i]; q < p->diag[i]; q++)
+				sum -= lu->vals[q] * z[lu->cols[q]];
+			z[i] = sum;
+		}
+
+		/* U z = y */
+		for (size_t i = n; i-- > 0;) {
+			double sum = z[i];
+			for (size_t q = p->diag[i] + 1; q < lu->row_ptr[i + 1];
+			     q++)
+				sum -= lu->vals[q] * z[lu->cols[q]];
+			z[i] = sum / lu->vals[p->diag[i]];
+		}
+		return;
+	}
+
+	case spnm::PRECOND_IC0: {
+		const csr_t *l = &(p->lu);
+		size_t       n = l->rows_c;
+
+		/* L y = r */
+		for (size_t i = 0; i < n; i++) {
+			double sum = r[i];
+			for (size_t q = l->row_ptr[i]; q < p->diag[i]; q++)
+				sum -= l->vals[q] * z[l->cols[q]];
+			z[i] = sum / l->vals[p->diag[i]];
+		}
+
+		/* L^T z = y, by the columns of L^T being the rows of L */
+		for (size_t i = n; i-- > 0;) {
+			z[i] /= l->vals[p->diag[i]];
+			for (size_t q = l->row_ptr[i]; q < p->diag[i]; q++)
+				z[l->cols[q]] -= l->vals[q] * z[i];
+		}
+		return;
+	}
+	}
+}
+
+size_t
+bicgstab(const csr_t *a, const precond_state_t *p, const double *b, double *x,
+         double tol, size_t iterations_max, size_t threads_c,
+         double *res_norm)
+{
+	size_t n = a->rows_c;
+
+	std::vector<double> r(n), r0(n), v(n, 0), pd(n, 0), p_hat(n), s(n),
+		s_hat(n), t(n);
+
+	/* r = b - a x */
+	csr_mul(a, x, r.data(), threads_c);
+	for (size_t i = 0; i < n; i++)
+		r[i] = b[i] - r[i];
+	r0 = r;
+
+	double stop = tol * std::max(norm2(b, n), 1.0);
+	*res_norm   = norm2(r.data(), n);
+	if (*res_norm <= stop)
+		return 0;
+
+	double rho = 1, alpha = 1, omega = 1;
+	size_t k;
+	for (k = 1; k <= iterations_max; k++) {
+		double rho_next = 0;
+		for (size_t i = 0; i < n; i++)
+			rho_next += r0[i] * r[i];
+		if (rho_next == 0)
+			break; /* breakdown, keep what we have */
+
+		double beta = (rho_next / rho) * (alpha / omega);
+		for (size_t i = 0; i < n; i++)
+			pd[i] = r[i] + beta * (pd[i] - omega * v[i]);
+
+		precond_apply(p, pd.data(), p_hat.data());
+		csr_mul(a, p_hat.data(), v.data(), threads_c);
+
+		double r0_v = 0;
+		for (size_t i = 0; i < n; i++)
+			r0_v += r0[i] * v[i];
+		if (r0_v == 0)
+			break;
+		alpha = rho_next / r0_v;
+
+		for (size_t i = 0; i < n; i++)
+			s[i] = r[i] - alpha * v[i];
+		if (norm2(s.data(), n) <= stop) {
+			for (size_t i = 0; i < n; i++)
+				x[i] += alpha * p_hat[i];
+			r = s;
+			break;
+		}
+
+		precond_apply(p, s.data(), s_hat.data());
+		csr_mul(a, s_hat.data(), t.data(), threads_c);
+
+		double t_s = 0, t_t = 0;
+		for (size_t i = 0; i < n; i++) {
+			t_s += t[i] * s[i];
+			t_t += t[i] * t[i];
+		}
+		omega = t_t == 0 ? 0 : t_s / t_t;
+
+		for (size_t i = 0; i < n; i++) {
+			x[i] += alpha * p_hat[i] + omega * s_hat[i];
+			r[i] = s[i] - omega * t[i];
+		}
+
+		if (norm2(r.data(), n) <= stop || omega == 0)
+			break;
+		rho = rho_next;
+	}
+
+	*res_norm = norm2(r.data(), n);
+	return std::min(k, iterations_max);
+}
+
+double
+norm2(const double *x, size_t n)
+{
+	double sum = 0;
+	for (size_t i = 0; i < n; i++)
+		sum += x[i] * x[i];
+
+	return sqrt(sum);
+}
+
+double
+dot(const double *x, const double *y, size_t n, size_t threads_c)
+{
+	size_t chunks_c = (n + PARALLEL_GRAIN_ROWS - 1) / PARALLEL_GRAIN_ROWS;
+	std::vector<double> sums(chunks_c, 0);
+
+	auto chunks = [&](size_t begin, size_t end) {
+		for (size_t k = begin; k < end; k++) {
+			size_t i     = k * PARALLEL_GRAIN_ROWS;
+			size_t i_end = std::min(n, i + PARALLEL_GRAIN_ROWS);
+			for (; i < i_end; i++)
+				sums[k] += x[i] * y[i];
+		}
+	};
+	parallel_for(chunks_c, 1, threads_c, chunks);
+
+	double sum = 0;
+	for (size_t k = 0; k < chunks_c; k++)
+		sum += sums[k];
+
+	return sum;
+}
+
+/* = INTERVAL = */
+
+static interval_t
+interval_empty(void)
+{
+	return { INFINITY, -INFINITY };
+}
+
+static interval_t
+interval_whole(void)
+{
+	return { -INFINITY, INFINITY };
+}
+
+static int
+interval_is_empty(interval_t x)
+{
+	return x.lo > x.hi;
+}
+
+/* Rounds [lo, hi] outward by an ulp, covering the error of the operation that
+ * computed it. Undefined bounds as of inf - inf make it the whole line. */
+static interval_t
+interval_out(double lo, double hi)
+{
+	if (std::isnan(lo) || std::isnan(hi))
+		return interval_whole();
+	return { nextafter(lo, -INFINITY), nextafter(hi, INFINITY) };
+}
+
+static interval_t
+interval_neg(interval_t x)
+{
+	return { -x.hi, -x.lo };
+}
+
+static interval_t
+interval_add(interval_t x, interval_t y)
+{
+	return interval_out(x.lo + y.lo, x.hi + y.hi);
+}
+
+static interval_t
+interval_sub(interval_t x, interval_t y)
+{
+	return interval_out(x.lo - y.hi, x.hi - y.lo);
+}
+
+/* Product of the bounds where 0 times an infinite bound is 0. */
+static double
+interval_bound_mul(double x, double y)
+{
+	if (x == 0 || y == 0)
+		return 0;
+	return x * y;
+}
+
+static interval_t
+interval_mul(interval_t x, interval_t y)
+{
+	double p[] = { interval_bound_mul(x.lo, y.lo),
+		       interval_bound_mul(x.lo, y.hi),
+		       interval_bound_mul(x.hi, y.lo),
+		       interval_bound_mul(x.hi, y.hi) };
+
+	return interval_out(*std::min_element(p, p + 4),
+	                    *std::max_element(p, p + 4));
+}
+
+static interval_t
+interval_div(interval_t x, interval_t y)
+{
+	if (y.lo == 0 && y.hi == 0)
+		return interval_empty();
+	if (y.lo <= 0 && y.hi >= 0)
+		return interval_whole();
+
+	return interval_mul(x, interval_out(1 / y.hi, 1 / y.lo));
+}
+
+/* x^n for an integer n. */
+static interval_t
+interval_pow_int(interval_t x, double n)
+{
+	if (n == 0)
+		return { 1, 1 };
+	if (n < 0)
+		return interval_div({ 1, 1 }, interval_pow_int(x, -n));
+
+	double lo = pow(x.lo, n), hi = pow(x.hi, n);
+	if (fmod(n, 2) != 0 || x.lo >= 0)
+		return interval_out(lo, hi);
+	if (x.hi <= 0)
+		return interval_out(hi, lo);
+	return interval_out(0, std::max(lo, hi));
+}
+
+static int
+interval_is_int(interval_t x)
+{
+	return x.lo == x.hi && std::floor(x.lo) == x.lo && fabs(x.lo) < 1e9;
+}
+
+static interval_t
+interval_pow(interval_t x, interval_t y)
+{
+	if (interval_is_int(y))
+		return interval_pow_int(x, y.lo);
+
+	/* no real powers of negative numbers, as with pow() */
+	if (x.hi < 0)
+		return interval_empty();
+	x.lo = std::max(x.lo, 0.0);
+
+	/* monotone in either argument, the extremes are at the corners */
+	double p[] = { pow(x.lo, y.lo), pow(x.lo, y.hi), pow(x.hi, y.lo),
+		       pow(x.hi, y.hi) };
+	for (double &v : p)
+		if (std::isnan(v))
+			return interval_whole();
+
+	return interval_out(*std::min_element(p, p + 4),
+	                    *std::max_element(p, p + 4));
+}
+
+/* Returns 1 if [lo, hi] contains `at` + 2k pi for some k, generously so that
+ * round off can only widen the result. */
+static int
+interval_has_period_point(interval_t x, double at)
+{
+	double k = std::ceil((x.lo - at) / (2 * M_PI) - 1e-9);
+	return at + 2 * M_PI * k <= x.hi + 1e-9;
+}
+
+/* f(x) for f being sin or cos, which have their maxima at `max_at` + 2k pi
+ * and minima at `min_at` + 2k pi. */
+static interval_t
+interval_periodic(interval_t x, double (*f)(double), double max_at,
+                  double min_at)
+{
+	if (!std::isfinite(x.lo) || !std::isfinite(x.hi) ||
+	    x.hi - x.lo >= 2 * M_PI)
+		return { -1, 1 };
+
+	double     lo = f(x.lo), hi = f(x.hi);
+	interval_t r  = interval_out(std::min(lo, hi), std::max(lo, hi));
+	if (interval_has_period_point(x, max_at))
+		r.hi = 1;
+	if (interval_has_period_point(x, min_at))
+		r.lo = -1;
+
+	return { std::max(r.lo, -1.0), std::min(r.hi, 1.0) };
+}
+
+/* f(x) for f increasing over the domain [dom_lo, dom_hi]. */
+static interval_t
+interval_increasing(interval_t x, double (*f)(double), double dom_lo,
+                    double dom_hi)
+{
+	if (x.hi < dom_lo || x.lo > dom_hi)
+		return interval_empty();
+
+	return interval_out(f(std::max(x.lo, dom_lo)),
+	                    f(std::min(x.hi, dom_hi)));
+}
+
+static double
+interval_log10(double x)
+{
+	return log10(x);
+}
+
+/* Applies the one operand `op` to `x`. */
+static interval_t
+interval_unary(expr_op op, interval_t x)
+{
+	switch (op) {
+	case EXPR_SIN:
+		return interval_periodic(x, sin, M_PI / 2, -M_PI / 2);
+	case EXPR_COS:
+		return interval_periodic(x, cos, 0, M_PI);
+	case EXPR_TAN:
+		if (!std::isfinite(x.lo) || !std::isfinite(x.hi) ||
+		    x.hi - x.lo >= M_PI ||
+		    interval_has_period_point(x, M_PI / 2) ||
+		    interval_has_period_point(x, -M_PI / 2))
+			return interval_whole();
+		return interval_out(tan(x.lo), tan(x.hi));
+	case EXPR_ASIN:
+		return interval_increasing(x, asin, -1, 1);
+	case EXPR_ACOS:
+		if (x.hi < -1 || x.lo > 1)
+			return interval_empty();
+		return interval_out(acos(std::min(x.hi, 1.0)),
+		                    acos(std::max(x.lo, -1.0)));
+	case EXPR_ATAN:
+		return interval_increasing(x, atan, -INFINITY, INFINITY);
+	case EXPR_SINH:
+		return interval_increasing(x, sinh, -INFINITY, INFINITY);
+	case EXPR_COSH: {
+		double lo = cosh(x.lo), hi = cosh(x.hi);
+		if (x.lo <= 0 && x.hi >= 0)
+			return interval_out(1, std::max(lo, hi));
+		return interval_out(std::min(lo, hi), std::max(lo, hi));
+	}
+	case EXPR_TANH:
+		return interval_increasing(x, tanh, -INFINITY, INFINITY);
+	case EXPR_EXP:
+		return interval_increasing(x, exp, -INFINITY, INFINITY);
+	case EXPR_LOG:
+		return interval_increasing(x, log, 0, INFINITY);
+	case EXPR_LOG10:
+		return interval_increasing(x, interval_log10, 0, INFINITY);
+	case EXPR_SQRT:
+		return interval_increasing(x, sqrt, 0, INFINITY);
+	case EXPR_ABS:
+		if (x.lo >= 0)
+			return x;
+		if (x.hi <= 0)
+			return interval_neg(x);
+		return { 0, std::max(-x.lo, x.hi) };
+	default:
+		return interval_whole();
+	}
+}
+
+/* Derivative of the one operand `op` at `x`, with `r` being `op` of `x`. */
+static interval_t
+interval_unary_d(expr_op op, interval_t x, interval_t r)
+{
+	interval_t one = { 1, 1 };
+
+	switch (op) {
+	case EXPR_SIN:
+		return interval_unary(EXPR_COS, x);
+	case EXPR_COS:
+		return interval_neg(interval_unary(EXPR_SIN, x));
+	case EXPR_TAN:
+		return interval_add(one, interval_pow_int(r, 2));
+	case EXPR_ASIN:
+	case EXPR_ACOS: {
+		interval_t d = interval_div(
+			one, interval_unary(EXPR_SQRT,
+		                            interval_sub(one,
+		                                         interval_pow_int(x, 2))));
+		return op == EXPR_ASIN ? d : interval_neg(d);
+	}
+	case EXPR_ATAN:
+		return interval_div(one, interval_add(one, interval_pow_int(x, 2)));
+	case EXPR_SINH:
+		return interval_unary(EXPR_COSH, x);
+	case EXPR_COSH:
+		return interval_unary(EXPR_SINH, x);
+	case EXPR_TANH:
+		return interval_sub(one, interval_pow_int(r, 2));
+	case EXPR_EXP:
+		return r;
+	case EXPR_LOG:
+		return interval_div(one, x);
+	case EXPR_LOG10:
+		return interval_div(one, interval_mul(x, { M_LN10, M_LN10 }));
+	case EXPR_SQRT:
+		return interval_div(one, interval_mul({ 2, 2 }, r));
+	case EXPR_ABS:
+		if (x.lo > 0)
+			return one;
+		if (x.hi < 0)
+			return interval_neg(one);
+		return { -1, 1 };
+	default:
+		return interval_whole();
+	}
+}
+
+interval_t
+expr_eval_interval(const expr_t *e, const interval_t *vars, interval_t *slots,
+                   interval_t *dslots, interval_t *dval)
+{
+	const expr_ins *ins   = e->ins.data();
+	size_t          ins_c = e->ins.size();
+	interval_t      zero  = { 0, 0 };
+
+	for (size_t i = 0; i < ins_c; i++) {
+		const expr_ins *in = ins + i;
+		interval_t     *r  = slots + i;
+		interval_t      a  = slots[in->a], b = slots[in->b];
+
+		if (in->op == EXPR_CONST) {
+			*r = { in->val, in->val };
+			if (dslots)
+				dslots[i] = zero;
+			continue;
+		}
+		if (in->op == EXPR_VAR) {
+			*r = vars[in->a];
+			if (dslots)
+				dslots[i] = in->a == 0 ? interval_t { 1, 1 }
+			                               : zero;
+			continue;
+		}
+
+		int binary = in->op == EXPR_ADD || in->op == EXPR_SUB ||
+		             in->op == EXPR_MUL || in->op == EXPR_DIV ||
+		             in->op == EXPR_POW;
+		if (interval_is_empty(a) || (binary && interval_is_empty(b))) {
+			*r = interval_empty();
+			if (dslots)
+				dslots[i] = interval_empty();
+			continue;
+		}
+
+		switch (in->op) {
+		case EXPR_NEG: *r = interval_neg(a); break;
+		case EXPR_ADD: *r = interval_add(a, b); break;
+		case EXPR_SUB: *r = interval_sub(a, b); break;
+		case EXPR_MUL: *r = interval_mul(a, b); break;
+		case EXPR_DIV: *r = interval_div(a, b); break;
+		case EXPR_POW: *r = interval_pow(a, b); break;
+		default:       *r = interval_unary(in->op, a); break;
+		}
+
+		if (!dslots)
+			continue;
+
+		interval_t da = dslots[in->a], db = dslots[in->b];
+		interval_t *d = dslots + i;
+		switch (in->op) {
+		case EXPR_NEG: *d = interval_neg(da); break;
+		case EXPR_ADD: *d = interval_add(da, db); break;
+		case EXPR_SUB: *d = interval_sub(da, db); break;
+		case EXPR_MUL:
+			*d = interval_add(interval_mul(da, b),
+			                  interval_mul(a, db));
+			break;
+		case EXPR_DIV:
+			*d = interval_div(interval_sub(da, interval_mul(*r, db)),
+			                  b);
+			break;
+		case EXPR_POW:
+			if (interval_is_int(b) && db.lo == 0 && db.hi == 0) {
+				*d = interval_mul(
+					interval_mul({ b.lo, b.lo },
+				                     interval_pow_int(a, b.lo - 1)),
+					da);
+				break;
+			}
+			/* r (b' log a + b a'/a) */
+			*d = interval_mul(
+				*r,
+				interval_add(
+					interval_mul(db, interval_unary(EXPR_LOG,
+				                                        a)),
+					interval_div(interval_mul(b, da), a)));
+			break;
+		default:
+			*d = interval_mul(interval_unary_d(in->op, a, *r), da);
+			break;
+		}
+	}
+
+	if (dslots)
+		*dval = dslots[ins_c - 1];
+	return slots[ins_c - 1];
+}
+
+int
+interval_excludes_zero(interval_t x)
+{
+	return interval_is_empty(x) || x.lo > 0 || x.hi < 0;
+}
+
+/* = LINEAR ALGEBRA = */
+
+int
+lu_factor(double *a, size_t n, size_t *perm)
+{
+	return lu_factor_panel(a, n, 0, n, n, perm, NULL);
+}
+
+int
+lu_factor_panel(double *a, size_t n, size_t k, size_t k_end, size_t cols_end,
+                size_t *perm, double *y)
+{
+	for (size_t c = k; c < k_end; c++) {
+		/* = PIVOTING = */
+
+		size_t pivot = c;
+		for (size_t i = c + 1; i < n; i++)
+			if (fabs(a[i * n + c]) > fabs(a[pivot * n + c]))
+				pivot = i;
+		perm[c] = pivot;
+
+		if (a[pivot * n + c] == 0)
+			return 0;
+		if (pivot != c) {
+			std::swap_ranges(a + c * n, a + (c + 1) * n,
+			                 a + pivot * n);
+			if (y)
+				std::swap(y[c], y[pivot]);
+		}
+
+		/* = ELIMINATION = */
+
+		for (size_t i = c + 1; i < n; i++) {
+			double l = (a[i * n + c] /= a[c * n + c]);
+			for (size_t j = c + 1; j < cols_end; j++)
+				a[i * n + j] -= l * a[c * n + j];
+			if (y)
+				y[i] -= l * y[c];
+		}
+	}
+
+	return 1;
+}
+
+/* Takes the rows [k, p_end) of `a` times the entries [k, p_end) of `row` from
+ * the columns [j0, j1) of `row`, one row of `a` after another. */
+static void
+lu_update_row(double *row, const double *a, size_t n, size_t k, size_t p_end,
+              size_t j0, size_t j1)
+{
+	size_t p = k;
+
+	/* four rows at once to go through `row` a quarter of the times, with
+	 * the same operations in the same order */
+	for (; p + 4 <= p_end; p += 4) {
+		const double *u0 = a + p * n;
+		const double *u1 = u0 + n;
+		const double *u2 = u1 + n;
+		const double *u3 = u2 + n;
+		double        l0 = row[p], l1 = row[p + 1];
+		double        l2 = row[p + 2], l3 = row[p + 3];
+
+		/* chunks of a fixed size, which the compiler vectorizes even
+		 * at -O2 */
+		size_t j = j0;
+		for (; j + LU_CHUNK <= j1; j += LU_CHUNK) {
+			double r[LU_CHUNK];
+			for (size_t q = 0; q < LU_CHUNK; q++)
+				r[q] = row[j + q] - l0 * u0[j + q] -
+				       l1 * u1[j + q] - l2 * u2[j + q] -
+				       l3 * u3[j + q];
+			for (size_t q = 0; q < LU_CHUNK; q++)
+				row[j + q] = r[q];
+		}
+		for (; j < j1; j++)
+			row[j] = row[j] - l0 * u0[j] - l1 * u1[j] -
+			         l2 * u2[j] - l3 * u3[j];
+	}
+	for (; p < p_end; p++) {
+		const double *u = a + p * n;
+		double        l = row[p];
+		for (size_t j = j0; j < j1; j++)
+			row[j] -= l * u[j];
+	}
+}
+
+void
+lu_update(double *a, size_t n, size_t k, size_t k_end, size_t threads_c)
+{
+	size_t tiles_c = (n - k_end + LU_TILE - 1) / LU_TILE;
+
+	/* every tile of columns is independent of the others, and each of its
+	 * entries goes through the same operations in the same order as
+	 * column by column whatever the threads */
+	auto tiles = [&](size_t begin, size_t end) {
+		for (size_t tile = begin; tile < end; tile++) {
+			size_t j0 = k_end + tile * LU_TILE;
+			size_t j1 = std::min(j0 + LU_TILE, n);
+
+			/* U, L of the panel having a unit diagonal */
+			for (size_t p = k + 1; p < k_end; p++)
+				lu_update_row(a + p * n, a, n, k, p, j0, j1);
+
+			/* rows below */
+			for (size_t i = k_end; i < n; i++)
+				lu_update_row(a + i * n, a, n, k, k_end, j0,
+				              j1);
+		}
+	};
+	parallel_for(tiles_c, 1, threads_c, tiles);
+}
+
+void
+lu_solve(const double *a, const size_t *perm, size_t n, double *b)
+{
+	for (size_t k = 0; k < n; k++)
+		std::swap(b[k], b[perm[k]]);
+
+	/* L y = b, L having a unit diagonal */
+	for (size_t i = 0; i < n; i++)
+		for (size_t j = 0; j < i; j++)
+			b[i] -= a[i * n + j] * b[j];
+
+	/* U x = y */
+	for (size_t i = n; i-- > 0;) {
+		for (size_t j = i + 1; j < n; j++)
+			b[i] -= a[i * n + j] * b[j];
+		b[i] /= a[i * n + i];
+	}
+}
+
+/* Evaluates the `cols_c` entries of `row` separated by `sep` into `vals`.
+ * Returns 0 on error. */
+static int
+linear_row_vals(const char *row, char sep, double *vals, size_t cols_c)
+{
+	for (size_t j = 0; j < cols_c; j++) {
+		const char *end = strchr(row, sep);
+		if (!end)
+			end = row + strlen(row);
+		if ((j + 1 < cols_c) != (*end == sep))
+			return 0;
+
+		std::string entry(row, end);
+		if (!expr_const_val(entry.c_str(), vals + j) ||
+		    !std::isfinite(vals[j]))
+			return 0;
+		row = end + 1;
+	}
+
+	return 1;
+}
+
+int
+linear_system_vals(const char *a_src, const char *b_src, std::vector<double> *a,
+                   std::vector<double> *b, size_t *n)
+{
+	if (!matrix_vals(a_src, a, n))
+		return 0;
+
+	b->resize(*n);
+	return linear_row_vals(b_src, ';', b->data(), *n);
+}
+
+int
+matrix_vals(const char *a_src, std::vector<double> *a, size_t *n)
+{
+	*n = 1;
+	for (const char *c = a_src; *c; c++)
+		*n += *c == ';';
+	a->resize(*n * *n);
+
+	const char *row = a_src;
+	for (size_t i = 0; i < *n; i++) {
+		const char *end = strchr(row, ';');
+		std::string row_string =
+			end ? std::string(row, end) : std::string(row);
+		if (!linear_row_vals(row_string.c_str(), ',',
+		                     a->data() + i * *n, *n))
+			return 0;
+		row = end ? end + 1 : row + row_string.size();
+	}
+
+	return 1;
+}
+
+/* Sets `v` and `beta` to the householder reflector I - beta v v^T taking the
+ * `c` entries of `u` to a multiple of the first unit vector, the multiple
+ * being returned. `beta` is 0, for the identity, if `u` is 0. */
+static double
+householder_vector(const double *u, size_t c, double *v, double *beta)
+{
+	double norm = 0;
+	for (size_t i = 0; i < c; i++)
+		norm += u[i] * u[i];
+	norm = sqrt(norm);
+
+	std::copy(u, u + c, v);
+	if (norm == 0) {
+		*beta = 0;
+		return 0;
+	}
+
+	/* the sign of u_0 for v_0 not to cancel */
+	double alpha = u[0] > 0 ? -norm : norm;
+	v[0] -= alpha;
+	*beta = 1 / (norm * fabs(v[0]));
+
+	return alpha;
+}
+
+void
+hessenberg_reduce(double *a, size_t n, size_t threads_c)
+{
+	std::vector<double> u(n), v(n);
+
+	for (size_t k = 0; k + 2 < n; k++) {
+		/* = REFLECTOR = */
+
+		/* zeroing the column k below the subdiagonal */
+		size_t c = n - k - 1;
+		for (size_t i = 0; i < c; i++)
+			u[i] = a[(k + 1 + i) * n + k];
+		double beta, alpha = householder_vector(u.data(), c, v.data(),
+		                                        &beta);
+		if (beta == 0)
+			continue;
+
+		a[(k + 1) * n + k] = alpha;
+		for (size_t i = 1; i < c; i++)
+			a[(k + 1 + i) * n + k] = 0;
+
+		/* = FROM THE LEFT = */
+
+		/* the rows below k from the column k + 1 on, tile by tile of
+		 * columns: w = v^T A and then A - beta v w */
+		auto cols = [&](size_t begin, size_t end) {
+			double w[HOUSEHOLDER_TILE];
+			for (size_t tile = begin; tile < end; tile++) {
+				size_t j0 = k + 1 + tile * HOUSEHOLDER_TILE;
+				size_t j1 = std::min(j0 + HOUSEHOLDER_TILE, n);
+
+				std::fill(w, w + (j1 - j0), 0);
+				for (size_t i = 0; i < c; i++) {
+					const double *row = a + (k + 1 + i) * n;
+					for (size_t j = j0; j < j1; j++)
+						w[j - j0] += v[i] * row[j];
+				}
+				for (size_t j = j0; j < j1; j++)
+					w[j - j0] *= beta;
+				for (size_t i = 0; i < c; i++) {
+					double *row = a + (k + 1 + i) * n;
+					for (size_t j = j0; j < j1; j++)
+						row[j] -= v[i] * w[j - j0];
+				}
+			}
+		};
+		parallel_for((c + HOUSEHOLDER_TILE - 1) / HOUSEHOLDER_TILE, 1,
+		             threads_c, cols);
+
+		/* = FROM THE RIGHT = */
+
+		/* every row from the column k + 1 on, tile by tile of rows:
+		 * A - beta (A v) v^T */
+		auto rows = [&](size_t begin, size_t end) {
+			for (size_t tile = begin; tile < end; tile++) {
+				size_t i0 = tile * HOUSEHOLDER_TILE;
+				size_t i1 = std::min(i0 + HOUSEHOLDER_TILE, n);
+				for (size_t i = i0; i < i1; i++) {
+					double *row = a + i * n + k + 1;
+					double  s   = 0;
+					for (size_t j = 0; j < c; j++)
+						s += row[j] * v[j];
+					s *= beta;
+					for (size_t j = 0; j < c; j++)
+						row[j] -= s * v[j];
+				}
+			}
+		};
+		parallel_for((n + HOUSEHOLDER_TILE - 1) / HOUSEHOLDER_TILE, 1,
+		             threads_c, rows);
+	}
+}
+
+/* = POLYNOMIALS = */
+
+void
+newton_form_eval(const double *xs, const double *coefs, size_t m,
+                 const double *x, size_t n, double *y, size_t threads_c)
+{
+	size_t blocks_c = (n + POLYNOMIAL_BLOCK - 1) / POLYNOMIAL_BLOCK;
+
+	auto blocks = [&](size_t begin, size_t end) {
+		double q[POLYNOMIAL_BLOCK], p[POLYNOMIAL_BLOCK];
+		for (size_t b = begin; b < end; b++) {
+			size_t i   = b * POLYNOMIAL_BLOCK;
+			size_t q_c = std::min(POLYNOMIAL_BLOCK, n - i);
+
+			/* the last block is padded with its last point */
+			std::copy(x + i, x + i + q_c, q);
+			std::fill(q + q_c, q + POLYNOMIAL_BLOCK, q[q_c - 1]);
+			std::fill(p, p + POLYNOMIAL_BLOCK, coefs[m - 1]);
+
+			/* whole blocks for the loop to vectorize */
+			for (size_t k = m - 1; k-- > 0;) {
+				double x_k = xs[k];
+				double c_k = coefs[k];
+				for (size_t j = 0; j < POLYNOMIAL_BLOCK; j++)
+					p[j] = p[j] * (q[j] - x_k) + c_k;
+			}
+
+			std::copy(p, p + q_c, y + i);
+		}
+	};
+	parallel_for(blocks_c, PARALLEL_GRAIN_EVAL / POLYNOMIAL_BLOCK,
+	             threads_c, blocks);
+}
+
+void
+segments_index(const double *xs, size_t segments_c, size_t *buckets)
+{
+	double width = (xs[segments_c] - xs[0]) / segments_c;
+
+	size_t i = 0;
+	for (size_t k = 0; k < segments_c; k++) {
+		double lower = xs[0] + k * width;
+		while (i + 1 < segments_c && xs[i + 1] <= lower)
+			i++;
+		buckets[k] = i;
+	}
+	buckets[segments_c] = segments_c - 1;
+}
+
+size_t
+segments_find(const double *xs, size_t segments_c, const size_t *buckets,
+              double x)
+{
+	double lower = xs[0];
+	double upper = xs[segments_c];
+	if (!(x > lower))
+		return 0;
+	if (x >= upper)
+		return segments_c - 1;
+
+	size_t k  = (size_t)((x - lower) / (upper - lower) * segments_c);
+	k         = std::min(k, segments_c - 1);
+	size_t lo = buckets[k];
+	size_t hi = buckets[k + 1];
+
+	/* the bucket off by one on the round off */
+	while (lo > 0 && xs[lo] > x)
+		lo--;
+	while (hi + 1 < segments_c && xs[hi + 1] <= x)
+		hi++;
+
+	/* the last x_i <= x */
+	return std::upper_bound(xs + lo + 1, xs + hi + 1, x) - xs - 1;
+}
+
+void
+cubic_segments_eval(const double *xs, const double *coefs, size_t segments_c,
+                    const size_t *buckets, const double *x, size_t n,
+                    double *y, size_t threads_c)
+{
+	const size_t B        = POLYNOMIAL_BLOCK;
+	size_t       blocks_c = (n + B - 1) / B;
+
+	auto blocks = [&](size_t begin, size_t end) {
+		double dx[B], a[B], b[B], c[B], d[B], p[B];
+		for (size_t k = begin; k < end; k++) {
+			size_t i   = k * B;
+			size_t q_c = std::min(B, n - i);
+
+			/* the cubic of the segment of every point, the last
+			 * block padded with zeros */
+			for (size_t j = 0; j < q_c; j++) {
+				size_t s = segments_find(xs, segments_c,
+				                         buckets, x[i + j]);
+				const double *coef = coefs + 4 * s;
+
+				dx[j] = x[i + j] - xs[s];
+				a[j]  = coef[0];
+				b[j]  = coef[1];
+				c[j]  = coef[2];
+				d[j]  = coef[3];
+			}
+			for (double *v : { dx, a, b, c, d })
+				std::fill(v + q_c, v + B, 0.0);
+
+			/* whole blocks for the loop to vectorize */
+			for (size_t j = 0; j < B; j++)
+				p[j] = ((d[j] * dx[j] + c[j]) * dx[j] + b[j]) *
+				               dx[j] +
+				       a[j];
+
+			std::copy(p, p + q_c, y + i);
+		}
+	};
+	parallel_for(blocks_c, PARALLEL_GRAIN_EVAL / B, threads_c, blocks);
+}
+
+/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+
+/* == 1. bisection == */
+
+std::string
+bisection_get_c(const char *a, const char *b)
+{
+	double a_val, b_val;
+	if (expr_const_val(a, &a_val) && expr_const_val(b, &b_val)) {
+		double c = (a_val + b_val) / 2;
+		if (!std::isfinite(c))
+			return "";
+		return approx_string(c);
+	}
+
+	/* construct formula */
+	std::string formula = "approx(((";
+	formula += a;
+	formula += ") + (";
+	formula += b;
+	formula += ")) / 2)";
+
+	return giac_approx_string(formula);
+}
+
+/* == 2. secant == */
+
+std::string
+secant_get_x_next(const char *x_prev, const char *fx_prev, const char *x_n,
+                  const char *fx_n)
+{
+	double x_prev_val, fx_prev_val, x_n_val, fx_n_val;
+	int    is_native = expr_const_val(x_prev, &x_prev_val) &&
+	                expr_const_val(fx_prev, &fx_prev_val) &&
+	                expr_const_val(x_n, &x_n_val) &&
+	                expr_const_val(fx_n, &fx_n_val);
+
+	/* landed on the rounded root, as a close start can, where giac would
+	 * divide by 0 too, the points being only told apart by giac when
+	 * f(x) is the same at both as for "2" and "2.0" */
+	int is_landed;
+	if (is_native) {
+		is_landed = x_prev_val == x_n_val;
+	} else {
+		std::string diff = "";
+		if (strcmp(x_prev, x_n) && !strcmp(fx_prev, fx_n))
+			diff = giac_approx_string(std::string("approx((") +
+			                          x_prev + ") - (" + x_n +
+			                          "))");
+		is_landed = !strcmp(x_prev, x_n) ||
+		            (diff != "" && strtod(diff.c_str(), NULL) == 0);
+	}
+	if (is_landed)
+		return x_n;
+
+	if (is_native) {
+		double x_next = ((x_prev_val * fx_n_val) - (x_n_val * fx_prev_val)) /
+		                (fx_n_val - fx_prev_val);
+		if (!std::isfinite(x_next))
+			return "";
+		return approx_string(x_next);
+	}
+
+	/* construct formula */
+	std::string formula = "approx((((";
+	formula += x_prev;
+	formula += ") * (";
+	formula += fx_n;
+	formula += ")) - ((";
+	formula += x_n;
+	formula += ") * (";
+	formula += fx_prev;
+	formula += "))) / ((";
+	formula += fx_n;
+	formula += ") - (";
+	formula += fx_prev;
+	formula += ")))";
+
+	return giac_approx_string(formula);
+}
+
+/* == 3. fixed point == */
+
+std::string
+fixed_point_get_x_acc(const char *x0, const char *x1, const char *x2)
+{
+	double x0_val, x1_val, x2_val;
+	if (expr_const_val(x0, &x0_val) && expr_const_val(x1, &x1_val) &&
+	    expr_const_val(x2, &x2_val)) {
+		/* already at the fixed point */
+		double denominator = x2_val - 2 * x1_val + x0_val;
+		if (denominator == 0)
+			return approx_string(x2_val);
+
+		double x_acc = x0_val - (x1_val - x0_val) * (x1_val - x0_val) /
+		                                denominator;
+		if (!std::isfinite(x_acc))
+			return "";
+		return approx_string(x_acc);
+	}
+
+	/* construct formula */
+	std::string formula = "approx((";
+	formula += x0;
+	formula += ") - ((";
+	formula += x1;
+	formula += ") - (";
+	formula += x0;
+	formula += "))^2 / (((";
+	formula += x2;
+	formula += ") - 2*(";
+	formula += x1;
+	formula += ")) + (";
+	formula += x0;
+	formula += ")))";
+
+	return giac_approx_string(formula);
+}
+
+/* == 4. newton system == */
+
+int
+newton_system_get_x_next(const char *const *x_n, spnm::fxs_t *f,
+                         std::string *fx_n, std::string *x_next)
+{
+	size_t n = f->vars_c;
+
+	double x_val[spnm::VARS_MAX];
+	double fx_val[spnm::VARS_MAX];
+	for (size_t i = 0; i < n; i++)
+		if (!expr_const_val(x_n[i], x_val + i))
+			return spnm::err_x_input;
+
+	if (!fxs_val_jacobian(f, x_val, fx_val))
+		return spnm::err_x_input;
+	if (!lu_factor(f->jacobian.data(), n, f->perm.data()))
+		return spnm::err_singular_matrix;
+
+	/* J(x_n) dx = -f(x_n) */
+	double dx[spnm::VARS_MAX];
+	for (size_t i = 0; i < n; i++)
+		dx[i] = -fx_val[i];
+	lu_solve(f->jacobian.data(), f->perm.data(), n, dx);
+
+	for (size_t i = 0; i < n; i++) {
+		double x_next_val = x_val[i] + dx[i];
+		if (!std::isfinite(x_next_val))
+			return spnm::err_x_input;
+
+		fx_n[i]   = val_string(fx_val[i]);
+		x_next[i] = approx_string(x_next_val);
+	}
+
+	return 0;
+}
+
+/* == 5. newton-krylov == */
+
+int
+newton_krylov_set_x(const char *initial_point, double *x, size_t x_c)
+{
+	double val;
+	if (!x || !expr_const_val(initial_point, &val))
+		return 0;
+
+	for (size_t i = 0; i < x_c; i++)
+		x[i] = val;
+	return 1;
+}
+
+int
+newton_krylov_get_x_next(spnm::sparse_fx_t *f, double *x,
+                         spnm::precond_t precond, size_t threads_c,
+                         std::string *residual_norm,
+                         size_t      *linear_iterations_c,
+                         std::string *linear_residual_norm,
+                         std::string *x_norm)
+{
+	size_t n = f->unknowns_c;
+
+	if (!sparse_fx_val_jacobian(f, x, threads_c))
+		return spnm::err_x_input;
+	if (!precond_setup(precond, &(f->jacobian), &(f->precond)))
+		return spnm::err_singular_matrix;
+
+	/* J(x_n) dx = -f(x_n) */
+	double *fx = f->fx.data();
+	double *dx = f->dx.data();
+	for (size_t i = 0; i < n; i++) {
+		fx[i] = -fx[i];
+		dx[i] = 0;
+	}
+
+	double linear_residual_norm_val;
+	*linear_iterations_c =
+		bicgstab(&(f->jacobian), &(f->precond), fx, dx,
+	                 LINEAR_TOLERANCE, std::max(n, (size_t)1000), threads_c,
+	                 &linear_residual_norm_val);
+
+	for (size_t i = 0; i < n; i++) {
+		x[i] += dx[i];
+		if (!std::isfinite(x[i]))
+			return spnm::err_x_input;
+	}
+
+	*residual_norm        = approx_string(norm2(fx, n));
+	*linear_residual_norm = approx_string(linear_residual_norm_val);
+	*x_norm               = approx_string(norm2(x, n));
+
+	return 0;
+}
+
+/* == 6. parameter sweep == */
+
+/* Solves `point` with `method` from `input1` and `input2` on the parsed `f`,
+ * adding up its steps. Returns 0 on success and the error of the solve on
+ * failure. */
+static int
+sweep_solve(const spnm::sweep_t *t, spnm::fx_t *f, const char *input1,
+            const char *input2, spnm::sweep_s *point)
+{
+	int ret;
+
+	if (t->method == spnm::SWEEP_BISECTION) {
+		spnm::bisection_t s = spnm::bisection_init(
+			t->fx, input1, input2, t->process, t->process_n);
+		s.f = f;
+		if ((ret = spnm::bisection_perform(&s)) == 0 && s.steps_c == 0)
+			ret = spnm::err_x_input;
+		if (ret == 0)
+			point->root = strdup(s.steps[s.steps_c - 1].c_n);
+		point->steps_c += s.steps_c;
+
+		/* `f` is shared by the points */
+		s.f = NULL;
+		spnm::bisection_free(&s);
+		return ret;
+	}
+
+	spnm::secant_t s = spnm::secant_init(t->fx, input1, input2, t->process,
+	                                     t->process_n);
+	s.f = f;
+	if ((ret = spnm::secant_perform(&s)) == 0 && s.steps_c == 0)
+		ret = spnm::err_x_input;
+	if (ret == 0)
+		point->root = strdup(s.steps[s.steps_c - 1].x_next);
+	point->steps_c += s.steps_c;
+
+	s.f = NULL;
+	spnm::secant_free(&s);
+	return ret;
+}
+
+void
+sweep_solve_point(const spnm::sweep_t *t, spnm::fx_t *f, double p,
+                  spnm::sweep_s *point, const spnm::sweep_s *prev1,
+                  const spnm::sweep_s *prev2)
+{
+	fx_set_param(f, p);
+
+	/* = WARM START = */
+
+	double      r1, r2;
+	std::string input1, input2;
+	if (prev1 && expr_const_val(prev1->root, &r1)) {
+		int has_r2 = prev2 && expr_const_val(prev2->root, &r2) && r1 != r2;
+
+		if (t->method == spnm::SWEEP_BISECTION) {
+			/* around the linear prediction, reaching back to r1 */
+			if (has_r2) {
+				double predicted = 2 * r1 - r2;
+				double width     = fabs(r1 - r2);
+				input1 = approx_string(predicted - width);
+				input2 = approx_string(predicted + width);
+			}
+		} else {
+			/* from r1 to the linear prediction, else as far from r1
+			 * as the given initial points are apart */
+			double x1, x2;
+			input1 = prev1->root;
+			if (has_r2)
+				input2 = approx_string(2 * r1 - r2);
+			else if (expr_const_val(t->input1, &x1) &&
+			         expr_const_val(t->input2, &x2))
+				input2 = approx_string(r1 + (x2 - x1));
+			else
+				input1 = "";
+		}
+	}
+
+	if (input1 != "" && input2 != "") {
+		point->err = sweep_solve(t, f, input1.c_str(), input2.c_str(),
+		                         point);
+		point->is_warm = point->err == 0;
+		if (point->is_warm)
+			return;
+	}
+
+	/* = COLD START = */
+
+	point->err = sweep_solve(t, f, t->input1, t->input2, point);
+}
+
+/* == 7. root isolation == */
+
+/* A subinterval left at the end of the branch and prune. */
+struct isolate_leaf_t {
+	interval_t        x;
+	spnm::enclosure_t kind;
+	int               bounded; /* 0 if f may have a pole in `x` */
+};
+
+/* Work queue of the branch and prune shared by the threads. */
+struct isolate_queue_t {
+	std::mutex                  m;
+	std::condition_variable     cv;
+	std::vector<interval_t>     boxes;   /* subintervals waiting */
+	std::vector<isolate_leaf_t> leaves;  /* subintervals kept */
+	size_t                      busy_c;  /* threads with subintervals */
+	size_t                      boxes_c; /* subintervals examined */
+	std::atomic<size_t>         idle_c;  /* threads waiting for work */
+};
+
+/* Returns the sign of f over the point `x` as '-' or '+', or '*' if the
+ * enclosure of f(x) has both. */
+static char
+isolate_point_sign(const expr_t *e, double x, interval_t *slots)
+{
+	interval_t at = { x, x };
+	interval_t fx = expr_eval_interval(e, &at, slots, NULL, NULL);
+	if (interval_is_empty(fx) || !interval_excludes_zero(fx))
+		return '*';
+	return fx.lo > 0 ? '+' : '-';
+}
+
+/* Works on the queue `q` for the roots of `e` until no subinterval is left
+ * anywhere. */
+static void
+isolate_work(const expr_t *e, double tolerance, isolate_queue_t *q)
+{
+	std::vector<interval_t>     slots(e->ins.size()), dslots(e->ins.size());
+	std::vector<interval_t>     local;
+	std::vector<isolate_leaf_t> leaves;
+	size_t                      boxes_c = 0;
+
+	for (;;) {
+		/* = TAKE WORK = */
+
+		if (local.empty()) {
+			std::unique_lock<std::mutex> lock(q->m);
+			q->idle_c++;
+			q->cv.wait(lock, [q]() {
+				return !q->boxes.empty() || q->busy_c == 0 ||
+				       q->boxes_c > spnm::ISOLATE_BOXES_MAX;
+			});
+			q->idle_c--;
+
+			if (q->boxes.empty() ||
+			    q->boxes_c > spnm::ISOLATE_BOXES_MAX) {
+				q->leaves.insert(q->leaves.end(), leaves.begin(),
+				                 leaves.end());
+				q->cv.notify_all();
+				return;
+			}
+			local.push_back(q->boxes.back());
+			q->boxes.pop_back();
+			q->busy_c++;
+		}
+
+		interval_t x = local.back();
+		local.pop_back();
+		boxes_c++;
+
+		/* = PRUNE = */
+
+		interval_t dfx;
+		interval_t fx = expr_eval_interval(e, &x, slots.data(),
+		                                   dslots.data(), &dfx);
+		if (!interval_excludes_zero(fx)) {
+			char lo_sign = isolate_point_sign(e, x.lo, slots.data());
+			char hi_sign = isolate_point_sign(e, x.hi, slots.data());
+			int  signs_known = lo_sign != '*' && hi_sign != '*';
+			int  monotone    = interval_excludes_zero(dfx);
+			double mid       = x.lo + (x.hi - x.lo) / 2;
+
+			/* a sign change across a pole as of 1/x is no root */
+			int bounded = std::isfinite(fx.lo) && std::isfinite(fx.hi);
+			int sign_change =
+				bounded && signs_known && lo_sign != hi_sign;
+
+			if (monotone && sign_change) {
+				leaves.push_back(
+					{ x, spnm::ENCLOSURE_UNIQUE, bounded });
+			} else if (monotone && signs_known) {
+				/* no root */
+			} else if (x.hi - x.lo <= tolerance || mid <= x.lo ||
+			           mid >= x.hi) {
+				leaves.push_back(
+					{ x,
+				          sign_change ? spnm::ENCLOSURE_EXISTS
+				                      : spnm::ENCLOSURE_POSSIBLE,
+				          bounded });
+			} else {
+				local.push_back({ mid, x.hi });
+				local.push_back({ x.lo, mid });
+			}
+		}
+
+		/* = SHARE WORK = */
+
+		if ((local.size() > 1 && q->idle_c > 0) || local.empty() ||
+		    boxes_c >= 1024) {
+			std::lock_guard<std::mutex> lock(q->m);
+			if (local.size() > 1 && q->idle_c > 0) {
+				/* the widest waiting subinterval */
+				q->boxes.push_back(local.front());
+				local.erase(local.begin());
+			}
+			q->boxes_c += boxes_c;
+			boxes_c = 0;
+			if (q->boxes_c > spnm::ISOLATE_BOXES_MAX)
+				local.clear();
+			if (local.empty())
+				q->busy_c--;
+			q->cv.notify_all();
+		}
+	}
+}
+
+/* Returns the bound `val` as a string rounded off away from the inside of
+ * its enclosure, towards -inf if `down` and +inf otherwise. */
+static std::string
+isolate_bound_string(double val, int down)
+{
+	std::string ret = approx_string(val);
+
+	double ret_val;
+	for (int i = 0; expr_const_val(ret.c_str(), &ret_val) &&
+	                (down ? ret_val > val : ret_val < val) && i < 64;
+	     i++) {
+		val += (down ? -1 : 1) * std::max(fabs(val) * 1e-12, 1e-300);
+		ret = approx_string(val);
+	}
+
+	return ret;
+}
+
+int
+isolate_get_enclosures(spnm::isolate_t *t, double lower, double upper,
+                       double tolerance)
+{
+	if (!t->f->is_native) {
+		t->log << "Can't evaluate '" << t->fx
+		       << "' natively in interval arithmetic." << std::endl;
+		return spnm::err_fx_parse;
+	}
+
+	/* f as written, the powers of `t->f` optimized into multiplications
+	 * having wider enclosures */
+	const char *vars[] = { "x" };
+	expr_t      expr;
+	expr_compile(t->fx, vars, 1, &expr);
+
+	/* = BRANCH AND PRUNE = */
+
+	isolate_queue_t q;
+	q.boxes.push_back({ lower, upper });
+	q.busy_c  = 0;
+	q.boxes_c = 0;
+	q.idle_c  = 0;
+
+	size_t threads_c = t->threads_c;
+	if (threads_c == 0)
+		threads_c = std::thread::hardware_concurrency();
+
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < threads_c; i++)
+		threads.emplace_back(isolate_work, &expr, tolerance, &q);
+	isolate_work(&expr, tolerance, &q);
+	for (std::thread &thread : threads)
+		thread.join();
+
+	t->boxes_c = q.boxes_c;
+	if (q.boxes_c > spnm::ISOLATE_BOXES_MAX)
+		return spnm::err_steps_max;
+
+	/* = ENCLOSURES = */
+
+	std::sort(q.leaves.begin(), q.leaves.end(),
+	          [](const isolate_leaf_t &a, const isolate_leaf_t &b) {
+			  return a.x.lo < b.x.lo;
+		  });
+
+	/* touching leaves are the same roots, as one on the bound between
+	 * them, except for unique ones */
+	std::vector<isolate_leaf_t> merged;
+	std::vector<interval_t>     slots(expr.ins.size());
+	for (const isolate_leaf_t &leaf : q.leaves) {
+		isolate_leaf_t *last = merged.empty() ? NULL : &merged.back();
+		if (!last || last->x.hi != leaf.x.lo ||
+		    last->kind == spnm::ENCLOSURE_UNIQUE ||
+		    leaf.kind == spnm::ENCLOSURE_UNIQUE) {
+			merged.push_back(leaf);
+			continue;
+		}
+
+		last->x.hi = leaf.x.hi;
+		last->bounded &= leaf.bounded;
+		char lo_sign =
+			isolate_point_sign(&expr, last->x.lo, slots.data());
+		char hi_sign =
+			isolate_point_sign(&expr, last->x.hi, slots.data());
+		last->kind = last->bounded && lo_sign != '*' && hi_sign != '*' &&
+		                             lo_sign != hi_sign
+		                     ? spnm::ENCLOSURE_EXISTS
+		                     : spnm::ENCLOSURE_POSSIBLE;
+	}
+
+	t->enclosures_c = merged.size();
+	t->enclosures   = (spnm::isolate_s *)calloc(merged.size(),
+	                                            sizeof(spnm::isolate_s));
+	for (size_t i = 0; i < merged.size(); i++) {
+		spnm::isolate_s *enclosure = t->enclosures + i;
+
+		enclosure->lower =
+			strdup(isolate_bound_string(merged[i].x.lo, 1).c_str());
+		enclosure->upper =
+			strdup(isolate_bound_string(merged[i].x.hi, 0).c_str());
+		enclosure->kind = merged[i].kind;
+	}
+
+	return 0;
+}
+
+/* == 8. polynomial roots == */
+
+/* Coefficients of a polynomial, the constant term first. */
+typedef std::vector<double> polynomial_t;
+
+/* Returns `a` times `b`. */
+static polynomial_t
+polynomial_mul(const polynomial_t &a, const polynomial_t &b)
+{
+	polynomial_t ret(a.size() + b.size() - 1, 0);
+	for (size_t i = 0; i < a.size(); i++)
+		for (size_t j = 0; j < b.size(); j++)
+			ret[i + j] += a[i] * b[j];
+
+	return ret;
+}
+
+/* Reads `e` as a polynomial in its first variable into `p`. Returns 0 if it
+ * isn't one of a degree up to `spnm::POLYNOMIAL_DEGREE_MAX`, as for "1/x" or
+ * "sin(x)", while functions of constants as in "sqrt(2) x" are fine. */
+static int
+expr_polynomial(const expr_t *e, polynomial_t *p)
+{
+	std::vector<polynomial_t> polys(e->ins.size());
+
+	for (size_t i = 0; i < e->ins.size(); i++) {
+		const expr_ins *in = &(e->ins[i]);
+		polynomial_t   *r  = &(polys[i]);
+
+		int binary = in->op >= EXPR_ADD && in->op <= EXPR_POW;
+		int unary  = in->op == EXPR_NEG || in->op >= EXPR_SIN;
+		int is_const =
+			(unary || binary) && polys[in->a].size() == 1 &&
+			(!binary || polys[in->b].size() == 1);
+
+		/* = CONSTANTS = */
+
+		if (is_const) {
+			*r = { expr_fold(in->op, polys[in->a][0],
+			                 binary ? polys[in->b][0] : 0) };
+			continue;
+		}
+
+		/* = POLYNOMIALS = */
+
+		switch (in->op) {
+		case EXPR_CONST: *r = { in->val }; break;
+		case EXPR_VAR:
+			if (in->a != 0)
+				return 0;
+			*r = { 0, 1 };
+			break;
+		case EXPR_NEG:
+			*r = polys[in->a];
+			for (double &c : *r)
+				c = -c;
+			break;
+		case EXPR_ADD:
+		case EXPR_SUB: {
+			const polynomial_t &a = polys[in->a], &b = polys[in->b];
+			r->assign(std::max(a.size(), b.size()), 0);
+			for (size_t k = 0; k < a.size(); k++)
+				(*r)[k] += a[k];
+			for (size_t k = 0; k < b.size(); k++)
+				(*r)[k] += in->op == EXPR_ADD ? b[k] : -b[k];
+		} break;
+		case EXPR_MUL:
+			*r = polynomial_mul(polys[in->a], polys[in->b]);
+			break;
+		case EXPR_DIV:
+			/* only by a constant */
+			if (polys[in->b].size() != 1)
+				return 0;
+			*r = polys[in->a];
+			for (double &c : *r)
+				c /= polys[in->b][0];
+			break;
+		case EXPR_POW: {
+			/* only to a constant natural power */
+			const polynomial_t &a = polys[in->a], &b = polys[in->b];
+			if (b.size() != 1 || !(b[0] >= 0) ||
+			    b[0] != std::floor(b[0]) ||
+			    (a.size() - 1) * b[0] > spnm::POLYNOMIAL_DEGREE_MAX)
+				return 0;
+			*r = { 1 };
+			for (size_t k = 0; k < (size_t)b[0]; k++)
+				*r = polynomial_mul(*r, a);
+		} break;
+		default:
+			return 0;
+		}
+
+		if (r->size() - 1 > spnm::POLYNOMIAL_DEGREE_MAX)
+			return 0;
+	}
+
+	/* the terms cancelling out as in "x^2 - x^2 + x" */
+	*p = polys.back();
+	while (p->size() > 1 && p->back() == 0)
+		p->pop_back();
+	for (double c : *p)
+		if (!std::isfinite(c))
+			return 0;
+
+	return 1;
+}
+
+/* Scales `p` for its coefficient of the largest magnitude to be 1 or -1,
+ * keeping its sign everywhere. */
+static void
+polynomial_normalize(polynomial_t *p)
+{
+	double max = 0;
+	for (double c : *p)
+		max = std::max(max, fabs(c));
+	if (max > 0)
+		for (double &c : *p)
+			c /= max;
+}
+
+/* Size of the coefficients of a remainder, next to those it is computed
+ * from, below which they are only rounding errors of a 0. */
+const double POLYNOMIAL_ZERO = 1e-11;
+
+/* Divides `a` by `b` into the quotient `q` and the remainder `r`, the
+ * leading coefficients of `r` that are rounding errors being dropped, none
+ * of them being left for a zero remainder. */
+static void
+polynomial_divide(const polynomial_t &a, const polynomial_t &b,
+                  polynomial_t *q, polynomial_t *r)
+{
+	size_t q_c = a.size() >= b.size() ? a.size() - b.size() + 1 : 0;
+	q->assign(std::max(q_c, (size_t)1), 0);
+	*r = a;
+
+	double scale = 0;
+	for (double c : a)
+		scale = std::max(scale, fabs(c));
+	for (size_t k = q_c; k-- > 0;) {
+		double c = (*r)[k + b.size() - 1] / b.back();
+		for (size_t j = 0; j < b.size(); j++)
+			(*r)[k + j] -= c * b[j];
+		(*q)[k] = c;
+		scale   = std::max(scale, fabs(c));
+	}
+
+	r->resize(std::min(r->size(), b.size() - 1));
+	while (!r->empty() && fabs(r->back()) <= POLYNOMIAL_ZERO * scale)
+		r->pop_back();
+}
+
+/* Returns `p` at `x` by horner's scheme, with a bound on its rounding error
+ * into `err`. */
+static double
+polynomial_val(const polynomial_t &p, double x, double *err)
+{
+	double val = 0, abs_val = 0;
+	for (size_t k = p.size(); k-- > 0;) {
+		val     = val * x + p[k];
+		abs_val = abs_val * fabs(x) + fabs(p[k]);
+	}
+	*err = 2 * p.size() * DBL_EPSILON * abs_val;
+
+	return val;
+}
+
+/* Returns the number of sign changes of the sturm sequence `seq` at `x`, or
+ * -1 if the sign of its first polynomial at `x` is lost in rounding errors.
+ * The signs of the others can't change the count where they are 0, their
+ * neighbours being then of opposite signs. */
+static int
+sturm_changes(const std::vector<polynomial_t> &seq, double x)
+{
+	int  changes = 0;
+	char prev    = 0;
+	for (size_t i = 0; i < seq.size(); i++) {
+		double err, val = polynomial_val(seq[i], x, &err);
+		if (i == 0 && fabs(val) <= err)
+			return -1;
+		if (val == 0)
+			continue;
+
+		char sign = val > 0 ? '+' : '-';
+		changes += prev && sign != prev;
+		prev = sign;
+	}
+
+	return changes;
+}
+
+/* Returns the sturm sequence of `p`: `p`, p' and the negated remainders of
+ * their euclidean algorithm, scaled as only their signs matter, the last one
+ * being the gcd of `p` and p' as far as double precision tells. */
+static std::vector<polynomial_t>
+sturm_sequence(const polynomial_t &p)
+{
+	std::vector<polynomial_t> seq(2);
+	seq[0] = p;
+	for (size_t k = 1; k < p.size(); k++)
+		seq[1].push_back(k * p[k]);
+	polynomial_normalize(&seq[0]);
+	polynomial_normalize(&seq[1]);
+	while (seq.back().size() > 1) {
+		polynomial_t q, r;
+		polynomial_divide(seq[seq.size() - 2], seq.back(), &q, &r);
+		if (r.empty())
+			break;
+		for (double &c : r)
+			c = -c;
+		polynomial_normalize(&r);
+		seq.push_back(r);
+	}
+
+	return seq;
+}
+
+/* A subinterval (lo, hi] of `lo_changes` - `hi_changes` roots. */
+struct sturm_box_t {
+	double lo, hi;
+	int    lo_changes, hi_changes;
+};
+
+/* Splits `box` of more than one root in two with the sequence `seq` into
+ * `left` and `right`, near its middle where f isn't too close to 0. Returns
+ * 0 if the roots can't be told apart in double precision. */
+static int
+sturm_split(const std::vector<polynomial_t> &seq, const sturm_box_t *box,
+            sturm_box_t *left, sturm_box_t *right)
+{
+	const double fractions[] = { 0.5,  0.375, 0.625,  0.25,
+		                     0.75, 0.4375, 0.5625 };
+	for (double fraction : fractions) {
+		double mid = box->lo + (box->hi - box->lo) * fraction;
+		if (mid <= box->lo || mid >= box->hi)
+			return 0;
+
+		int changes = sturm_changes(seq, mid);
+		if (changes < 0)
+			continue;
+
+		*left  = { box->lo, mid, box->lo_changes, changes };
+		*right = { mid, box->hi, changes, box->hi_changes };
+		return 1;
+	}
+
+	return 0;
+}
+
+/* Examines `box` with the sequence `seq`, keeping it in `leaves` when it has
+ * a root of its own or roots that can't be told apart and else splitting it
+ * into `left` and `right` if it has any. Returns 1 if it is split. */
+static int
+sturm_examine(const std::vector<polynomial_t> &seq, const sturm_box_t *box,
+              std::vector<isolate_leaf_t> *leaves, sturm_box_t *left,
+              sturm_box_t *right)
+{
+	int roots_c = box->lo_changes - box->hi_changes;
+	if (roots_c <= 0)
+		return 0;
+	if (roots_c > 1 && sturm_split(seq, box, left, right))
+		return 1;
+
+	leaves->push_back({ { box->lo, box->hi },
+	                    roots_c == 1 ? spnm::ENCLOSURE_UNIQUE
+	                                 : spnm::ENCLOSURE_EXISTS,
+	                    1 });
+	return 0;
+}
+
+/* Isolates the roots in `box` depth first with the sequence `seq` into
+ * `leaves`, in increasing order, counting the subintervals examined into
+ * `boxes_c` shared by the threads. */
+static void
+sturm_isolate(const std::vector<polynomial_t> &seq, sturm_box_t box,
+              std::vector<isolate_leaf_t> *leaves,
+              std::atomic<size_t> *boxes_c)
+{
+	std::vector<sturm_box_t> local = { box };
+	while (!local.empty() && *boxes_c <= spnm::ISOLATE_BOXES_MAX) {
+		box = local.back();
+		local.pop_back();
+		(*boxes_c)++;
+
+		sturm_box_t left, right;
+		if (sturm_examine(seq, &box, leaves, &left, &right)) {
+			local.push_back(right);
+			local.push_back(left);
+		}
+	}
+}
+
+/* Returns `p` as an expression in x. */
+static std::string
+polynomial_string(const polynomial_t &p)
+{
+	std::string ret = "";
+	for (size_t k = p.size(); k-- > 0;) {
+		if (p[k] == 0)
+			continue;
+
+		if (ret == "")
+			ret = approx_string(p[k]);
+		else if (p[k] < 0)
+			ret += " - " + approx_string(-p[k]);
+		else
+			ret += " + " + approx_string(p[k]);
+		if (k == 1)
+			ret += "*x";
+		else if (k > 1)
+			ret += "*x^" + std::to_string(k);
+	}
+
+	return ret;
+}
+
+int
+polynomial_roots_get_enclosures(spnm::polynomial_roots_t *t)
+{
+	polynomial_t p;
+	if (!t->f->is_native || !expr_polynomial(&(t->f->expr), &p) ||
+	    p.size() < 2) {
+		t->log << "Can't read '" << t->fx
+		       << "' natively as a polynomial in x of a degree from 1 "
+		          "to "
+		       << spnm::POLYNOMIAL_DEGREE_MAX << "." << std::endl;
+		return spnm::err_fx_parse;
+	}
+	t->degree = p.size() - 1;
+
+	/* = STURM SEQUENCE = */
+
+	std::vector<polynomial_t> seq = sturm_sequence(p);
+	t->sequence_c                 = seq.size();
+
+	/* the last one is the gcd of f and f', not a constant only when f has
+	 * multiple roots or roots too close to be told apart from them */
+	std::vector<polynomial_t> gcd_seq;
+	if (seq.back().size() > 1) {
+		gcd_seq = sturm_sequence(seq.back());
+
+		polynomial_t q, r;
+		polynomial_divide(seq[0], seq.back(), &q, &r);
+
+		/* the coefficients left by the rounding of an exact 0 */
+		double scale = 0;
+		for (double c : q)
+			scale = std::max(scale, fabs(c));
+		for (double &c : q)
+			if (fabs(c) <= POLYNOMIAL_ZERO * scale)
+				c = 0;
+		t->square_free = strdup(polynomial_string(q).c_str());
+	}
+
+	/* = BOUND = */
+
+	/* every root is below 2 max |a_(n - k) / a_n|^(1 / k) in magnitude by
+	 * fujiwara's bound, halving a_0, which unlike cauchy's grows as the
+	 * roots do and not as their product, doubled for f to be far from 0 at
+	 * the ends */
+	size_t n     = p.size() - 1;
+	double bound = 0;
+	for (size_t k = 1; k <= n; k++) {
+		double a = fabs(p[n - k] / p[n]);
+		if (k == n)
+			a /= 2;
+		bound = std::max(bound, pow(a, 1.0 / k));
+	}
+	bound = 4 * bound;
+	if (bound == 0)
+		bound = 1;
+
+	sturm_box_t box = { -bound, bound, sturm_changes(seq, -bound),
+		            sturm_changes(seq, bound) };
+	if (box.lo_changes < 0 || box.hi_changes < 0) {
+		t->log << "The coefficients of '" << t->fx
+		       << "' are too far apart in magnitude." << std::endl;
+		return spnm::err_fx_parse;
+	}
+
+	/* = ISOLATION = */
+
+	size_t threads_c = t->threads_c;
+	if (threads_c == 0)
+		threads_c = std::thread::hardware_concurrency();
+
+	/* split breadth first until there are a few subintervals of roots for
+	 * every thread to take, each being then isolated depth first */
+	std::vector<isolate_leaf_t> leaves;
+	std::vector<sturm_box_t>    boxes = { box };
+	std::atomic<size_t>         boxes_c(0);
+	while (!boxes.empty() && boxes.size() < 4 * threads_c &&
+	       boxes_c <= spnm::ISOLATE_BOXES_MAX) {
+		std::vector<sturm_box_t> next;
+		for (const sturm_box_t &b : boxes) {
+			boxes_c++;
+
+			sturm_box_t left, right;
+			if (sturm_examine(seq, &b, &leaves, &left, &right)) {
+				next.push_back(left);
+				next.push_back(right);
+			}
+		}
+		boxes = next;
+	}
+
+	std::vector<std::vector<isolate_leaf_t>> box_leaves(boxes.size());
+	auto isolate = [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; i++)
+			sturm_isolate(seq, boxes[i], &box_leaves[i], &boxes_c);
+	};
+	parallel_for(boxes.size(), 1, threads_c, isolate);
+
+	t->boxes_c = boxes_c;
+	if (boxes_c > spnm::ISOLATE_BOXES_MAX)
+		return spnm::err_steps_max;
+
+	for (const std::vector<isolate_leaf_t> &b : box_leaves)
+		leaves.insert(leaves.end(), b.begin(), b.end());
+	std::sort(leaves.begin(), leaves.end(),
+	          [](const isolate_leaf_t &a, const isolate_leaf_t &b) {
+			  return a.x.lo < b.x.lo;
+		  });
+
+	/* a root of its own is only unique where the gcd has none, the
+	 * others being multiple roots or close roots alike, which f changing
+	 * sign or not over them is all that is told of */
+	for (isolate_leaf_t &leaf : leaves) {
+		if (gcd_seq.empty() || leaf.kind != spnm::ENCLOSURE_UNIQUE)
+			continue;
+
+		int lo_changes = sturm_changes(gcd_seq, leaf.x.lo);
+		int hi_changes = sturm_changes(gcd_seq, leaf.x.hi);
+		if (lo_changes >= 0 && hi_changes >= 0 &&
+		    lo_changes == hi_changes)
+			continue;
+
+		double err, lo_val = polynomial_val(p, leaf.x.lo, &err);
+		double      hi_val = polynomial_val(p, leaf.x.hi, &err);
+		leaf.kind = (lo_val < 0) != (hi_val < 0)
+		                    ? spnm::ENCLOSURE_EXISTS
+		                    : spnm::ENCLOSURE_POSSIBLE;
+	}
+
+	/* = ENCLOSURES = */
+
+	t->enclosures_c = leaves.size();
+	t->enclosures   = (spnm::isolate_s *)calloc(leaves.size(),
+	                                            sizeof(spnm::isolate_s));
+	for (size_t i = 0; i < leaves.size(); i++) {
+		spnm::isolate_s *enclosure = t->enclosures + i;
+
+		enclosure->lower =
+			strdup(isolate_bound_string(leaves[i].x.lo, 1).c_str());
+		enclosure->upper =
+			strdup(isolate_bound_string(leaves[i].x.hi, 0).c_str());
+		enclosure->kind = leaves[i].kind;
+	}
+
+	return 0;
+}
+
+/* = 2 - NUMERICAL INTEGRATION = */
+
+/* == 1. newton-cotes and romberg == */
+
+/* Nodes evaluated at once by `integration_sum()`. */
+const size_t INTEGRATION_NODES_CHUNK = 1024;
+
+/* Evaluates `src` as a limit of an integration. Returns 0 on error. */
+static int
+integration_limit_val(const char *src, double *val)
+{
+	if (expr_const_val(src, val))
+		return 1;
+
+	std::string val_string = giac_approx_string(src);
+	if (val_string == "")
+		return 0;
+	*val = strtod(val_string.c_str(), NULL);
+	return std::isfinite(*val);
+}
+
+/* Sets `sum` to the sum of w_i f(x0 + i dx) over the `nodes_c` nodes, the
+ * weights w_i repeating `weights` from i = 0. Returns 0 if f isn't finite at a
+ * node. */
+static int
+integration_sum(spnm::fx_t *f, double x0, double dx, size_t nodes_c,
+                const double *weights, size_t weights_c, double *sum)
+{
+	double x[INTEGRATION_NODES_CHUNK];
+	double fx[INTEGRATION_NODES_CHUNK];
+
+	*sum = 0;
+	for (size_t i = 0; i < nodes_c; i += INTEGRATION_NODES_CHUNK) {
+		size_t chunk_c = std::min(INTEGRATION_NODES_CHUNK, nodes_c - i);
+		for (size_t j = 0; j < chunk_c; j++)
+			x[j] = x0 + (double)(i + j) * dx;
+
+		fx_val_batch(f, x, chunk_c, fx);
+
+		for (size_t j = 0; j < chunk_c; j++) {
+			if (!std::isfinite(fx[j]))
+				return 0;
+			*sum += weights[(i + j) % weights_c] * fx[j];
+		}
+	}
+
+	return 1;
+}
+
+/* Moves `t->trapezoid` to twice the subintervals, evaluating f only at the new
+ * midpoints, or sets it up on a single subinterval the first time. Returns 0
+ * if f isn't finite at a node. */
+static int
+integration_trapezoid_next(spnm::integration_t *t)
+{
+	const double one[] = { 1 };
+	double       sum;
+
+	if (t->intervals_c == 0) {
+		double ends[] = { t->a, t->b }, f_ends[2];
+		fx_val_batch(t->f, ends, 2, f_ends);
+		if (!std::isfinite(f_ends[0]) || !std::isfinite(f_ends[1]))
+			return 0;
+
+		t->intervals_c = 1;
+		t->trapezoid   = (t->b - t->a) / 2 * (f_ends[0] + f_ends[1]);
+		return 1;
+	}
+
+	double h = (t->b - t->a) / (double)(2 * t->intervals_c);
+	if (!integration_sum(t->f, t->a + h, 2 * h, t->intervals_c, one, 1,
+	                     &sum))
+		return 0;
+
+	t->intervals_c *= 2;
+	t->trapezoid = t->trapezoid / 2 + h * sum;
+	return 1;
+}
+
+/* Sets `val` to simpson's 3/8 rule on `intervals_c` subintervals, a multiple
+ * of 3. Returns 0 if f isn't finite at a node. */
+static int
+integration_simpson_38(spnm::fx_t *f, double a, double b, size_t intervals_c,
+                       double *val)
+{
+	/* the interior nodes from x_1 on */
+	const double weights[] = { 3, 3, 2 };
+	double       h         = (b - a) / (double)intervals_c;
+	double       ends[]    = { a, b }, f_ends[2], sum;
+
+	fx_val_batch(f, ends, 2, f_ends);
+	if (!std::isfinite(f_ends[0]) || !std::isfinite(f_ends[1]) ||
+	    !integration_sum(f, a + h, h, intervals_c - 1, weights, 3, &sum))
+		return 0;
+
+	*val = 3 * h / 8 * (f_ends[0] + f_ends[1] + sum);
+	return 1;
+}
+
+int
+integration_set_limits(spnm::integration_t *t)
+{
+	return integration_limit_val(t->lower, &(t->a)) &&
+	       integration_limit_val(t->upper, &(t->b));
+}
+
+int
+integration_get_next(spnm::integration_t *t, std::string *h,
+                     std::string *integral, std::string *row)
+{
+	double integral_val;
+
+	switch (t->rule) {
+	case spnm::QUAD_TRAPEZOIDAL:
+		if (!integration_trapezoid_next(t))
+			return spnm::err_x_input;
+		integral_val = t->trapezoid;
+		break;
+	case spnm::QUAD_SIMPSON_13: {
+		/* S(2n) = (4 T(2n) - T(n)) / 3 */
+		if (t->intervals_c == 0 && !integration_trapezoid_next(t))
+			return spnm::err_x_input;
+		double trapezoid_prev = t->trapezoid;
+		if (!integration_trapezoid_next(t))
+			return spnm::err_x_input;
+		integral_val = (4 * t->trapezoid - trapezoid_prev) / 3;
+		break;
+	}
+	case spnm::QUAD_SIMPSON_38: {
+		/* nothing of the previous nodes carries over as the weights
+		 * change with the halving */
+		size_t intervals_c = t->intervals_c ? 2 * t->intervals_c : 3;
+		if (!integration_simpson_38(t->f, t->a, t->b, intervals_c,
+		                            &integral_val))
+			return spnm::err_x_input;
+		t->intervals_c = intervals_c;
+		break;
+	}
+	case spnm::QUAD_ROMBERG: {
+		/* R(k, j) = R(k, j-1) + (R(k, j-1) - R(k-1, j-1)) / (4^j - 1) */
+		if (!integration_trapezoid_next(t))
+			return spnm::err_x_input;
+
+		size_t k = t->steps_c;
+		double cur[spnm::INTEGRATION_STEPS_MAX];
+		double factor = 1;
+		cur[0]        = t->trapezoid;
+		for (size_t j = 1; j <= k; j++) {
+			factor *= 4;
+			cur[j] = cur[j - 1] +
+			         (cur[j - 1] - t->romberg[j - 1]) / (factor - 1);
+		}
+		for (size_t j = 0; j <= k; j++) {
+			t->romberg[j] = cur[j];
+			row[j]        = approx_string(cur[j]);
+		}
+		integral_val = cur[k];
+		break;
+	}
+	default:
+		return spnm::err_x_input;
+	}
+
+	if (!std::isfinite(integral_val))
+		return spnm::err_x_input;
+
+	*h        = approx_string((t->b - t->a) / (double)t->intervals_c);
+	*integral = approx_string(integral_val);
+	return 0;
+}
+
+/* == 2. adaptive gauss-kronrod == */
+
+/* nodes of the 15 point kronrod rule on [-1, 1], the odd ones being those of
+ * the 7 point gauss rule, along with the weights of both */
+static const double gauss_kronrod_xk[8] = {
+	0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+	0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+	0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+	0.207784955007898467600689403773245, 0.000000000000000000000000000000000,
+};
+static const double gauss_kronrod_wk[8] = {
+	0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+	0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+	0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+	0.204432940075298892414161999234649, 0.209482141084727828012999174891714,
+};
+static const double gauss_kronrod_wg[4] = {
+	0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+	0.381830050505118944950369775488975, 0.417959183673469387755102040816327,
+};
+
+/* Least number of subintervals worth a thread of their own. */
+const size_t GAUSS_KRONROD_GRAIN = PARALLEL_GRAIN_EVAL / 15;
+
+/* Orders the subintervals on their error, then on their position so that the
+ * order never depends on how they were computed. */
+static bool
+gauss_kronrod_box_less(const spnm::gauss_kronrod_box_t &x,
+                       const spnm::gauss_kronrod_box_t &y)
+{
+	if (x.error != y.error)
+		return x.error < y.error;
+	return x.lower > y.lower;
+}
+
+/* Writes the 15 nodes of the subinterval `box` to `x`: the pairs
+ * c -/+ h xk_j followed by the center c. */
+static void
+gauss_kronrod_nodes(const spnm::gauss_kronrod_box_t *box, double *x)
+{
+	double c = (box->lower + box->upper) / 2;
+	double h = (box->upper - box->lower) / 2;
+
+	for (size_t j = 0; j < 7; j++) {
+		x[2 * j]     = c - h * gauss_kronrod_xk[j];
+		x[2 * j + 1] = c + h * gauss_kronrod_xk[j];
+	}
+	x[14] = c;
+}
+
+/* Sets the integral and the error of `box` from f over its nodes `fx`, as
+ * QUADPACK's qk15 does. */
+static void
+gauss_kronrod_rule(spnm::gauss_kronrod_box_t *box, const double *fx)
+{
+	double h = (box->upper - box->lower) / 2;
+
+	double kronrod = gauss_kronrod_wk[7] * fx[14];
+	double gauss   = gauss_kronrod_wg[3] * fx[14];
+	double abs     = fabs(kronrod);
+	for (size_t j = 0; j < 7; j++) {
+		double pair = fx[2 * j] + fx[2 * j + 1];
+		kronrod += gauss_kronrod_wk[j] * pair;
+		abs += gauss_kronrod_wk[j] *
+		       (fabs(fx[2 * j]) + fabs(fx[2 * j + 1]));
+		if (j % 2 == 1)
+			gauss += gauss_kronrod_wg[j / 2] * pair;
+	}
+
+	/* the spread of f about its mean scales the estimate, which is
+	 * otherwise far too pessimistic for smooth f */
+	double mean = kronrod / 2;
+	double asc  = gauss_kronrod_wk[7] * fabs(fx[14] - mean);
+	for (size_t j = 0; j < 14; j++)
+		asc += gauss_kronrod_wk[j / 2] * fabs(fx[j] - mean);
+
+	double error = fabs((kronrod - gauss) * h);
+	asc *= fabs(h);
+	abs *= fabs(h);
+	if (asc != 0 && error != 0)
+		error = asc * std::min(1.0, pow(200 * error / asc, 1.5));
+	if (abs > DBL_MIN / (50 * DBL_EPSILON))
+		error = std::max(50 * DBL_EPSILON * abs, error);
+
+	box->integral = kronrod * h;
+	box->error    = error;
+}
+
+/* Integrates the `boxes_c` subintervals `boxes` on `threads_c` threads.
+ * Returns 0 if f isn't finite at a node. */
+static int
+gauss_kronrod_boxes(spnm::fx_t *f, spnm::gauss_kronrod_box_t *boxes,
+                    size_t boxes_c, size_t threads_c)
+{
+	std::atomic<int> is_finite(1);
+
+	parallel_for(
+		boxes_c, GAUSS_KRONROD_GRAIN, threads_c,
+		[&](size_t begin, size_t end) {
+			spnm::fx_t *f_local = fx_clone(f);
+
+			/* all the nodes of the chunk go in the same batches */
+			std::vector<double> x((end - begin) * 15);
+			std::vector<double> fx(x.size());
+			for (size_t i = begin; i < end; i++)
+				gauss_kronrod_nodes(boxes + i,
+				                    x.data() + (i - begin) * 15);
+			fx_val_batch(f_local, x.data(), x.size(), fx.data());
+
+			for (size_t i = 0; i < fx.size(); i++)
+				if (!std::isfinite(fx[i]))
+					is_finite = 0;
+			for (size_t i = begin; i < end; i++)
+				gauss_kronrod_rule(boxes + i,
+				                   fx.data() + (i - begin) * 15);
+
+			fx_free(f_local);
+		});
+
+	return is_finite;
+}
+
+int
+gauss_kronrod_set_up(spnm::gauss_kronrod_t *t)
+{
+	if (!integration_limit_val(t->lower, &(t->a)) ||
+	    !integration_limit_val(t->upper, &(t->b)) ||
+	    !expr_const_val(t->tolerance, &(t->error_max)) ||
+	    !(t->error_max >= 0))
+		return 0;
+
+	if (!t->queue)
+		t->queue = new spnm::gauss_kronrod_queue_t;
+	return 1;
+}
+
+size_t
+gauss_kronrod_intervals_c(const spnm::gauss_kronrod_t *t)
+{
+	return t->queue->heap.size();
+}
+
+int
+gauss_kronrod_get_next(spnm::gauss_kronrod_t *t, std::string *integral,
+                       std::string *error, double *error_val)
+{
+	if (t->deadline_ms > 0 && t->wall_ms >= t->deadline_ms)
+		return spnm::err_deadline;
+
+	auto start = std::chrono::steady_clock::now();
+
+	/* = SUBINTERVALS OF THE ROUND = */
+
+	std::vector<spnm::gauss_kronrod_box_t> &heap = t->queue->heap;
+	std::vector<spnm::gauss_kronrod_box_t>  boxes;
+	if (t->steps_c == 0)
+		boxes.push_back({ t->a, t->b, 0, 0 });
+
+	double width = fabs(t->b - t->a);
+	while (!heap.empty() && boxes.size() < 2 * spnm::GAUSS_KRONROD_ROUND) {
+		spnm::gauss_kronrod_box_t worst = heap.front();
+
+		/* the rest are most likely within their share too */
+		double share = t->error_max * fabs(worst.upper - worst.lower) /
+		               width;
+		if (!boxes.empty() && worst.error <= share)
+			break;
+
+		double mid = (worst.lower + worst.upper) / 2;
+		if (mid == worst.lower || mid == worst.upper)
+			break; /* can't be bisected any more */
+
+		std::pop_heap(heap.begin(), heap.end(), gauss_kronrod_box_less);
+		heap.pop_back();
+		boxes.push_back({ worst.lower, mid, 0, 0 });
+		boxes.push_back({ mid, worst.upper, 0, 0 });
+	}
+
+	/* = INTEGRATION = */
+
+	if (!gauss_kronrod_boxes(t->f, boxes.data(), boxes.size(),
+	                         t->threads_c))
+		return spnm::err_x_input;
+
+	for (const spnm::gauss_kronrod_box_t &box : boxes) {
+		heap.push_back(box);
+		std::push_heap(heap.begin(), heap.end(), gauss_kronrod_box_less);
+	}
+	t->evals_c += 15 * boxes.size();
+
+	double integral_val = 0;
+	*error_val          = 0;
+	for (const spnm::gauss_kronrod_box_t &box : heap) {
+		integral_val += box.integral;
+		*error_val += box.error;
+	}
+
+	t->wall_ms += std::chrono::duration<double, std::milli>(
+			      std::chrono::steady_clock::now() - start)
+	                      .count();
+
+	*integral = approx_string(integral_val);
+	*error    = approx_string(*error_val);
+	return 0;
+}
+
+/* = 3 - ORDINARY DIFFERENTIAL EQUATIONS = */
+
+/* == 1. initial value problems == */
+
+/* dormand-prince 5(4): the nodes, the stages and the weights of the 5th order
+ * solution, which are the last stage, less those of the embedded 4th order
+ * one */
+static const double ode_dp_c[7] = {
+	0, 1.0 / 5, 3.0 / 10, 4.0 / 5, 8.0 / 9, 1, 1,
+};
+static const double ode_dp_a[7][6] = {
+	{ 0 },
+	{ 1.0 / 5 },
+	{ 3.0 / 40, 9.0 / 40 },
+	{ 44.0 / 45, -56.0 / 15, 32.0 / 9 },
+	{ 19372.0 / 6561, -25360.0 / 2187, 64448.0 / 6561, -212.0 / 729 },
+	{ 9017.0 / 3168, -355.0 / 33, 46732.0 / 5247, 49.0 / 176,
+	  -5103.0 / 18656 },
+	{ 35.0 / 384, 0, 500.0 / 1113, 125.0 / 192, -2187.0 / 6784,
+	  11.0 / 84 },
+};
+static const double ode_dp_e[7] = {
+	35.0 / 384 - 5179.0 / 57600,   0,
+	500.0 / 1113 - 7571.0 / 16695, 125.0 / 192 - 393.0 / 640,
+	-2187.0 / 6784 + 92097.0 / 339200, 11.0 / 84 - 187.0 / 2100,
+	-1.0 / 40,
+};
+
+/* Returns f(x, y) of `t`. */
+static double
+ode_f(spnm::ode_t *t, double x, double y)
+{
+	double vars[] = { x, y };
+	return expr_eval(&(t->f->expr), vars, t->f->slots.data());
+}
+
+/* Returns f(x_n, y_n) of `t`, evaluated only once per point. */
+static double
+ode_f_n(spnm::ode_t *t)
+{
+	if (!t->is_f_n) {
+		t->f_n    = ode_f(t, t->x_n, t->y_n);
+		t->is_f_n = 1;
+	}
+	return t->f_n;
+}
+
+/* Returns y_(n+1) of a fixed step of `h` of `t`. */
+static double
+ode_fixed_step(spnm::ode_t *t, double h)
+{
+	double x = t->x_n, y = t->y_n;
+	double k1 = ode_f_n(t);
+
+	switch (t->method) {
+	case spnm::ODE_EULER:
+		return y + h * k1;
+	case spnm::ODE_HEUN: {
+		double k2 = ode_f(t, x + h, y + h * k1);
+		return y + h / 2 * (k1 + k2);
+	}
+	default: {
+		double k2 = ode_f(t, x + h / 2, y + h / 2 * k1);
+		double k3 = ode_f(t, x + h / 2, y + h / 2 * k2);
+		double k4 = ode_f(t, x + h, y + h * k3);
+		return y + h / 6 * (k1 + 2 * k2 + 2 * k3 + k4);
+	}
+	}
+}
+
+/* Takes a dormand-prince step of `h` of `t` to `y_next` with `f_next` being
+ * f(x_n + h, y_next). Returns the estimate of the local error. */
+static double
+ode_dp_step(spnm::ode_t *t, double h, double *y_next, double *f_next)
+{
+	double k[7];
+	k[0] = ode_f_n(t);
+	for (size_t i = 1; i < 7; i++) {
+		double y = t->y_n;
+		for (size_t j = 0; j < i; j++)
+			y += h * ode_dp_a[i][j] * k[j];
+		k[i] = ode_f(t, t->x_n + ode_dp_c[i] * h, y);
+
+		/* the last stage is at the solution itself */
+		if (i == 6)
+			*y_next = y;
+	}
+	*f_next = k[6];
+
+	double error = 0;
+	for (size_t i = 0; i < 7; i++)
+		error += ode_dp_e[i] * k[i];
+	return fabs(h * error);
+}
+
+int
+ode_set_up(spnm::ode_t *t)
 {
+	if (!expr_const_val(t->initial_x, &(t->x_0)) ||
+	    !expr_const_val(t->initial_y, &(t->y_n)) ||
+	    !expr_const_val(t->final_x, &(t->x_end)) ||
+	    !expr_const_val(t->h, &(t->h_0)) || !(t->h_0 != 0) ||
+	    (t->method == spnm::ODE_RK45 &&
+	     (!expr_const_val(t->tolerance, &(t->error_max)) ||
+	      !(t->error_max > 0))))
+		return 0;
+
+	/* stepping towards the final x whatever the sign of h */
+	t->h_0    = t->x_end < t->x_0 ? -fabs(t->h_0) : fabs(t->h_0);
+	t->x_n    = t->x_0;
+	t->h_n    = t->h_0;
+	t->is_f_n = 0;
 	return 1;
 }
 
-/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+int
+ode_get_next(spnm::ode_t *t, std::string *h, std::string *x_n,
+             std::string *y_n, std::string *error, int *is_end)
+{
+	double h_val = 0, x_next = 0, y_next = 0, error_val = 0;
+
+	if (t->method != spnm::ODE_RK45) {
+		/* from x_0 rather than adding up h to not drift, the last
+		 * step ending on the final x */
+		x_next = t->x_0 + (double)(t->steps_c + 1) * t->h_0;
+		*is_end = (x_next - t->x_end) * t->h_0 >=
+		          -1e-9 * t->h_0 * t->h_0;
+		if (*is_end)
+			x_next = t->x_end;
+		h_val  = x_next - t->x_n;
+		y_next = ode_fixed_step(t, h_val);
+		t->is_f_n = 0;
+	} else {
+		double f_next;
+		for (;;) {
+			h_val   = t->h_n;
+			*is_end = (t->x_n + h_val - t->x_end) * h_val >= 0;
+			if (*is_end)
+				h_val = t->x_end - t->x_n;
+			x_next = *is_end ? t->x_end : t->x_n + h_val;
+			if (x_next == t->x_n)
+				return spnm::err_x_input; /* h underflowed */
+
+			error_val = ode_dp_step(t, h_val, &y_next, &f_next);
+			if (!std::isfinite(error_val) || !std::isfinite(y_next))
+				return spnm::err_x_input;
+
+			/* the usual safety factor, h changing by at most 5
+			 * times either way */
+			double factor = 5;
+			if (error_val != 0)
+				factor = std::min(
+					5.0,
+					std::max(0.2, 0.9 * pow(t->error_max /
+				                                        error_val,
+				                                0.2)));
+			if (error_val <= t->error_max) {
+				/* a cut short last step doesn't shrink h */
+				if (!*is_end)
+					t->h_n = h_val * factor;
+				break;
+			}
+			t->h_n = h_val * factor;
+			t->rejected_c++;
+		}
+		t->f_n    = f_next;
+		t->is_f_n = 1;
+	}
+	if (!std::isfinite(y_next))
+		return spnm::err_x_input;
+
+	t->x_n = x_next;
+	t->y_n = y_next;
+
+	*h   = approx_string(h_val);
+	*x_n = approx_string(x_next);
+	*y_n = approx_string(y_next);
+	if (t->method == spnm::ODE_RK45)
+		*error = approx_string(error_val);
+	return 0;
+}
+
+
+/* = 4 - LINEAR SYSTEMS = */
+
+/* == 1. gaussian elimination and lu decomposition == */
+
+int
+elimination_set_up(spnm::elimination_t *t)
+{
+	if (t->a) {
+		/* = PARSE A AND B = */
+
+		std::vector<double> a, b;
+		size_t              n;
+		if (!linear_system_vals(t->a, t->b, &a, &b, &n))
+			return 0;
+
+		free(t->lu);
+		free(t->y);
+		t->rows_c = n;
+		t->lu     = (double *)malloc(n * n * sizeof(double));
+		t->y      = (double *)malloc(n * sizeof(double));
+		std::copy(a.begin(), a.end(), t->lu);
+		std::copy(b.begin(), b.end(), t->y);
+	} else {
+		for (size_t i = 0; i < t->rows_c * t->rows_c; i++)
+			if (!std::isfinite(t->lu[i]))
+				return 0;
+		for (size_t i = 0; i < t->rows_c; i++)
+			if (!std::isfinite(t->y[i]))
+				return 0;
+	}
+	if (t->rows_c == 0)
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	free(t->perm);
+	free(t->steps);
+	t->perm  = (size_t *)malloc(t->rows_c * sizeof(size_t));
+	t->steps = (spnm::elimination_s *)calloc(t->rows_c,
+	                                         sizeof(spnm::elimination_s));
+	return 1;
+}
+
+int
+elimination_get_next(spnm::elimination_t *t, size_t *columns_c,
+                     size_t *pivot, std::string *pivot_val,
+                     char ***snapshot)
+{
+	size_t n = t->rows_c;
+	size_t k = t->steps_c;
+
+	/* = ELIMINATION = */
+
+	*snapshot = NULL;
+	if (t->snapshots) {
+		/* a column at a time, updating the whole matrix */
+		*columns_c = 1;
+		if (!lu_factor_panel(t->lu, n, k, k + 1, n, t->perm, t->y))
+			return spnm::err_singular_matrix;
+	} else {
+		*columns_c = std::min(spnm::ELIMINATION_BLOCK, n - k);
+		size_t k_end = k + *columns_c;
+		if (!lu_factor_panel(t->lu, n, k, k_end, k_end, t->perm, t->y))
+			return spnm::err_singular_matrix;
+		lu_update(t->lu, n, k, k_end, t->threads_c);
+	}
+
+	for (size_t i = 0; i < *columns_c; i++) {
+		pivot[i]     = t->perm[k + i];
+		pivot_val[i] = approx_string(t->lu[(k + i) * n + k + i]);
+	}
+
+	/* = SNAPSHOT = */
+
+	if (!t->snapshots)
+		return 0;
+
+	int    is_gauss = t->method == spnm::ELIMINATION_GAUSS;
+	size_t cols_c   = n + is_gauss;
+	*snapshot       = (char **)malloc(n * cols_c * sizeof(char *));
+	for (size_t i = 0; i < n; i++)
+		for (size_t j = 0; j < cols_c; j++) {
+			double val;
+			if (j == n)
+				val = t->y[i];
+			else if (is_gauss && j < i && j <= k)
+				val = 0; /* eliminated */
+			else
+				val = t->lu[i * n + j];
+			(*snapshot)[i * cols_c + j] =
+				strdup(approx_string(val).c_str());
+		}
+
+	return 0;
+}
+
+int
+elimination_get_x(spnm::elimination_t *t)
+{
+	size_t  n = t->rows_c;
+	double *x = t->y;
+
+	/* U x = y */
+	for (size_t i = n; i-- > 0;) {
+		for (size_t j = i + 1; j < n; j++)
+			x[i] -= t->lu[i * n + j] * x[j];
+		x[i] /= t->lu[i * n + i];
+		if (!std::isfinite(x[i]))
+			return spnm::err_x_input;
+	}
+
+	t->x = (char **)malloc(n * sizeof(char *));
+	for (size_t i = 0; i < n; i++)
+		t->x[i] = strdup(approx_string(x[i]).c_str());
+	return 0;
+}
+
+/* == 2. iterative methods == */
+
+int
+iterative_set_up(spnm::iterative_t *t)
+{
+	spnm::sparse_system_t *s = t->system;
+	size_t                 n = sparse_system_rows_c(s);
+
+	/* every row is solved for its x_i */
+	for (size_t i = 0; i < n; i++) {
+		size_t p = s->diag[i];
+		if (p == s->a.cols.size() || s->a.vals[p] == 0)
+			return 0;
+	}
+
+	t->omega = 1;
+	if (t->method == spnm::ITERATIVE_SOR &&
+	    (!t->relaxation || !expr_const_val(t->relaxation, &(t->omega)) ||
+	     !(t->omega > 0 && t->omega < 2)))
+		return 0;
+
+	t->rows_c     = n;
+	t->correction = 0;
+	t->growths_c  = 0;
+	free(t->x);
+	t->x = (double *)malloc(n * sizeof(double));
+	s->x_next.resize(n);
+	return newton_krylov_set_x(t->initial_point, t->x, n);
+}
+
+/* Returns the value of x_i solving the i-th equation of `s` from `x`, moved
+ * from x_i by the relaxation factor `omega`. */
+static double
+iterative_row_val(const spnm::sparse_system_t *s, const double *x, size_t i,
+                  double omega)
+{
+	const csr_t *a   = &(s->a);
+	double       sum = s->b[i];
+	for (size_t p = a->row_ptr[i]; p < a->row_ptr[i + 1]; p++)
+		if (a->cols[p] != i)
+			sum -= a->vals[p] * x[a->cols[p]];
+
+	/* exactly the gauss-seidel value for omega = 1 */
+	return (1 - omega) * x[i] + omega * (sum / a->vals[s->diag[i]]);
+}
+
+/* Sets x_i of `s->x_next` to `iterative_row_val()` for the rows `first`,
+ * `first` + `stride`, ... on `threads_c` threads. */
+static void
+iterative_rows_next(spnm::sparse_system_t *s, const double *x, size_t first,
+                    size_t stride, double omega, size_t threads_c)
+{
+	size_t n      = s->a.rows_c;
+	size_t rows_c = first < n ? (n - first + stride - 1) / stride : 0;
+
+	parallel_for(rows_c, PARALLEL_GRAIN_ROWS, threads_c,
+	             [&](size_t begin, size_t end) {
+		             for (size_t r = begin; r < end; r++) {
+			             size_t i = first + r * stride;
+			             s->x_next[i] =
+				             iterative_row_val(s, x, i, omega);
+		             }
+	             });
+}
+
+int
+iterative_get_next(spnm::iterative_t *t, char **x_next,
+                   void (*manip)(char *, size_t))
+{
+	spnm::sparse_system_t *s     = t->system;
+	size_t                 n     = t->rows_c;
+	double                *x     = t->x;
+	double                *x_new = s->x_next.data();
+	double                 omega = t->omega;
+
+	/* = STEP = */
+
+	double correction = 0;
+	if (t->method == spnm::ITERATIVE_JACOBI) {
+		iterative_rows_next(s, x, 0, 1, 1, t->threads_c);
+		for (size_t i = 0; i < n; i++)
+			correction =
+				std::max(correction, fabs(x_new[i] - x[i]));
+		std::copy(x_new, x_new + n, x);
+	} else if (t->red_black) {
+		/* the rows of a color all from x and only then into x, so
+		 * that the step doesn't depend on the threads */
+		for (size_t color = 0; color < 2; color++) {
+			iterative_rows_next(s, x, color, 2, omega,
+			                    t->threads_c);
+			for (size_t i = color; i < n; i += 2) {
+				correction = std::max(correction,
+				                      fabs(x_new[i] - x[i]));
+				x[i]       = x_new[i];
+			}
+		}
+	} else {
+		for (size_t i = 0; i < n; i++) {
+			double x_i = iterative_row_val(s, x, i, omega);
+			correction = std::max(correction, fabs(x_i - x[i]));
+			x[i]       = x_i;
+		}
+	}
+
+	double x_max = 0;
+	for (size_t i = 0; i < n; i++) {
+		if (!std::isfinite(x[i]))
+			return spnm::err_x_input;
+		x_max = std::max(x_max, fabs(x[i]));
+	}
+
+	/* = DIVERGENCE = */
+
+	/* corrections down to the round off of x can grow at random once
+	 * converged */
+	if (t->steps_c > 0 && correction > t->correction &&
+	    correction > DBL_EPSILON * x_max)
+		t->growths_c++;
+	else
+		t->growths_c = 0;
+	t->correction = correction;
+	if (t->growths_c == spnm::DIVERGENCE_STEPS)
+		return spnm::err_x_input;
+
+	/* = FORMATTING = */
+
+	size_t process_n = t->process_n;
+	parallel_for(n, PARALLEL_GRAIN_EVAL, t->threads_c,
+	             [&](size_t begin, size_t end) {
+		             for (size_t i = begin; i < end; i++) {
+			             std::string x_i = approx_string(x[i]);
+			             x_next[i]       = strdup(x_i.c_str());
+			             manip(x_next[i], process_n);
+		             }
+	             });
+
+	return 0;
+}
+
+/* == 3. conjugate gradient == */
+
+int
+conjugate_gradient_set_up(spnm::conjugate_gradient_t *t)
+{
+	spnm::sparse_system_t *s = t->system;
+	size_t                 n = sparse_system_rows_c(s);
+
+	t->rows_c = n;
+	free(t->x);
+	t->x = (double *)malloc(n * sizeof(double));
+	if (!newton_krylov_set_x(t->initial_point, t->x, n))
+		return spnm::err_x_input;
+
+	if (!precond_setup(t->precond, &(s->a), &(s->precond)))
+		return spnm::err_singular_matrix;
+
+	/* r = b - A x, z = M^-1 r, p = z */
+	s->r.resize(n);
+	s->z.resize(n);
+	s->q.resize(n);
+	csr_mul(&(s->a), t->x, s->r.data(), t->threads_c);
+	for (size_t i = 0; i < n; i++)
+		s->r[i] = s->b[i] - s->r[i];
+	precond_apply(&(s->precond), s->r.data(), s->z.data());
+	s->p  = s->z;
+	t->rz = dot(s->r.data(), s->z.data(), n, t->threads_c);
+
+	return 0;
+}
+
+int
+conjugate_gradient_get_next(spnm::conjugate_gradient_t *t, std::string *alpha,
+                            std::string *beta, std::string *residual_norm,
+                            std::string *x_norm, int *is_solved)
+{
+	spnm::sparse_system_t *s = t->system;
+	size_t                 n = t->rows_c;
+	double *x = t->x, *r = s->r.data(), *z = s->z.data(), *p = s->p.data(),
+	       *q = s->q.data();
+
+	/* a vanishing residual, on an exact initial point, is done without
+	 * moving */
+	*is_solved = t->rz == 0;
+	double alpha_n = 0, beta_n = 0;
+	if (!*is_solved) {
+		/* = ALONG P = */
+
+		csr_mul(&(s->a), p, q, t->threads_c);
+		double pq = dot(p, q, n, t->threads_c);
+		if (!(pq > 0))
+			return std::isfinite(pq) ? spnm::err_condition_not_met :
+			                           spnm::err_x_input;
+
+		alpha_n = t->rz / pq;
+		parallel_for(n, PARALLEL_GRAIN_ROWS, t->threads_c,
+		             [&](size_t begin, size_t end) {
+			             for (size_t i = begin; i < end; i++) {
+				             x[i] += alpha_n * p[i];
+				             r[i] -= alpha_n * q[i];
+			             }
+		             });
+
+		/* = NEXT DIRECTION = */
+
+		precond_apply(&(s->precond), r, z);
+		double rz = dot(r, z, n, t->threads_c);
+		beta_n    = rz / t->rz;
+		t->rz     = rz;
+		parallel_for(n, PARALLEL_GRAIN_ROWS, t->threads_c,
+		             [&](size_t begin, size_t end) {
+			             for (size_t i = begin; i < end; i++)
+				             p[i] = z[i] + beta_n * p[i];
+		             });
+		*is_solved = rz == 0;
+	}
+
+	double residual_norm_n = sqrt(dot(r, r, n, t->threads_c));
+	double x_norm_n        = sqrt(dot(x, x, n, t->threads_c));
+	if (!std::isfinite(residual_norm_n) || !std::isfinite(x_norm_n) ||
+	    !std::isfinite(beta_n))
+		return spnm::err_x_input;
+
+	*alpha         = approx_string(alpha_n);
+	*beta          = approx_string(beta_n);
+	*residual_norm = approx_string(residual_norm_n);
+	*x_norm        = approx_string(x_norm_n);
+
+	return 0;
+}
+
+/* = 5 - INTERPOLATION = */
+
+/* == 1. newton's and lagrange's interpolation == */
+
+/* Relative difference of the spacings of x taken as equal. */
+const double INTERPOLATION_SPACING = 1e-9;
+
+/* Returns 1 if `x` follows `x_prev` by the spacing `h`. */
+static int
+interpolation_is_spaced(double x, double x_prev, double h)
+{
+	return fabs(x - x_prev - h) <= INTERPOLATION_SPACING * fabs(h);
+}
+
+/* Makes room in the state and the steps of `t` for `points_c` points. */
+static void
+interpolation_reserve(spnm::interpolation_t *t, size_t points_c)
+{
+	if (points_c <= t->points_max)
+		return;
+
+	size_t   max      = std::max(points_c, 2 * t->points_max);
+	double **arrays[] = { &(t->xs),       &(t->ys),    &(t->column),
+		              &(t->diagonal), &(t->coefs), &(t->basis) };
+	for (double **array : arrays)
+		*array = (double *)realloc(*array, max * sizeof(double));
+	t->steps = (spnm::interpolation_s *)realloc(
+		t->steps, max * sizeof(spnm::interpolation_s));
+	t->points_max = max;
+}
+
+/* Returns the factor turning the differences of order `k` of `t` into divided
+ * differences, 1 / (k! h^k) for equally spaced x and else 1. */
+static double
+interpolation_scale(const spnm::interpolation_t *t, size_t k)
+{
+	if (t->method != spnm::INTERPOLATION_FORWARD &&
+	    t->method != spnm::INTERPOLATION_BACKWARD)
+		return 1;
+
+	double h     = t->xs[1] - t->xs[0];
+	double scale = 1;
+	for (size_t i = 1; i <= k; i++)
+		scale /= i * h;
+	return scale;
+}
+
+/* Builds the table of divided differences of `t` for its bottom diagonal and
+ * the newton's form. Returns 0 if a difference isn't finite. */
+static int
+interpolation_divided_table(spnm::interpolation_t *t)
+{
+	size_t  n = t->points_c;
+	double *c = t->column;
+
+	std::copy(t->ys, t->ys + n, c);
+	t->diagonal[0] = c[n - 1];
+	t->coefs[0]    = c[0];
+
+	/* from the bottom up for the order k to take the place of k - 1 */
+	for (size_t k = 1; k < n; k++) {
+		for (size_t i = n - 1; i >= k; i--) {
+			c[i] = (c[i] - c[i - 1]) / (t->xs[i] - t->xs[i - k]);
+			if (!std::isfinite(c[i]))
+				return 0;
+		}
+		t->diagonal[k] = c[n - 1];
+		t->coefs[k]    = c[k];
+	}
+
+	return 1;
+}
+
+/* Appends ';' and `item` to the list `list`. */
+static void
+interpolation_append(char **list, const char *item)
+{
+	size_t len      = strlen(*list);
+	size_t item_len = strlen(item);
+
+	*list        = (char *)realloc(*list, len + item_len + 2);
+	(*list)[len] = ';';
+	memcpy(*list + len + 1, item, item_len + 1);
+}
+
+int
+interpolation_set_up(spnm::interpolation_t *t)
+{
+	/* = PARSE THE POINTS = */
+
+	if (!t->x || !t->y || !t->at)
+		return 0;
+
+	size_t n = 1;
+	for (const char *c = t->x; *c; c++)
+		n += *c == ';';
+	if (n < 2)
+		return 0;
+
+	interpolation_reserve(t, n);
+	if (!linear_row_vals(t->x, ';', t->xs, n) ||
+	    !linear_row_vals(t->y, ';', t->ys, n) ||
+	    !expr_const_val(t->at, &(t->at_val)) || !std::isfinite(t->at_val))
+		return 0;
+
+	int is_spaced = t->method == spnm::INTERPOLATION_FORWARD ||
+	                t->method == spnm::INTERPOLATION_BACKWARD;
+	double h = t->xs[1] - t->xs[0];
+	if (h == 0)
+		return 0;
+	for (size_t i = 1; i < n; i++) {
+		double x = t->xs[i];
+		if (is_spaced ? !interpolation_is_spaced(x, t->xs[i - 1], h) :
+		                std::find(t->xs, t->xs + i, x) != t->xs + i)
+			return 0;
+	}
+
+	/* = FOR FIRST STEP = */
+
+	t->points_c = n;
+	std::copy(t->ys, t->ys + n, t->column);
+	t->diagonal[0] = t->ys[n - 1];
+	t->coefs[0]    = t->ys[0];
+	return 1;
+}
+
+int
+interpolation_get_next(spnm::interpolation_t *t, char ***vals,
+                       size_t *vals_c)
+{
+	size_t  n = t->points_c;
+	size_t  k = t->steps_c + 1;
+	double *c = t->column;
+
+	if (t->method == spnm::INTERPOLATION_LAGRANGE) {
+		/* = TERM = */
+
+		size_t i = k - 1;
+		double l = 1;
+		for (size_t j = 0; j < n; j++)
+			if (j != i)
+				l *= (t->at_val - t->xs[j]) /
+				     (t->xs[i] - t->xs[j]);
+		if (!std::isfinite(l) || !std::isfinite(l * t->ys[i]))
+			return spnm::err_x_input;
+		t->basis[i] = l;
+
+		*vals_c    = 2;
+		*vals      = (char **)malloc(2 * sizeof(char *));
+		(*vals)[0] = strdup(approx_string(l).c_str());
+		(*vals)[1] = strdup(approx_string(l * t->ys[i]).c_str());
+
+		/* the newton's form is only for evaluating */
+		if (k == n && !interpolation_divided_table(t)) {
+			free((*vals)[0]);
+			free((*vals)[1]);
+			free(*vals);
+			return spnm::err_x_input;
+		}
+		return 0;
+	}
+
+	/* = DIFFERENCES = */
+
+	/* the column of order k in place of the one of order k - 1 */
+	int    is_divided = t->method == spnm::INTERPOLATION_DIVIDED;
+	size_t m          = n - k;
+	for (size_t i = 0; i < m; i++) {
+		c[i] = c[i + 1] - c[i];
+		if (is_divided)
+			c[i] /= t->xs[i + k] - t->xs[i];
+		if (!std::isfinite(c[i]))
+			return spnm::err_x_input;
+	}
+	t->diagonal[k] = c[m - 1];
+	t->coefs[k]    = c[0] * interpolation_scale(t, k);
+
+	*vals_c = m;
+	*vals   = (char **)malloc(m * sizeof(char *));
+	for (size_t i = 0; i < m; i++)
+		(*vals)[i] = strdup(approx_string(c[i]).c_str());
+	return 0;
+}
+
+int
+interpolation_get_value(spnm::interpolation_t *t, std::string *value)
+{
+	double y = 0;
+	if (t->method == spnm::INTERPOLATION_LAGRANGE) {
+		/* sum of the terms */
+		for (size_t i = 0; i < t->points_c; i++)
+			y += t->ys[i] * t->basis[i];
+	} else {
+		/* nested multiplication of the newton's form */
+		for (size_t k = t->points_c; k-- > 0;)
+			y = y * (t->at_val - t->xs[k]) + t->coefs[k];
+	}
+	if (!std::isfinite(y))
+		return spnm::err_x_input;
+
+	*value = approx_string(y);
+	return 0;
+}
+
+int
+interpolation_push_point(spnm::interpolation_t *t, const char *x_src,
+                         const char *y_src, char ***vals, size_t *vals_c)
+{
+	size_t n           = t->points_c;
+	int    is_lagrange = t->method == spnm::INTERPOLATION_LAGRANGE;
+
+	/* = PARSE THE POINT = */
+
+	double x, y;
+	if (!x_src || !y_src || !expr_const_val(x_src, &x) ||
+	    !std::isfinite(x) || !expr_const_val(y_src, &y) ||
+	    !std::isfinite(y))
+		return spnm::err_x_input;
+
+	if (t->method == spnm::INTERPOLATION_FORWARD ||
+	    t->method == spnm::INTERPOLATION_BACKWARD) {
+		double h = t->xs[1] - t->xs[0];
+		if (!interpolation_is_spaced(x, t->xs[n - 1], h))
+			return spnm::err_x_input;
+	} else if (std::find(t->xs, t->xs + n, x) != t->xs + n) {
+		return spnm::err_x_input;
+	}
+
+	/* = NEW BOTTOM DIAGONAL = */
+
+	/* every difference from the one of the order below it and the old
+	 * difference of that order above it */
+	int is_divided = is_lagrange ||
+	                 t->method == spnm::INTERPOLATION_DIVIDED;
+	std::vector<double> diagonal(n + 1);
+	diagonal[0] = y;
+	for (size_t k = 1; k <= n; k++) {
+		diagonal[k] = diagonal[k - 1] - t->diagonal[k - 1];
+		if (is_divided)
+			diagonal[k] /= x - t->xs[n - k];
+		if (!std::isfinite(diagonal[k]))
+			return spnm::err_x_input;
+	}
+
+	/* every basis polynomial has the factor of the new point */
+	std::vector<double> basis;
+	if (is_lagrange) {
+		basis.resize(n + 1);
+		basis[n] = 1;
+		for (size_t i = 0; i < n; i++) {
+			basis[i] = t->basis[i] * (t->at_val - x) /
+			           (t->xs[i] - x);
+			basis[n] *= (t->at_val - t->xs[i]) / (x - t->xs[i]);
+		}
+		for (size_t i = 0; i <= n; i++) {
+			double y_i = i < n ? t->ys[i] : y;
+			if (!std::isfinite(basis[i]) ||
+			    !std::isfinite(basis[i] * y_i))
+				return spnm::err_x_input;
+		}
+	}
+
+	/* = ADD THE POINT = */
+
+	interpolation_reserve(t, n + 1);
+	t->xs[n] = x;
+	t->ys[n] = y;
+	std::copy(diagonal.begin(), diagonal.end(), t->diagonal);
+	std::copy(basis.begin(), basis.end(), t->basis);
+	t->points_c = n + 1;
+	t->coefs[n] = diagonal[n] * interpolation_scale(t, n);
+	interpolation_append(&(t->x), x_src);
+	interpolation_append(&(t->y), y_src);
+
+	if (is_lagrange) {
+		*vals_c = 2 * (n + 1);
+		*vals   = (char **)malloc(*vals_c * sizeof(char *));
+		for (size_t i = 0; i <= n; i++) {
+			double l = t->basis[i];
+			(*vals)[2 * i] = strdup(approx_string(l).c_str());
+			(*vals)[2 * i + 1] =
+				strdup(approx_string(l * t->ys[i]).c_str());
+		}
+	} else {
+		*vals_c = n;
+		*vals   = (char **)malloc(n * sizeof(char *));
+		for (size_t k = 1; k <= n; k++)
+			(*vals)[k - 1] =
+				strdup(approx_string(diagonal[k]).c_str());
+	}
+	return 0;
+}
+
+void
+interpolation_push_val(spnm::interpolation_s *step, char *val)
+{
+	/* the room is always a power of 2 */
+	if ((step->vals_c & (step->vals_c - 1)) == 0)
+		step->vals = (char **)realloc(
+			step->vals,
+			std::max((size_t)1, 2 * step->vals_c) * sizeof(char *));
+	step->vals[step->vals_c++] = val;
+}
+
+/* == 2. cubic splines == */
+
+/* Solves for the coefficients of every segment of the `n` points of `t` from
+ * c = S''/2 at the points, which is tridiagonal in c, by the thomas algorithm,
+ * with the slopes `s_0` and `s_n` at the ends for SPLINE_CLAMPED. Returns 0 if
+ * a coefficient isn't finite. */
+static int
+spline_solve(spnm::spline_t *t, size_t n, double s_0, double s_n)
+{
+	const double *x       = t->xs;
+	const double *y       = t->ys;
+	int           clamped = t->ends == spnm::SPLINE_CLAMPED;
+
+	/* = FORWARD ELIMINATION = */
+
+	/* the upper diagonal over the diagonal in `u` and c as eliminated in
+	 * `c`, row by row */
+	std::vector<double> u(n), c(n);
+	for (size_t i = 0; i < n; i++) {
+		double lower = 0, diag = 1, upper = 0, rhs = 0;
+		if (i > 0 && i < n - 1) {
+			double h_prev = x[i] - x[i - 1], h = x[i + 1] - x[i];
+			lower         = h_prev;
+			diag          = 2 * (h_prev + h);
+			upper         = h;
+			rhs = 3 * ((y[i + 1] - y[i]) / h -
+			           (y[i] - y[i - 1]) / h_prev);
+		} else if (clamped && i == 0) {
+			double h = x[1] - x[0];
+			diag     = 2 * h;
+			upper    = h;
+			rhs      = 3 * ((y[1] - y[0]) / h - s_0);
+		} else if (clamped) {
+			double h = x[i] - x[i - 1];
+			lower    = h;
+			diag     = 2 * h;
+			rhs      = 3 * (s_n - (y[i] - y[i - 1]) / h);
+		}
+
+		double m = diag - (i ? lower * u[i - 1] : 0);
+		u[i]     = upper / m;
+		c[i]     = (rhs - (i ? lower * c[i - 1] : 0)) / m;
+	}
+
+	/* = BACK SUBSTITUTION = */
+
+	for (size_t i = n - 1; i-- > 0;)
+		c[i] -= u[i] * c[i + 1];
+
+	/* = COEFFICIENTS = */
+
+	for (size_t i = 0; i + 1 < n; i++) {
+		double  h    = x[i + 1] - x[i];
+		double *coef = t->coefs + 4 * i;
+
+		coef[0] = y[i];
+		coef[1] = (y[i + 1] - y[i]) / h - h * (2 * c[i] + c[i + 1]) / 3;
+		coef[2] = c[i];
+		coef[3] = (c[i + 1] - c[i]) / (3 * h);
+		for (size_t j = 0; j < 4; j++)
+			if (!std::isfinite(coef[j]))
+				return 0;
+	}
+
+	return 1;
+}
+
+int
+spline_set_up(spnm::spline_t *t)
+{
+	free(t->buckets);
+	t->buckets = NULL;
+
+	/* = PARSE THE POINTS = */
+
+	if (t->x) {
+		if (!t->y)
+			return 0;
+
+		size_t n = 1;
+		for (const char *c = t->x; *c; c++)
+			n += *c == ';';
+
+		free(t->xs);
+		free(t->ys);
+		t->points_c = n;
+		t->xs       = (double *)malloc(n * sizeof(double));
+		t->ys       = (double *)malloc(n * sizeof(double));
+		if (!linear_row_vals(t->x, ';', t->xs, n) ||
+		    !linear_row_vals(t->y, ';', t->ys, n))
+			return 0;
+	} else {
+		for (size_t i = 0; i < t->points_c; i++)
+			if (!std::isfinite(t->xs[i]) ||
+			    !std::isfinite(t->ys[i]))
+				return 0;
+	}
+
+	size_t n = t->points_c;
+	if (n < 2 || !t->at || !expr_const_val(t->at, &(t->at_val)) ||
+	    !std::isfinite(t->at_val))
+		return 0;
+	for (size_t i = 1; i < n; i++)
+		if (!(t->xs[i] > t->xs[i - 1]))
+			return 0;
+
+	double slopes[2] = { 0, 0 };
+	if (t->ends == spnm::SPLINE_CLAMPED &&
+	    (!t->slopes || !linear_row_vals(t->slopes, ';', slopes, 2)))
+		return 0;
+
+	/* = COEFFICIENTS = */
+
+	free(t->coefs);
+	t->coefs = (double *)malloc(4 * (n - 1) * sizeof(double));
+	if (!spline_solve(t, n, slopes[0], slopes[1]))
+		return 0;
+
+	/* = FOR FIRST STEP = */
+
+	free(t->steps);
+	t->steps   = (spnm::spline_s *)calloc(n - 1, sizeof(spnm::spline_s));
+	t->buckets = (size_t *)malloc(n * sizeof(size_t));
+	segments_index(t->xs, n - 1, t->buckets);
+	return 1;
+}
+
+void
+spline_get_next(spnm::spline_t *t, std::string *a, std::string *b,
+                std::string *c, std::string *d)
+{
+	const double *coef = t->coefs + 4 * t->steps_c;
+
+	*a = approx_string(coef[0]);
+	*b = approx_string(coef[1]);
+	*c = approx_string(coef[2]);
+	*d = approx_string(coef[3]);
+}
+
+int
+spline_get_value(spnm::spline_t *t, std::string *value)
+{
+	double y;
+	cubic_segments_eval(t->xs, t->coefs, t->points_c - 1, t->buckets,
+	                    &(t->at_val), 1, &y, 1);
+	if (!std::isfinite(y))
+		return spnm::err_x_input;
+
+	*value = approx_string(y);
+	return 0;
+}
+
+void
+spline_unsigned_zero(char *str)
+{
+	if (*str == '-' && strspn(str + 1, "0.") == strlen(str + 1))
+		memmove(str, str + 1, strlen(str));
+}
+
+/* = 6 - CURVE FITTING = */
+
+/* == 1. least squares == */
+
+/* Sums of x^k for k up to 2m and of x^k y for k up to m of a degree m. */
+const size_t FIT_SUMS_MAX = 3 * spnm::FIT_DEGREE_MAX + 2;
+
+/* Pivot of the normal equations, relative to the sum of x^2k on its
+ * diagonal, below which they're taken as singular. */
+const double FIT_PIVOT_MIN = 64 * DBL_EPSILON;
+
+/* Sums over a run of points, kept per lane of `POLYNOMIAL_BLOCK` points so
+ * that the loops over a block vectorize, the lanes being added once the run
+ * is done. */
+struct fit_acc_t {
+	double lanes[FIT_SUMS_MAX][POLYNOMIAL_BLOCK];
+	double x[POLYNOMIAL_BLOCK]; /* points of the block being filled */
+	double y[POLYNOMIAL_BLOCK];
+	size_t block_c;  /* points in the block being filled */
+	size_t points_c; /* points summed */
+	size_t degree;   /* degree m of the fit */
+	int    is_log;   /* 1 if ln y is fitted rather than y */
+	int    is_valid; /* 0 once a point is invalid */
+};
 
-/* == 1. bisection method == */
+static void
+fit_acc_init(fit_acc_t *acc, size_t degree, int is_log)
+{
+	memset(acc->lanes, 0, sizeof(acc->lanes));
+	acc->block_c  = 0;
+	acc->points_c = 0;
+	acc->degree   = degree;
+	acc->is_log   = is_log;
+	acc->is_valid = 1;
+}
 
-bisection_t
-bisection_init(const char *fx, const char *interval_lower,
-               const char *interval_upper, process_t process, size_t process_n)
+/* Adds the powers of x of the points of the block of `acc`, padded with
+ * points of no weight, to its lanes. */
+static void
+fit_acc_flush(fit_acc_t *acc)
 {
-	bisection_t ret;
+	const size_t B = POLYNOMIAL_BLOCK;
+	size_t       m = acc->degree;
+
+	double p[B];
+	for (size_t q = 0; q < B; q++) {
+		int is_point = q < acc->block_c;
+		p[q]         = is_point;
+		acc->x[q]    = is_point ? acc->x[q] : 0;
+		acc->y[q]    = is_point ? acc->y[q] : 0;
+	}
 
-	ret.fx             = spnm_utils::strdup(fx);
-	ret.interval_lower = spnm_utils::strdup(interval_lower);
-	ret.interval_upper = spnm_utils::strdup(interval_upper);
-	ret.process        = process;
-	ret.process_n      = process_n;
+	for (size_t k = 0; k <= 2 * m; k++) {
+		double *sum_x = acc->lanes[k];
+		for (size_t q = 0; q < B; q++)
+			sum_x[q] += p[q];
+		if (k <= m) {
+			double *sum_xy = acc->lanes[2 * m + 1 + k];
+			for (size_t q = 0; q < B; q++)
+				sum_xy[q] += p[q] * acc->y[q];
+		}
+		for (size_t q = 0; q < B; q++)
+			p[q] *= acc->x[q];
+	}
 
-	ret.steps_c = 0;
+	acc->points_c += acc->block_c;
+	acc->block_c = 0;
+}
 
-	return ret;
+static inline void
+fit_acc_push(fit_acc_t *acc, double x, double y)
+{
+	if (acc->is_log)
+		y = y > 0 ? log(y) : NAN;
+	if (!std::isfinite(x) || !std::isfinite(y))
+		acc->is_valid = 0;
+
+	acc->x[acc->block_c] = x;
+	acc->y[acc->block_c] = y;
+	if (++(acc->block_c) == POLYNOMIAL_BLOCK)
+		fit_acc_flush(acc);
 }
 
-int
-bisection_perform(bisection_t *t)
+/* Adds the lanes of `acc` to the `3m + 2` `sums`. */
+static void
+fit_acc_sums(fit_acc_t *acc, double *sums)
 {
-	/* = INIT GIAC = */
+	if (acc->block_c)
+		fit_acc_flush(acc);
+	for (size_t k = 0; k < 3 * acc->degree + 2; k++)
+		for (size_t q = 0; q < POLYNOMIAL_BLOCK; q++)
+			sums[k] += acc->lanes[k][q];
+}
 
-	giac::context ct;
-	giac::logptr(&(t->log), &ct);
+/* Returns 1 if `ch` separates the numbers of a line of a csv file. */
+static inline int
+fit_is_sep(char ch)
+{
+	return ch == ',' || ch == ';' || ch == ' ' || ch == '\t' ||
+	       ch == '\r';
+}
 
-	if (!spnm_utils::giac_fx_parse(t->fx, &ct))
-		return err_fx_parse;
+/* Reads the point of the line [c, line_end) of a csv file into `x` and `y`.
+ * Returns 0 if it isn't one. */
+static int
+fit_csv_point(const char *c, const char *line_end, double *x, double *y)
+{
+	double *vals[2] = { x, y };
+	for (double *val : vals) {
+		while (c < line_end && fit_is_sep(*c))
+			c++;
+		size_t len = 0;
+		while (c + len < line_end && !fit_is_sep(c[len]))
+			len++;
+		if (!mapped_number(c, len, val))
+			return 0;
+		c += len;
+	}
+	while (c < line_end && fit_is_sep(*c))
+		c++;
 
-	/* = CHECK IF CONDITION FOR BISECTION METHOD IS MET = */
+	return c == line_end;
+}
 
-	char *a_n = spnm_utils::strdup(t->interval_lower);
-	char *b_n = spnm_utils::strdup(t->interval_upper);
+/* Sums the points of the csv file `f` with their lines starting in the chunk
+ * [begin, end) into `acc`. A line not being a point is only allowed as the
+ * first one, a header, or blank. */
+static void
+fit_csv_chunk(const mapped_file_t *f, size_t begin, size_t end,
+              fit_acc_t *acc)
+{
+	const char *file_end = f->data + f->size;
+	const char *c        = f->data + begin;
 
-	char fa_sign = spnm_utils::giac_fx_val_sign(t->interval_lower, &ct);
-	char fb_sign = spnm_utils::giac_fx_val_sign(t->interval_upper, &ct);
-	if (fa_sign == '*' || fb_sign == '*')
-		return err_x_input;
-	if (fa_sign == fb_sign)
-		return err_condition_not_met;
+	/* the line started in the chunk before */
+	if (begin > 0 && c[-1] != '\n') {
+		c = (const char *)memchr(c, '\n', file_end - c);
+		c = c ? c + 1 : file_end;
+	}
 
-	/* = BISECTION PROCESS = */
-	size_t steps_c = 0;
-	int    done    = 0;
-	while (!done) {
-		bisection_s *cur_step = t->steps + steps_c;
+	while (c < f->data + end) {
+		const char *line_end =
+			(const char *)memchr(c, '\n', file_end - c);
+		if (!line_end)
+			line_end = file_end;
+
+		double x, y;
+		if (fit_csv_point(c, line_end, &x, &y)) {
+			fit_acc_push(acc, x, y);
+		} else if (c != f->data) {
+			const char *blank = c;
+			while (blank < line_end && fit_is_sep(*blank))
+				blank++;
+			if (blank != line_end)
+				acc->is_valid = 0;
+		}
+		c = line_end + 1;
+	}
+}
 
-		/* arithmetic */
-		SPNM_MANIP(t->process, t->process_n, a_n);
-		SPNM_MANIP(t->process, t->process_n, b_n);
+/* Sums the points of the binary file `f` in the chunk [begin, end), of whole
+ * points, into `acc`. */
+static void
+fit_binary_chunk(const mapped_file_t *f, size_t begin, size_t end,
+                 fit_acc_t *acc)
+{
+	for (size_t i = begin; i < end; i += 2 * sizeof(double)) {
+		double point[2];
+		memcpy(point, f->data + i, sizeof(point));
+		fit_acc_push(acc, point[0], point[1]);
+	}
+}
 
-		std::string c_n_string = spnm_utils::bisection_get_c(a_n, b_n);
-		if (c_n_string == "")
-			return err_x_input;
-		char *c_n = spnm_utils::strdup(c_n_string.c_str());
-		SPNM_MANIP(t->process, t->process_n, c_n);
-		char fc_sign = spnm_utils::giac_fx_val_sign(c_n, &ct);
-		if (fc_sign == '*')
-			return err_x_input;
+/* Sums over the points of the file of `t` into `t->sums`, the chunks of a
+ * round on threads of their own. Returns 0 on error. */
+static int
+fit_read(spnm::fit_t *t)
+{
+	mapped_file_t f;
+	if (!mapped_file_open(t->file, &f)) {
+		t->log << "Can't read '" << t->file << "'" << std::endl;
+		return 0;
+	}
+	int is_binary = t->format == spnm::FIT_BINARY;
+	if (is_binary && f.size % (2 * sizeof(double)) != 0) {
+		t->log << "'" << t->file << "' isn't of whole points"
+		       << std::endl;
+		mapped_file_close(&f);
+		return 0;
+	}
 
-		/* filling data */
-		cur_step->n         = steps_c + 1;
-		cur_step->a_n       = a_n;
-		cur_step->b_n       = b_n;
-		cur_step->fa_n_sign = fa_sign;
-		cur_step->fb_n_sign = fb_sign;
-		cur_step->c_n       = c_n;
-		cur_step->fc_n_sign = fc_sign;
-
-		steps_c++;
-
-		if (steps_c != 1) /* avoid checking on first step */
-			/* following macro modifies 'done' */
-			SPNM_CMP(t->process, t->process_n, cur_step->c_n,
-			         (t->steps + (steps_c - 2))->c_n)
-
-		/* for next step */
-		if (cur_step->fc_n_sign == cur_step->fa_n_sign) {
-			a_n = spnm_utils::strdup(c_n);
-			b_n = spnm_utils::strdup(b_n);
-		} else {
-			a_n = spnm_utils::strdup(a_n);
-			b_n = spnm_utils::strdup(c_n);
+	/* the sums of every chunk of a round, added in order after it, and the
+	 * chunks of a fixed size make the sums the same whatever the
+	 * threads */
+	const size_t        chunk    = spnm::FIT_CHUNK;
+	size_t              m        = t->degree;
+	size_t              sums_c   = 3 * m + 2;
+	size_t              chunks_c = (f.size + chunk - 1) / chunk;
+	int                 is_log   = t->model == spnm::FIT_EXPONENTIAL;
+	std::vector<double> round_sums(spnm::FIT_ROUND * sums_c);
+	std::vector<size_t> round_points(spnm::FIT_ROUND);
+	std::vector<int>    round_valid(spnm::FIT_ROUND);
+	int                 is_valid = 1;
+
+	for (size_t round = 0; round < chunks_c; round += spnm::FIT_ROUND) {
+		size_t round_c = std::min(spnm::FIT_ROUND, chunks_c - round);
+		std::fill(round_sums.begin(), round_sums.end(), 0);
+
+		auto chunks = [&](size_t begin, size_t end) {
+			fit_acc_t acc;
+			for (size_t k = begin; k < end; k++) {
+				size_t from = (round + k) * chunk;
+				size_t to   = std::min(from + chunk, f.size);
+
+				fit_acc_init(&acc, m, is_log);
+				if (is_binary)
+					fit_binary_chunk(&f, from, to, &acc);
+				else
+					fit_csv_chunk(&f, from, to, &acc);
+				fit_acc_sums(&acc, &(round_sums[k * sums_c]));
+				round_points[k] = acc.points_c;
+				round_valid[k]  = acc.is_valid;
+			}
+		};
+		parallel_for(round_c, 1, t->threads_c, chunks);
+
+		for (size_t k = 0; k < round_c; k++) {
+			for (size_t j = 0; j < sums_c; j++)
+				t->sums[j] += round_sums[k * sums_c + j];
+			t->points_c += round_points[k];
+			is_valid = is_valid && round_valid[k];
 		}
+
+		/* the pages of the round are dropped from memory, being read
+		 * again from the file if ever needed */
+		size_t round_begin = round * chunk;
+		size_t round_end   = (round + round_c) * chunk;
+		madvise((void *)(f.data + round_begin),
+		        std::min(f.size, round_end) - round_begin,
+		        MADV_DONTNEED);
 	}
-	t->steps_c = steps_c;
+	mapped_file_close(&f);
 
-	return 0;
+	if (!is_valid)
+		t->log << "Invalid points in '" << t->file << "'" << std::endl;
+	return is_valid;
 }
 
-/* Free's dynamically allocated resources from the struct. */
-void
-bisection_free(bisection_t *t)
+int
+fit_set_up(spnm::fit_t *t)
 {
-	free(t->fx);
-	free(t->interval_lower);
-	free(t->interval_upper);
+	size_t m = t->degree;
+	if (m == 0 || m > spnm::FIT_DEGREE_MAX)
+		return 0;
 
-	for (size_t i = 0; i < t->steps_c; i++) {
-		free(t->steps[i].a_n);
-		free(t->steps[i].b_n);
-		free(t->steps[i].c_n);
+	free(t->sums);
+	t->sums     = (double *)calloc(3 * m + 2, sizeof(double));
+	t->points_c = 0;
+
+	/* = SUMS OVER THE POINTS = */
+
+	if (t->file) {
+		if (!fit_read(t))
+			return 0;
+	} else {
+		if (!t->x || !t->y)
+			return 0;
+
+		size_t n = 1;
+		for (const char *c = t->x; *c; c++)
+			n += *c == ';';
+
+		std::vector<double> x(n), y(n);
+		if (!linear_row_vals(t->x, ';', x.data(), n) ||
+		    !linear_row_vals(t->y, ';', y.data(), n))
+			return 0;
+
+		fit_acc_t acc;
+		fit_acc_init(&acc, m, t->model == spnm::FIT_EXPONENTIAL);
+		for (size_t i = 0; i < n; i++)
+			fit_acc_push(&acc, x[i], y[i]);
+		fit_acc_sums(&acc, t->sums);
+		t->points_c = acc.points_c;
+		if (!acc.is_valid)
+			return 0;
 	}
-}
 
-/* == 2. secant method == */
+	for (size_t k = 0; k < 3 * m + 2; k++)
+		if (!std::isfinite(t->sums[k]))
+			return 0;
 
-secant_t
-secant_init(const char *fx, const char *initial_point1,
-            const char *initial_point2, process_t process, size_t process_n)
-{
-	secant_t ret;
+	/* = FOR FIRST STEP = */
 
-	ret.fx             = spnm_utils::strdup(fx);
-	ret.initial_point1 = spnm_utils::strdup(initial_point1);
-	ret.initial_point2 = spnm_utils::strdup(initial_point2);
-	ret.process        = process;
-	ret.process_n      = process_n;
+	free(t->steps);
+	t->steps = (spnm::fit_s *)calloc(2 * m + 1, sizeof(spnm::fit_s));
+	return 1;
+}
 
-	ret.steps_c = 0;
+void
+fit_get_next(spnm::fit_t *t, std::string *sum_x, std::string *sum_xy)
+{
+	size_t k = t->steps_c;
 
-	return ret;
+	*sum_x  = approx_string(t->sums[k]);
+	*sum_xy = k <= t->degree ?
+	                  approx_string(t->sums[2 * t->degree + 1 + k]) :
+	                  "";
 }
 
 int
-secant_perform(secant_t *t)
+fit_get_coefs(spnm::fit_t *t, char ***coefs, size_t *coefs_c)
 {
-	/* = INIT GIAC = */
+	size_t m = t->degree, n = m + 1;
+	if (t->points_c < n)
+		return spnm::err_singular_matrix;
+
+	/* = NORMAL EQUATIONS = */
+
+	std::vector<double> a(n * n), b(n);
+	std::vector<size_t> perm(n);
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j < n; j++)
+			a[i * n + j] = t->sums[i + j];
+		b[i] = t->sums[2 * m + 1 + i];
+	}
+	/* a pivot lost to the round off is of a singular system too */
+	if (!lu_factor(a.data(), n, perm.data()))
+		return spnm::err_singular_matrix;
+	for (size_t i = 0; i < n; i++)
+		if (fabs(a[i * n + i]) <= FIT_PIVOT_MIN * t->sums[2 * i])
+			return spnm::err_singular_matrix;
+	lu_solve(a.data(), perm.data(), n, b.data());
+
+	/* y = a e^(b x) from ln y = ln a + b x */
+	if (t->model == spnm::FIT_EXPONENTIAL)
+		b[0] = exp(b[0]);
+
+	for (size_t i = 0; i < n; i++)
+		if (!std::isfinite(b[i]))
+			return spnm::err_x_input;
+
+	*coefs_c = n;
+	*coefs   = (char **)malloc(n * sizeof(char *));
+	for (size_t i = 0; i < n; i++)
+		(*coefs)[i] = strdup(approx_string(b[i]).c_str());
 
-	giac::context ct;
-	giac::logptr(&(t->log), &ct);
+	return 0;
+}
 
-	if (!spnm_utils::giac_fx_parse(t->fx, &ct))
-		return err_fx_parse;
+/* = 7 - NUMERICAL DIFFERENTIATION = */
 
-	/* = FOR FIRST STEP = */
+/* == 1. finite differences and richardson == */
 
-	char *x_prev = spnm_utils::strdup(t->initial_point1);
-	char *x_n    = spnm_utils::strdup(t->initial_point2);
-	SPNM_MANIP(t->process, t->process_n, x_prev);
-	SPNM_MANIP(t->process, t->process_n, x_n);
+int
+differentiation_set_up(spnm::differentiation_t *t)
+{
+	if (!expr_const_val(t->x, &(t->x_val)) ||
+	    !std::isfinite(t->x_val) || !expr_const_val(t->h, &(t->h_val)) ||
+	    !std::isfinite(t->h_val) || t->h_val == 0)
+		return 0;
 
-	std::string fx_prev_string =
-		spnm_utils::giac_fx_val_string(x_prev, &ct);
-	if (fx_prev_string == "")
-		return err_x_input;
-	char       *fx_prev     = spnm_utils::strdup(fx_prev_string.c_str());
-	std::string fx_n_string = spnm_utils::giac_fx_val_string(x_n, &ct);
-	if (fx_n_string == "")
-		return err_x_input;
-	char *fx_n = spnm_utils::strdup(fx_n_string.c_str());
-	SPNM_MANIP(t->process, t->process_n, fx_prev);
-	SPNM_MANIP(t->process, t->process_n, fx_n);
-
-	/* = SECANT PROCESS = */
-	size_t steps_c = 0;
-	int    done    = 0;
-	while (!done) {
-		secant_s *cur_step = t->steps + steps_c;
-
-		/* arithmetic */
-		std::string x_next_string = spnm_utils::secant_get_x_next(
-			x_prev, fx_prev, x_n, fx_n);
-		if (x_next_string == "")
-			return err_x_input;
-		char *x_next = spnm_utils::strdup(x_next_string.c_str());
-		SPNM_MANIP(t->process, t->process_n, x_next);
+	/* = NODES OF THE WHOLE TABLE = */
+
+	/* only the nodes the difference takes, f possibly not being defined
+	 * on the other side of x */
+	const size_t steps_max = spnm::DIFFERENTIATION_STEPS_MAX;
+	int          is_plus   = t->difference != spnm::DIFFERENCE_BACKWARD;
+	int          is_minus  = t->difference != spnm::DIFFERENCE_FORWARD;
+	int          is_x      = t->difference != spnm::DIFFERENCE_CENTRAL;
+
+	double x[2 * steps_max + 1], fx[2 * steps_max + 1];
+	size_t nodes_c = 0;
+	if (is_x)
+		x[nodes_c++] = t->x_val;
+	for (size_t k = 0; k < steps_max; k++) {
+		double h = ldexp(t->h_val, -(int)k);
+		if (is_plus)
+			x[nodes_c++] = t->x_val + h;
+		if (is_minus)
+			x[nodes_c++] = t->x_val - h;
+	}
 
-		std::string fx_next_string =
-			spnm_utils::giac_fx_val_string(x_next, &ct);
-		if (fx_next_string == "")
-			return err_x_input;
-		char *fx_next = spnm_utils::strdup(fx_next_string.c_str());
-		SPNM_MANIP(t->process, t->process_n, fx_next);
+	/* = ALL AT ONCE = */
 
-		/* filling data */
-		cur_step->n       = steps_c + 1;
-		cur_step->x_prev  = x_prev;
-		cur_step->fx_prev = fx_prev;
-		cur_step->x_n     = x_n;
-		cur_step->fx_n    = fx_n;
-		cur_step->x_next  = x_next;
-		cur_step->fx_next = fx_next;
+	fx_val_batch(t->f, x, nodes_c, fx);
 
-		steps_c++;
+	size_t i = 0;
+	t->fx_x  = is_x ? fx[i++] : 0;
+	for (size_t k = 0; k < steps_max; k++) {
+		t->fx_plus[k]  = is_plus ? fx[i++] : 0;
+		t->fx_minus[k] = is_minus ? fx[i++] : 0;
+	}
 
-		if (steps_c != 1) /* avoid checking on first step */
-			/* following macro modifies 'done' */
-			SPNM_CMP(t->process, t->process_n, cur_step->x_next,
-			         (t->steps + (steps_c - 2))->x_next)
+	return 1;
+}
 
-		/* for next step */
-		x_prev  = x_n;
-		fx_prev = fx_n;
-		x_n     = x_next;
-		fx_n    = fx_next;
+int
+differentiation_get_next(spnm::differentiation_t *t, std::string *h,
+                         std::string *derivative, std::string *row)
+{
+	size_t k     = t->steps_c;
+	double h_val = ldexp(t->h_val, -(int)k);
+
+	/* = DIFFERENCE = */
+
+	double difference;
+	switch (t->difference) {
+	case spnm::DIFFERENCE_FORWARD:
+		difference = (t->fx_plus[k] - t->fx_x) / h_val;
+		break;
+	case spnm::DIFFERENCE_BACKWARD:
+		difference = (t->fx_x - t->fx_minus[k]) / h_val;
+		break;
+	case spnm::DIFFERENCE_CENTRAL:
+		difference = (t->fx_plus[k] - t->fx_minus[k]) / (2 * h_val);
+		break;
+	default:
+		return spnm::err_x_input;
 	}
-	t->steps_c = steps_c;
+	if (!std::isfinite(difference))
+		return spnm::err_x_input;
+
+	/* = RICHARDSON = */
+
+	double derivative_val = difference;
+	if (t->extrapolation == spnm::EXTRAPOLATION_RICHARDSON) {
+		/* D(k, j) = D(k, j-1) + (D(k, j-1) - D(k-1, j-1)) / (r^j - 1)
+		 */
+		double r = t->difference == spnm::DIFFERENCE_CENTRAL ? 4 : 2;
+		double cur[spnm::DIFFERENTIATION_STEPS_MAX];
+		double factor = 1;
+		cur[0]        = difference;
+		for (size_t j = 1; j <= k; j++) {
+			factor *= r;
+			cur[j] = cur[j - 1] +
+			         (cur[j - 1] - t->richardson[j - 1]) /
+			                 (factor - 1);
+		}
+		for (size_t j = 0; j <= k; j++) {
+			t->richardson[j] = cur[j];
+			row[j]           = approx_string(cur[j]);
+		}
+		derivative_val = cur[k];
+	}
+
+	if (!std::isfinite(derivative_val))
+		return spnm::err_x_input;
 
+	*h          = approx_string(h_val);
+	*derivative = approx_string(derivative_val);
 	return 0;
 }
 
-void
-secant_free(secant_t *t)
+/* = 8 - EIGENVALUES = */
+
+/* == 1. power method and inverse iteration == */
+
+int
+power_iteration_set_up(spnm::power_iteration_t *t)
 {
-	free(t->fx);
-	free(t->initial_point1);
-	free(t->initial_point2);
+	if (t->a) {
+		/* = PARSE A AND X_0 = */
+
+		std::vector<double> a, x;
+		size_t              n;
+		if (!linear_system_vals(t->a, t->initial_vector, &a, &x, &n))
+			return spnm::err_x_input;
+
+		free(t->shifted);
+		free(t->x);
+		t->rows_c  = n;
+		t->shifted = (double *)malloc(n * n * sizeof(double));
+		t->x       = (double *)malloc(n * sizeof(double));
+		std::copy(a.begin(), a.end(), t->shifted);
+		std::copy(x.begin(), x.end(), t->x);
+	} else {
+		for (size_t i = 0; i < t->rows_c * t->rows_c; i++)
+			if (!std::isfinite(t->shifted[i]))
+				return spnm::err_x_input;
+		for (size_t i = 0; i < t->rows_c; i++)
+			if (!std::isfinite(t->x[i]))
+				return spnm::err_x_input;
+	}
+	size_t n = t->rows_c;
+	if (n == 0 || std::all_of(t->x, t->x + n,
+	                          [](double x_i) { return x_i == 0; }))
+		return spnm::err_x_input;
+
+	/* = A - S I = */
+
+	if (!expr_const_val(t->shift, &(t->shift_val)) ||
+	    !std::isfinite(t->shift_val))
+		return spnm::err_x_input;
+	for (size_t i = 0; i < n; i++)
+		t->shifted[i * n + i] -= t->shift_val;
+
+	free(t->y);
+	t->y = (double *)malloc(n * sizeof(double));
+	if (t->method != spnm::POWER_INVERSE)
+		return 0;
 
-	size_t i;
-	for (i = 0; i < t->steps_c; i++) {
-		free(t->steps[i].x_prev);
-		free(t->steps[i].fx_prev);
+	/* blocked as of `spnm::elimination_perform()` */
+	free(t->perm);
+	t->perm = (size_t *)malloc(n * sizeof(size_t));
+	for (size_t k = 0; k < n; k += spnm::ELIMINATION_BLOCK) {
+		size_t k_end = std::min(k + spnm::ELIMINATION_BLOCK, n);
+		if (!lu_factor_panel(t->shifted, n, k, k_end, k_end, t->perm,
+		                     NULL))
+			return spnm::err_singular_matrix;
+		lu_update(t->shifted, n, k, k_end, t->threads_c);
 	}
-	free(t->steps[i - 1].x_n);
-	free(t->steps[i - 1].fx_n);
-	free(t->steps[i - 1].x_next);
-	free(t->steps[i - 1].fx_next);
+
+	return 0;
 }
 
-} /* namespace spnm */
+int
+power_iteration_get_next(spnm::power_iteration_t *t, std::string *eigenvalue,
+                         std::string bounds[2], char **x_next,
+                         void (*manip)(char *, size_t))
+{
+	size_t  n = t->rows_c;
+	double *x = t->x;
+	double *y = t->y;
+
+	/* = STEP = */
+
+	if (t->method == spnm::POWER_INVERSE) {
+		std::copy(x, x + n, y);
+		lu_solve(t->shifted, t->perm, n, y);
+	} else {
+		/* rows of about as many entries as `PARALLEL_GRAIN_ROWS`
+		 * sparse rows per thread */
+		const double *a = t->shifted;
+		parallel_for(n, PARALLEL_GRAIN_ROWS / n + 1, t->threads_c,
+		             [&](size_t begin, size_t end) {
+			             for (size_t i = begin; i < end; i++) {
+				             const double *row = a + i * n;
+				             double        sum = 0;
+				             for (size_t j = 0; j < n; j++)
+					             sum += row[j] * x[j];
+				             y[i] = sum;
+			             }
+		             });
+	}
 
-/*
- ===============================================================================
- |                                    Utils                                    |
- ===============================================================================
- */
+	/* scaled by the first entry of the largest magnitude */
+	size_t largest = 0;
+	for (size_t i = 1; i < n; i++)
+		if (fabs(y[i]) > fabs(y[largest]))
+			largest = i;
+	double m      = y[largest];
+	double x_max  = 0;
+	double x_diff = 0;
+	for (size_t i = 0; i < n; i++) {
+		double x_i = y[i] / m;
+		if (!std::isfinite(x_i))
+			return spnm::err_x_input;
+		x_max  = std::max(x_max, fabs(x[i]));
+		x_diff = std::max(x_diff, fabs(x_i - x[i]));
+		x[i]   = x_i;
+	}
 
-namespace spnm_utils
-{
+	/* (A - s I) x_n - m x_n = m (x_(n+1) - x_n) for POWER_DIRECT and
+	 * (A - s I) x_(n+1) - x_(n+1) / m = (x_n - x_(n+1)) / m for
+	 * POWER_INVERSE */
+	double residual = t->method == spnm::POWER_INVERSE ?
+	                          x_diff / fabs(m) :
+	                          fabs(m) * x_diff / x_max;
+
+	double eigenvalue_val = t->method == spnm::POWER_INVERSE ?
+	                                t->shift_val + 1 / m :
+	                                m + t->shift_val;
+	if (!std::isfinite(eigenvalue_val))
+		return spnm::err_x_input;
+
+	/* = FORMATTING = */
+
+	*eigenvalue      = approx_string(eigenvalue_val);
+	bounds[0]        = approx_string(eigenvalue_val - residual);
+	bounds[1]        = approx_string(eigenvalue_val + residual);
+	size_t process_n = t->process_n;
+	parallel_for(n, PARALLEL_GRAIN_EVAL, t->threads_c,
+	             [&](size_t begin, size_t end) {
+		             for (size_t i = begin; i < end; i++) {
+			             std::string x_i = approx_string(x[i]);
+			             x_next[i]       = strdup(x_i.c_str());
+			             manip(x_next[i], process_n);
+		             }
+	             });
 
-/* = STRING = */
+	return 0;
+}
 
-char *
-strdup(const char *str)
-{
-	size_t str_len = strlen(str) + 1;
+/* == 2. qr algorithm == */
 
-	char *out = (char *)malloc(str_len);
-	memcpy(out, str, str_len);
+/* Returns the first row of the unreduced block of `t->h` ending at the row
+ * `t->hi` - 1, setting the negligible subdiagonal entry above it to 0. */
+static size_t
+qr_algorithm_block_lo(spnm::qr_algorithm_t *t)
+{
+	double *h = t->h;
+	size_t  n = t->rows_c;
+
+	size_t l = t->hi - 1;
+	for (; l > 0; l--) {
+		double s = fabs(h[(l - 1) * n + l - 1]) + fabs(h[l * n + l]);
+		if (s == 0)
+			s = t->norm;
+		if (fabs(h[l * n + l - 1]) <= DBL_EPSILON * s) {
+			h[l * n + l - 1] = 0;
+			break;
+		}
+	}
 
-	return out;
+	return l;
 }
 
-/* = GIAC = */
+/* Finds the eigenvalues off the 1 x 1 and 2 x 2 blocks split off the end of
+ * the rows of `t` left, setting the block to sweep next. */
+static void
+qr_algorithm_deflate(spnm::qr_algorithm_t *t)
+{
+	double *h = t->h;
+	size_t  n = t->rows_c;
+
+	while (t->hi > 0) {
+		size_t hi = t->hi;
+		size_t l  = qr_algorithm_block_lo(t);
+
+		if (l + 1 == hi) {
+			t->wr[hi - 1] = h[(hi - 1) * n + hi - 1];
+			t->wi[hi - 1] = 0;
+			t->hi -= 1;
+		} else if (l + 2 == hi) {
+			/* the eigenvalues of [a, b; c, d], d + p +- sqrt(q) */
+			double a  = h[(hi - 2) * n + hi - 2];
+			double b  = h[(hi - 2) * n + hi - 1];
+			double c  = h[(hi - 1) * n + hi - 2];
+			double d  = h[(hi - 1) * n + hi - 1];
+			double p  = (a - d) / 2;
+			double bc = b * c;
+			double q  = p * p + bc;
+			if (q >= 0) {
+				/* the root of the larger magnitude first for
+				 * the other not to cancel */
+				double z = p < 0 ? p - sqrt(q) : p + sqrt(q);
+				t->wr[hi - 2] = d + z;
+				t->wr[hi - 1] = z != 0 ? d - bc / z : d;
+				t->wi[hi - 2] = 0;
+				t->wi[hi - 1] = 0;
+			} else {
+				t->wr[hi - 2] = d + p;
+				t->wr[hi - 1] = d + p;
+				t->wi[hi - 2] = sqrt(-q);
+				t->wi[hi - 1] = -sqrt(-q);
+			}
+			t->hi -= 2;
+		} else {
+			t->lo = l;
+			return;
+		}
+		t->sweeps_c = 0;
+	}
+}
 
-int
-giac_fx_parse(const char *fx, giac::context *ct)
+/* Takes the householder reflector I - beta v v^T of the `C` entries of `v`
+ * from the left of the rows [k, k + C) of `h` over the columns [j0, j1) and
+ * then from the right of its columns [k, k + C) over the rows [i0, i1). */
+template <size_t C>
+static void
+qr_algorithm_reflect(double *h, size_t n, size_t k, const double *v,
+                     double beta, size_t j0, size_t j1, size_t i0, size_t i1)
 {
-	/* construct f(x) */
-	std::string expr = "f(x) := ";
-	expr += fx;
+	double *rows[C];
+	for (size_t p = 0; p < C; p++)
+		rows[p] = h + (k + p) * n;
+
+	for (size_t j = j0; j < j1; j++) {
+		double s = 0;
+		for (size_t p = 0; p < C; p++)
+			s += v[p] * rows[p][j];
+		s *= beta;
+		for (size_t p = 0; p < C; p++)
+			rows[p][j] -= s * v[p];
+	}
 
-	giac::eval(giac::gen(expr, ct), 1, ct);
-	if (giac::first_error_line(ct))
-		return 0;
-	return 1;
+	for (size_t i = i0; i < i1; i++) {
+		double *row = h + i * n + k;
+		double  s   = 0;
+		for (size_t p = 0; p < C; p++)
+			s += row[p] * v[p];
+		s *= beta;
+		for (size_t p = 0; p < C; p++)
+			row[p] -= s * v[p];
+	}
 }
 
-std::string
-giac_fx_val_string(const char *x, giac::context *ct)
+/* Reflectors of a sweep chased at once, their products with the rows above
+ * the bulge and with the columns past it being delayed to a single pass over
+ * each. */
+const size_t QR_BATCH = 32;
+
+/* Least number of rows or columns of a delayed product worth a thread of
+ * their own. */
+const size_t QR_GRAIN = 512;
+
+/* Rows of a delayed product from the right reflected at once. */
+const size_t QR_ROWS = 4;
+
+/* Takes the `b_c` reflectors `v` and `beta` chased from the row `k0` from the
+ * left of the columns [j0, j1) of `h`, `LU_CHUNK` columns at a time for the
+ * rows of the chunk to stay in the cache through all the reflectors. */
+static void
+qr_algorithm_delayed_left(double *h, size_t n, size_t k0, const double (*v)[3],
+                          const double *beta, size_t b_c, size_t j0, size_t j1,
+                          size_t threads_c)
 {
-	/* creating string off the double makes it easier to deal with very
-	 * small numbers -- avoid 6e-09 case for example. */
-	double val = giac_fx_val_double(x, ct);
-	if (std::isnan(val))
-		return "";
+	size_t chunks_c = (j1 - j0) / LU_CHUNK;
+
+	/* chunks of a fixed size, which the compiler vectorizes even at -O2 */
+	auto chunks = [&](size_t begin, size_t end) {
+		for (size_t chunk = begin; chunk < end; chunk++) {
+			double *col = h + k0 * n + j0 + chunk * LU_CHUNK;
+			for (size_t b = 0; b < b_c; b++, col += n) {
+				const double *u  = v[b];
+				double       *r0 = col, *r1 = r0 + n;
+				double       *r2 = r1 + n;
+				double        s[LU_CHUNK];
+				for (size_t q = 0; q < LU_CHUNK; q++)
+					s[q] = (u[0] * r0[q] + u[1] * r1[q] +
+					        u[2] * r2[q]) *
+					       beta[b];
+				for (size_t q = 0; q < LU_CHUNK; q++) {
+					r0[q] -= s[q] * u[0];
+					r1[q] -= s[q] * u[1];
+					r2[q] -= s[q] * u[2];
+				}
+			}
+		}
+	};
+	parallel_for(chunks_c, QR_GRAIN / LU_CHUNK, threads_c, chunks);
 
-	/* get for example "4.000000" as "4" */
-	if (std::floor(val) == val)
-		return std::to_string((int)val);
-	return std::to_string(val);
+	/* the columns left */
+	for (size_t b = 0; b < b_c; b++)
+		qr_algorithm_reflect<3>(h, n, k0 + b, v[b], beta[b],
+		                        j0 + chunks_c * LU_CHUNK, j1, 0, 0);
 }
 
-double
-giac_fx_val_double(const char *x, giac::context *ct)
+/* Takes the `b_c` reflectors `v` and `beta` chased from the row `k0` from the
+ * right of the rows [i0, i1) of `h`, `QR_ROWS` rows at a time for their
+ * reflections to overlap. */
+static void
+qr_algorithm_delayed_right(double *h, size_t n, size_t k0,
+                           const double (*v)[3], const double *beta,
+                           size_t b_c, size_t i0, size_t i1, size_t threads_c)
 {
-	std::string input = "approx(f(";
-	input += x;
-	input += "))";
-
-	giac::gen f = giac::eval(giac::gen(input, ct), 1, ct);
+	size_t groups_c = (i1 - i0) / QR_ROWS;
+
+	auto groups = [&](size_t begin, size_t end) {
+		for (size_t group = begin; group < end; group++) {
+			double *row = h + (i0 + group * QR_ROWS) * n + k0;
+			double *rows[QR_ROWS];
+			for (size_t g = 0; g < QR_ROWS; g++)
+				rows[g] = row + g * n;
+			for (size_t b = 0; b < b_c; b++) {
+				double s[QR_ROWS];
+				for (size_t g = 0; g < QR_ROWS; g++)
+					s[g] = (rows[g][b] * v[b][0] +
+					        rows[g][b + 1] * v[b][1] +
+					        rows[g][b + 2] * v[b][2]) *
+					       beta[b];
+				for (size_t g = 0; g < QR_ROWS; g++) {
+					rows[g][b] -= s[g] * v[b][0];
+					rows[g][b + 1] -= s[g] * v[b][1];
+					rows[g][b + 2] -= s[g] * v[b][2];
+				}
+			}
+		}
+	};
+	parallel_for(groups_c, QR_GRAIN / QR_ROWS, threads_c, groups);
 
-	return f.to_double(ct);
+	/* the rows left */
+	for (size_t b = 0; b < b_c; b++)
+		qr_algorithm_reflect<3>(h, n, k0 + b, v[b], beta[b], 0, 0,
+		                        i0 + groups_c * QR_ROWS, i1);
 }
 
-char
-giac_fx_val_sign(const char *x, giac::context *ct)
+/* Performs a francis double shift sweep over the rows and columns [l, m] of
+ * `t->h`, only the block being updated as only its eigenvalues are wanted.
+ *
+ * The reflectors are chased `QR_BATCH` at a time, each being taken at once
+ * only from the rows and columns the next ones are computed from, and then
+ * all of them from the rows above and the columns past the batch. Every entry
+ * goes through the same operations in the same order as one reflector after
+ * another, whatever the threads. */
+static void
+qr_algorithm_sweep(spnm::qr_algorithm_t *t, size_t l, size_t m)
 {
-	double val = giac_fx_val_double(x, ct);
-	if (std::isnan(val))
-		return '*';
+	double *h = t->h;
+	size_t  n = t->rows_c;
+
+	/* = SHIFTS = */
+
+	/* the sum s and the product p of the eigenvalues of the trailing 2 x 2
+	 * block, or made up every 10 sweeps to break out of a cycle */
+	double s, p;
+	if (t->sweeps_c == 10 || t->sweeps_c == 20) {
+		double e = fabs(h[m * n + m - 1]) +
+		           fabs(h[(m - 1) * n + m - 2]);
+		s        = 1.5 * e;
+		p        = e * e;
+	} else {
+		s = h[(m - 1) * n + m - 1] + h[m * n + m];
+		p = h[(m - 1) * n + m - 1] * h[m * n + m] -
+		    h[(m - 1) * n + m] * h[m * n + m - 1];
+	}
 
-	if (val < 0)
-		return '-';
-	return '+';
-}
+	/* the first column of (H - s_1 I)(H - s_2 I) */
+	const double *h_l  = h + l * n;
+	const double *h_l1 = h_l + n;
+	double        u[3];
+	u[0] = h_l[l] * h_l[l] + h_l[l + 1] * h_l1[l] - s * h_l[l] + p;
+	u[1] = h_l1[l] * (h_l[l] + h_l1[l + 1] - s);
+	u[2] = h_l1[l] * h_l1[n + l + 1];
+
+	/* = BULGE CHASE = */
+
+	double v[QR_BATCH][3], beta[QR_BATCH];
+	for (size_t k0 = l; k0 + 2 <= m; k0 += QR_BATCH) {
+		size_t k1    = std::min(k0 + QR_BATCH, m - 1);
+		size_t j_end = std::min(k1 + 2, m + 1);
+
+		for (size_t k = k0; k < k1; k++) {
+			size_t b = k - k0;
+			householder_vector(u, 3, v[b], beta + b);
+
+			/* the rows above k0 and the columns from j_end on are
+			 * neither read nor written by the rest of the batch */
+			size_t q = k > l ? k - 1 : l;
+			size_t r = std::min(k + 3, m);
+			qr_algorithm_reflect<3>(h, n, k, v[b], beta[b], q,
+			                        j_end, k0, r + 1);
+			if (k > l) {
+				h[(k + 1) * n + k - 1] = 0;
+				h[(k + 2) * n + k - 1] = 0;
+			}
+
+			u[0] = h[(k + 1) * n + k];
+			u[1] = h[(k + 2) * n + k];
+			if (k + 3 <= m)
+				u[2] = h[(k + 3) * n + k];
+		}
 
-/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
+		qr_algorithm_delayed_left(h, n, k0, v, beta, k1 - k0, j_end,
+		                          m + 1, t->threads_c);
+		qr_algorithm_delayed_right(h, n, k0, v, beta, k1 - k0, l, k0,
+		                           t->threads_c);
+	}
 
-/* == 1. bisection == */
+	double v_m[2], beta_m;
+	householder_vector(u, 2, v_m, &beta_m);
+	qr_algorithm_reflect<2>(h, n, m - 1, v_m, beta_m, m - 2, m + 1, l,
+	                        m + 1);
+	h[m * n + m - 2] = 0;
+}
 
-std::string
-bisection_get_c(const char *a, const char *b)
+int
+qr_algorithm_set_up(spnm::qr_algorithm_t *t)
 {
-	giac::context ct;
+	if (t->a) {
+		/* = PARSE A = */
+
+		std::vector<double> a;
+		size_t              n;
+		if (!matrix_vals(t->a, &a, &n))
+			return 0;
+
+		free(t->h);
+		t->rows_c = n;
+		t->h      = (double *)malloc(n * n * sizeof(double));
+		std::copy(a.begin(), a.end(), t->h);
+	} else {
+		for (size_t i = 0; i < t->rows_c * t->rows_c; i++)
+			if (!std::isfinite(t->h[i]))
+				return 0;
+	}
+	if (t->rows_c == 0)
+		return 0;
 
-	/* construct formula */
-	std::string formula = "approx(((";
-	formula += a;
-	formula += ") + (";
-	formula += b;
-	formula += ")) / 2)";
+	/* = HESSENBERG FORM = */
 
-	giac::gen c = giac::eval(giac::gen(formula, &ct), 1, &ct);
-	if (giac::first_error_line(&ct))
-		return "";
+	size_t n = t->rows_c;
+	hessenberg_reduce(t->h, n, t->threads_c);
 
-	return c.print();
-}
+	t->norm = 0;
+	for (size_t i = 0; i < n; i++)
+		for (size_t j = i ? i - 1 : 0; j < n; j++)
+			t->norm += fabs(t->h[i * n + j]);
 
-/* == 2. secant == */
+	/* = FOR FIRST STEP = */
 
-std::string
-secant_get_x_next(const char *x_prev, const char *fx_prev, const char *x_n,
-                  const char *fx_n)
+	free(t->wr);
+	free(t->wi);
+	t->wr       = (double *)calloc(n, sizeof(double));
+	t->wi       = (double *)calloc(n, sizeof(double));
+	t->hi       = n;
+	t->sweeps_c = 0;
+	qr_algorithm_deflate(t);
+
+	return 1;
+}
+
+int
+qr_algorithm_get_next(spnm::qr_algorithm_t *t, size_t *active,
+                      std::string *subdiagonal)
 {
-	giac::context ct;
+	if (t->sweeps_c == spnm::QR_SWEEPS_MAX)
+		return spnm::err_steps_max;
+
+	/* room for the step */
+	if (t->steps_c == t->steps_max) {
+		t->steps_max = std::max((size_t)16, 2 * t->steps_max);
+		t->steps     = (spnm::qr_algorithm_s *)realloc(
+			t->steps, t->steps_max * sizeof(spnm::qr_algorithm_s));
+	}
 
-	/* construct formula */
-	std::string formula = "approx((((";
-	formula += x_prev;
-	formula += ") * (";
-	formula += fx_n;
-	formula += ")) - ((";
-	formula += x_n;
-	formula += ") * (";
-	formula += fx_prev;
-	formula += "))) / ((";
-	formula += fx_n;
-	formula += ") - (";
-	formula += fx_prev;
-	formula += ")))";
+	/* = SWEEP = */
 
-	giac::gen c = giac::eval(giac::gen(formula, &ct), 1, &ct);
-	if (giac::first_error_line(&ct))
-		return "";
+	qr_algorithm_sweep(t, t->lo, t->hi - 1);
+	t->sweeps_c++;
+	qr_algorithm_deflate(t);
 
-	return c.print();
+	size_t n     = t->rows_c;
+	*active      = t->hi;
+	*subdiagonal = approx_string(
+		t->hi > 1 ? fabs(t->h[(t->hi - 1) * n + t->hi - 2]) : 0);
+	return 0;
 }
 
+void
+qr_algorithm_get_eigenvalues(spnm::qr_algorithm_t *t)
+{
+	size_t n = t->rows_c;
+
+	t->re = (char **)malloc(n * sizeof(char *));
+	t->im = (char **)malloc(n * sizeof(char *));
+	for (size_t i = 0; i < n; i++) {
+		t->re[i] = strdup(approx_string(t->wr[i]).c_str());
+		t->im[i] = strdup(approx_string(t->wi[i]).c_str());
+	}
+}
 } /* namespace spnm_utils */
 
 #endif /* SPNM_IMPL */
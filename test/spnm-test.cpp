@@ -23,6 +23,16 @@
 #include <iostream>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <type_traits>
+#include <unistd.h>
 
 /* spnm - https://github.com/mrsafalpiya/spnm */
 #define SPNM_IMPL
@@ -37,107 +47,2168 @@
 #define GRN   "\x1B[32m"
 #define RESET "\x1B[0m"
 
+/* defaults */
+#define BUDGET_MS_DEFAULT 1000 /* latency budget of a single case */
+
 /* test */
-size_t test_failed_c = 0;
+struct test_case {
+	/* === input === */
+	const char     *fx; /* f(x), ';' separated f_i for systems, A for
+	                       linear systems and eigenvalues, x for
+	                       interpolations and fits */
+	spnm::process_t process;
+	size_t          process_n;
+	const char     *correct;
+	std::function<void(test_case *)> test; /* test of the method with
+	                                          its own inputs */
+
+	/* === output === */
+	size_t      failed_c; /* number of failed checks */
+	std::string log;      /* messages of the failed checks */
+	double      time_ms;  /* wall time of the case */
+};
+
+/* = CHECKS = */
+
+/* Checks the output `out` of the method `name` of `c` against `correct`. */
+void
+check_output(test_case *c, const std::string &name, const std::string &out,
+             const std::string &correct)
+{
+	if (out == correct)
+		return;
+
+	c->log += RED "FAILED " + name + " for '" + std::string(c->fx) +
+	          "':\n" RESET;
+	c->log += RED + out + RESET;
+	c->log += GRN + correct + "\n" RESET;
+	c->failed_c++;
+}
+
+/* Checks the output of `run` on 1 and on 4 threads for the method `name` of
+ * `c` against `correct`, or against each other and for not being "" if
+ * `correct` is NULL. */
+void
+check_threads(test_case *c, const std::string &name,
+              const std::function<std::string(size_t)> &run,
+              const char *correct)
+{
+	if (correct) {
+		for (size_t threads_c : { 1, 4 })
+			check_output(c,
+			             name + " on " + std::to_string(threads_c) +
+			                     " threads",
+			             run(threads_c), correct);
+		return;
+	}
+
+	std::string serial_out = run(1);
+	if (serial_out == "" || run(4) != serial_out) {
+		c->log += RED "FAILED " + name + " on 4 threads for '" +
+		          std::string(c->fx) + "'\n" RESET;
+		c->failed_c++;
+	}
+}
+
+/* The type of the steps of the method of `T`. */
+template <typename T>
+using step_of = typename std::remove_reference<decltype(
+	std::declval<T &>().steps[0])>::type;
+
+/* Checks the method `name` of `c` both performed and with its steps lazily
+ * computed by `steps`, on the instances returned by `init()`: the output of
+ * `format`, "" on an error, should be `correct` either way. The performing is
+ * done on 1 and on 4 threads if `threads_c` isn't NULL. */
+template <typename T, int (*STEP)(T *), typename Init, typename Format>
+void
+check_method(test_case *c, const std::string &name, const std::string &correct,
+             Init init, int (*perform)(T *),
+             spnm::steps_range<T, step_of<T>, STEP> (*steps)(T *),
+             void (*free)(T *), Format format, size_t T::*threads_c = NULL)
+{
+	auto run = [&](size_t threads_c_val) {
+		T t = init();
+		if (threads_c)
+			t.*threads_c = threads_c_val;
+
+		std::string out = perform(&t) == 0 ? format(&t) : "";
+		free(&t);
+		return out;
+	};
+	if (threads_c)
+		check_threads(c, name, run, correct.c_str());
+	else
+		check_output(c, name, run(0), correct);
+
+	/* lazily computed steps should be the same */
+	T    t          = init();
+	auto lazy_steps = steps(&t);
+	for (const step_of<T> &step : lazy_steps)
+		(void)step;
+
+	check_output(c, "lazy " + name, lazy_steps.err ? "" : format(&t),
+	             correct);
+	free(&t);
+
+	/* steps resumed twice and then performed should be the same too */
+	T resumed = init();
+	for (size_t stop_c : { 1, 3 }) {
+		auto resumed_steps = steps(&resumed);
+		for (const step_of<T> &step : resumed_steps) {
+			(void)step;
+			if (resumed.steps_c >= stop_c)
+				break;
+		}
+	}
+	check_output(c, "resumed " + name,
+	             perform(&resumed) == 0 ? format(&resumed) : "", correct);
+	free(&resumed);
+}
+
+/* = COMPARISON = */
+
+struct is_equal_case {
+	const char *input2; /* compared to `fx` */
+};
+
+/* Checks the comparison of `fx` to `input2` up to n decimal places or
+ * significant digits. */
+void
+test_is_equal(test_case *c, const is_equal_case &in)
+{
+	int is_equal =
+		c->process == spnm::DECIMAL_PLACES ?
+			spl_maths_is_equal_deci_str(c->fx, in.input2,
+		                                    c->process_n) :
+			spl_maths_is_equal_signi_str(c->fx, in.input2,
+		                                     c->process_n);
+	check_output(c, "comparison to '" + std::string(in.input2) + "'",
+	             std::to_string(is_equal) + "\n", c->correct);
+}
+
+/* = EXPRESSION = */
+
+struct expr_optimize_case {
+	const char *p; /* value of the parameter p */
+};
+
+/* Checks the instructions of f(x; p) compiled, optimized and invariant among
+ * those and the values of the optimized f against those of the compiled one
+ * from -4 to 4. */
+void
+test_expr_optimize(test_case *c, const expr_optimize_case &in)
+{
+	const char        *vars[] = { "x", "p" };
+	spnm_utils::expr_t expr, opt;
+	if (!spnm_utils::expr_compile(c->fx, vars, 2, &expr)) {
+		c->log += RED "FAILED compiling '" + std::string(c->fx) +
+		          "'\n" RESET;
+		c->failed_c++;
+		return;
+	}
+	opt = expr;
+	spnm_utils::expr_optimize(&opt, 1);
+
+	char buffer[1024];
+	sprintf(buffer, "%lu\t%lu\t%lu\n", expr.ins.size(), opt.ins.size(),
+	        opt.invariant_c);
+	check_output(c, "optimizing", buffer, c->correct);
+
+	std::vector<double> slots(expr.ins.size()), opt_slots(opt.ins.size());
+	double              vals[] = { 0, atof(in.p) };
+	spnm_utils::expr_eval_invariant(&opt, vals, opt_slots.data());
+	for (int i = 0; i <= 80; i++) {
+		vals[0]    = -4 + 0.1 * i;
+		double val = spnm_utils::expr_eval(&expr, vals, slots.data());
+		double opt_val =
+			spnm_utils::expr_eval_varying(&opt, vals,
+		                                      opt_slots.data());
+		if (val == opt_val ||
+		    (std::isnan(val) && std::isnan(opt_val)) ||
+		    fabs(val - opt_val) <= 1e-12 * std::max(1.0, fabs(val)))
+			continue;
+
+		c->log += RED "FAILED optimized value of '" +
+		          std::string(c->fx) + "' at " +
+		          spnm_utils::approx_string(vals[0]) + ": " +
+		          spnm_utils::approx_string(opt_val) + " for " +
+		          spnm_utils::approx_string(val) + "\n" RESET;
+		c->failed_c++;
+		return;
+	}
+}
 
 /* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
 
+struct bisection_case {
+	const char *lower, *upper; /* interval */
+};
+
+/* Returns the step `step` of a bisection as text. */
+std::string
+bisection_step_format(const spnm::bisection_s *step)
+{
+	char buffer[1024];
+	sprintf(buffer, "%lu\t%s\t%c\t%s\t%c\t%s\t%c\n", step->n, step->a_n,
+	        step->fa_n_sign, step->b_n, step->fb_n_sign, step->c_n,
+	        step->fc_n_sign);
+
+	return buffer;
+}
+
+/* Returns the steps of the bisection `t` as text. */
+std::string
+bisection_format(const spnm::bisection_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++)
+		out += bisection_step_format(t->steps + i);
+
+	return out;
+}
+
 void
-test_bisection(const char *fx, const char *interval_lower,
-               const char *interval_upper, spnm::process_t process,
-               size_t process_n, const char *correct)
+test_bisection(test_case *c, const bisection_case &in)
 {
-	spnm::bisection_t bisection_instance = spnm::bisection_init(
-		fx, interval_lower, interval_upper, process, process_n);
-	spnm::bisection_perform(&bisection_instance);
+	check_method<spnm::bisection_t, spnm::bisection_step>(
+		c, "bisection", c->correct,
+		[&]() {
+			return spnm::bisection_init(c->fx, in.lower, in.upper,
+		                                    c->process, c->process_n);
+		},
+		spnm::bisection_perform, spnm::bisection_steps,
+		spnm::bisection_free, bisection_format);
+}
 
-	char output_buffer[1024] = "";
-	for (size_t i = 0; i < bisection_instance.steps_c; i++) {
-		char buffer[1024];
-		sprintf(buffer, "%lu\t%s\t%c\t%s\t%c\t%s\t%c\n",
-		        bisection_instance.steps[i].n,
-		        bisection_instance.steps[i].a_n,
-		        bisection_instance.steps[i].fa_n_sign,
-		        bisection_instance.steps[i].b_n,
-		        bisection_instance.steps[i].fb_n_sign,
-		        bisection_instance.steps[i].c_n,
-		        bisection_instance.steps[i].fc_n_sign);
-		strcat(output_buffer, buffer);
+struct secant_case {
+	const char *initial_point1, *initial_point2;
+};
+
+/* Returns the steps of the secant method `t` as text. */
+std::string
+secant_format(const spnm::secant_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::secant_s *step = t->steps + i;
+		char                  buffer[1024];
+		sprintf(buffer, "%lu\t%s\t%s\t%s\t%s\t%s\t%s\n", step->n,
+		        step->x_prev, step->fx_prev, step->x_n, step->fx_n,
+		        step->x_next, step->fx_next);
+		out += buffer;
 	}
 
-	if (strcmp(output_buffer, correct)) {
-		fprintf(stderr, RED "FAILED bisection for '%s':\n" RESET, fx);
-		fprintf(stderr, RED "%s" RESET, output_buffer);
-		fprintf(stderr, GRN "%s\n" RESET, correct);
-		test_failed_c++;
+	return out;
+}
+
+void
+test_secant(test_case *c, const secant_case &in)
+{
+	check_method<spnm::secant_t, spnm::secant_step>(
+		c, "secant", c->correct,
+		[&]() {
+			return spnm::secant_init(c->fx, in.initial_point1,
+		                                 in.initial_point2, c->process,
+		                                 c->process_n);
+		},
+		spnm::secant_perform, spnm::secant_steps, spnm::secant_free,
+		secant_format);
+}
+
+struct fixed_point_case {
+	const char   *initial_point;
+	spnm::accel_t accel;
+};
+
+/* Returns the steps of the fixed point iteration `t` as text, with g(g(x_n))
+ * and x_(n+1) when accelerated. */
+std::string
+fixed_point_format(const spnm::fixed_point_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::fixed_point_s *step = t->steps + i;
+		char                       buffer[1024];
+		if (t->accel == spnm::ACCEL_NONE)
+			sprintf(buffer, "%lu\t%s\t%s\n", step->n, step->x_n,
+			        step->gx_n);
+		else
+			sprintf(buffer, "%lu\t%s\t%s\t%s\t%s\n", step->n,
+			        step->x_n, step->gx_n, step->ggx_n,
+			        step->x_next);
+		out += buffer;
+	}
+
+	return out;
+}
+
+void
+test_fixed_point(test_case *c, const fixed_point_case &in)
+{
+	check_method<spnm::fixed_point_t, spnm::fixed_point_step>(
+		c, "fixed point", c->correct,
+		[&]() {
+			return spnm::fixed_point_init(c->fx, in.initial_point,
+		                                      c->process, c->process_n,
+		                                      in.accel);
+		},
+		spnm::fixed_point_perform, spnm::fixed_point_steps,
+		spnm::fixed_point_free, fixed_point_format);
+}
+
+/* Splits the ';' separated `list` into `out` trimming the spaces. */
+void
+split_list(const char *list, std::vector<std::string> *out)
+{
+	std::string item;
+	for (const char *p = list;; p++) {
+		if (*p != ';' && *p != '\0') {
+			if (*p != ' ' || !item.empty())
+				item += *p;
+			continue;
+		}
+
+		while (!item.empty() && item.back() == ' ')
+			item.pop_back();
+		out->push_back(item);
+		item.clear();
+
+		if (*p == '\0')
+			break;
+	}
+}
+
+struct newton_system_case {
+	std::vector<const char *> initial_point, vars;
+};
+
+/* Returns the steps of the newton's method `t` as text. */
+std::string
+newton_system_format(const spnm::newton_system_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::newton_system_s *step = t->steps + i;
+		out += std::to_string(step->n);
+		for (size_t j = 0; j < t->vars_c; j++)
+			out += "\t" + std::string(step->x_n[j]);
+		for (size_t j = 0; j < t->vars_c; j++)
+			out += "\t" + std::string(step->fx_n[j]);
+		for (size_t j = 0; j < t->vars_c; j++)
+			out += "\t" + std::string(step->x_next[j]);
+		out += "\n";
+	}
+
+	return out;
+}
+
+void
+test_newton_system(test_case *c, const newton_system_case &in)
+{
+	std::vector<std::string> fxs;
+	split_list(c->fx, &fxs);
+
+	const char *fx_list[spnm::VARS_MAX];
+	for (size_t i = 0; i < fxs.size(); i++)
+		fx_list[i] = fxs[i].c_str();
+
+	check_method<spnm::newton_system_t, spnm::newton_system_step>(
+		c, "newton system", c->correct,
+		[&]() {
+			return spnm::newton_system_init(
+				fx_list, in.vars.data(),
+				in.initial_point.data(), in.vars.size(),
+				c->process, c->process_n);
+		},
+		spnm::newton_system_perform, spnm::newton_system_steps,
+		spnm::newton_system_free, newton_system_format);
+}
+
+struct newton_krylov_case {
+	std::vector<const char *> vars;    /* variables of the stencil */
+	std::vector<int>          offsets; /* offsets of the variables */
+	size_t                    unknowns_c;
+	const char               *boundary_lower, *boundary_upper;
+	const char               *initial_point;
+	spnm::precond_t           precond;
+};
+
+/* Returns the steps of the newton-krylov method `t` as text. */
+std::string
+newton_krylov_format(const spnm::newton_krylov_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::newton_krylov_s *step = t->steps + i;
+		char                         buffer[1024];
+		sprintf(buffer, "%lu\t%s\t%lu\t%s\t%s\n", step->n,
+		        step->residual_norm, step->linear_iterations_c,
+		        step->linear_residual_norm, step->x_norm);
+		out += buffer;
 	}
+
+	return out;
 }
 
 void
-test_secant(const char *fx, const char *initial_point1,
-            const char *initial_point2, spnm::process_t process,
-            size_t process_n, const char *correct)
+test_newton_krylov(test_case *c, const newton_krylov_case &in)
+{
+	/* the steps shouldn't depend on the number of threads */
+	check_method<spnm::newton_krylov_t, spnm::newton_krylov_step>(
+		c, "newton-krylov", c->correct,
+		[&]() {
+			return spnm::newton_krylov_init(
+				c->fx, in.vars.data(), in.offsets.data(),
+				in.vars.size(), in.unknowns_c,
+				in.boundary_lower, in.boundary_upper,
+				in.initial_point, in.precond, c->process,
+				c->process_n);
+		},
+		spnm::newton_krylov_perform, spnm::newton_krylov_steps,
+		spnm::newton_krylov_free, newton_krylov_format,
+		&spnm::newton_krylov_t::threads_c);
+}
+
+struct sweep_case {
+	const char          *param, *param_lower, *param_upper;
+	size_t               points_c;
+	spnm::sweep_method_t method;
+	const char          *point1, *point2; /* interval of SWEEP_BISECTION,
+	                                         initial points of
+	                                         SWEEP_SECANT */
+};
+
+/* Runs the sweep `in` of `c`, returning its table and the sum of its
+ * steps. */
+std::string
+sweep_run(test_case *c, const sweep_case &in, int warm_start,
+          size_t threads_c, size_t *steps_c)
+{
+	spnm::sweep_t sweep_instance = spnm::sweep_init(
+		c->fx, in.param, in.param_lower, in.param_upper, in.points_c,
+		in.method, in.point1, in.point2, c->process, c->process_n);
+	sweep_instance.warm_start = warm_start;
+	sweep_instance.threads_c  = threads_c;
+
+	std::string out = "";
+	*steps_c        = 0;
+	if (spnm::sweep_perform(&sweep_instance) == 0) {
+		for (size_t i = 0; i < sweep_instance.points_c; i++) {
+			spnm::sweep_s *point = sweep_instance.points + i;
+			char           buffer[1024];
+			sprintf(buffer, "%lu\t%s\t%s\t%lu\t%c\n", i + 1,
+			        point->p, point->root, point->steps_c,
+			        point->is_warm ? 'w' : 'c');
+			out += buffer;
+			*steps_c += point->steps_c;
+		}
+	}
+	spnm::sweep_free(&sweep_instance);
+
+	return out;
+}
+
+void
+test_sweep(test_case *c, const sweep_case &in)
+{
+	/* the points shouldn't depend on the number of threads */
+	size_t steps_c = 0;
+	check_threads(
+		c, "sweep",
+		[&](size_t threads_c) {
+			return sweep_run(c, in, 1, threads_c, &steps_c);
+		},
+		c->correct);
+
+	/* warm starts should take fewer steps than cold ones */
+	size_t cold_steps_c;
+	sweep_run(c, in, 0, 1, &cold_steps_c);
+	if (steps_c >= cold_steps_c) {
+		c->log += RED "FAILED sweep for '" + std::string(c->fx) +
+		          "': " + std::to_string(steps_c) +
+		          " steps warm started against " +
+		          std::to_string(cold_steps_c) + " cold\n" RESET;
+		c->failed_c++;
+	}
+}
+
+/* Returns the enclosures `enclosures` of roots with the steps of their
+ * bisections as text. */
+std::string
+enclosures_format(const spnm::isolate_s *enclosures, size_t enclosures_c)
 {
-	spnm::secant_t secant_instance = spnm::secant_init(
-		fx, initial_point1, initial_point2, process, process_n);
-	spnm::secant_perform(&secant_instance);
+	const char *kinds[] = { "unique", "exists", "possible" };
+	std::string out     = "";
+	for (size_t i = 0; i < enclosures_c; i++) {
+		const spnm::isolate_s *enclosure = enclosures + i;
+		char                   buffer[1024];
+		sprintf(buffer, "%lu\t%s\t%s\t%s\n", i + 1, enclosure->lower,
+		        enclosure->upper, kinds[enclosure->kind]);
+		out += buffer;
+		if (!enclosure->bisection)
+			continue;
 
-	char output_buffer[1024] = "";
-	for (size_t i = 0; i < secant_instance.steps_c; i++) {
+		const spnm::bisection_t *bisection = enclosure->bisection;
+		for (size_t j = 0; j < bisection->steps_c; j++)
+			out += "\t" + bisection_step_format(bisection->steps +
+			                                    j);
+	}
+
+	return out;
+}
+
+struct isolate_case {
+	const char *lower, *upper; /* interval */
+	const char *tolerance;
+};
+
+/* Returns the enclosures of the isolation `in` of `c` on `threads_c` threads
+ * with the steps of their bisections as text. */
+std::string
+isolate_run(test_case *c, const isolate_case &in, size_t threads_c)
+{
+	spnm::isolate_t isolate_instance =
+		spnm::isolate_init(c->fx, in.lower, in.upper, in.tolerance,
+	                           c->process, c->process_n);
+	isolate_instance.threads_c = threads_c;
+
+	std::string out = "";
+	if (spnm::isolate_perform(&isolate_instance) == 0)
+		out = enclosures_format(isolate_instance.enclosures,
+		                        isolate_instance.enclosures_c);
+	spnm::isolate_free(&isolate_instance);
+
+	return out;
+}
+
+void
+test_isolate(test_case *c, const isolate_case &in)
+{
+	/* the enclosures shouldn't depend on the number of threads */
+	check_threads(
+		c, "isolation",
+		[&](size_t threads_c) { return isolate_run(c, in, threads_c); },
+		c->correct);
+}
+
+struct polynomial_roots_case {
+};
+
+/* Returns the square-free part and the enclosures of the roots of the
+ * polynomial of `c` on `threads_c` threads with the steps of their bisections
+ * as text. */
+std::string
+polynomial_roots_run(test_case *c, size_t threads_c)
+{
+	spnm::polynomial_roots_t polynomial_roots_instance =
+		spnm::polynomial_roots_init(c->fx, c->process, c->process_n);
+	polynomial_roots_instance.threads_c = threads_c;
+
+	std::string out = "";
+	if (spnm::polynomial_roots_perform(&polynomial_roots_instance) == 0) {
+		const char *square_free = polynomial_roots_instance.square_free;
+		if (square_free)
+			out += "square_free\t" + std::string(square_free) + "\n";
+		out += enclosures_format(
+			polynomial_roots_instance.enclosures,
+			polynomial_roots_instance.enclosures_c);
+	}
+	spnm::polynomial_roots_free(&polynomial_roots_instance);
+
+	return out;
+}
+
+void
+test_polynomial_roots(test_case *c, const polynomial_roots_case &)
+{
+	/* the enclosures shouldn't depend on the number of threads */
+	check_threads(
+		c, "polynomial roots",
+		[&](size_t threads_c) {
+			return polynomial_roots_run(c, threads_c);
+		},
+		c->correct);
+}
+
+/* = 2 - NUMERICAL INTEGRATION = */
+
+struct integration_case {
+	const char        *lower, *upper; /* limits */
+	spnm::quadrature_t rule;
+};
+
+/* Returns the steps of the integration `t` as text. */
+std::string
+integration_format(const spnm::integration_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::integration_s *step = t->steps + i;
+		char                       buffer[1024];
+		sprintf(buffer, "%lu\t%lu\t%s", step->n, step->intervals_c,
+		        step->h);
+		out += buffer;
+		if (t->rule != spnm::QUAD_ROMBERG) {
+			out += "\t" + std::string(step->integral) + "\n";
+			continue;
+		}
+		for (size_t j = 0; j < step->n; j++)
+			out += "\t" + std::string(step->romberg[j]);
+		out += "\n";
+	}
+
+	return out;
+}
+
+void
+test_integration(test_case *c, const integration_case &in)
+{
+	auto init = [&]() {
+		return spnm::integration_init(c->fx, in.lower, in.upper,
+		                              in.rule, c->process,
+		                              c->process_n);
+	};
+	check_method<spnm::integration_t, spnm::integration_step>(
+		c, "integration", c->correct, init, spnm::integration_perform,
+		spnm::integration_steps, spnm::integration_free,
+		integration_format);
+
+	/* the batches should agree with evaluating one point at a time,
+	 * across the end of a batch */
+	spnm::integration_t integration_instance = init();
+	spnm::integration_perform(&integration_instance);
+
+	double x[100], fx[100];
+	for (size_t i = 0; i < 100; i++)
+		x[i] = integration_instance.a +
+		       (integration_instance.b - integration_instance.a) * i /
+		               99;
+	spnm_utils::fx_val_batch(integration_instance.f, x, 100, fx);
+	for (size_t i = 0; i < 100; i++) {
+		double val = spnm_utils::fx_val_double(
+			spnm_utils::approx_string(x[i]).c_str(),
+			integration_instance.f);
+		if (fabs(fx[i] - val) > 1e-9 * std::max(1.0, fabs(val))) {
+			c->log += RED "FAILED batch evaluation for '" +
+			          std::string(c->fx) + "' at " +
+			          spnm_utils::approx_string(x[i]) + "\n" RESET;
+			c->failed_c++;
+			break;
+		}
+	}
+	spnm::integration_free(&integration_instance);
+}
+
+struct gauss_kronrod_case {
+	const char *lower, *upper; /* limits */
+	const char *tolerance;
+};
+
+/* Returns the rounds of the gauss-kronrod integration `t` as text. */
+std::string
+gauss_kronrod_format(const spnm::gauss_kronrod_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::gauss_kronrod_s *step = t->steps + i;
+		char                         buffer[1024];
+		sprintf(buffer, "%lu\t%lu\t%lu\t%s\t%s\n", step->n,
+		        step->intervals_c, step->evals_c, step->integral,
+		        step->error);
+		out += buffer;
+	}
+
+	return out;
+}
+
+void
+test_gauss_kronrod(test_case *c, const gauss_kronrod_case &in)
+{
+	auto init = [&]() {
+		return spnm::gauss_kronrod_init(c->fx, in.lower, in.upper,
+		                                in.tolerance, c->process,
+		                                c->process_n);
+	};
+
+	/* the rounds shouldn't depend on the number of threads */
+	check_method<spnm::gauss_kronrod_t, spnm::gauss_kronrod_step>(
+		c, "gauss-kronrod", c->correct, init,
+		spnm::gauss_kronrod_perform, spnm::gauss_kronrod_steps,
+		spnm::gauss_kronrod_free, gauss_kronrod_format,
+		&spnm::gauss_kronrod_t::threads_c);
+
+	/* no round should be started past the deadline */
+	spnm::gauss_kronrod_t deadline_instance = init();
+	deadline_instance.deadline_ms           = 1e-9;
+
+	int ret = spnm::gauss_kronrod_perform(&deadline_instance);
+	if (ret != spnm::err_deadline || deadline_instance.steps_c != 1 ||
+	    deadline_instance.evals_c != 15) {
+		c->log += RED "FAILED gauss-kronrod deadline for '" +
+		          std::string(c->fx) + "'\n" RESET;
+		c->failed_c++;
+	}
+	spnm::gauss_kronrod_free(&deadline_instance);
+}
+
+/* = 3 - ORDINARY DIFFERENTIAL EQUATIONS = */
+
+struct ode_case {
+	const char        *initial_x, *initial_y, *final_x, *h;
+	spnm::ode_method_t method;
+	const char        *tolerance; /* for ODE_RK45 */
+};
+
+/* An `on_step` stopping the solve after 2 steps. */
+int
+ode_stop_step(const spnm::ode_s *step, void *)
+{
+	return step->n == 2;
+}
+
+void
+test_ode(test_case *c, const ode_case &in)
+{
+	auto init = [&]() {
+		return spnm::ode_init(c->fx, in.initial_x, in.initial_y,
+		                      in.final_x, in.h, in.tolerance,
+		                      in.method, c->process, c->process_n);
+	};
+
+	/* streamed steps */
+	std::ostringstream out;
+	spnm::ode_t        ode_instance = init();
+	ode_instance.on_step            = spnm::ode_write_step;
+	ode_instance.data               = &out;
+
+	if (spnm::ode_perform(&ode_instance) != 0)
+		out.str("");
+	check_output(c, "ode", out.str(), c->correct);
+	spnm::ode_free(&ode_instance);
+
+	/* stepping by hand should be the same */
+	std::ostringstream stepped_out;
+	spnm::ode_t        stepped_instance = init();
+
+	int ret = spnm::ode_begin(&stepped_instance);
+	while (!ret && !stepped_instance.done)
+		if ((ret = spnm::ode_step(&stepped_instance)) == 0)
+			spnm::ode_write_step(&(stepped_instance.step),
+			                     &stepped_out);
+
+	if (ret)
+		stepped_out.str("");
+	check_output(c, "stepped ode", stepped_out.str(), c->correct);
+	spnm::ode_free(&stepped_instance);
+
+	/* the callback can stop the solve */
+	spnm::ode_t stopped_instance = init();
+	stopped_instance.on_step     = ode_stop_step;
+	if (spnm::ode_perform(&stopped_instance) != 0 ||
+	    stopped_instance.steps_c != 2) {
+		c->log += RED "FAILED stopping ode for '" + std::string(c->fx) +
+		          "'\n" RESET;
+		c->failed_c++;
+	}
+	spnm::ode_free(&stopped_instance);
+}
+
+/* = 4 - LINEAR SYSTEMS = */
+
+struct elimination_case {
+	const char                *b;
+	spnm::elimination_method_t method;
+};
+
+/* Returns the steps and x of the elimination `t` as text, without the
+ * snapshots if `snapshots` is 0. */
+std::string
+elimination_format(const spnm::elimination_t *t, int snapshots)
+{
+	size_t cols_c = t->rows_c + (t->method == spnm::ELIMINATION_GAUSS);
+
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::elimination_s *step = t->steps + i;
+		char                       buffer[1024];
+		sprintf(buffer, "%lu\t%lu\t%s\n", step->n, step->pivot,
+		        step->pivot_val);
+		out += buffer;
+		for (size_t j = 0; snapshots && j < t->rows_c; j++) {
+			for (size_t k = 0; k < cols_c; k++)
+				out += "\t" + std::string(
+					step->snapshot[j * cols_c + k]);
+			out += "\n";
+		}
+	}
+	out += "x";
+	for (size_t i = 0; i < t->rows_c; i++)
+		out += "\t" + std::string(t->x[i]);
+	out += "\n";
+
+	return out;
+}
+
+/* Returns x of a system of `n` equations with a dominant entry in every row
+ * and column as text, solved by `lu_factor()` column by column if
+ * `threads_c` is 0 and else by elimination on `threads_c` threads. */
+std::string
+elimination_values_run(size_t n, size_t threads_c)
+{
+	std::vector<double> a(n * n), b(n);
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j < n; j++)
+			a[i * n + j] = 1.0 / (1 + (i * 7 + j * 3) % 11);
+		a[i * n + (i * 7) % n] += n;
+		b[i] = i % 3;
+	}
+
+	std::string out = "";
+	if (threads_c == 0) {
+		std::vector<size_t> perm(n);
+		if (!spnm_utils::lu_factor(a.data(), n, perm.data()))
+			return out;
+		spnm_utils::lu_solve(a.data(), perm.data(), n, b.data());
+		for (size_t i = 0; i < n; i++) {
+			char x[spnm::STR_MAX];
+			strcpy(x, spnm_utils::approx_string(b[i]).c_str());
+			spnm::significant_digits_policy::manip(x, 12);
+			out += std::string(x) + "\n";
+		}
+		return out;
+	}
+
+	spnm::elimination_t elimination_instance =
+		spnm::elimination_init_values(a.data(), b.data(), n,
+	                                      spnm::ELIMINATION_LU,
+	                                      spnm::SIGNIFICANT_DIGITS, 12);
+	elimination_instance.threads_c = threads_c;
+
+	if (spnm::elimination_perform(&elimination_instance) == 0)
+		for (size_t i = 0; i < n; i++)
+			out += std::string(elimination_instance.x[i]) + "\n";
+	spnm::elimination_free(&elimination_instance);
+
+	return out;
+}
+
+void
+test_elimination(test_case *c, const elimination_case &in)
+{
+	auto init = [&]() {
+		return spnm::elimination_init(c->fx, in.b, in.method,
+		                              c->process, c->process_n);
+	};
+
+	/* step by step with the snapshots */
+	spnm::elimination_t elimination_instance = init();
+	elimination_instance.snapshots           = 1;
+
+	std::string out = "";
+	if (spnm::elimination_perform(&elimination_instance) == 0)
+		out = elimination_format(&elimination_instance, 1);
+	check_output(c, "elimination", out, c->correct);
+	spnm::elimination_free(&elimination_instance);
+
+	/* the steps without snapshots should be the same */
+	std::string correct = "";
+	for (const char *line = c->correct; *line;) {
+		const char *end = strchr(line, '\n') + 1;
+		if (*line != '\t')
+			correct += std::string(line, end);
+		line = end;
+	}
+	check_method<spnm::elimination_t, spnm::elimination_step>(
+		c, "elimination without snapshots", correct, init,
+		spnm::elimination_perform, spnm::elimination_steps,
+		spnm::elimination_free,
+		[](const spnm::elimination_t *t) {
+			return elimination_format(t, 0);
+		});
+
+	/* the blocked elimination should be the same as column by column
+	 * whatever the threads */
+	std::string column_out = elimination_values_run(400, 0);
+	check_threads(
+		c, "blocked elimination",
+		[](size_t threads_c) {
+			return elimination_values_run(400, threads_c);
+		},
+		column_out.c_str());
+}
+
+struct iterative_case {
+	const char              *b, *initial_point;
+	spnm::iterative_method_t method;
+	const char              *relaxation;
+	int                      red_black;
+};
+
+/* Returns the steps of the iterative method `t` as text. */
+std::string
+iterative_format(const spnm::iterative_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		out += std::to_string(t->steps[i].n);
+		for (size_t j = 0; j < t->rows_c; j++)
+			out += "\t" + std::string(t->steps[i].x_next[j]);
+		out += "\n";
+	}
+
+	return out;
+}
+
+/* Returns x after 2 steps of the method `in` on `threads_c` threads for a
+ * tridiagonal system of 70000 equations as text. */
+std::string
+iterative_csr_run(const iterative_case &in, size_t threads_c)
+{
+	const size_t        n = 70000;
+	std::vector<size_t> row_ptr(1, 0), cols;
+	std::vector<double> vals, b(n);
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = i ? i - 1 : 0; j <= i + 1 && j < n; j++) {
+			cols.push_back(j);
+			vals.push_back(j == i ? 4 : -1);
+		}
+		row_ptr.push_back(cols.size());
+		b[i] = i % 5;
+	}
+
+	spnm::iterative_t iterative_instance = spnm::iterative_init_csr(
+		row_ptr.data(), cols.data(), vals.data(), b.data(), n, "0",
+		in.method, in.relaxation, spnm::SIGNIFICANT_DIGITS, 12);
+	iterative_instance.red_black = in.red_black;
+	iterative_instance.threads_c = threads_c;
+
+	std::string out = "";
+	if (spnm::iterative_begin(&iterative_instance) == 0 &&
+	    spnm::iterative_step(&iterative_instance) == 0 &&
+	    spnm::iterative_step(&iterative_instance) == 0)
+		for (size_t i = 0; i < n; i++)
+			out += std::string(
+				iterative_instance.steps[1].x_next[i]) + "\n";
+	spnm::iterative_free(&iterative_instance);
+
+	return out;
+}
+
+void
+test_iterative(test_case *c, const iterative_case &in)
+{
+	check_method<spnm::iterative_t, spnm::iterative_step>(
+		c, "iterative", c->correct,
+		[&]() {
+			spnm::iterative_t ret = spnm::iterative_init(
+				c->fx, in.b, in.initial_point, in.method,
+				in.relaxation, c->process, c->process_n);
+			ret.red_black = in.red_black;
+			return ret;
+		},
+		spnm::iterative_perform, spnm::iterative_steps,
+		spnm::iterative_free, iterative_format);
+
+	/* the rows updated all at once shouldn't depend on the threads */
+	if (!strcmp(c->correct, ""))
+		return;
+	check_threads(
+		c, "iterative",
+		[&](size_t threads_c) {
+			return iterative_csr_run(in, threads_c);
+		},
+		NULL);
+}
+
+struct conjugate_gradient_case {
+	const char     *b, *initial_point;
+	spnm::precond_t precond;
+};
+
+/* Writes A of `c` and `b` to new matrix market files, A in symmetric
+ * coordinates, into `a_file` and `b_file`. Returns 0 on error. */
+int
+conjugate_gradient_files(test_case *c, const char *b_list,
+                         std::string *a_file, std::string *b_file)
+{
+	std::vector<std::string> rows, b;
+	split_list(c->fx, &rows);
+	split_list(b_list, &b);
+
+	/* the entries on and below the diagonal */
+	std::string entries = "";
+	size_t      entries_c = 0;
+	for (size_t i = 0; i < rows.size(); i++) {
+		std::string row = rows[i];
+		for (char &ch : row)
+			ch = ch == ',' ? ';' : ch;
+		std::vector<std::string> vals;
+		split_list(row.c_str(), &vals);
+		for (size_t j = 0; j <= i; j++) {
+			if (vals[j] == "0")
+				continue;
+			entries += std::to_string(i + 1) + " " +
+			           std::to_string(j + 1) + " " + vals[j] + "\n";
+			entries_c++;
+		}
+	}
+
+	char a_template[] = "/tmp/spnm-test-a-XXXXXX";
+	char b_template[] = "/tmp/spnm-test-b-XXXXXX";
+	int  a_fd = mkstemp(a_template), b_fd = mkstemp(b_template);
+	if (a_fd < 0 || b_fd < 0)
+		return 0;
+	close(a_fd);
+	close(b_fd);
+	*a_file = a_template;
+	*b_file = b_template;
+
+	std::ofstream a_out(*a_file), b_out(*b_file);
+	a_out << "%%MatrixMarket matrix coordinate real symmetric\n"
+	      << "% A of '" << c->fx << "'\n"
+	      << rows.size() << " " << rows.size() << " " << entries_c << "\n"
+	      << entries;
+	b_out << "%%MatrixMarket matrix array real general\n"
+	      << b.size() << " 1\n";
+	for (const std::string &b_i : b)
+		b_out << b_i << "\n";
+
+	return 1;
+}
+
+/* Returns the steps of the conjugate gradient with the preconditioner
+ * `precond` on `threads_c` threads for the 5 point poisson problem of 90601
+ * unknowns as text. */
+std::string
+conjugate_gradient_csr_run(spnm::precond_t precond, size_t threads_c)
+{
+	const size_t        m = 301, n = m * m;
+	std::vector<size_t> row_ptr(1, 0), cols;
+	std::vector<double> vals, b(n);
+	for (size_t i = 0; i < n; i++) {
+		const size_t js[] = { i - m, i - 1, i, i + 1, i + m };
+		const int    valid[] = { i >= m, i % m > 0, 1, i % m + 1 < m,
+			                 i + m < n };
+		for (size_t k = 0; k < 5; k++) {
+			if (!valid[k])
+				continue;
+			cols.push_back(js[k]);
+			vals.push_back(k == 2 ? 4 : -1);
+		}
+		row_ptr.push_back(cols.size());
+		b[i] = i % 7;
+	}
+
+	std::ostringstream         out;
+	spnm::conjugate_gradient_t conjugate_gradient_instance =
+		spnm::conjugate_gradient_init_csr(
+			row_ptr.data(), cols.data(), vals.data(), b.data(), n,
+			"0", precond, spnm::NO_OF_STEPS, 5);
+	conjugate_gradient_instance.threads_c = threads_c;
+	conjugate_gradient_instance.on_step =
+		spnm::conjugate_gradient_write_step;
+	conjugate_gradient_instance.data = &out;
+
+	if (spnm::conjugate_gradient_perform(&conjugate_gradient_instance) != 0)
+		out.str("");
+	spnm::conjugate_gradient_free(&conjugate_gradient_instance);
+
+	return out.str();
+}
+
+void
+test_conjugate_gradient(test_case *c, const conjugate_gradient_case &in)
+{
+	/* streamed steps */
+	std::ostringstream         out;
+	spnm::conjugate_gradient_t conjugate_gradient_instance =
+		spnm::conjugate_gradient_init(c->fx, in.b, in.initial_point,
+	                                      in.precond, c->process,
+	                                      c->process_n);
+	conjugate_gradient_instance.on_step =
+		spnm::conjugate_gradient_write_step;
+	conjugate_gradient_instance.data = &out;
+
+	if (spnm::conjugate_gradient_perform(&conjugate_gradient_instance) != 0)
+		out.str("");
+	check_output(c, "conjugate gradient", out.str(), c->correct);
+	spnm::conjugate_gradient_free(&conjugate_gradient_instance);
+
+	/* stepping by hand on A and b read from files should be the same */
+	std::string a_file, b_file;
+	if (!conjugate_gradient_files(c, in.b, &a_file, &b_file)) {
+		c->log += RED "FAILED writing the matrix market files\n" RESET;
+		c->failed_c++;
+		return;
+	}
+
+	std::ostringstream         stepped_out;
+	spnm::conjugate_gradient_t stepped_instance =
+		spnm::conjugate_gradient_init_file(
+			a_file.c_str(), b_file.c_str(), in.initial_point,
+			in.precond, c->process, c->process_n);
+
+	int ret = spnm::conjugate_gradient_begin(&stepped_instance);
+	while (!ret && !stepped_instance.done)
+		if ((ret = spnm::conjugate_gradient_step(&stepped_instance)) ==
+		    0)
+			spnm::conjugate_gradient_write_step(
+				&(stepped_instance.step), &stepped_out);
+
+	if (ret)
+		stepped_out.str("");
+	check_output(c, "conjugate gradient from files", stepped_out.str(),
+	             c->correct);
+	spnm::conjugate_gradient_free(&stepped_instance);
+	unlink(a_file.c_str());
+	unlink(b_file.c_str());
+
+	/* the steps shouldn't depend on the threads */
+	if (!strcmp(c->correct, ""))
+		return;
+	check_threads(
+		c, "conjugate gradient",
+		[&](size_t threads_c) {
+			return conjugate_gradient_csr_run(in.precond,
+			                                  threads_c);
+		},
+		NULL);
+}
+
+/* = 5 - INTERPOLATION = */
+
+struct interpolation_case {
+	const char                  *y;
+	spnm::interpolation_method_t method;
+	const char                  *at;
+};
+
+/* Returns the steps and the interpolated y of the interpolation `t` as text.
+ */
+std::string
+interpolation_format(const spnm::interpolation_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		out += std::to_string(t->steps[i].n);
+		for (size_t j = 0; j < t->steps[i].vals_c; j++)
+			out += "\t" + std::string(t->steps[i].vals[j]);
+		out += "\n";
+	}
+	out += "y\t" + std::string(t->value) + "\n";
+
+	return out;
+}
+
+/* Returns the interpolation `in` of `c` without its last `drop_c` points,
+ * initialized. */
+spnm::interpolation_t
+interpolation_case_init(test_case *c, const interpolation_case &in,
+                        size_t drop_c)
+{
+	std::vector<std::string> xs, ys;
+	split_list(c->fx, &xs);
+	split_list(in.y, &ys);
+
+	std::string x = xs[0], y = ys[0];
+	for (size_t i = 1; i + drop_c < xs.size(); i++) {
+		x += ";" + xs[i];
+		y += ";" + ys[i];
+	}
+
+	return spnm::interpolation_init(x.c_str(), y.c_str(), in.at,
+	                                in.method, c->process, c->process_n);
+}
+
+void
+test_interpolation(test_case *c, const interpolation_case &in)
+{
+	check_method<spnm::interpolation_t, spnm::interpolation_step>(
+		c, "interpolation", c->correct,
+		[&]() { return interpolation_case_init(c, in, 0); },
+		spnm::interpolation_perform, spnm::interpolation_steps,
+		spnm::interpolation_free, interpolation_format);
+	if (!strcmp(c->correct, ""))
+		return;
+
+	/* adding the points one by one to the table of the first two should
+	 * be the same, lazily computed */
+	std::vector<std::string> xs, ys;
+	split_list(c->fx, &xs);
+	split_list(in.y, &ys);
+
+	spnm::interpolation_t added_instance =
+		interpolation_case_init(c, in, xs.size() - 2);
+	auto added_steps = spnm::interpolation_steps(&added_instance);
+	for (const spnm::interpolation_s &step : added_steps)
+		(void)step;
+
+	int ret = added_steps.err;
+	for (size_t i = 2; !ret && i < xs.size(); i++)
+		ret = spnm::interpolation_add_point(
+			&added_instance, xs[i].c_str(), ys[i].c_str());
+
+	std::string out = ret ? "" : interpolation_format(&added_instance);
+	check_output(c, "interpolation adding points", out, c->correct);
+
+	/* a point already there is rejected with the table unchanged */
+	if (spnm::interpolation_add_point(&added_instance, xs[0].c_str(),
+	                                  "0") != spnm::err_x_input ||
+	    (!ret && interpolation_format(&added_instance) != out)) {
+		c->log += RED "FAILED interpolation adding a repeated point "
+		              "for '" + std::string(c->fx) + "'\n" RESET;
+		c->failed_c++;
+	}
+
+	/* the polynomial goes through the points and its values at many
+	 * points shouldn't depend on the threads */
+	size_t              n = 100000;
+	std::vector<double> nodes(xs.size()), at(n), serial(n), parallel(n);
+	for (size_t i = 0; i < xs.size(); i++)
+		spnm_utils::expr_const_val(xs[i].c_str(), &nodes[i]);
+	for (size_t i = 0; i < n; i++)
+		at[i] = i < xs.size() ? nodes[i] :
+		                        nodes[0] + (nodes.back() - nodes[0]) *
+		                                           i / n;
+
+	added_instance.threads_c = 1;
+	ret = spnm::interpolation_eval(&added_instance, at.data(), n,
+	                               serial.data());
+	added_instance.threads_c = 4;
+	ret = ret ? ret :
+	            spnm::interpolation_eval(&added_instance, at.data(), n,
+	                                     parallel.data());
+	for (size_t i = 0; !ret && i < xs.size(); i++) {
+		double y;
+		spnm_utils::expr_const_val(ys[i].c_str(), &y);
+		ret = fabs(serial[i] - y) > 1e-9 * (1 + fabs(y));
+	}
+	if (ret || serial != parallel) {
+		c->log += RED "FAILED interpolation evaluated at many points "
+		              "for '" + std::string(c->fx) + "'\n" RESET;
+		c->failed_c++;
+	}
+	spnm::interpolation_free(&added_instance);
+}
+
+struct spline_case {
+	const char        *y, *at;
+	spnm::spline_end_t ends;
+	const char        *slopes; /* for SPLINE_CLAMPED, else NULL */
+};
+
+/* Returns the steps and the interpolated y of the spline `t` as text. */
+std::string
+spline_format(const spnm::spline_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::spline_s *step = t->steps + i;
+		char                  buffer[1024];
+		sprintf(buffer, "%lu\t%s\t%s\t%s\t%s\n", step->n, step->a,
+		        step->b, step->c, step->d);
+		out += buffer;
+	}
+	out += "y\t" + std::string(t->value) + "\n";
+
+	return out;
+}
+
+void
+test_spline(test_case *c, const spline_case &in)
+{
+	check_method<spnm::spline_t, spnm::spline_step>(
+		c, "spline", c->correct,
+		[&]() {
+			return spnm::spline_init(c->fx, in.y, in.at, in.ends,
+		                                 in.slopes, c->process,
+		                                 c->process_n);
+		},
+		spnm::spline_perform, spnm::spline_steps, spnm::spline_free,
+		spline_format);
+	if (!strcmp(c->correct, ""))
+		return;
+
+	/* evaluating the spline at unsorted points, found by their buckets,
+	 * should be the same as at every point by a binary search, whatever
+	 * the threads */
+	size_t              n = 1000;
+	std::vector<double> xs, ys;
+	for (size_t i = 0; i < n; i++) {
+		xs.push_back(i + 0.9 * sin(i * 0.7));
+		ys.push_back(cos(0.05 * xs.back()));
+	}
+	spnm::spline_t values_instance =
+		spnm::spline_init_values(xs.data(), ys.data(), n, "0", in.ends,
+	                                 "0; 0", c->process, c->process_n);
+	int ret = spnm::spline_begin(&values_instance);
+
+	size_t              queries_c = 100000;
+	std::vector<double> at(queries_c), searched(queries_c),
+		serial(queries_c), parallel(queries_c);
+	for (size_t i = 0; i < queries_c; i++) {
+		at[i] = -2 + (n + 3) * ((i * 7919) % queries_c) /
+		                     (double)queries_c;
+
+		size_t s = std::upper_bound(xs.begin(), xs.end(), at[i]) -
+		           xs.begin();
+		s        = std::min(std::max(s, (size_t)1), n - 1) - 1;
+		const double *coef = values_instance.coefs + 4 * s;
+		double        dx   = at[i] - xs[s];
+		searched[i] = ((coef[3] * dx + coef[2]) * dx + coef[1]) * dx +
+		              coef[0];
+	}
+
+	values_instance.threads_c = 1;
+	ret = ret ? ret :
+	            spnm::spline_eval(&values_instance, at.data(), queries_c,
+	                              serial.data());
+	values_instance.threads_c = 4;
+	ret = ret ? ret :
+	            spnm::spline_eval(&values_instance, at.data(), queries_c,
+	                              parallel.data());
+	if (ret || serial != searched || parallel != searched) {
+		c->log += RED "FAILED spline evaluated at many points for '" +
+		          std::string(c->fx) + "'\n" RESET;
+		c->failed_c++;
+	}
+	spnm::spline_free(&values_instance);
+}
+
+/* = 6 - CURVE FITTING = */
+
+struct fit_case {
+	const char       *y;
+	spnm::fit_model_t model;
+	size_t            degree; /* for FIT_POLYNOMIAL */
+};
+
+/* Returns the steps and the coefficients of the fit `t` as text. */
+std::string
+fit_format(const spnm::fit_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::fit_s *step = t->steps + i;
+		out += std::to_string(step->n) + "\t" + step->sum_x;
+		if (step->sum_xy)
+			out += "\t" + std::string(step->sum_xy);
+		out += "\n";
+	}
+	out += "a";
+	for (size_t i = 0; i < t->coefs_c; i++)
+		out += "\t" + std::string(t->coefs[i]);
+
+	return out + "\n";
+}
+
+/* Returns the output of the fit `in` of the points in `file` of `format` on
+ * `threads_c` threads, "" on error, with the number of points read. */
+std::string
+fit_file_run(test_case *c, const fit_case &in, const char *file,
+             spnm::fit_format_t format, size_t threads_c, size_t *points_c)
+{
+	spnm::fit_t fit_instance = spnm::fit_init_file(
+		file, format, in.model, in.degree, c->process, c->process_n);
+	fit_instance.threads_c = threads_c;
+
+	std::string out = "";
+	if (spnm::fit_perform(&fit_instance) == 0)
+		out = fit_format(&fit_instance);
+	*points_c = fit_instance.points_c;
+	spnm::fit_free(&fit_instance);
+
+	return out;
+}
+
+/* Writes the points `x` and `y` to new files, as csv with a header and as
+ * binary, into `csv_file` and `binary_file`. Returns 0 on error. */
+int
+fit_files(const std::vector<std::string> &x, const std::vector<std::string> &y,
+          std::string *csv_file, std::string *binary_file)
+{
+	char csv_template[]    = "/tmp/spnm-test-csv-XXXXXX";
+	char binary_template[] = "/tmp/spnm-test-binary-XXXXXX";
+	int  csv_fd            = mkstemp(csv_template);
+	int  binary_fd         = mkstemp(binary_template);
+	if (csv_fd < 0 || binary_fd < 0)
+		return 0;
+	close(csv_fd);
+	close(binary_fd);
+	*csv_file    = csv_template;
+	*binary_file = binary_template;
+
+	std::ofstream csv_out(*csv_file);
+	std::ofstream binary_out(*binary_file, std::ios::binary);
+	csv_out << "x, y\r\n";
+	for (size_t i = 0; i < x.size(); i++) {
+		csv_out << x[i] << ", " << y[i] << "\r\n";
+
+		double point[2] = { strtod(x[i].c_str(), NULL),
+			            strtod(y[i].c_str(), NULL) };
+		binary_out.write((const char *)point, sizeof(point));
+	}
+
+	return 1;
+}
+
+void
+test_fit(test_case *c, const fit_case &in)
+{
+	check_method<spnm::fit_t, spnm::fit_step>(
+		c, "fit", c->correct,
+		[&]() {
+			return spnm::fit_init(c->fx, in.y, in.model, in.degree,
+		                              c->process, c->process_n);
+		},
+		spnm::fit_perform, spnm::fit_steps, spnm::fit_free, fit_format);
+	if (!strcmp(c->correct, ""))
+		return;
+
+	/* the points read from files should sum the same as given as strings,
+	 * whatever the threads */
+	std::vector<std::string> x, y;
+	split_list(c->fx, &x);
+	split_list(in.y, &y);
+	std::string csv_file, binary_file;
+	if (!fit_files(x, y, &csv_file, &binary_file)) {
+		c->log += RED "FAILED to write the points of '" +
+		          std::string(c->fx) + "'\n" RESET;
+		c->failed_c++;
+		return;
+	}
+	for (size_t threads_c : { 1, 4 }) {
+		size_t points_c;
+		if (fit_file_run(c, in, csv_file.c_str(), spnm::FIT_CSV,
+		                 threads_c, &points_c) != c->correct ||
+		    fit_file_run(c, in, binary_file.c_str(), spnm::FIT_BINARY,
+		                 threads_c, &points_c) != c->correct) {
+			c->log += RED "FAILED fit of files for '" +
+			          std::string(c->fx) + "'\n" RESET;
+			c->failed_c++;
+		}
+	}
+	unlink(csv_file.c_str());
+	unlink(binary_file.c_str());
+
+	/* points over several chunks, with lines across their ends, should all
+	 * be read and sum the same whatever the threads */
+	size_t n = 120000;
+	x.clear();
+	y.clear();
+	for (size_t i = 0; i < n; i++) {
+		x.push_back(std::to_string(i * 1e-5));
+		y.push_back(std::to_string(1 + 0.5 * i * 1e-5 +
+		                           0.01 * ((i * 7919) % 13)));
+	}
+	if (!fit_files(x, y, &csv_file, &binary_file)) {
+		c->log += RED "FAILED to write the points of '" +
+		          std::string(c->fx) + "'\n" RESET;
+		c->failed_c++;
+		return;
+	}
+	for (const std::string &file : { csv_file, binary_file }) {
+		spnm::fit_format_t format = file == csv_file ? spnm::FIT_CSV :
+		                                               spnm::FIT_BINARY;
+		size_t             serial_c, parallel_c;
+		std::string serial = fit_file_run(c, in, file.c_str(), format,
+		                                  1, &serial_c);
+		std::string parallel = fit_file_run(c, in, file.c_str(),
+		                                    format, 4, &parallel_c);
+		if (serial == "" || serial != parallel || serial_c != n ||
+		    parallel_c != n) {
+			c->log += RED "FAILED fit of chunked files for '" +
+			          std::string(c->fx) + "'\n" RESET;
+			c->failed_c++;
+		}
+	}
+	unlink(csv_file.c_str());
+	unlink(binary_file.c_str());
+}
+
+/* = 7 - NUMERICAL DIFFERENTIATION = */
+
+struct differentiation_case {
+	const char           *x, *h;
+	spnm::difference_t    difference;
+	spnm::extrapolation_t extrapolation;
+};
+
+/* Returns the steps of the differentiation `t` as text, the row of the table
+ * in place of the derivative for richardson. */
+std::string
+differentiation_format(const spnm::differentiation_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::differentiation_s *step = t->steps + i;
+		out += std::to_string(step->n) + "\t" + step->h;
+		if (t->extrapolation != spnm::EXTRAPOLATION_RICHARDSON) {
+			out += "\t" + std::string(step->derivative) + "\n";
+			continue;
+		}
+		for (size_t j = 0; j < step->n; j++)
+			out += "\t" + std::string(step->richardson[j]);
+		out += "\n";
+	}
+
+	return out;
+}
+
+void
+test_differentiation(test_case *c, const differentiation_case &in)
+{
+	check_method<spnm::differentiation_t, spnm::differentiation_step>(
+		c, "differentiation", c->correct,
+		[&]() {
+			return spnm::differentiation_init(
+				c->fx, in.x, in.h, in.difference,
+				in.extrapolation, c->process, c->process_n);
+		},
+		spnm::differentiation_perform, spnm::differentiation_steps,
+		spnm::differentiation_free, differentiation_format);
+}
+
+/* = 8 - EIGENVALUES = */
+
+struct power_iteration_case {
+	const char          *initial_vector;
+	spnm::power_method_t method;
+	const char          *shift;
+};
+
+/* Returns the steps of the power iteration `t` as text. */
+std::string
+power_iteration_format(const spnm::power_iteration_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::power_iteration_s *step = t->steps + i;
+		out += std::to_string(step->n) + "\t" + step->eigenvalue;
+		for (size_t j = 0; j < t->rows_c; j++)
+			out += "\t" + std::string(step->x_next[j]);
+		out += "\n";
+	}
+
+	return out;
+}
+
+void
+test_power_iteration(test_case *c, const power_iteration_case &in)
+{
+	check_method<spnm::power_iteration_t, spnm::power_iteration_step>(
+		c, "power iteration", c->correct,
+		[&]() {
+			return spnm::power_iteration_init(
+				c->fx, in.initial_vector, in.method, in.shift,
+				c->process, c->process_n);
+		},
+		spnm::power_iteration_perform, spnm::power_iteration_steps,
+		spnm::power_iteration_free, power_iteration_format);
+}
+
+struct qr_algorithm_case {
+};
+
+/* Returns the steps of the qr algorithm `t` followed by the real and the
+ * imaginary parts of the eigenvalues as text. */
+std::string
+qr_algorithm_format(const spnm::qr_algorithm_t *t)
+{
+	std::string out = "";
+	for (size_t i = 0; i < t->steps_c; i++) {
+		const spnm::qr_algorithm_s *step = t->steps + i;
+		out += std::to_string(step->n) + "\t" +
+		       std::to_string(step->active) + "\t" +
+		       step->subdiagonal + "\n";
+	}
+	out += "re";
+	for (size_t i = 0; i < t->rows_c; i++)
+		out += "\t" + std::string(t->re[i]);
+	out += "\nim";
+	for (size_t i = 0; i < t->rows_c; i++)
+		out += "\t" + std::string(t->im[i]);
+	out += "\n";
+
+	return out;
+}
+
+/* Returns the eigenvalues of the 160 x 160 matrix of sin(i) as its i-th
+ * entry on `threads_c` threads as text. */
+std::string
+qr_algorithm_sin_run(size_t threads_c)
+{
+	const size_t        n = 160;
+	std::vector<double> a(n * n);
+	for (size_t i = 0; i < n * n; i++)
+		a[i] = sin((double)i);
+
+	spnm::qr_algorithm_t qr_algorithm_instance =
+		spnm::qr_algorithm_init_values(a.data(), n,
+	                                       spnm::SIGNIFICANT_DIGITS, 12);
+	qr_algorithm_instance.threads_c = threads_c;
+
+	std::string out = "";
+	if (spnm::qr_algorithm_perform(&qr_algorithm_instance) == 0)
+		out = qr_algorithm_format(&qr_algorithm_instance);
+	spnm::qr_algorithm_free(&qr_algorithm_instance);
+
+	return out;
+}
+
+void
+test_qr_algorithm(test_case *c, const qr_algorithm_case &)
+{
+	check_method<spnm::qr_algorithm_t, spnm::qr_algorithm_step>(
+		c, "qr algorithm", c->correct,
+		[&]() {
+			return spnm::qr_algorithm_init(c->fx, c->process,
+		                                       c->process_n);
+		},
+		spnm::qr_algorithm_perform, spnm::qr_algorithm_steps,
+		spnm::qr_algorithm_free, qr_algorithm_format);
+	if (!strcmp(c->correct, ""))
+		return;
+
+	/* the reflectors taken tile by tile shouldn't depend on the threads */
+	check_threads(c, "qr algorithm", qr_algorithm_sin_run, NULL);
+}
+
+/* = RUNNER = */
+
+/* Runs and times the case `c` checking it against the latency budget. */
+void
+run_case(test_case *c, double budget_ms)
+{
+	auto start = std::chrono::steady_clock::now();
+	c->test(c);
+	auto end   = std::chrono::steady_clock::now();
+	c->time_ms = std::chrono::duration<double, std::milli>(end - start)
+	                     .count();
+
+	if (c->time_ms > budget_ms) {
 		char buffer[1024];
-		sprintf(buffer, "%lu\t%s\t%s\t%s\t%s\t%s\t%s\n",
-		        secant_instance.steps[i].n,
-		        secant_instance.steps[i].x_prev,
-		        secant_instance.steps[i].fx_prev,
-		        secant_instance.steps[i].x_n,
-		        secant_instance.steps[i].fx_n,
-		        secant_instance.steps[i].x_next,
-		        secant_instance.steps[i].fx_next);
-		strcat(output_buffer, buffer);
+		snprintf(buffer, sizeof(buffer),
+		         RED "FAILED budget for '%s': %.3f ms > %.3f ms\n" RESET,
+		         c->fx, c->time_ms, budget_ms);
+		c->log += buffer;
+		c->failed_c++;
 	}
+}
 
-	if (strcmp(output_buffer, correct)) {
-		fprintf(stderr, RED "FAILED secant for '%s':\n" RESET, fx);
-		fprintf(stderr, RED "%s" RESET, output_buffer);
-		fprintf(stderr, GRN "%s\n" RESET, correct);
-		test_failed_c++;
+/* Runs all the `cases` concurrently on `threads_c` threads. */
+void
+run_cases(std::vector<test_case> *cases, size_t threads_c, double budget_ms)
+{
+	std::atomic<size_t>      next(0);
+	std::vector<std::thread> threads;
+
+	for (size_t i = 0; i < threads_c; i++) {
+		threads.emplace_back([&]() {
+			size_t c;
+			while ((c = next++) < cases->size())
+				run_case(&(*cases)[c], budget_ms);
+		});
 	}
+	for (std::thread &thread : threads)
+		thread.join();
+}
+
+/* Adds the case of `fx` checked by `test` with the inputs `in` of the
+ * method. */
+template <typename I>
+void
+add_case(std::vector<test_case> *cases, void (*test)(test_case *, const I &),
+         const char *fx, I in, spnm::process_t process, size_t process_n,
+         const char *correct)
+{
+	test_case c;
+	c.fx        = fx;
+	c.process   = process;
+	c.process_n = process_n;
+	c.correct   = correct;
+	c.test      = [test, in](test_case *c) { test(c, in); };
+	c.failed_c  = 0;
+	c.time_ms   = 0;
+	cases->push_back(c);
 }
 
 int
-main(void)
+main(int argc, char **argv)
 {
+	/* = OPTIONS = */
+
+	/* -j threads, -b latency budget of a case in ms */
+	size_t threads_c = std::thread::hardware_concurrency();
+	double budget_ms = BUDGET_MS_DEFAULT;
+	for (int i = 1; i + 1 < argc; i += 2) {
+		if (!strcmp(argv[i], "-j"))
+			threads_c = atoi(argv[i + 1]);
+		else if (!strcmp(argv[i], "-b"))
+			budget_ms = atof(argv[i + 1]);
+	}
+	if (threads_c == 0)
+		threads_c = std::thread::hardware_concurrency();
+	if (threads_c == 0)
+		threads_c = 1;
+
 	/* = TESTS = */
 
+	std::vector<test_case> cases;
+
+	/* = COMPARISON = */
+
+	add_case(&cases, test_is_equal, "2.0", { "2.0000" },
+	         spnm::DECIMAL_PLACES, 4, correct_equal);
+	add_case(&cases, test_is_equal, "-0.12345", { "-0.12349" },
+	         spnm::DECIMAL_PLACES, 4, correct_equal);
+	/* the decimals alone are the same */
+	add_case(&cases, test_is_equal, "4.0", { "2.0" }, spnm::DECIMAL_PLACES,
+	         4, correct_not_equal);
+	add_case(&cases, test_is_equal, "-5.0", { "5.0" }, spnm::DECIMAL_PLACES,
+	         4, correct_not_equal);
+	add_case(&cases, test_is_equal, "13.25", { "3.25" },
+	         spnm::DECIMAL_PLACES, 2, correct_not_equal);
+	add_case(&cases, test_is_equal, "2.0", { "2.0" },
+	         spnm::SIGNIFICANT_DIGITS, 4, correct_equal);
+	/* the digits alone are the same */
+	add_case(&cases, test_is_equal, "1200.0", { "120.0" },
+	         spnm::SIGNIFICANT_DIGITS, 2, correct_not_equal);
+
+	/* = EXPRESSION = */
+
+	add_case(&cases, test_expr_optimize, "e^x - x - 2", { "0" },
+	         spnm::DECIMAL_PLACES, 0, correct_expr_optimize_1);
+	/* the terms in p only are hoisted, sin(p^2 + 1) once */
+	add_case(&cases, test_expr_optimize,
+	         "sin(p^2 + 1) x^2 + sin(p^2 + 1) x + sqrt(p)", { "2" },
+	         spnm::DECIMAL_PLACES, 0, correct_expr_optimize_2);
+	add_case(&cases, test_expr_optimize, "x^-3 + x^0 + x^1 + -(-x)",
+	         { "0" }, spnm::DECIMAL_PLACES, 0, correct_expr_optimize_3);
+	add_case(&cases, test_expr_optimize, "(x + 1)^2 + (1 + x)^2 - 2*3",
+	         { "0" }, spnm::DECIMAL_PLACES, 0, correct_expr_optimize_4);
+
 	/* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
 
 	/* == 1. bisection method == */
 
-	test_bisection("x^3 - 3x + 1", "0", "1", spnm::DECIMAL_PLACES, 3,
-	               correct_bisection_1);
-	test_bisection("x^3 - 2 sin(x)", "0.5", "2", spnm::SIGNIFICANT_DIGITS,
-	               5, correct_bisection_2);
-	test_bisection("x*e^x - 1", "0", "1", spnm::DECIMAL_PLACES, 3,
-	               correct_bisection_3);
-	test_bisection("e^x - x - 2", "1", "2", spnm::SIGNIFICANT_DIGITS, 4,
-	               correct_bisection_4);
-	test_bisection("sin(x) - 2x + 1", "0", "1", spnm::DECIMAL_PLACES, 4,
-	               correct_bisection_5);
-	test_bisection("log(x) - cos(x)", "1", "2", spnm::DECIMAL_PLACES, 3,
-	               correct_bisection_6);
+	add_case(&cases, test_bisection, "x^3 - 3x + 1", { "0", "1" },
+	         spnm::DECIMAL_PLACES, 3, correct_bisection_1);
+	add_case(&cases, test_bisection, "x^3 - 2 sin(x)", { "0.5", "2" },
+	         spnm::SIGNIFICANT_DIGITS, 5, correct_bisection_2);
+	add_case(&cases, test_bisection, "x*e^x - 1", { "0", "1" },
+	         spnm::DECIMAL_PLACES, 3, correct_bisection_3);
+	add_case(&cases, test_bisection, "e^x - x - 2", { "1", "2" },
+	         spnm::SIGNIFICANT_DIGITS, 4, correct_bisection_4);
+	add_case(&cases, test_bisection, "sin(x) - 2x + 1", { "0", "1" },
+	         spnm::DECIMAL_PLACES, 4, correct_bisection_5);
+	add_case(&cases, test_bisection, "log(x) - cos(x)", { "1", "2" },
+	         spnm::DECIMAL_PLACES, 3, correct_bisection_6);
+	/* the decimals of 4.0 and 2.0 agree but not their integer parts */
+	add_case(&cases, test_bisection, "x - 3.3", { "0", "8" },
+	         spnm::DECIMAL_PLACES, 4, correct_bisection_7);
 
 	/* == 2. secant method == */
 
-	test_secant("x^3 - 3x + 1", "0", "1", spnm::DECIMAL_PLACES, 3,
-	            correct_secant_1);
-	test_secant("3x + sin(x) - e^x", "0", "1", spnm::NO_OF_STEPS, 6,
-	            correct_secant_2);
-	test_secant("x^3 + x^2 - 3x - 3", "1", "2", spnm::SIGNIFICANT_DIGITS, 5,
-	            correct_secant_3);
-	test_secant("x^5 + x^3 + 3", "1", "-1", spnm::DECIMAL_PLACES, 4,
-	            correct_secant_4);
-	test_secant("sin(x) - 2x + 1", "0", "1", spnm::DECIMAL_PLACES, 4,
-	            correct_secant_5);
+	add_case(&cases, test_secant, "x^3 - 3x + 1", { "0", "1" },
+	         spnm::DECIMAL_PLACES, 3, correct_secant_1);
+	add_case(&cases, test_secant, "3x + sin(x) - e^x", { "0", "1" },
+	         spnm::NO_OF_STEPS, 6, correct_secant_2);
+	add_case(&cases, test_secant, "x^3 + x^2 - 3x - 3", { "1", "2" },
+	         spnm::SIGNIFICANT_DIGITS, 5, correct_secant_3);
+	add_case(&cases, test_secant, "x^5 + x^3 + 3", { "1", "-1" },
+	         spnm::DECIMAL_PLACES, 4, correct_secant_4);
+	add_case(&cases, test_secant, "sin(x) - 2x + 1", { "0", "1" },
+	         spnm::DECIMAL_PLACES, 4, correct_secant_5);
+
+	/* == 3. fixed point iteration == */
+
+	add_case(&cases, test_fixed_point, "(x^3 + 1)/3",
+	         { "0", spnm::ACCEL_NONE }, spnm::DECIMAL_PLACES, 3,
+	         correct_fixed_point_1);
+	add_case(&cases, test_fixed_point, "(x^3 + 1)/3",
+	         { "0", spnm::ACCEL_AITKEN }, spnm::DECIMAL_PLACES, 3,
+	         correct_fixed_point_2);
+	add_case(&cases, test_fixed_point, "cos(x)",
+	         { "1", spnm::ACCEL_AITKEN }, spnm::DECIMAL_PLACES, 4,
+	         correct_fixed_point_3);
+	add_case(&cases, test_fixed_point, "cos(x)",
+	         { "1", spnm::ACCEL_STEFFENSEN }, spnm::DECIMAL_PLACES, 4,
+	         correct_fixed_point_4);
+	add_case(&cases, test_fixed_point, "e^(-x)",
+	         { "0.5", spnm::ACCEL_STEFFENSEN }, spnm::SIGNIFICANT_DIGITS,
+	         5, correct_fixed_point_5);
+
+	/* == 4. newton's method for systems == */
+
+	add_case(&cases, test_newton_system, "x^2 + y^2 - 4; x*y - 1",
+	         { { "2", "0.5" }, { "x", "y" } }, spnm::DECIMAL_PLACES, 4,
+	         correct_newton_system_1);
+	add_case(&cases, test_newton_system, "x^2 + x*y - 10; y + 3x*y^2 - 57",
+	         { { "1.5", "3.5" }, { "x", "y" } }, spnm::SIGNIFICANT_DIGITS,
+	         4, correct_newton_system_2);
+	add_case(&cases, test_newton_system,
+	         "3a - cos(b*c) - 0.5; a^2 - 81(b + 0.1)^2 + sin(c) + 1.06; "
+	         "e^(-a*b) + 20c + (10pi - 3)/3",
+	         { { "0.1", "0.1", "-0.1" }, { "a", "b", "c" } },
+	         spnm::NO_OF_STEPS, 4, correct_newton_system_3);
+
+	/* == 5. newton-krylov method == */
+
+	add_case(&cases, test_newton_krylov, "l - 2c + r + e^c/(n + 1)^2",
+	         { { "l", "c", "r" }, { -1, 0, 1 }, 99, "0", "0", "0",
+	           spnm::PRECOND_JACOBI },
+	         spnm::DECIMAL_PLACES, 6, correct_newton_krylov_1);
+	add_case(&cases, test_newton_krylov, "l - 2c + r + e^c/(n + 1)^2",
+	         { { "l", "c", "r" }, { -1, 0, 1 }, 5000, "0", "0", "0",
+	           spnm::PRECOND_ILU0 },
+	         spnm::SIGNIFICANT_DIGITS, 6, correct_newton_krylov_2);
+	add_case(&cases, test_newton_krylov,
+	         "ll - 4l + 6c - 4r + rr + (c^3 - 1)/(n + 1)^4",
+	         { { "ll", "l", "c", "r", "rr" }, { -2, -1, 0, 1, 2 }, 3000,
+	           "1", "1", "0", spnm::PRECOND_ILU0 },
+	         spnm::DECIMAL_PLACES, 4, correct_newton_krylov_3);
+
+	/* == 6. parameter sweep == */
+
+	add_case(&cases, test_sweep, "x^3 - p",
+	         { "p", "1", "8", 15, spnm::SWEEP_SECANT, "1", "2" },
+	         spnm::DECIMAL_PLACES, 5, correct_sweep_1);
+	add_case(&cases, test_sweep, "x^3 - p",
+	         { "p", "1", "8", 15, spnm::SWEEP_BISECTION, "0", "3" },
+	         spnm::DECIMAL_PLACES, 4, correct_sweep_2);
+	add_case(&cases, test_sweep, "cos(x) - a*x",
+	         { "a", "0.5", "4", 100, spnm::SWEEP_SECANT, "0", "1" },
+	         spnm::SIGNIFICANT_DIGITS, 4, correct_sweep_3);
+
+	/* == 7. root isolation == */
+
+	add_case(&cases, test_isolate, "x^3 - 3x + 1",
+	         { "-3", "3", "0.000001" }, spnm::DECIMAL_PLACES, 4,
+	         correct_isolate_1);
+	/* no sign change over [-1, 1] for the bisection method alone */
+	add_case(&cases, test_isolate, "x^2 - 0.0001",
+	         { "-1", "1", "0.000001" }, spnm::SIGNIFICANT_DIGITS, 3,
+	         correct_isolate_2);
+	/* the poles are possible roots */
+	add_case(&cases, test_isolate, "tan(x) - x", { "1", "5", "0.000001" },
+	         spnm::NO_OF_STEPS, 5, correct_isolate_3);
+
+	/* == 8. polynomial roots == */
+
+	add_case(&cases, test_polynomial_roots, "x^3 - 3x + 1", {},
+	         spnm::DECIMAL_PLACES, 3, correct_polynomial_roots_1);
+	/* the double root is bisected on the square-free part */
+	add_case(&cases, test_polynomial_roots, "(x - 1)^2 (x - 2)", {},
+	         spnm::SIGNIFICANT_DIGITS, 3, correct_polynomial_roots_2);
+	add_case(&cases, test_polynomial_roots, "x^2 + 1", {},
+	         spnm::DECIMAL_PLACES, 4, correct_polynomial_roots_3);
+	add_case(&cases, test_polynomial_roots, "(x - 1)^3 (x + 2)^2 x", {},
+	         spnm::NO_OF_STEPS, 4, correct_polynomial_roots_4);
+	/* close roots taken for a double one */
+	add_case(&cases, test_polynomial_roots, "(x - 1)(x - 1.0000001)", {},
+	         spnm::DECIMAL_PLACES, 4, correct_polynomial_roots_5);
+
+	/* = 2 - NUMERICAL INTEGRATION = */
+
+	/* == 1. newton-cotes and romberg == */
+
+	add_case(&cases, test_integration, "e^x",
+	         { "0", "1", spnm::QUAD_TRAPEZOIDAL }, spnm::DECIMAL_PLACES, 4,
+	         correct_integration_1);
+	add_case(&cases, test_integration, "1/(1 + x^2)",
+	         { "0", "1", spnm::QUAD_SIMPSON_13 }, spnm::DECIMAL_PLACES, 6,
+	         correct_integration_2);
+	add_case(&cases, test_integration, "sqrt(1 + x^3)",
+	         { "0", "2", spnm::QUAD_SIMPSON_38 }, spnm::SIGNIFICANT_DIGITS,
+	         5, correct_integration_3);
+	add_case(&cases, test_integration, "sin(x)",
+	         { "0", "pi", spnm::QUAD_ROMBERG }, spnm::DECIMAL_PLACES, 6,
+	         correct_integration_4);
+	add_case(&cases, test_integration, "e^(-x^2)",
+	         { "0", "1", spnm::QUAD_ROMBERG }, spnm::NO_OF_STEPS, 4,
+	         correct_integration_5);
+
+	/* == 2. adaptive gauss-kronrod == */
+
+	/* singular at 0 */
+	add_case(&cases, test_gauss_kronrod, "log(x)", { "0", "1", "0.000001" },
+	         spnm::DECIMAL_PLACES, 6, correct_gauss_kronrod_1);
+	/* a peak at 0.3 */
+	add_case(&cases, test_gauss_kronrod, "1/(0.0001 + (x - 0.3)^2)",
+	         { "0", "1", "0.000000001" }, spnm::SIGNIFICANT_DIGITS, 8,
+	         correct_gauss_kronrod_2);
+	/* oscillating faster and faster towards 0 */
+	add_case(&cases, test_gauss_kronrod, "sin(1/x)",
+	         { "0.001", "1", "0.0000000001" }, spnm::DECIMAL_PLACES, 8,
+	         correct_gauss_kronrod_3);
+
+	/* = 3 - ORDINARY DIFFERENTIAL EQUATIONS = */
+
+	/* == 1. initial value problems == */
+
+	add_case(&cases, test_ode, "x + y",
+	         { "0", "1", "0.5", "0.1", spnm::ODE_EULER, "0" },
+	         spnm::DECIMAL_PLACES, 4, correct_ode_1);
+	add_case(&cases, test_ode, "x + y",
+	         { "0", "1", "0.5", "0.1", spnm::ODE_HEUN, "0" },
+	         spnm::DECIMAL_PLACES, 4, correct_ode_2);
+	/* the last step is cut short */
+	add_case(&cases, test_ode, "y - x^2 + 1",
+	         { "0", "0.5", "2", "0.3", spnm::ODE_RK4, "0" },
+	         spnm::SIGNIFICANT_DIGITS, 6, correct_ode_3);
+	/* backwards */
+	add_case(&cases, test_ode, "-y",
+	         { "1", "1", "0", "0.25", spnm::ODE_RK4, "0" },
+	         spnm::DECIMAL_PLACES, 5, correct_ode_4);
+	add_case(&cases, test_ode, "-2x*y",
+	         { "0", "1", "1", "0.1", spnm::ODE_RK45, "0.000001" },
+	         spnm::DECIMAL_PLACES, 6, correct_ode_5);
+	/* values beyond 1e12 */
+	add_case(&cases, test_ode, "100*y",
+	         { "0", "1", "2", "0.1", spnm::ODE_EULER, "0" },
+	         spnm::DECIMAL_PLACES, 2, correct_ode_6);
+	add_case(&cases, test_ode, "100*y",
+	         { "0", "1", "2", "0.1", spnm::ODE_EULER, "0" },
+	         spnm::SIGNIFICANT_DIGITS, 4, correct_ode_7);
+	/* past the pole at x = 1 until y overflows */
+	add_case(&cases, test_ode, "y^2",
+	         { "0", "1", "2.1", "0.1", spnm::ODE_RK4, "0" },
+	         spnm::DECIMAL_PLACES, 6, correct_ode_8);
+
+	/* = 4 - LINEAR SYSTEMS = */
+
+	/* == 1. gaussian elimination and lu decomposition == */
+
+	add_case(&cases, test_elimination, "2, 1, -1; -3, -1, 2; -2, 1, 2",
+	         { "8; -11; -3", spnm::ELIMINATION_GAUSS },
+	         spnm::DECIMAL_PLACES, 4, correct_elimination_1);
+	add_case(&cases, test_elimination, "4, -2, 1; -2, 4, -2; 1, -2, 4",
+	         { "11; -16; 17", spnm::ELIMINATION_LU },
+	         spnm::SIGNIFICANT_DIGITS, 5, correct_elimination_2);
+	/* a zero pivot to begin with */
+	add_case(&cases, test_elimination,
+	         "0, 2, 1, 4; 1, 1, 2, 6; 2, 1, 1, 7; 1, 2/3, sqrt(2), 1",
+	         { "1; 2; 3; 4", spnm::ELIMINATION_GAUSS },
+	         spnm::DECIMAL_PLACES, 6, correct_elimination_3);
+	add_case(&cases, test_elimination, "1, 1, 1; 0, 2, 5; 2, 5, -1",
+	         { "6; -4; 27", spnm::ELIMINATION_LU }, spnm::NO_OF_STEPS, 3,
+	         correct_elimination_4);
+	/* singular */
+	add_case(&cases, test_elimination, "1, 2; 2, 4",
+	         { "1; 2", spnm::ELIMINATION_GAUSS }, spnm::DECIMAL_PLACES, 4,
+	         correct_elimination_5);
+
+	/* == 2. iterative methods == */
+
+	add_case(&cases, test_iterative, "4, 1, 0; 1, 4, 1; 0, 1, 4",
+	         { "5; 6; 5", "0", spnm::ITERATIVE_JACOBI, "1", 0 },
+	         spnm::DECIMAL_PLACES, 4, correct_iterative_1);
+	add_case(&cases, test_iterative,
+	         "10, -1, 2, 0; -1, 11, -1, 3; 2, -1, 10, -1; 0, 3, -1, 8",
+	         { "6; 25; -11; 15", "0", spnm::ITERATIVE_GAUSS_SEIDEL, "1",
+	           0 },
+	         spnm::SIGNIFICANT_DIGITS, 5, correct_iterative_2);
+	add_case(&cases, test_iterative, "4, 3, 0; 3, 4, -1; 0, -1, 4",
+	         { "24; 30; -24", "1", spnm::ITERATIVE_SOR, "1.25", 0 },
+	         spnm::DECIMAL_PLACES, 5, correct_iterative_3);
+	/* the even rows and then the odd rows */
+	add_case(&cases, test_iterative,
+	         "4, -1, 0, 0, 0; -1, 4, -1, 0, 0; 0, -1, 4, -1, 0; "
+	         "0, 0, -1, 4, -1; 0, 0, 0, -1, 4",
+	         { "3; 2; 2; 2; 3", "0", spnm::ITERATIVE_GAUSS_SEIDEL, "1",
+	           1 },
+	         spnm::DECIMAL_PLACES, 6, correct_iterative_4);
+	add_case(&cases, test_iterative, "4, 3, 0; 3, 4, -1; 0, -1, 4",
+	         { "24; 30; -24", "1", spnm::ITERATIVE_SOR, "1.25", 1 },
+	         spnm::NO_OF_STEPS, 6, correct_iterative_5);
+	/* the relaxation factor out of (0, 2) */
+	add_case(&cases, test_iterative, "4, 1; 1, 4",
+	         { "5; 5", "0", spnm::ITERATIVE_SOR, "2", 0 },
+	         spnm::DECIMAL_PLACES, 4, correct_iterative_6);
+	/* not diagonally dominant, diverging */
+	add_case(&cases, test_iterative, "1, 2; 2, 1",
+	         { "5; 5", "0", spnm::ITERATIVE_JACOBI, "1", 0 },
+	         spnm::DECIMAL_PLACES, 4, correct_iterative_7);
+	add_case(&cases, test_iterative, "1, 2; 2, 1",
+	         { "5; 5", "0", spnm::ITERATIVE_GAUSS_SEIDEL, "1", 0 },
+	         spnm::NO_OF_STEPS, 30, correct_iterative_8);
+
+	/* == 3. conjugate gradient == */
+
+	add_case(&cases, test_conjugate_gradient, "4, 1; 1, 3",
+	         { "1; 2", "0", spnm::PRECOND_NONE }, spnm::DECIMAL_PLACES, 6,
+	         correct_conjugate_gradient_1);
+	add_case(&cases, test_conjugate_gradient,
+	         "4, -1, 0, 0, 0; -1, 4, -1, 0, 0; 0, -1, 4, -1, 0; "
+	         "0, 0, -1, 4, -1; 0, 0, 0, -1, 4",
+	         { "1; 2; 3; 4; 5", "0", spnm::PRECOND_JACOBI },
+	         spnm::SIGNIFICANT_DIGITS, 6, correct_conjugate_gradient_2);
+	/* fill-in dropped by the incomplete factorizations */
+	add_case(&cases, test_conjugate_gradient,
+	         "6, 1, 0, 2; 1, 5, 1, 0; 0, 1, 7, 1; 2, 0, 1, 8",
+	         { "1; 0; 1; 0", "1", spnm::PRECOND_IC0 }, spnm::DECIMAL_PLACES,
+	         7, correct_conjugate_gradient_3);
+	add_case(&cases, test_conjugate_gradient,
+	         "6, 1, 0, 2; 1, 5, 1, 0; 0, 1, 7, 1; 2, 0, 1, 8",
+	         { "1; 0; 1; 0", "1", spnm::PRECOND_ILU0 }, spnm::NO_OF_STEPS,
+	         3, correct_conjugate_gradient_4);
+	/* indefinite */
+	add_case(&cases, test_conjugate_gradient, "1, 2; 2, 1",
+	         { "1; 2", "0", spnm::PRECOND_NONE }, spnm::DECIMAL_PLACES, 6,
+	         correct_conjugate_gradient_5);
+
+	/* = 5 - INTERPOLATION = */
+
+	/* == 1. newton's and lagrange's interpolation == */
+
+	add_case(&cases, test_interpolation, "1; 2; 3; 4; 5",
+	         { "1; 8; 27; 64; 125", spnm::INTERPOLATION_FORWARD, "1.5" },
+	         spnm::DECIMAL_PLACES, 4, correct_interpolation_1);
+	add_case(&cases, test_interpolation, "0.1; 0.2; 0.3; 0.4; 0.5",
+	         { "1.1052; 1.2214; 1.3499; 1.4918; 1.6487",
+	           spnm::INTERPOLATION_BACKWARD, "0.45" },
+	         spnm::SIGNIFICANT_DIGITS, 5, correct_interpolation_2);
+	add_case(&cases, test_interpolation, "0; 1; 3; 4; 7",
+	         { "1; 3; 49; 129; 813", spnm::INTERPOLATION_DIVIDED, "2" },
+	         spnm::DECIMAL_PLACES, 5, correct_interpolation_3);
+	add_case(&cases, test_interpolation, "5; 7; 11; 13; 17",
+	         { "150; 392; 1452; 2366; 5202", spnm::INTERPOLATION_LAGRANGE,
+	           "9" },
+	         spnm::SIGNIFICANT_DIGITS, 6, correct_interpolation_4);
+	add_case(&cases, test_interpolation, "0; pi/6; pi/3; pi/2",
+	         { "0; 1/2; sqrt(3)/2; 1", spnm::INTERPOLATION_DIVIDED,
+	           "pi/4" },
+	         spnm::NO_OF_STEPS, 3, correct_interpolation_5);
+	/* not equally spaced */
+	add_case(&cases, test_interpolation, "0; 1; 3",
+	         { "1; 2; 3", spnm::INTERPOLATION_FORWARD, "1" },
+	         spnm::DECIMAL_PLACES, 4, correct_interpolation_6);
+
+	/* == 2. cubic splines == */
+
+	add_case(&cases, test_spline, "0; 1; 2; 3",
+	         { "1; e; e^2; e^3", "1.5", spnm::SPLINE_NATURAL, NULL },
+	         spnm::DECIMAL_PLACES, 5, correct_spline_1);
+	/* a cubic with its slopes is its own spline */
+	add_case(&cases, test_spline, "0; 1; 2; 3",
+	         { "0; 1; 8; 27", "1.5", spnm::SPLINE_CLAMPED, "0; 27" },
+	         spnm::DECIMAL_PLACES, 4, correct_spline_2);
+	add_case(&cases, test_spline, "0.9; 1.3; 1.9; 2.1; 2.6",
+	         { "1.3; 1.5; 1.85; 2.1; 2.6", "2", spnm::SPLINE_NATURAL,
+	           NULL },
+	         spnm::SIGNIFICANT_DIGITS, 5, correct_spline_3);
+	add_case(&cases, test_spline, "0; pi/4; pi/2",
+	         { "0; sqrt(2)/2; 1", "pi/3", spnm::SPLINE_CLAMPED, "1; 0" },
+	         spnm::NO_OF_STEPS, 2, correct_spline_4);
+	/* a quadratic, d rounding off to 0 */
+	add_case(&cases, test_spline, "0; 1; 2",
+	         { "0; 1; 4", "1.5", spnm::SPLINE_CLAMPED, "0; 4" },
+	         spnm::DECIMAL_PLACES, 5, correct_spline_6);
+	/* not in increasing order */
+	add_case(&cases, test_spline, "0; 2; 1",
+	         { "0; 1; 8", "1.5", spnm::SPLINE_NATURAL, NULL },
+	         spnm::DECIMAL_PLACES, 4, correct_spline_5);
+
+	/* = 6 - CURVE FITTING = */
+
+	/* == 1. least squares == */
+
+	add_case(&cases, test_fit, "1; 2; 3; 4; 5; 6",
+	         { "1.2; 1.9; 3.2; 3.8; 5.1; 6.0", spnm::FIT_LINE, 1 },
+	         spnm::DECIMAL_PLACES, 4, correct_fit_1);
+	add_case(&cases, test_fit, "0; 1; 2; 3; 4",
+	         { "1; 1.8; 1.3; 2.5; 6.3", spnm::FIT_POLYNOMIAL, 2 },
+	         spnm::DECIMAL_PLACES, 4, correct_fit_2);
+	add_case(&cases, test_fit, "1; 2; 3; 4",
+	         { "7; 11; 17; 27", spnm::FIT_EXPONENTIAL, 1 },
+	         spnm::SIGNIFICANT_DIGITS, 4, correct_fit_3);
+	/* a cubic is its own fit */
+	add_case(&cases, test_fit, "0; 1; 2; 3; -1; -2",
+	         { "1; 1; 9; 31; 3; 1", spnm::FIT_POLYNOMIAL, 3 },
+	         spnm::NO_OF_STEPS, 3, correct_fit_4);
+	/* a single distinct x */
+	add_case(&cases, test_fit, "1; 1; 1", { "1; 2; 3", spnm::FIT_LINE, 1 },
+	         spnm::DECIMAL_PLACES, 4, correct_fit_5);
+
+	/* = 7 - NUMERICAL DIFFERENTIATION = */
+
+	/* == 1. finite differences and richardson == */
+
+	add_case(&cases, test_differentiation, "sin(x)",
+	         { "1", "0.4", spnm::DIFFERENCE_CENTRAL,
+	           spnm::EXTRAPOLATION_RICHARDSON },
+	         spnm::DECIMAL_PLACES, 6, correct_differentiation_1);
+	add_case(&cases, test_differentiation, "e^x",
+	         { "0", "0.1", spnm::DIFFERENCE_FORWARD,
+	           spnm::EXTRAPOLATION_NONE },
+	         spnm::DECIMAL_PLACES, 3, correct_differentiation_2);
+	add_case(&cases, test_differentiation, "x^3",
+	         { "2", "0.5", spnm::DIFFERENCE_BACKWARD,
+	           spnm::EXTRAPOLATION_RICHARDSON },
+	         spnm::SIGNIFICANT_DIGITS, 6, correct_differentiation_3);
+	add_case(&cases, test_differentiation, "ln(x)",
+	         { "1", "0.2", spnm::DIFFERENCE_FORWARD,
+	           spnm::EXTRAPOLATION_RICHARDSON },
+	         spnm::NO_OF_STEPS, 4, correct_differentiation_4);
+	add_case(&cases, test_differentiation, "cos(x)",
+	         { "pi/4", "0.1", spnm::DIFFERENCE_CENTRAL,
+	           spnm::EXTRAPOLATION_NONE },
+	         spnm::DECIMAL_PLACES, 5, correct_differentiation_5);
+	/* no step size */
+	add_case(&cases, test_differentiation, "x^2",
+	         { "1", "0", spnm::DIFFERENCE_CENTRAL,
+	           spnm::EXTRAPOLATION_NONE },
+	         spnm::DECIMAL_PLACES, 4, correct_differentiation_6);
+
+	/* = 8 - EIGENVALUES = */
+
+	/* == 1. power method and inverse iteration == */
+
+	add_case(&cases, test_power_iteration, "2, 1, 0; 1, 3, 1; 0, 1, 4",
+	         { "1; 1; 1", spnm::POWER_DIRECT, "0" }, spnm::DECIMAL_PLACES,
+	         3, correct_power_iteration_1);
+	add_case(&cases, test_power_iteration, "2, 1, 0; 1, 3, 1; 0, 1, 4",
+	         { "1; 1; 1", spnm::POWER_INVERSE, "1" },
+	         spnm::SIGNIFICANT_DIGITS, 6, correct_power_iteration_2);
+	add_case(&cases, test_power_iteration, "4, 1; 2, 3",
+	         { "1; 0", spnm::POWER_DIRECT, "1" }, spnm::NO_OF_STEPS, 5,
+	         correct_power_iteration_3);
+	/* the shift is an eigenvalue */
+	add_case(&cases, test_power_iteration, "2, 0; 0, 3",
+	         { "1; 1", spnm::POWER_INVERSE, "2" }, spnm::DECIMAL_PLACES, 4,
+	         correct_power_iteration_4);
+	/* x cycling without being an eigenvector */
+	add_case(&cases, test_power_iteration, "0, 1; -1, 0",
+	         { "1; 0", spnm::POWER_DIRECT, "0" }, spnm::DECIMAL_PLACES, 4,
+	         correct_power_iteration_5);
+	add_case(&cases, test_power_iteration, "0, 1; -1, 0",
+	         { "1; 0", spnm::POWER_DIRECT, "0" }, spnm::SIGNIFICANT_DIGITS,
+	         4, correct_power_iteration_6);
+
+	/* == 2. qr algorithm == */
+
+	add_case(&cases, test_qr_algorithm, "2, 1, 0; 1, 3, 1; 0, 1, 4", {},
+	         spnm::DECIMAL_PLACES, 7, correct_qr_algorithm_1);
+	/* two complex conjugate pairs */
+	add_case(&cases, test_qr_algorithm,
+	         "4, -2, 1, 0; 3, 1, 0, 2; 0, 1, 2, -1; 1, 0, 3, 5", {},
+	         spnm::DECIMAL_PLACES, 5, correct_qr_algorithm_2);
+	add_case(&cases, test_qr_algorithm, "1, 2, 3; 4, 5, 6; 7, 8, 10", {},
+	         spnm::SIGNIFICANT_DIGITS, 6, correct_qr_algorithm_3);
+	add_case(&cases, test_qr_algorithm, "1, 2; 3", {}, spnm::DECIMAL_PLACES,
+	         4, correct_qr_algorithm_4);
+
+	/* = RUN = */
+
+	run_cases(&cases, threads_c, budget_ms);
+
+	size_t test_failed_c = 0;
+	for (const test_case &c : cases) {
+		fprintf(stderr, "%10.3f ms  %s\n", c.time_ms, c.fx);
+		fprintf(stderr, "%s", c.log.c_str());
+		test_failed_c += c.failed_c;
+	}
 
 	/* = EXIT = */
 
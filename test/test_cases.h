@@ -1,3 +1,19 @@
+/* = COMPARISON = */
+
+const char *correct_equal = "1\n";
+
+const char *correct_not_equal = "0\n";
+
+/* = EXPRESSION = */
+
+const char *correct_expr_optimize_1 = "7\t6\t2\n";
+
+const char *correct_expr_optimize_2 = "22\t12\t6\n";
+
+const char *correct_expr_optimize_3 = "16\t8\t1\n";
+
+const char *correct_expr_optimize_4 = "15\t7\t2\n";
+
 /* = 1 - SOLUTION OF NONLINEAR EQUATIONS = */
 
 /* == 1. bisection method == */
@@ -85,6 +101,24 @@ const char *correct_bisection_6 = "1\t1\t-\t2\t+\t1.5\t+\n"
 				  "10\t1.3026\t-\t1.3046\t+\t1.3036\t+\n"
 				  "11\t1.3026\t-\t1.3036\t+\t1.3031\t+\n";
 
+const char *correct_bisection_7 = "1\t0\t-\t8\t+\t4.0\t+\n"
+				  "2\t0\t-\t4.0\t+\t2.0\t-\n"
+				  "3\t2.0\t-\t4.0\t+\t3.0\t-\n"
+				  "4\t3.0\t-\t4.0\t+\t3.5\t+\n"
+				  "5\t3.0\t-\t3.5\t+\t3.25\t-\n"
+				  "6\t3.25\t-\t3.5\t+\t3.375\t+\n"
+				  "7\t3.25\t-\t3.375\t+\t3.3125\t+\n"
+				  "8\t3.25\t-\t3.3125\t+\t3.28125\t-\n"
+				  "9\t3.28125\t-\t3.3125\t+\t3.29688\t-\n"
+				  "10\t3.29688\t-\t3.3125\t+\t3.30469\t+\n"
+				  "11\t3.29688\t-\t3.30469\t+\t3.30078\t+\n"
+				  "12\t3.29688\t-\t3.30078\t+\t3.29883\t-\n"
+				  "13\t3.29883\t-\t3.30078\t+\t3.29980\t-\n"
+				  "14\t3.29980\t-\t3.30078\t+\t3.30029\t+\n"
+				  "15\t3.29980\t-\t3.30029\t+\t3.30004\t+\n"
+				  "16\t3.29980\t-\t3.30004\t+\t3.29992\t-\n"
+				  "17\t3.29992\t-\t3.30004\t+\t3.29998\t-\n";
+
 /* == 2. secant method == */
 
 const char *correct_secant_1 =
@@ -124,3 +158,965 @@ const char *correct_secant_5 =
 	"2\t1\t-0.15853\t0.86316\t0.03358\t0.88708\t0.00107\n"
 	"3\t0.86316\t0.03358\t0.88708\t0.00107\t0.88787\t-0.00001\n"
 	"4\t0.88708\t0.00107\t0.88787\t-0.00001\t0.88786\t0.00000\n";
+
+/* == 3. fixed point iteration == */
+
+const char *correct_fixed_point_1 =
+	"1\t0\t0.3333\n"
+	"2\t0.3333\t0.3457\n"
+	"3\t0.3457\t0.3471\n"
+	"4\t0.3471\t0.3473\n";
+
+const char *correct_fixed_point_2 =
+	"1\t0\t0.3333\t0.3457\t0.3462\n"
+	"2\t0.3333\t0.3457\t0.3471\t0.3473\n"
+	"3\t0.3457\t0.3471\t0.3473\t0.3473\n";
+
+const char *correct_fixed_point_3 =
+	"1\t1\t0.54030\t0.85755\t0.72801\n"
+	"2\t0.54030\t0.85755\t0.65429\t0.73366\n"
+	"3\t0.85755\t0.65429\t0.79348\t0.73690\n"
+	"4\t0.65429\t0.79348\t0.70137\t0.73805\n"
+	"5\t0.79348\t0.70137\t0.76396\t0.73864\n"
+	"6\t0.70137\t0.76396\t0.72210\t0.73888\n"
+	"7\t0.76396\t0.72210\t0.75042\t0.73899\n"
+	"8\t0.72210\t0.75042\t0.73140\t0.73904\n"
+	"9\t0.75042\t0.73140\t0.74424\t0.73906\n";
+
+const char *correct_fixed_point_4 =
+	"1\t1\t0.54030\t0.85755\t0.72801\n"
+	"2\t0.72801\t0.7465\t0.73407\t0.73907\n"
+	"3\t0.73907\t0.7391\t0.73908\t0.73909\n";
+
+const char *correct_fixed_point_5 =
+	"1\t0.5\t0.60653\t0.54524\t0.56762\n"
+	"2\t0.56762\t0.56687\t0.5673\t0.56714\n"
+	"3\t0.56714\t0.56714\t0.56714\t0.56714\n";
+
+/* == 4. newton's method for systems == */
+
+const char *correct_newton_system_1 =
+	"1\t2\t0.5\t0.25000\t0\t1.93333\t0.51667\n"
+	"2\t1.93333\t0.51667\t0.00471\t-0.00111\t1.93185\t0.51764\n"
+	"3\t1.93185\t0.51764\t-0.00000\t0.00000\t1.93185\t0.51764\n";
+
+const char *correct_newton_system_2 =
+	"1\t1.5\t3.5\t-2.5000\t1.6250\t2.0360\t2.8439\n"
+	"2\t2.0360\t2.8439\t-0.0645\t-4.7560\t1.9987\t3.0023\n"
+	"3\t1.9987\t3.0023\t-0.0045\t0.05\t2.0\t3.0\n"
+	"4\t2.0\t3.0\t0\t0\t2.0\t3.0\n";
+
+const char *correct_newton_system_3 =
+	"1\t0.1\t0.1\t-0.1\t-1.199950\t-2.269833\t8.462025\t0.49987\t0.019467\t-0.521520\n"
+	"2\t0.49987\t0.019467\t-0.521520\t-0.000338\t-0.344390\t0.031892\t0.500014\t0.001589\t-0.523557\n"
+	"3\t0.500014\t0.001589\t-0.523557\t0.000042\t-0.025896\t0.000041\t0.500000\t0.000012\t-0.523598\n"
+	"4\t0.500000\t0.000012\t-0.523598\t0.000000\t-0.000194\t0.000010\t0.500000\t0.000000\t-0.523599\n";
+
+/* == 5. newton-krylov method == */
+
+const char *correct_newton_krylov_1 =
+	"1\t0.000995\t59\t0.0000000\t1.0156735\n"
+	"2\t0.0000064\t49\t0.0000000\t1.0229475\n"
+	"3\t0.0000000\t22\t0.0000000\t1.0229479\n";
+
+const char *correct_newton_krylov_2 =
+	"1\t0.000003\t1\t0.000000\t7.182548\n"
+	"2\t0.000000\t1\t0.000000\t7.233982\n"
+	"3\t0.000000\t0\t0.000000\t7.233982\n";
+
+const char *correct_newton_krylov_3 =
+	"1\t4.47214\t1\t0.00000\t54.84842\n"
+	"2\t0.00000\t0\t0.00000\t54.84842\n";
+
+/* == 6. parameter sweep == */
+
+const char *correct_sweep_1 =
+	"1\t1.0\t1.0\t2\tc\n"
+	"2\t1.5\t1.144714\t6\tw\n"
+	"3\t2.0\t1.259921\t4\tw\n"
+	"4\t2.5\t1.357209\t4\tw\n"
+	"5\t3.0\t1.44225\t4\tw\n"
+	"6\t3.5\t1.518294\t3\tw\n"
+	"7\t4.0\t1.587401\t3\tw\n"
+	"8\t4.5\t1.650964\t3\tw\n"
+	"9\t5.0\t1.709976\t3\tw\n"
+	"10\t5.5\t1.765174\t3\tw\n"
+	"11\t6.0\t1.817121\t3\tw\n"
+	"12\t6.5\t1.866256\t3\tw\n"
+	"13\t7.0\t1.912931\t3\tw\n"
+	"14\t7.5\t1.957434\t3\tw\n"
+	"15\t8.0\t2.0\t3\tw\n";
+
+const char *correct_sweep_2 =
+	"1\t1.0\t1.00000\t18\tc\n"
+	"2\t1.5\t1.14469\t15\tc\n"
+	"3\t2.0\t1.2599\t13\tw\n"
+	"4\t2.5\t1.35718\t13\tw\n"
+	"5\t3.0\t1.44225\t12\tw\n"
+	"6\t3.5\t1.51829\t14\tw\n"
+	"7\t4.0\t1.58741\t14\tw\n"
+	"8\t4.5\t1.65096\t12\tw\n"
+	"9\t5.0\t1.70998\t11\tw\n"
+	"10\t5.5\t1.76517\t12\tw\n"
+	"11\t6.0\t1.81715\t12\tw\n"
+	"12\t6.5\t1.86626\t12\tw\n"
+	"13\t7.0\t1.91293\t11\tw\n"
+	"14\t7.5\t1.95744\t12\tw\n"
+	"15\t8.0\t1.99999\t13\tw\n";
+
+const char *correct_sweep_3 =
+	"1\t0.5\t1.0299\t3\tc\n"
+	"2\t0.535353535354\t1.0036\t3\tw\n"
+	"3\t0.570707070707\t0.9784\t2\tw\n"
+	"4\t0.606060606061\t0.9542\t2\tw\n"
+	"5\t0.641414141414\t0.9309\t2\tw\n"
+	"6\t0.676767676768\t0.9085\t2\tw\n"
+	"7\t0.712121212121\t0.8871\t2\tw\n"
+	"8\t0.747474747475\t0.8664\t2\tw\n"
+	"9\t0.782828282828\t0.8465\t2\tw\n"
+	"10\t0.818181818182\t0.8273\t2\tw\n"
+	"11\t0.853535353535\t0.8088\t2\tw\n"
+	"12\t0.888888888889\t0.791\t2\tw\n"
+	"13\t0.924242424242\t0.7739\t2\tw\n"
+	"14\t0.959595959596\t0.7573\t2\tw\n"
+	"15\t0.994949494949\t0.7413\t2\tw\n"
+	"16\t1.0303030303\t0.7259\t2\tw\n"
+	"17\t1.06565656566\t0.711\t2\tw\n"
+	"18\t1.10101010101\t0.6967\t2\tw\n"
+	"19\t1.13636363636\t0.6828\t2\tw\n"
+	"20\t1.17171717172\t0.6693\t2\tw\n"
+	"21\t1.20707070707\t0.6563\t2\tw\n"
+	"22\t1.24242424242\t0.6438\t2\tw\n"
+	"23\t1.27777777778\t0.6316\t2\tw\n"
+	"24\t1.31313131313\t0.6198\t2\tw\n"
+	"25\t1.34848484848\t0.6085\t2\tw\n"
+	"26\t1.38383838384\t0.5974\t2\tw\n"
+	"27\t1.41919191919\t0.5868\t2\tw\n"
+	"28\t1.45454545455\t0.5764\t2\tw\n"
+	"29\t1.4898989899\t0.5664\t2\tw\n"
+	"30\t1.52525252525\t0.5566\t2\tw\n"
+	"31\t1.56060606061\t0.5472\t2\tw\n"
+	"32\t1.59595959596\t0.5380\t2\tw\n"
+	"33\t1.63131313131\t0.5292\t2\tw\n"
+	"34\t1.66666666667\t0.5206\t2\tw\n"
+	"35\t1.70202020202\t0.5122\t2\tw\n"
+	"36\t1.73737373737\t0.504\t2\tw\n"
+	"37\t1.77272727273\t0.4961\t2\tw\n"
+	"38\t1.80808080808\t0.4884\t2\tw\n"
+	"39\t1.84343434343\t0.4809\t4\tw\n"
+	"40\t1.87878787879\t0.4736\t2\tw\n"
+	"41\t1.91414141414\t0.4666\t2\tw\n"
+	"42\t1.94949494949\t0.4597\t2\tw\n"
+	"43\t1.98484848485\t0.453\t2\tw\n"
+	"44\t2.0202020202\t0.4465\t2\tw\n"
+	"45\t2.05555555556\t0.4401\t2\tw\n"
+	"46\t2.09090909091\t0.4339\t2\tw\n"
+	"47\t2.12626262626\t0.4279\t2\tw\n"
+	"48\t2.16161616162\t0.4220\t2\tw\n"
+	"49\t2.19696969697\t0.4163\t2\tw\n"
+	"50\t2.23232323232\t0.4107\t2\tw\n"
+	"51\t2.26767676768\t0.4053\t2\tw\n"
+	"52\t2.30303030303\t0.3999\t2\tw\n"
+	"53\t2.33838383838\t0.3948\t2\tw\n"
+	"54\t2.37373737374\t0.3897\t2\tw\n"
+	"55\t2.40909090909\t0.3847\t2\tw\n"
+	"56\t2.44444444444\t0.3799\t2\tw\n"
+	"57\t2.4797979798\t0.3752\t2\tw\n"
+	"58\t2.51515151515\t0.3706\t2\tw\n"
+	"59\t2.55050505051\t0.3661\t2\tw\n"
+	"60\t2.58585858586\t0.3617\t2\tw\n"
+	"61\t2.62121212121\t0.3574\t2\tw\n"
+	"62\t2.65656565657\t0.3532\t2\tw\n"
+	"63\t2.69191919192\t0.3491\t2\tw\n"
+	"64\t2.72727272727\t0.3451\t2\tw\n"
+	"65\t2.76262626263\t0.3411\t4\tc\n"
+	"66\t2.79797979798\t0.3373\t2\tw\n"
+	"67\t2.83333333333\t0.3335\t2\tw\n"
+	"68\t2.86868686869\t0.3298\t2\tw\n"
+	"69\t2.90404040404\t0.3262\t2\tw\n"
+	"70\t2.93939393939\t0.3226\t2\tw\n"
+	"71\t2.97474747475\t0.3192\t2\tw\n"
+	"72\t3.0101010101\t0.3158\t2\tw\n"
+	"73\t3.04545454545\t0.3124\t2\tw\n"
+	"74\t3.08080808081\t0.3092\t2\tw\n"
+	"75\t3.11616161616\t0.306\t2\tw\n"
+	"76\t3.15151515152\t0.3028\t2\tw\n"
+	"77\t3.18686868687\t0.2998\t2\tw\n"
+	"78\t3.22222222222\t0.2968\t2\tw\n"
+	"79\t3.25757575758\t0.2938\t2\tw\n"
+	"80\t3.29292929293\t0.2909\t2\tw\n"
+	"81\t3.32828282828\t0.2881\t2\tw\n"
+	"82\t3.36363636364\t0.2853\t2\tw\n"
+	"83\t3.39898989899\t0.2825\t2\tw\n"
+	"84\t3.43434343434\t0.2798\t2\tw\n"
+	"85\t3.4696969697\t0.2772\t2\tw\n"
+	"86\t3.50505050505\t0.2746\t2\tw\n"
+	"87\t3.5404040404\t0.2720\t2\tw\n"
+	"88\t3.57575757576\t0.2696\t2\tw\n"
+	"89\t3.61111111111\t0.2671\t2\tw\n"
+	"90\t3.64646464646\t0.2647\t2\tw\n"
+	"91\t3.68181818182\t0.2623\t2\tw\n"
+	"92\t3.71717171717\t0.26\t2\tw\n"
+	"93\t3.75252525253\t0.2577\t2\tw\n"
+	"94\t3.78787878788\t0.2554\t2\tw\n"
+	"95\t3.82323232323\t0.2532\t2\tw\n"
+	"96\t3.85858585859\t0.2510\t2\tw\n"
+	"97\t3.89393939394\t0.2489\t2\tw\n"
+	"98\t3.92929292929\t0.2468\t2\tw\n"
+	"99\t3.96464646465\t0.2447\t2\tw\n"
+	"100\t4.0\t0.2427\t2\tw\n";
+
+/* == 7. root isolation == */
+
+const char *correct_isolate_1 =
+	"1\t-3.0\t-1.5\tunique\n"
+	"\t1\t-3.0\t-\t-1.5\t+\t-2.25\t-\n"
+	"\t2\t-2.25\t-\t-1.5\t+\t-1.875\t+\n"
+	"\t3\t-2.25\t-\t-1.875\t+\t-2.0625\t-\n"
+	"\t4\t-2.0625\t-\t-1.875\t+\t-1.96875\t-\n"
+	"\t5\t-1.96875\t-\t-1.875\t+\t-1.92188\t-\n"
+	"\t6\t-1.92188\t-\t-1.875\t+\t-1.89844\t-\n"
+	"\t7\t-1.89844\t-\t-1.875\t+\t-1.88672\t-\n"
+	"\t8\t-1.88672\t-\t-1.875\t+\t-1.88086\t-\n"
+	"\t9\t-1.88086\t-\t-1.875\t+\t-1.87793\t+\n"
+	"\t10\t-1.88086\t-\t-1.87793\t+\t-1.8794\t-\n"
+	"\t11\t-1.8794\t-\t-1.87793\t+\t-1.87866\t+\n"
+	"\t12\t-1.8794\t-\t-1.87866\t+\t-1.87903\t+\n"
+	"\t13\t-1.8794\t-\t-1.87903\t+\t-1.87922\t+\n"
+	"\t14\t-1.8794\t-\t-1.87922\t+\t-1.87931\t+\n"
+	"\t15\t-1.8794\t-\t-1.87931\t+\t-1.87936\t+\n"
+	"2\t0.0\t0.75\tunique\n"
+	"\t1\t0.0\t+\t0.75\t-\t0.375\t-\n"
+	"\t2\t0.0\t+\t0.375\t-\t0.1875\t+\n"
+	"\t3\t0.1875\t+\t0.375\t-\t0.28125\t+\n"
+	"\t4\t0.28125\t+\t0.375\t-\t0.32812\t+\n"
+	"\t5\t0.32812\t+\t0.375\t-\t0.35156\t-\n"
+	"\t6\t0.32812\t+\t0.35156\t-\t0.33984\t+\n"
+	"\t7\t0.33984\t+\t0.35156\t-\t0.3457\t+\n"
+	"\t8\t0.3457\t+\t0.35156\t-\t0.34863\t-\n"
+	"\t9\t0.3457\t+\t0.34863\t-\t0.34716\t+\n"
+	"\t10\t0.34716\t+\t0.34863\t-\t0.3479\t-\n"
+	"\t11\t0.34716\t+\t0.3479\t-\t0.34753\t-\n"
+	"\t12\t0.34716\t+\t0.34753\t-\t0.34734\t-\n"
+	"\t13\t0.34716\t+\t0.34734\t-\t0.34725\t+\n"
+	"\t14\t0.34725\t+\t0.34734\t-\t0.3473\t-\n"
+	"\t15\t0.34725\t+\t0.3473\t-\t0.34728\t+\n"
+	"\t16\t0.34728\t+\t0.3473\t-\t0.34729\t+\n"
+	"3\t1.5\t3.0\tunique\n"
+	"\t1\t1.5\t-\t3.0\t+\t2.25\t+\n"
+	"\t2\t1.5\t-\t2.25\t+\t1.875\t+\n"
+	"\t3\t1.5\t-\t1.875\t+\t1.6875\t+\n"
+	"\t4\t1.5\t-\t1.6875\t+\t1.59375\t+\n"
+	"\t5\t1.5\t-\t1.59375\t+\t1.54688\t+\n"
+	"\t6\t1.5\t-\t1.54688\t+\t1.52344\t-\n"
+	"\t7\t1.52344\t-\t1.54688\t+\t1.53516\t+\n"
+	"\t8\t1.52344\t-\t1.53516\t+\t1.5293\t-\n"
+	"\t9\t1.5293\t-\t1.53516\t+\t1.53223\t+\n"
+	"\t10\t1.5293\t-\t1.53223\t+\t1.53076\t-\n"
+	"\t11\t1.53076\t-\t1.53223\t+\t1.5315\t-\n"
+	"\t12\t1.5315\t-\t1.53223\t+\t1.53186\t-\n"
+	"\t13\t1.53186\t-\t1.53223\t+\t1.53204\t-\n"
+	"\t14\t1.53204\t-\t1.53223\t+\t1.53214\t+\n"
+	"\t15\t1.53204\t-\t1.53214\t+\t1.53209\t+\n"
+	"\t16\t1.53204\t-\t1.53209\t+\t1.53206\t-\n";
+
+const char *correct_isolate_2 =
+	"1\t-0.015625\t-0.0078125\tunique\n"
+	"\t1\t-0.016\t+\t-0.008\t-\t-0.012\t+\n"
+	"\t2\t-0.012\t+\t-0.008\t-\t-0.01\t+\n"
+	"2\t0.0078125\t0.015625\tunique\n"
+	"\t1\t0.008\t-\t0.016\t+\t0.012\t+\n"
+	"\t2\t0.008\t-\t0.012\t+\t0.01\t+\n";
+
+const char *correct_isolate_3 =
+	"1\t1.57079601287\t1.57079696656\tpossible\n"
+	"2\t4.0\t4.5\tunique\n"
+	"\t1\t4.0\t-\t4.5\t+\t4.25\t-\n"
+	"\t2\t4.25\t-\t4.5\t+\t4.375\t-\n"
+	"\t3\t4.375\t-\t4.5\t+\t4.4375\t-\n"
+	"\t4\t4.4375\t-\t4.5\t+\t4.46875\t-\n"
+	"\t5\t4.46875\t-\t4.5\t+\t4.484375\t-\n"
+	"3\t4.71238803863\t4.71238899231\tpossible\n";
+
+/* == 8. polynomial roots == */
+
+const char *correct_polynomial_roots_1 =
+	"1\t-6.92820323028\t0.0\tunique\n"
+	"\t1\t-6.9282\t-\t0.0\t+\t-3.4641\t-\n"
+	"\t2\t-3.4641\t-\t0.0\t+\t-1.7320\t+\n"
+	"\t3\t-3.4641\t-\t-1.7320\t+\t-2.5980\t-\n"
+	"\t4\t-2.5980\t-\t-1.7320\t+\t-2.165\t-\n"
+	"\t5\t-2.165\t-\t-1.7320\t+\t-1.9485\t-\n"
+	"\t6\t-1.9485\t-\t-1.7320\t+\t-1.8402\t+\n"
+	"\t7\t-1.9485\t-\t-1.8402\t+\t-1.8944\t-\n"
+	"\t8\t-1.8944\t-\t-1.8402\t+\t-1.8673\t+\n"
+	"\t9\t-1.8944\t-\t-1.8673\t+\t-1.8808\t-\n"
+	"\t10\t-1.8808\t-\t-1.8673\t+\t-1.8740\t+\n"
+	"\t11\t-1.8808\t-\t-1.8740\t+\t-1.8774\t+\n"
+	"\t12\t-1.8808\t-\t-1.8774\t+\t-1.8791\t+\n"
+	"\t13\t-1.8808\t-\t-1.8791\t+\t-1.88\t-\n"
+	"\t14\t-1.88\t-\t-1.8791\t+\t-1.8796\t-\n"
+	"\t15\t-1.8796\t-\t-1.8791\t+\t-1.8794\t-\n"
+	"2\t0.0\t0.866025403788\tunique\n"
+	"\t1\t0.0\t+\t0.8660\t-\t0.433\t-\n"
+	"\t2\t0.0\t+\t0.433\t-\t0.2165\t+\n"
+	"\t3\t0.2165\t+\t0.433\t-\t0.3248\t+\n"
+	"\t4\t0.3248\t+\t0.433\t-\t0.3789\t-\n"
+	"\t5\t0.3248\t+\t0.3789\t-\t0.3518\t-\n"
+	"\t6\t0.3248\t+\t0.3518\t-\t0.3383\t+\n"
+	"\t7\t0.3383\t+\t0.3518\t-\t0.3450\t+\n"
+	"\t8\t0.3450\t+\t0.3518\t-\t0.3484\t-\n"
+	"\t9\t0.3450\t+\t0.3484\t-\t0.3467\t+\n"
+	"\t10\t0.3467\t+\t0.3484\t-\t0.3476\t-\n"
+	"\t11\t0.3467\t+\t0.3476\t-\t0.3472\t+\n"
+	"3\t0.866025403784\t1.73205080757\tunique\n"
+	"\t1\t0.8660\t-\t1.7320\t+\t1.299\t-\n"
+	"\t2\t1.299\t-\t1.7320\t+\t1.5155\t-\n"
+	"\t3\t1.5155\t-\t1.7320\t+\t1.6238\t+\n"
+	"\t4\t1.5155\t-\t1.6238\t+\t1.5696\t+\n"
+	"\t5\t1.5155\t-\t1.5696\t+\t1.5426\t+\n"
+	"\t6\t1.5155\t-\t1.5426\t+\t1.5290\t-\n"
+	"\t7\t1.5290\t-\t1.5426\t+\t1.5358\t+\n"
+	"\t8\t1.5290\t-\t1.5358\t+\t1.5324\t+\n"
+	"\t9\t1.5290\t-\t1.5324\t+\t1.5307\t-\n"
+	"\t10\t1.5307\t-\t1.5324\t+\t1.5316\t-\n"
+	"\t11\t1.5316\t-\t1.5324\t+\t1.532\t-\n"
+	"\t12\t1.532\t-\t1.5324\t+\t1.5322\t+\n";
+
+const char *correct_polynomial_roots_2 =
+	"square_free\t0.2*x^2 - 0.6*x + 0.4\n"
+	"1\t0.0\t1.5\tpossible\n"
+	"\t1\t0.0\t+\t1.5\t-\t0.75\t+\n"
+	"\t2\t0.75\t+\t1.5\t-\t1.125\t-\n"
+	"\t3\t0.75\t+\t1.125\t-\t0.938\t+\n"
+	"\t4\t0.938\t+\t1.125\t-\t1.032\t-\n"
+	"\t5\t0.938\t+\t1.032\t-\t0.985\t+\n"
+	"\t6\t0.985\t+\t1.032\t-\t1.008\t-\n"
+	"\t7\t0.985\t+\t1.008\t-\t0.996\t+\n"
+	"\t8\t0.996\t+\t1.008\t-\t1.002\t-\n"
+	"\t9\t0.996\t+\t1.002\t-\t0.999\t+\n"
+	"\t10\t0.999\t+\t1.002\t-\t1.000\t+\n"
+	"\t11\t1.000\t+\t1.002\t-\t1.001\t-\n"
+	"2\t1.5\t4.0\tunique\n"
+	"\t1\t1.5\t-\t4.0\t+\t2.75\t+\n"
+	"\t2\t1.5\t-\t2.75\t+\t2.125\t+\n"
+	"\t3\t1.5\t-\t2.125\t+\t1.812\t-\n"
+	"\t4\t1.812\t-\t2.125\t+\t1.968\t-\n"
+	"\t5\t1.968\t-\t2.125\t+\t2.046\t+\n"
+	"\t6\t1.968\t-\t2.046\t+\t2.007\t+\n"
+	"\t7\t1.968\t-\t2.007\t+\t1.988\t-\n"
+	"\t8\t1.988\t-\t2.007\t+\t1.998\t-\n"
+	"\t9\t1.998\t-\t2.007\t+\t2.002\t+\n"
+	"\t10\t1.998\t-\t2.002\t+\t2.0\t+\n"
+	"\t11\t1.998\t-\t2.0\t+\t1.999\t-\n"
+	"\t12\t1.999\t-\t2.0\t+\t2.0\t+\n"
+	"\t13\t1.999\t-\t2.0\t+\t2.0\t+\n";
+
+const char *correct_polynomial_roots_3 =
+	"";
+
+const char *correct_polynomial_roots_4 =
+	"square_free\t0.375*x^3 + 0.375*x^2 - 0.75*x\n"
+	"1\t-2.2360679775\t-0.838525491562\tpossible\n"
+	"\t1\t-2.236068\t-\t-0.838525\t+\t-1.537296\t+\n"
+	"\t2\t-2.236068\t-\t-1.537296\t+\t-1.886682\t+\n"
+	"\t3\t-2.236068\t-\t-1.886682\t+\t-2.061375\t-\n"
+	"\t4\t-2.061375\t-\t-1.886682\t+\t-1.974028\t+\n"
+	"2\t-0.838525491565\t0.559016994375\tunique\n"
+	"\t1\t-0.838525\t+\t0.559017\t-\t-0.139754\t+\n"
+	"\t2\t-0.139754\t+\t0.559017\t-\t0.209632\t-\n"
+	"\t3\t-0.139754\t+\t0.209632\t-\t0.034939\t-\n"
+	"\t4\t-0.139754\t+\t0.034939\t-\t-0.052408\t+\n"
+	"3\t0.559016994374\t3.35410196625\texists\n"
+	"\t1\t0.559017\t-\t3.354102\t+\t1.95656\t+\n"
+	"\t2\t0.559017\t-\t1.95656\t+\t1.257788\t+\n"
+	"\t3\t0.559017\t-\t1.257788\t+\t0.908402\t-\n"
+	"\t4\t0.908402\t-\t1.257788\t+\t1.083095\t+\n";
+
+const char *correct_polynomial_roots_5 =
+	"square_free\t0.5*x - 0.500000025\n"
+	"1\t-8.00000040001\t8.00000040001\tpossible\n"
+	"\t1\t-8.00000\t-\t8.00000\t+\t0.0\t-\n"
+	"\t2\t0.0\t-\t8.00000\t+\t4.0\t+\n"
+	"\t3\t0.0\t-\t4.0\t+\t2.0\t+\n"
+	"\t4\t0.0\t-\t2.0\t+\t1.0\t-\n"
+	"\t5\t1.0\t-\t2.0\t+\t1.5\t+\n"
+	"\t6\t1.0\t-\t1.5\t+\t1.25\t+\n"
+	"\t7\t1.0\t-\t1.25\t+\t1.125\t+\n"
+	"\t8\t1.0\t-\t1.125\t+\t1.0625\t+\n"
+	"\t9\t1.0\t-\t1.0625\t+\t1.03125\t+\n"
+	"\t10\t1.0\t-\t1.03125\t+\t1.01562\t+\n"
+	"\t11\t1.0\t-\t1.01562\t+\t1.00781\t+\n"
+	"\t12\t1.0\t-\t1.00781\t+\t1.00390\t+\n"
+	"\t13\t1.0\t-\t1.00390\t+\t1.00195\t+\n"
+	"\t14\t1.0\t-\t1.00195\t+\t1.00098\t+\n"
+	"\t15\t1.0\t-\t1.00098\t+\t1.00049\t+\n"
+	"\t16\t1.0\t-\t1.00049\t+\t1.00024\t+\n"
+	"\t17\t1.0\t-\t1.00024\t+\t1.00012\t+\n"
+	"\t18\t1.0\t-\t1.00012\t+\t1.00006\t+\n"
+	"\t19\t1.0\t-\t1.00006\t+\t1.00003\t+\n";
+
+const char *correct_integration_1 =
+	"1\t1\t1.0\t1.85914\n"
+	"2\t2\t0.5\t1.75393\n"
+	"3\t4\t0.25\t1.72722\n"
+	"4\t8\t0.125\t1.72052\n"
+	"5\t16\t0.0625\t1.71884\n"
+	"6\t32\t0.03125\t1.71842\n"
+	"7\t64\t0.01562\t1.71832\n"
+	"8\t128\t0.00781\t1.71829\n"
+	"9\t256\t0.00391\t1.71828\n";
+
+const char *correct_integration_2 =
+	"1\t2\t0.5\t0.7833333\n"
+	"2\t4\t0.25\t0.7853922\n"
+	"3\t8\t0.125\t0.7853981\n"
+	"4\t16\t0.0625\t0.7853982\n";
+
+const char *correct_integration_3 =
+	"1\t3\t0.66667\t3.23080\n"
+	"2\t6\t0.33333\t3.24059\n"
+	"3\t12\t0.16667\t3.24128\n"
+	"4\t24\t0.08333\t3.24131\n"
+	"5\t48\t0.04167\t3.24131\n";
+
+const char *correct_integration_4 =
+	"1\t1\t3.1415926\t0.0000000\n"
+	"2\t2\t1.5707963\t1.5707963\t2.0943951\n"
+	"3\t4\t0.7853982\t1.8961189\t2.0045598\t1.9985707\n"
+	"4\t8\t0.3926991\t1.9742316\t2.0002692\t1.9999831\t2.0000055\n"
+	"5\t16\t0.1963495\t1.9935703\t2.0000166\t1.9999998\t2.0000000\t2.0\n"
+	"6\t32\t0.0981748\t1.9983934\t2.0000010\t2.0\t2.0000000\t2.0\t2.0\n";
+
+const char *correct_integration_5 =
+	"1\t1\t1.0\t0.68394\n"
+	"2\t2\t0.5\t0.731370\t0.747180\n"
+	"3\t4\t0.25\t0.742984\t0.746855\t0.746834\n"
+	"4\t8\t0.125\t0.745866\t0.746826\t0.746824\t0.746824\n";
+
+
+const char *correct_gauss_kronrod_1 =
+	"1\t1\t15\t-0.9983073\t0.734521436199\n"
+	"2\t2\t45\t-0.9991537\t0.3672607181\n"
+	"3\t3\t75\t-0.9995768\t0.18363035905\n"
+	"4\t4\t105\t-0.9997884\t0.0918151795249\n"
+	"5\t5\t135\t-0.9998942\t0.0459075897625\n"
+	"6\t6\t165\t-0.9999471\t0.0229537948812\n"
+	"7\t7\t195\t-0.9999736\t0.0114768974406\n"
+	"8\t8\t225\t-0.9999868\t0.00573844872033\n"
+	"9\t9\t255\t-0.9999934\t0.00286922436017\n"
+	"10\t10\t285\t-0.9999967\t0.0014346121801\n"
+	"11\t11\t315\t-0.9999983\t0.00071730609006\n"
+	"12\t12\t345\t-0.9999992\t0.000358653045041\n"
+	"13\t13\t375\t-0.9999996\t0.000179326522531\n";
+
+const char *correct_gauss_kronrod_2 =
+	"1\t1\t15\t906.465221\t1581.16708396\n"
+	"2\t2\t45\t550.674995\t873.012931061\n"
+	"3\t4\t105\t339.179446\t404.745898077\n"
+	"4\t7\t195\t313.932587\t274.099653254\n"
+	"5\t10\t285\t309.402913\t176.412564283\n"
+	"6\t13\t375\t309.398692\t4.20929628549\n"
+	"7\t16\t465\t309.398692\t0.0000488892506459\n";
+
+const char *correct_gauss_kronrod_3 =
+	"1\t1\t15\t0.605036897\t0.459888074493\n"
+	"2\t2\t45\t0.481920547\t0.271094068179\n"
+	"3\t4\t105\t0.488690304\t0.155634529088\n"
+	"4\t6\t165\t0.524571546\t0.0771399367438\n"
+	"5\t8\t225\t0.516339515\t0.0343514345965\n"
+	"6\t10\t285\t0.503254532\t0.0374522094049\n"
+	"7\t13\t375\t0.507829883\t0.0168239013146\n"
+	"8\t17\t495\t0.506043064\t0.0148136664939\n"
+	"9\t22\t645\t0.503024875\t0.0100764076621\n"
+	"10\t29\t855\t0.503902311\t0.00598609627822\n"
+	"11\t38\t1125\t0.504052061\t0.00411552605484\n"
+	"12\t50\t1485\t0.503801220\t0.00283059562879\n"
+	"13\t65\t1935\t0.503934450\t0.00195495138127\n"
+	"14\t84\t2505\t0.503989812\t0.00101403895218\n"
+	"15\t110\t3285\t0.50406962\t0.000576563577886\n"
+	"16\t140\t4185\t0.504066498\t0.000226623221962\n"
+	"17\t171\t5115\t0.504066498\t0.00000118480430979\n";
+
+const char *correct_ode_1 =
+	"1\t0.1\t0.1\t1.1\n"
+	"2\t0.1\t0.2\t1.22\n"
+	"3\t0.1\t0.3\t1.362\n"
+	"4\t0.1\t0.4\t1.5282\n"
+	"5\t0.1\t0.5\t1.72102\n";
+
+const char *correct_ode_2 =
+	"1\t0.1\t0.1\t1.11\n"
+	"2\t0.1\t0.2\t1.24205\n"
+	"3\t0.1\t0.3\t1.39846\n"
+	"4\t0.1\t0.4\t1.58180\n"
+	"5\t0.1\t0.5\t1.79489\n";
+
+const char *correct_ode_3 =
+	"1\t0.3\t0.3\t1.015031\n"
+	"2\t0.3\t0.6\t1.648850\n"
+	"3\t0.3\t0.9\t2.380045\n"
+	"4\t0.3\t1.2\t3.179711\n"
+	"5\t0.3\t1.5\t4.008828\n"
+	"6\t0.3\t1.8\t4.814732\n"
+	"7\t0.2\t2.0\t5.304931\n";
+
+const char *correct_ode_4 =
+	"1\t-0.25\t0.75\t1.284017\n"
+	"2\t-0.25\t0.5\t1.648699\n"
+	"3\t-0.25\t0.25\t2.116958\n"
+	"4\t-0.25\t0.0\t2.71821\n";
+
+const char *correct_ode_5 =
+	"1\t0.1\t0.1\t0.9900498\t0.00000000265120630493\n"
+	"2\t0.2948179\t0.3948179\t0.8556607\t0.000000399295594286\n"
+	"3\t0.1720879\t0.5669057\t0.725146\t0.000000392820074781\n"
+	"4\t0.1867042\t0.7536099\t0.5666983\t0.000000705904124374\n"
+	"5\t0.1801554\t0.9337653\t0.4181488\t0.000000148834008061\n"
+	"6\t0.0662346\t1.0\t0.3678793\t0.00000000449342100968\n";
+
+const char *correct_ode_6 =
+	"1\t0.1\t0.1\t11.0\n"
+	"2\t0.1\t0.2\t121.0\n"
+	"3\t0.1\t0.3\t1331.0\n"
+	"4\t0.1\t0.4\t14641.0\n"
+	"5\t0.1\t0.5\t161051.0\n"
+	"6\t0.1\t0.6\t1771561.0\n"
+	"7\t0.1\t0.7\t19487171.0\n"
+	"8\t0.1\t0.8\t214358881.0\n"
+	"9\t0.1\t0.9\t2357947691.0\n"
+	"10\t0.1\t1.0\t25937424601.0\n"
+	"11\t0.1\t1.1\t285311670611.0\n"
+	"12\t0.1\t1.2\t3138428376720.0\n"
+	"13\t0.1\t1.3\t34522712143900.0\n"
+	"14\t0.1\t1.4\t379749833583000.0\n"
+	"15\t0.1\t1.5\t4177248169420000.0\n"
+	"16\t0.1\t1.6\t45949729863600000.0\n"
+	"17\t0.1\t1.7\t505447028499000000.0\n"
+	"18\t0.1\t1.8\t5559917313490000000.0\n"
+	"19\t0.1\t1.9\t61159090448400000000.0\n"
+	"20\t0.1\t2.0\t672749994933000000000.0\n";
+
+const char *correct_ode_7 =
+	"1\t0.1\t0.1\t11.0\n"
+	"2\t0.1\t0.2\t121.0\n"
+	"3\t0.1\t0.3\t1331.0\n"
+	"4\t0.1\t0.4\t14641.0\n"
+	"5\t0.1\t0.5\t161050.0\n"
+	"6\t0.1\t0.6\t1771600.0\n"
+	"7\t0.1\t0.7\t19487000.0\n"
+	"8\t0.1\t0.8\t214360000.0\n"
+	"9\t0.1\t0.9\t2357900000.0\n"
+	"10\t0.1\t1.0\t25937000000.0\n"
+	"11\t0.1\t1.1\t285310000000.0\n"
+	"12\t0.1\t1.2\t3138400000000.0\n"
+	"13\t0.1\t1.3\t34523000000000.0\n"
+	"14\t0.1\t1.4\t379750000000000.0\n"
+	"15\t0.1\t1.5\t4177200000000000.0\n"
+	"16\t0.1\t1.6\t45950000000000000.0\n"
+	"17\t0.1\t1.7\t505450000000000000.0\n"
+	"18\t0.1\t1.8\t5559900000000000000.0\n"
+	"19\t0.1\t1.9\t61159000000000000000.0\n"
+	"20\t0.1\t2.0\t672750000000000000000.0\n";
+
+const char *correct_ode_8 = "";
+
+/* = 4 - LINEAR SYSTEMS = */
+
+/* == 1. gaussian elimination and lu decomposition == */
+
+const char *correct_elimination_1 =
+	"1\t2\t-3.0\n"
+	"\t-3.0\t-1.0\t2.0\t-11.0\n"
+	"\t0.0\t0.33333\t0.33333\t0.66667\n"
+	"\t0.0\t1.66667\t0.66667\t4.33333\n"
+	"2\t3\t1.66667\n"
+	"\t-3.0\t-1.0\t2.0\t-11.0\n"
+	"\t0.0\t1.66667\t0.66667\t4.33333\n"
+	"\t0.0\t0.0\t0.2\t-0.2\n"
+	"3\t3\t0.2\n"
+	"\t-3.0\t-1.0\t2.0\t-11.0\n"
+	"\t0.0\t1.66667\t0.66667\t4.33333\n"
+	"\t0.0\t0.0\t0.2\t-0.2\n"
+	"x\t2.0\t3.0\t-1.0\n";
+
+const char *correct_elimination_2 =
+	"1\t1\t4.0\n"
+	"\t4.0\t-2.0\t1.0\n"
+	"\t-0.5\t3.0\t-1.5\n"
+	"\t0.25\t-1.5\t3.75\n"
+	"2\t2\t3.0\n"
+	"\t4.0\t-2.0\t1.0\n"
+	"\t-0.5\t3.0\t-1.5\n"
+	"\t0.25\t-0.5\t3.0\n"
+	"3\t3\t3.0\n"
+	"\t4.0\t-2.0\t1.0\n"
+	"\t-0.5\t3.0\t-1.5\n"
+	"\t0.25\t-0.5\t3.0\n"
+	"x\t1.0\t-2.0\t3.0\n";
+
+const char *correct_elimination_3 =
+	"1\t3\t2.0\n"
+	"\t2.0\t1.0\t1.0\t7.0\t3.0\n"
+	"\t0.0\t0.5\t1.5\t2.5\t0.5\n"
+	"\t0.0\t2.0\t1.0\t4.0\t1.0\n"
+	"\t0.0\t0.1666667\t0.9142136\t-2.5\t2.5\n"
+	"2\t3\t2.0\n"
+	"\t2.0\t1.0\t1.0\t7.0\t3.0\n"
+	"\t0.0\t2.0\t1.0\t4.0\t1.0\n"
+	"\t0.0\t0.0\t1.25\t1.5\t0.25\n"
+	"\t0.0\t0.0\t0.8308802\t-2.8333333\t2.4166667\n"
+	"3\t3\t1.25\n"
+	"\t2.0\t1.0\t1.0\t7.0\t3.0\n"
+	"\t0.0\t2.0\t1.0\t4.0\t1.0\n"
+	"\t0.0\t0.0\t1.25\t1.5\t0.25\n"
+	"\t0.0\t0.0\t0.0\t-3.8303896\t2.2504906\n"
+	"4\t4\t-3.8303896\n"
+	"\t2.0\t1.0\t1.0\t7.0\t3.0\n"
+	"\t0.0\t2.0\t1.0\t4.0\t1.0\n"
+	"\t0.0\t0.0\t1.25\t1.5\t0.25\n"
+	"\t0.0\t0.0\t0.0\t-3.8303896\t2.2504906\n"
+	"x\t2.4925785\t1.22255\t0.9050428\t-0.5875357\n";
+
+const char *correct_elimination_4 =
+	"1\t3\t2.0\n"
+	"\t2.0\t5.0\t-1.0\n"
+	"\t0.0\t2.0\t5.0\n"
+	"\t0.5\t-1.5\t1.5\n"
+	"2\t2\t2.0\n"
+	"\t2.0\t5.0\t-1.0\n"
+	"\t0.0\t2.0\t5.0\n"
+	"\t0.5\t-0.75\t5.25\n"
+	"3\t3\t5.25\n"
+	"\t2.0\t5.0\t-1.0\n"
+	"\t0.0\t2.0\t5.0\n"
+	"\t0.5\t-0.75\t5.25\n"
+	"x\t5.0\t3.0\t-2.0\n";
+
+const char *correct_elimination_5 = "";
+
+/* == 2. iterative methods == */
+
+const char *correct_iterative_1 =
+	"1\t1.25\t1.5\t1.25\n"
+	"2\t0.875\t0.875\t0.875\n"
+	"3\t1.03125\t1.0625\t1.03125\n"
+	"4\t0.98438\t0.98438\t0.98438\n"
+	"5\t1.00391\t1.00781\t1.00391\n"
+	"6\t0.99805\t0.99805\t0.99805\n"
+	"7\t1.00049\t1.00098\t1.00049\n"
+	"8\t0.99976\t0.99976\t0.99976\n"
+	"9\t1.00006\t1.00012\t1.00006\n"
+	"10\t0.99997\t0.99997\t0.99997\n"
+	"11\t1.00001\t1.00002\t1.00001\n"
+	"12\t1.0\t1.0\t1.0\n";
+
+const char *correct_iterative_2 =
+	"1\t0.6\t2.32727\t-0.98727\t0.87886\n"
+	"2\t1.03018\t2.03694\t-1.01446\t0.98434\n"
+	"3\t1.00658\t2.00356\t-1.00253\t0.99835\n"
+	"4\t1.00086\t2.0003\t-1.00031\t0.99985\n"
+	"5\t1.00009\t2.00002\t-1.00003\t0.99999\n"
+	"6\t1.00001\t2.00000\t-1.00000\t1.0\n"
+	"7\t1.00000\t2.00000\t-1.00000\t1.0\n";
+
+const char *correct_iterative_3 =
+	"1\t6.3125\t3.519531\t-6.650146\n"
+	"2\t2.622314\t3.958527\t-4.600424\n"
+	"3\t3.133303\t4.010265\t-5.096686\n"
+	"4\t2.957051\t4.007484\t-4.97349\n"
+	"5\t3.003721\t4.002925\t-5.005714\n"
+	"6\t2.996328\t4.000926\t-4.998282\n"
+	"7\t3.00005\t4.000258\t-5.000349\n"
+	"8\t2.999745\t4.000065\t-4.999892\n"
+	"9\t3.000002\t4.000015\t-5.000022\n"
+	"10\t2.999985\t4.000003\t-4.999993\n"
+	"11\t3.000001\t4.000000\t-5.000001\n"
+	"12\t2.999999\t4.000000\t-5.0\n"
+	"13\t3.000000\t4.0\t-5.000000\n"
+	"14\t3.0\t4.0\t-5.0\n";
+
+const char *correct_iterative_4 =
+	"1\t0.75\t0.8125\t0.5\t0.8125\t0.75\n"
+	"2\t0.953125\t0.9648438\t0.90625\t0.9648438\t0.953125\n"
+	"3\t0.9912109\t0.9934082\t0.9824219\t0.9934082\t0.9912109\n"
+	"4\t0.9983520\t0.9987640\t0.9967041\t0.9987640\t0.9983520\n"
+	"5\t0.9996910\t0.9997682\t0.9993820\t0.9997682\t0.9996910\n"
+	"6\t0.9999421\t0.9999565\t0.9998841\t0.9999565\t0.9999421\n"
+	"7\t0.9999891\t0.9999918\t0.9999783\t0.9999918\t0.9999891\n"
+	"8\t0.999998\t0.9999985\t0.9999959\t0.9999985\t0.999998\n"
+	"9\t0.9999996\t0.9999997\t0.9999992\t0.9999997\t0.9999996\n"
+	"10\t0.9999999\t0.9999999\t0.9999998\t0.9999999\t0.9999999\n";
+
+const char *correct_iterative_5 =
+	"1\t6.3125\t0.882812\t-7.4375\n"
+	"2\t5.094238\t2.701965\t-5.364746\n"
+	"3\t3.693348\t3.57623\t-5.314449\n"
+	"4\t3.223948\t3.879174\t-5.053816\n"
+	"5\t3.057287\t3.968904\t-5.024304\n"
+	"6\t3.014830\t3.992733\t-5.003641\n";
+
+const char *correct_iterative_6 = "";
+
+const char *correct_iterative_7 = "";
+
+const char *correct_iterative_8 = "";
+
+/* == 3. conjugate gradient == */
+
+const char *correct_conjugate_gradient_1 =
+	"1\t0.25\t0.0625\t0.559017\t0.559017\n"
+	"2\t0.3636364\t0.0\t0.0\t0.6428243\n";
+
+const char *correct_conjugate_gradient_2 =
+	"1\t1.571428\t0.055102\t1.740865\t2.913506\n"
+	"2\t1.004785\t0.053985\t0.404485\t3.047693\n"
+	"3\t1.006146\t0.048421\t0.089006\t3.058353\n"
+	"4\t0.963773\t0.032510\t0.016048\t3.059009\n"
+	"5\t0.857436\t0.000000\t0.000000\t3.059032\n"
+	"6\t1.742314\t0.017446\t0.000000\t3.059032\n";
+
+const char *correct_conjugate_gradient_3 =
+	"1\t1.02185448\t0.00087291\t0.32963164\t0.20465409\n"
+	"2\t1.03635993\t0.00027543\t0.00677586\t0.27929393\n"
+	"3\t0.95009546\t0.00000000\t0.00000000\t0.27957529\n"
+	"4\t1.00837063\t0.00054967\t0.00000000\t0.27957529\n";
+
+const char *correct_conjugate_gradient_4 =
+	"1\t1.021854\t0.000873\t0.329632\t0.204654\n"
+	"2\t1.03636\t0.000275\t0.006776\t0.279294\n"
+	"3\t0.950095\t0.000000\t0.000000\t0.279575\n";
+
+const char *correct_conjugate_gradient_5 = "";
+
+/* = 5 - INTERPOLATION = */
+
+/* == 1. newton's and lagrange's interpolation == */
+
+const char *correct_interpolation_1 =
+	"1\t7.0\t19.0\t37.0\t61.0\n"
+	"2\t12.0\t18.0\t24.0\n"
+	"3\t6.0\t6.0\n"
+	"4\t0.0\n"
+	"y\t3.375\n";
+
+const char *correct_interpolation_2 =
+	"1\t0.1162\t0.1285\t0.1419\t0.1569\n"
+	"2\t0.0123\t0.0134\t0.015\n"
+	"3\t0.0011\t0.0016\n"
+	"4\t0.0005\n"
+	"y\t1.56826\n";
+
+const char *correct_interpolation_3 =
+	"1\t2.0\t23.0\t80.0\t228.0\n"
+	"2\t7.0\t19.0\t37.0\n"
+	"3\t3.0\t3.0\n"
+	"4\t0.0\n"
+	"y\t13.0\n";
+
+const char *correct_interpolation_4 =
+	"1\t-0.111111\t-16.66667\n"
+	"2\t0.533333\t209.0667\n"
+	"3\t0.888889\t1290.667\n"
+	"4\t-0.333333\t-788.6667\n"
+	"5\t0.022222\t115.6\n"
+	"y\t810.0\n";
+
+const char *correct_interpolation_5 =
+	"1\t0.95493\t0.699057\t0.255873\n"
+	"2\t-0.244340\t-0.42321\n"
+	"3\t-0.113872\n"
+	"y\t0.705889\n";
+
+const char *correct_interpolation_6 = "";
+
+/* == 2. cubic splines == */
+
+const char *correct_spline_1 =
+	"1\t1.0\t1.465998\t0.0\t0.252284\n"
+	"2\t2.718282\t2.222850\t0.756853\t1.691071\n"
+	"3\t7.389056\t8.80977\t5.830067\t-1.943356\n"
+	"y\t4.230304\n";
+
+const char *correct_spline_2 =
+	"1\t0.0\t0.0\t0.0\t1.0\n"
+	"2\t1.0\t3.0\t3.0\t1.0\n"
+	"3\t8.0\t12.0\t6.0\t1.0\n"
+	"y\t3.375\n";
+
+const char *correct_spline_3 =
+	"1\t1.3\t0.54175\t0.0\t-0.26095\n"
+	"2\t1.5\t0.4165\t-0.31314\t0.98534\n"
+	"3\t1.85\t1.10489\t1.46047\t-3.67471\n"
+	"4\t2.1\t1.24812\t-0.74435\t0.49624\n"
+	"y\t1.97142\n";
+
+const char *correct_spline_4 =
+	"1\t0.0\t1.0\t-0.005068\t-0.155148\n"
+	"2\t0.707107\t0.70493\t-0.370627\t-0.066332\n"
+	"y\t0.865064\n";
+
+const char *correct_spline_5 = "";
+
+const char *correct_spline_6 =
+	"1\t0.0\t0.0\t1.0\t0.000000\n"
+	"2\t1.0\t2.0\t1.0\t0.000000\n"
+	"y\t2.25\n";
+
+/* = 6 - CURVE FITTING = */
+
+/* == 1. least squares == */
+
+const char *correct_fit_1 =
+	"1\t6.0\t21.2\n"
+	"2\t21.0\t91.3\n"
+	"3\t91.0\n"
+	"a\t0.11333\t0.97714\n";
+
+const char *correct_fit_2 =
+	"1\t5.0\t12.9\n"
+	"2\t10.0\t37.1\n"
+	"3\t30.0\t130.3\n"
+	"4\t100.0\n"
+	"5\t354.0\n"
+	"a\t1.42\t-1.07\t0.55\n";
+
+const char *correct_fit_3 =
+	"1\t4.0\t10.473\n"
+	"2\t10.0\t28.425\n"
+	"3\t30.0\n"
+	"a\t4.468\t0.4485\n";
+
+const char *correct_fit_4 =
+	"1\t6.0\t46.0\n"
+	"2\t3.0\t107.0\n"
+	"3\t19.0\t323.0\n"
+	"4\t27.0\t899.0\n"
+	"5\t115.0\n"
+	"6\t243.0\n"
+	"7\t859.0\n"
+	"a\t1.0\t-2.0\t1.0\t1.0\n";
+
+const char *correct_fit_5 = "";
+
+/* = 7 - NUMERICAL DIFFERENTIATION = */
+
+/* == 1. finite differences and richardson == */
+
+const char *correct_differentiation_1 =
+	"1\t0.4\t0.5260091\n"
+	"2\t0.2\t0.5367075\t0.5402736\n"
+	"3\t0.1\t0.5394022\t0.5403005\t0.5403023\n"
+	"4\t0.05\t0.5400772\t0.5403022\t0.5403023\t0.5403023\n";
+
+const char *correct_differentiation_2 =
+	"1\t0.1\t1.0517\n"
+	"2\t0.05\t1.0254\n"
+	"3\t0.025\t1.0126\n"
+	"4\t0.0125\t1.0063\n"
+	"5\t0.0062\t1.0031\n"
+	"6\t0.0031\t1.0016\n"
+	"7\t0.0016\t1.0008\n"
+	"8\t0.0008\t1.0004\n";
+
+const char *correct_differentiation_3 =
+	"1\t0.5\t9.25\n"
+	"2\t0.25\t10.5625\t11.875\n"
+	"3\t0.125\t11.26562\t11.96875\t12.0\n"
+	"4\t0.0625\t11.62891\t11.99219\t12.0\t12.0\n";
+
+const char *correct_differentiation_4 =
+	"1\t0.2\t0.911608\n"
+	"2\t0.1\t0.953102\t0.994596\n"
+	"3\t0.05\t0.975803\t0.998505\t0.999808\n"
+	"4\t0.025\t0.987704\t0.999606\t0.999973\t0.999996\n";
+
+const char *correct_differentiation_5 =
+	"1\t0.1\t-0.705929\n"
+	"2\t0.05\t-0.706812\n"
+	"3\t0.025\t-0.707033\n"
+	"4\t0.0125\t-0.707088\n"
+	"5\t0.00625\t-0.707102\n"
+	"6\t0.003125\t-0.707106\n";
+
+const char *correct_differentiation_6 = "";
+
+/* = 8 - EIGENVALUES = */
+
+/* == 1. power method and inverse iteration == */
+
+const char *correct_power_iteration_1 =
+	"1\t5.0\t0.6\t1.0\t1.0\n"
+	"2\t5.0\t0.44\t0.92\t1.0\n"
+	"3\t4.92\t0.3658\t0.8536\t1.0\n"
+	"4\t4.8536\t0.3266\t0.8090\t1.0\n"
+	"5\t4.8090\t0.3041\t0.7806\t1.0\n"
+	"6\t4.7806\t0.2905\t0.7626\t1.0\n"
+	"7\t4.7626\t0.2821\t0.7513\t1.0\n"
+	"8\t4.7513\t0.2769\t0.7442\t1.0\n"
+	"9\t4.7442\t0.2736\t0.7398\t1.0\n"
+	"10\t4.7398\t0.2715\t0.7369\t1.0\n"
+	"11\t4.7369\t0.2702\t0.7351\t1.0\n"
+	"12\t4.7351\t0.2694\t0.7340\t1.0\n"
+	"13\t4.7340\t0.2688\t0.7333\t1.0\n"
+	"14\t4.7333\t0.2685\t0.7328\t1.0\n"
+	"15\t4.7328\t0.2683\t0.7325\t1.0\n"
+	"16\t4.7325\t0.2682\t0.7324\t1.0\n"
+	"17\t4.7324\t0.2681\t0.7322\t1.0\n"
+	"18\t4.7322\t0.2680\t0.7322\t1.0\n"
+	"19\t4.7322\t0.2680\t0.7321\t1.0\n";
+
+const char *correct_power_iteration_2 =
+	"1\t1.666667\t1.0\t-0.333333\t0.333333\n"
+	"2\t1.315789\t1.0\t-0.684210\t0.263158\n"
+	"3\t1.273381\t1.0\t-0.726619\t0.266187\n"
+	"4\t1.268599\t1.0\t-0.731401\t0.267633\n"
+	"5\t1.268030\t1.0\t-0.731969\t0.267901\n"
+	"6\t1.26796\t1.0\t-0.732040\t0.267942\n"
+	"7\t1.267950\t1.0\t-0.732049\t0.267948\n"
+	"8\t1.267949\t1.0\t-0.732051\t0.267949\n"
+	"9\t1.267949\t1.0\t-0.732051\t0.267949\n";
+
+const char *correct_power_iteration_3 =
+	"1\t4.0\t1.0\t0.666667\n"
+	"2\t4.666667\t1.0\t0.909091\n"
+	"3\t4.909091\t1.0\t0.976744\n"
+	"4\t4.976744\t1.0\t0.994152\n"
+	"5\t4.994152\t1.0\t0.998536\n";
+
+const char *correct_power_iteration_4 = "";
+
+const char *correct_power_iteration_5 = "";
+
+const char *correct_power_iteration_6 = "";
+
+/* == 2. qr algorithm == */
+
+const char *correct_qr_algorithm_1 =
+	"1\t3\t0.33333333\n"
+	"2\t3\t0.00653595\n"
+	"3\t3\t0.00000005\n"
+	"4\t0\t0.0\n"
+	"re\t1.26794919\t3.0\t4.73205081\n"
+	"im\t0.0\t0.0\t0.0\n";
+
+const char *correct_qr_algorithm_2 =
+	"1\t4\t1.755980\n"
+	"2\t4\t2.200282\n"
+	"3\t4\t0.645810\n"
+	"4\t4\t0.878046\n"
+	"5\t4\t1.526094\n"
+	"6\t4\t1.194663\n"
+	"7\t0\t0.0\n"
+	"re\t1.834364\t1.834364\t4.165636\t4.165636\n"
+	"im\t2.204548\t-2.204548\t1.362857\t-1.362857\n";
+
+const char *correct_qr_algorithm_3 =
+	"1\t3\t0.014816\n"
+	"2\t3\t0.000015\n"
+	"3\t3\t0.000000\n"
+	"4\t0\t0.0\n"
+	"re\t16.70749\t-0.905740\t0.198247\n"
+	"im\t0.0\t0.0\t0.0\n";
+
+const char *correct_qr_algorithm_4 = "";